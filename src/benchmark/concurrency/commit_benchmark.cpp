@@ -0,0 +1,62 @@
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Measures the throughput of the commit pipeline itself: every transaction gets a commit id and must become visible
+// in commit id order. Run with an increasing number of threads to see how well pending commits are batched.
+static void BM_CommitEmptyTransactions(benchmark::State& state) {
+  auto& manager = TransactionManager::get();
+
+  while (state.KeepRunning()) {
+    auto transaction_context = manager.new_transaction_context();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_CommitEmptyTransactions)->ThreadRange(1, 32)->UseRealTime();
+
+// Many small transactions that each insert a single row into the same table, similar to TPC-C's order entry
+static void BM_CommitSingleRowInserts(benchmark::State& state) {
+  const auto table_name = std::string{"commit_benchmark"};
+
+  if (state.thread_index == 0) {
+    auto table = std::make_shared<Table>(Chunk::MAX_SIZE);
+    table->add_column("a", DataType::Int);
+    StorageManager::get().add_table(table_name, table);
+  }
+
+  auto values = std::make_shared<Table>();
+  values->add_column("a", DataType::Int);
+  values->append({state.thread_index});
+  auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  auto& manager = TransactionManager::get();
+
+  while (state.KeepRunning()) {
+    auto transaction_context = manager.new_transaction_context();
+    auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index == 0) StorageManager::get().drop_table(table_name);
+}
+
+BENCHMARK(BM_CommitSingleRowInserts)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,118 @@
+#include <memory>
+#include <optional>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../benchmark_basic_fixture.hpp"
+#include "benchmark/benchmark.h"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "tpch/tpch_db_generator.hpp"
+#include "types.hpp"
+#include "utils/hash_table.hpp"
+
+namespace opossum {
+
+BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_JoinHash)(benchmark::State& state) {
+  clear_cache();
+
+  auto warm_up = std::make_shared<JoinHash>(_table_wrapper_a, _table_wrapper_b, JoinMode::Inner,
+                                            ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto join = std::make_shared<JoinHash>(_table_wrapper_a, _table_wrapper_b, JoinMode::Inner,
+                                           ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+    join->execute();
+  }
+}
+BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_JoinHash)->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+
+// Builds a HashTable from state.range(0) rows with state.range(1) distinct values and probes it with as many values,
+// half of which are not in the table
+static void BM_JoinHash_HashTable(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto distinct_value_count = static_cast<int32_t>(state.range(1));
+
+  auto random_engine = std::mt19937{};
+  auto build_distribution = std::uniform_int_distribution<int32_t>{0, distinct_value_count - 1};
+  auto probe_distribution = std::uniform_int_distribution<int32_t>{0, 2 * distinct_value_count - 1};
+
+  auto build_values = std::vector<int32_t>(row_count);
+  auto probe_values = std::vector<int32_t>(row_count);
+  for (auto& value : build_values) value = build_distribution(random_engine);
+  for (auto& value : probe_values) value = probe_distribution(random_engine);
+
+  while (state.KeepRunning()) {
+    auto hashtable = HashTable<int32_t>{row_count};
+    for (auto row_index = size_t{0u}; row_index < row_count; ++row_index) {
+      hashtable.put(build_values[row_index], RowID{ChunkID{0}, static_cast<ChunkOffset>(row_index)});
+    }
+    hashtable.finalize();
+
+    auto match_count = size_t{0u};
+    hashtable.probe(row_count, [&](const size_t index) { return probe_values[index]; },
+                    [&](const size_t, const auto& row_ids) { match_count += row_ids.size(); });
+    benchmark::DoNotOptimize(match_count);
+  }
+
+  state.SetItemsProcessed(state.iterations() * row_count * 2);
+}
+BENCHMARK(BM_JoinHash_HashTable)->Args({10'000, 10'000})->Args({1'000'000, 1'000'000})->Args({1'000'000, 1'000});
+
+/*
+Runs the chain of JoinHashes of TPC-H query state.range(0) (3, 5, or 10) on scale factor 0.01 without the scans and
+aggregations of the query. state.range(1) is the number of radix bits, or -1 to let JoinHash choose them.
+  Q3:  customer ⋈ orders ⋈ lineitem
+  Q5:  customer ⋈ orders ⋈ lineitem ⋈ supplier ⋈ nation
+  Q10: customer ⋈ orders ⋈ lineitem ⋈ nation
+*/
+static void BM_JoinHash_TPCH(benchmark::State& state) {
+  static const auto tables = [] {
+    auto table_wrappers = std::unordered_map<TpchTable, std::shared_ptr<TableWrapper>>{};
+    for (auto& [tpch_table, table] : TpchDbGenerator(0.01f, 10'000).generate()) {
+      table_wrappers[tpch_table] = std::make_shared<TableWrapper>(table);
+      table_wrappers[tpch_table]->execute();
+    }
+    return table_wrappers;
+  }();
+
+  const auto query = state.range(0);
+  const auto radix_bits = state.range(1) < 0 ? std::nullopt : std::optional<size_t>{static_cast<size_t>(state.range(1))};
+
+  // Joins (table, left column, right column) with the result of the previous joins
+  auto joins = std::vector<std::tuple<TpchTable, ColumnID, ColumnID>>{
+      {TpchTable::Orders, ColumnID{0} /* c_custkey */, ColumnID{1} /* o_custkey */},
+      {TpchTable::LineItem, ColumnID{8} /* o_orderkey */, ColumnID{0} /* l_orderkey */}};
+  if (query == 5) {
+    joins.emplace_back(TpchTable::Supplier, ColumnID{19} /* l_suppkey */, ColumnID{0} /* s_suppkey */);
+    joins.emplace_back(TpchTable::Nation, ColumnID{36} /* s_nationkey */, ColumnID{0} /* n_nationkey */);
+  } else if (query == 10) {
+    joins.emplace_back(TpchTable::Nation, ColumnID{3} /* c_nationkey */, ColumnID{0} /* n_nationkey */);
+  }
+
+  while (state.KeepRunning()) {
+    auto result = std::shared_ptr<const AbstractOperator>{tables.at(TpchTable::Customer)};
+    for (const auto& [tpch_table, left_column_id, right_column_id] : joins) {
+      auto join = std::make_shared<JoinHash>(result, tables.at(tpch_table), JoinMode::Inner,
+                                             ColumnIDPair(left_column_id, right_column_id), ScanType::Equals,
+                                             std::vector<ColumnIDPair>{}, radix_bits);
+      join->execute();
+      result = join;
+    }
+  }
+}
+BENCHMARK(BM_JoinHash_TPCH)
+    ->Args({3, -1})
+    ->Args({3, 0})
+    ->Args({3, 9})
+    ->Args({5, -1})
+    ->Args({5, 0})
+    ->Args({5, 9})
+    ->Args({10, -1})
+    ->Args({10, 0})
+    ->Args({10, 9});
+
+}  // namespace opossum
@@ -6,8 +6,6 @@
 #include <utility>
 #include <vector>
 
-#include "tbb/concurrent_vector.h"
-
 #include "storage/chunk.hpp"
 #include "storage/dictionary_compression.hpp"
 #include "storage/table.hpp"
@@ -19,7 +17,7 @@ namespace opossum {
 
 std::shared_ptr<Table> TableGenerator::generate_table(const ChunkID chunk_size, const bool compress) {
   std::shared_ptr<Table> table = std::make_shared<Table>(chunk_size);
-  std::vector<tbb::concurrent_vector<int>> value_vectors;
+  std::vector<AppendOnlyVector<int>> value_vectors;
   auto vector_size = chunk_size > 0 ? chunk_size : _num_rows;
   /*
    * Generate table layout with column names from 'a' to 'z'.
@@ -28,7 +26,7 @@ std::shared_ptr<Table> TableGenerator::generate_table(const ChunkID chunk_size,
   for (size_t i = 0; i < _num_columns; i++) {
     auto column_name = std::string(1, static_cast<char>(static_cast<int>('a') + i));
     table->add_column_definition(column_name, DataType::Int);
-    value_vectors.emplace_back(tbb::concurrent_vector<int>(vector_size));
+    value_vectors.emplace_back(AppendOnlyVector<int>(vector_size));
   }
   auto chunk = std::make_shared<Chunk>();
   std::default_random_engine engine;
@@ -41,7 +39,7 @@ std::shared_ptr<Table> TableGenerator::generate_table(const ChunkID chunk_size,
     if (i % vector_size == 0 && i > 0) {
       for (size_t j = 0; j < _num_columns; j++) {
         chunk->add_column(std::make_shared<ValueColumn<int>>(std::move(value_vectors[j])));
-        value_vectors[j] = tbb::concurrent_vector<int>(vector_size);
+        value_vectors[j] = AppendOnlyVector<int>(vector_size);
       }
       table->emplace_chunk(std::move(chunk));
       chunk = std::make_shared<Chunk>();
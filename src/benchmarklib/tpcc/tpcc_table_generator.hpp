@@ -8,8 +8,6 @@
 #include <unordered_map>
 #include <vector>
 
-#include "tbb/concurrent_vector.h"
-
 #include "benchmark_utilities/abstract_benchmark_table_generator.hpp"
 #include "tpcc_random_generator.hpp"
 
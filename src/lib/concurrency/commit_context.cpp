@@ -1,26 +1,27 @@
 #include <memory>
+#include <utility>
 
 #include "commit_context.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-CommitContext::CommitContext(const CommitID commit_id) : _commit_id{commit_id}, _pending{false} {}
+CommitContext::CommitContext(const CommitID commit_id) : _commit_id{commit_id}, _pending{false}, _transaction_id{0} {}
 
 CommitID CommitContext::commit_id() const { return _commit_id; }
 
 bool CommitContext::is_pending() const { return _pending; }
 
 void CommitContext::make_pending(const TransactionID transaction_id, std::function<void(TransactionID)> callback) {
-  _pending = true;
+  _transaction_id = transaction_id;
+  _callback = std::move(callback);
 
-  if (callback) {
-    _callback = [callback, transaction_id]() { callback(transaction_id); };
-  }
+  // The callback must be set before other threads can see the context as pending and fire it
+  _pending = true;
 }
 
 void CommitContext::fire_callback() {
-  if (_callback) _callback();
+  if (_callback) _callback(_transaction_id);
 }
 
 bool CommitContext::has_next() const { return next() != nullptr; }
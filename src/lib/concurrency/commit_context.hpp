@@ -52,6 +52,7 @@ class CommitContext : private Noncopyable {
   const CommitID _commit_id;
   std::atomic<bool> _pending;  // true if context is waiting to be committed
   std::shared_ptr<CommitContext> _next;
-  std::function<void()> _callback;
+  TransactionID _transaction_id;
+  std::function<void(TransactionID)> _callback;
 };
 }  // namespace opossum
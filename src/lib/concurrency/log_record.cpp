@@ -0,0 +1,209 @@
+#include "log_record.hpp"
+
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto CHECKSUM_SEED = 0x1337u;
+
+template <typename T>
+void write_value(std::vector<char>& buffer, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly.");
+  const auto* begin = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), begin, begin + sizeof(T));
+}
+
+void write_string(std::vector<char>& buffer, const std::string& value) {
+  write_value(buffer, static_cast<uint32_t>(value.size()));
+  buffer.insert(buffer.end(), value.cbegin(), value.cend());
+}
+
+// Reads values from a serialized record and fails softly, i.e., returns false, if the record is truncated
+class RecordReader {
+ public:
+  RecordReader(const char* begin, const char* end) : _position(begin), _end(end) {}
+
+  template <typename T>
+  bool read(T& value) {
+    if (static_cast<size_t>(_end - _position) < sizeof(T)) return false;
+    std::memcpy(&value, _position, sizeof(T));
+    _position += sizeof(T);
+    return true;
+  }
+
+  bool read(std::string& value) {
+    auto size = uint32_t{0u};
+    if (!read(size) || static_cast<size_t>(_end - _position) < size) return false;
+    value.assign(_position, size);
+    _position += size;
+    return true;
+  }
+
+ private:
+  const char* _position;
+  const char* _end;
+};
+
+}  // namespace
+
+LogRecord::LogRecord(const CommitID commit_id) : _commit_id(commit_id) {}
+
+void LogRecord::add_insert(const std::string& table_name, const Table& table, const PosList& row_ids) {
+  auto entry = LogEntry{LogEntryType::Insert, table_name, row_ids, table.column_types(), {}};
+  entry.values.reserve(row_ids.size() * table.column_count());
+
+  for (const auto& row_id : row_ids) {
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      entry.values.emplace_back((*chunk->get_column(column_id))[row_id.chunk_offset]);
+    }
+  }
+
+  _entries.emplace_back(std::move(entry));
+}
+
+void LogRecord::add_delete(const std::string& table_name, const PosList& row_ids) {
+  _entries.emplace_back(LogEntry{LogEntryType::Delete, table_name, row_ids, {}, {}});
+}
+
+CommitID LogRecord::commit_id() const { return _commit_id; }
+
+const std::vector<LogEntry>& LogRecord::entries() const { return _entries; }
+
+void LogRecord::serialize(std::vector<char>& buffer) const {
+  const auto record_begin = buffer.size();
+
+  // Payload size and checksum are filled in once the payload has been written
+  write_value(buffer, uint32_t{0u});
+  write_value(buffer, uint32_t{0u});
+  const auto payload_begin = buffer.size();
+
+  write_value(buffer, _commit_id);
+  write_value(buffer, static_cast<uint32_t>(_entries.size()));
+
+  for (const auto& entry : _entries) {
+    write_value(buffer, entry.type);
+    write_string(buffer, entry.table_name);
+    write_value(buffer, static_cast<uint32_t>(entry.row_ids.size()));
+    for (const auto& row_id : entry.row_ids) {
+      write_value(buffer, static_cast<ChunkID::base_type>(row_id.chunk_id));
+      write_value(buffer, row_id.chunk_offset);
+    }
+
+    if (entry.type != LogEntryType::Insert) continue;
+
+    write_value(buffer, static_cast<uint16_t>(entry.column_types.size()));
+    for (const auto column_type : entry.column_types) write_value(buffer, column_type);
+
+    for (auto value_index = size_t{0u}; value_index < entry.values.size(); ++value_index) {
+      const auto& value = entry.values[value_index];
+      const auto is_null = variant_is_null(value);
+      write_value(buffer, static_cast<uint8_t>(is_null));
+      if (is_null) continue;
+
+      resolve_data_type(entry.column_types[value_index % entry.column_types.size()], [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+          write_string(buffer, type_cast<std::string>(value));
+        } else {
+          write_value(buffer, type_cast<ColumnDataType>(value));
+        }
+      });
+    }
+  }
+
+  const auto payload_size = buffer.size() - payload_begin;
+  Assert(payload_size <= std::numeric_limits<uint32_t>::max(), "Log record exceeds the maximum size of 4 GB.");
+  const auto checksum = murmur_hash2(buffer.data() + payload_begin, static_cast<int>(payload_size), CHECKSUM_SEED);
+
+  const auto payload_size_32 = static_cast<uint32_t>(payload_size);
+  std::memcpy(buffer.data() + record_begin, &payload_size_32, sizeof(uint32_t));
+  std::memcpy(buffer.data() + record_begin + sizeof(uint32_t), &checksum, sizeof(uint32_t));
+}
+
+std::optional<LogRecord> LogRecord::deserialize(const std::vector<char>& buffer, size_t& offset) {
+  auto header_reader = RecordReader{buffer.data() + offset, buffer.data() + buffer.size()};
+  auto payload_size = uint32_t{0u};
+  auto checksum = uint32_t{0u};
+  if (!header_reader.read(payload_size) || !header_reader.read(checksum)) return std::nullopt;
+
+  const auto payload_begin = offset + 2u * sizeof(uint32_t);
+  if (buffer.size() - payload_begin < payload_size) return std::nullopt;
+  if (murmur_hash2(buffer.data() + payload_begin, static_cast<int>(payload_size), CHECKSUM_SEED) != checksum) {
+    return std::nullopt;
+  }
+
+  auto reader = RecordReader{buffer.data() + payload_begin, buffer.data() + payload_begin + payload_size};
+
+  auto commit_id = CommitID{0u};
+  auto entry_count = uint32_t{0u};
+  if (!reader.read(commit_id) || !reader.read(entry_count)) return std::nullopt;
+
+  auto record = LogRecord{commit_id};
+  for (auto entry_index = uint32_t{0u}; entry_index < entry_count; ++entry_index) {
+    auto entry = LogEntry{};
+    auto row_count = uint32_t{0u};
+    if (!reader.read(entry.type) || !reader.read(entry.table_name) || !reader.read(row_count)) return std::nullopt;
+
+    entry.row_ids.reserve(row_count);
+    for (auto row_index = uint32_t{0u}; row_index < row_count; ++row_index) {
+      auto chunk_id = ChunkID::base_type{0u};
+      auto chunk_offset = ChunkOffset{0u};
+      if (!reader.read(chunk_id) || !reader.read(chunk_offset)) return std::nullopt;
+      entry.row_ids.emplace_back(RowID{ChunkID{chunk_id}, chunk_offset});
+    }
+
+    if (entry.type == LogEntryType::Insert) {
+      auto column_count = uint16_t{0u};
+      if (!reader.read(column_count)) return std::nullopt;
+
+      entry.column_types.resize(column_count);
+      for (auto& column_type : entry.column_types) {
+        if (!reader.read(column_type)) return std::nullopt;
+      }
+
+      entry.values.reserve(static_cast<size_t>(row_count) * column_count);
+      for (auto value_index = size_t{0u}; value_index < static_cast<size_t>(row_count) * column_count; ++value_index) {
+        auto is_null = uint8_t{0u};
+        if (!reader.read(is_null)) return std::nullopt;
+
+        if (is_null) {
+          entry.values.emplace_back(NULL_VALUE);
+          continue;
+        }
+
+        auto success = false;
+        resolve_data_type(entry.column_types[value_index % column_count], [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto value = ColumnDataType{};
+          success = reader.read(value);
+          entry.values.emplace_back(std::move(value));
+        });
+        if (!success) return std::nullopt;
+      }
+    }
+
+    record._entries.emplace_back(std::move(entry));
+  }
+
+  offset = payload_begin + payload_size;
+  return record;
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class LogEntryType : uint8_t { Insert, Delete };
+
+/**
+ * The redo information of one Insert or Delete. Since recovery restores the physical layout of the tables, rows are
+ * identified by their RowIDs. Inserts additionally carry the inserted values, row by row.
+ */
+struct LogEntry {
+  LogEntryType type;
+  std::string table_name;
+  PosList row_ids;
+
+  // Insert only
+  std::vector<DataType> column_types;
+  std::vector<AllTypeVariant> values;
+};
+
+/**
+ * A LogRecord holds the effects of one committed transaction and is the unit written by the WriteAheadLog. An Update
+ * is logged as the Delete and the Insert it consists of.
+ *
+ * Serialized records have the following layout:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Payload size          | uint32_t                              |   4
+ * Checksum              | uint32_t (murmur hash of the payload) |   4
+ * Commit ID             | CommitID                              |   4
+ * Entry count           | uint32_t                              |   4
+ * Entries               | see below                             |   variable
+ *
+ * Each entry consists of its type (uint8_t), the table name (uint32_t length followed by the characters), the number
+ * of rows (uint32_t) and their RowIDs. Inserts append the column count (uint16_t), the DataType of each column and
+ * the values. Each value is a null flag (uint8_t) followed by the value, if it is not null. Strings are stored as
+ * their length (uint32_t) followed by the characters.
+ */
+class LogRecord {
+ public:
+  explicit LogRecord(const CommitID commit_id);
+
+  // Adds the current values of `row_ids` in `table`
+  void add_insert(const std::string& table_name, const Table& table, const PosList& row_ids);
+  void add_delete(const std::string& table_name, const PosList& row_ids);
+
+  CommitID commit_id() const;
+  const std::vector<LogEntry>& entries() const;
+
+  // Appends the serialized record to `buffer`
+  void serialize(std::vector<char>& buffer) const;
+
+  /**
+   * Reads the record starting at `offset` and advances `offset` past it. Returns nullopt if the data ends within the
+   * record or the checksum does not match, which happens for the last record if the process crashed while writing it.
+   */
+  static std::optional<LogRecord> deserialize(const std::vector<char>& buffer, size_t& offset);
+
+ private:
+  CommitID _commit_id;
+  std::vector<LogEntry> _entries;
+};
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "mvcc_garbage_collector.hpp"
+
+#include <memory>
+
+#include "tasks/mvcc_garbage_collection_task.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+MvccGarbageCollector& MvccGarbageCollector::get() {
+  static MvccGarbageCollector instance;
+  return instance;
+}
+
+void MvccGarbageCollector::reset() {
+  auto& collector = get();
+  collector.pause();
+  collector.set_options(Options{});
+}
+
+MvccGarbageCollector::~MvccGarbageCollector() { pause(); }
+
+const MvccGarbageCollector::Options& MvccGarbageCollector::options() const { return _options; }
+
+void MvccGarbageCollector::set_options(const Options& options) {
+  const auto was_running = is_running();
+  pause();
+
+  _options = options;
+
+  if (was_running) resume();
+}
+
+void MvccGarbageCollector::resume() {
+  if (is_running()) return;
+
+  // The loop works on a copy of the options, so that they can be changed while it is running
+  _collector_thread = std::make_unique<PausableLoopThread>(
+      _options.interval, [options = _options](size_t) { MvccGarbageCollectionTask(options).execute(); });
+}
+
+void MvccGarbageCollector::pause() { _collector_thread.reset(); }
+
+bool MvccGarbageCollector::is_running() const { return _collector_thread != nullptr; }
+
+}  // namespace opossum
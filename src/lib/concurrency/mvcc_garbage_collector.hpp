@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct PausableLoopThread;
+
+/**
+ * The MvccGarbageCollector is a singleton that periodically runs the MvccGarbageCollectionTask, which reclaims the
+ * space of rows that have been deleted or updated and are invisible to all transactions. Like the
+ * NUMAPlacementManager, it is created in a paused state and needs to be resumed to start its operation.
+ *
+ * Garbage collection relies on the TransactionManager's lowest active snapshot commit id. Result tables pin the
+ * snapshots they were read under (see Table::add_snapshot_pin()), so they stay readable after their
+ * TransactionContext has been destroyed.
+ */
+class MvccGarbageCollector : private Noncopyable {
+ public:
+  struct Options {
+    // Time between two garbage collection runs
+    std::chrono::milliseconds interval = std::chrono::seconds(10);
+
+    // Chunks with a share of rows that are invisible to all transactions above this threshold are compacted
+    double invalid_row_share_threshold = 0.5;
+  };
+
+  static MvccGarbageCollector& get();
+
+  // Pauses the collector and restores the default options
+  static void reset();
+
+  const Options& options() const;
+
+  // Takes effect immediately, also if the collector is running
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+  bool is_running() const;
+
+ private:
+  MvccGarbageCollector() = default;
+  ~MvccGarbageCollector();
+
+  Options _options;
+
+  // Only exists while the collector is running. Destroying it stops the loop without waiting for the interval to pass.
+  std::unique_ptr<PausableLoopThread> _collector_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,236 @@
+#include "recovery.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log_record.hpp"
+#include "operators/import_binary.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "transaction_manager.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "write_ahead_log.hpp"
+
+namespace opossum {
+
+namespace {
+
+using ReplayEntry = std::pair<CommitID, const LogEntry*>;
+
+template <typename T>
+std::vector<T> read_values(std::istream& file, const size_t count) {
+  auto values = std::vector<T>(count);
+  file.read(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+  return values;
+}
+
+// Imports a table of the checkpoint at `path` and restores its MVCC columns (see WriteAheadLog::checkpoint())
+std::shared_ptr<Table> load_checkpoint_table(const std::string& path) {
+  auto import_binary = std::make_shared<ImportBinary>(path + ".bin");
+  import_binary->execute();
+
+  // The table has just been created by ImportBinary and is not shared with anyone
+  auto table = std::const_pointer_cast<Table>(import_binary->get_output());
+
+  auto mvcc_file = std::ifstream{};
+  mvcc_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  mvcc_file.open(path + ".mvcc", std::ios::binary);
+
+  const auto chunk_count = read_values<uint32_t>(mvcc_file, 1u).front();
+  Assert(chunk_count == table->chunk_count(), "MVCC information does not match table " + path);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto row_count = read_values<uint32_t>(mvcc_file, 1u).front();
+    Assert(row_count == chunk->size(), "MVCC information does not match table " + path);
+
+    const auto begin_cids = read_values<CommitID>(mvcc_file, row_count);
+    const auto end_cids = read_values<CommitID>(mvcc_file, row_count);
+
+    auto mvcc_columns = chunk->mvcc_columns();
+    std::copy(begin_cids.cbegin(), begin_cids.cend(), mvcc_columns->begin_cids.begin());
+    std::copy(end_cids.cbegin(), end_cids.cend(), mvcc_columns->end_cids.begin());
+    mvcc_columns->any_row_invalidated = std::any_of(end_cids.cbegin(), end_cids.cend(),
+                                                    [](const auto end_cid) { return end_cid != Chunk::MAX_COMMIT_ID; });
+  }
+
+  return table;
+}
+
+// Appends placeholder rows until `row_id` exists. Inserts of transactions that did not commit have left gaps.
+void ensure_row_exists(Table& table, const RowID& row_id) {
+  while (table.chunk_count() <= row_id.chunk_id) table.create_new_chunk();
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (row_id.chunk_offset < chunk->size()) return;
+
+  auto placeholder = std::vector<AllTypeVariant>{};
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    if (table.column_is_nullable(column_id)) {
+      placeholder.emplace_back(NULL_VALUE);
+      continue;
+    }
+
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      placeholder.emplace_back(ColumnDataType{});
+    });
+  }
+
+  // Chunk::append() adds rows that are invisible until they are committed
+  auto append_lock = table.acquire_append_mutex();
+  table.reserve_chunk_capacity(row_id.chunk_id, row_id.chunk_offset + 1u);
+  while (chunk->size() <= row_id.chunk_offset) chunk->append(placeholder);
+}
+
+void replay_insert(Table& table, const CommitID commit_id, const LogEntry& entry) {
+  Assert(entry.column_types == table.column_types(), "Logged Insert does not match the columns of its table.");
+
+  for (const auto& row_id : entry.row_ids) ensure_row_exists(table, row_id);
+
+  const auto column_count = table.column_count();
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      for (auto row_index = size_t{0u}; row_index < entry.row_ids.size(); ++row_index) {
+        const auto& row_id = entry.row_ids[row_index];
+
+        // Encoded chunks are only created from complete chunks and thus already contain the final values
+        const auto value_column = std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(
+            table.get_chunk(row_id.chunk_id)->get_mutable_column(column_id));
+        if (!value_column) continue;
+
+        const auto& value = entry.values[row_index * column_count + column_id];
+        const auto is_null = variant_is_null(value);
+        value_column->values()[row_id.chunk_offset] = is_null ? ColumnDataType{} : type_cast<ColumnDataType>(value);
+        if (value_column->is_nullable()) value_column->null_values()[row_id.chunk_offset] = is_null;
+      }
+    });
+  }
+
+  for (const auto& row_id : entry.row_ids) {
+    auto mvcc_columns = table.get_chunk(row_id.chunk_id)->mvcc_columns();
+    mvcc_columns->begin_cids[row_id.chunk_offset] = commit_id;
+  }
+}
+
+void replay_delete(Table& table, const CommitID commit_id, const LogEntry& entry) {
+  for (const auto& row_id : entry.row_ids) {
+    Assert(row_id.chunk_id < table.chunk_count() && row_id.chunk_offset < table.get_chunk(row_id.chunk_id)->size(),
+           "Logged Delete refers to a row that does not exist.");
+
+    auto mvcc_columns = table.get_chunk(row_id.chunk_id)->mvcc_columns();
+    mvcc_columns->any_row_invalidated = true;
+    mvcc_columns->end_cids[row_id.chunk_offset] = commit_id;
+  }
+}
+
+void recover_table(Table& table, std::vector<ReplayEntry>& entries) {
+  // Transactions are logged in the order in which they became durable, not in commit id order
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  for (const auto& [commit_id, entry] : entries) {
+    if (entry->type == LogEntryType::Insert) {
+      replay_insert(table, commit_id, *entry);
+    } else {
+      replay_delete(table, commit_id, *entry);
+    }
+  }
+
+  // Like rolled back Inserts, placeholders become invisible for everyone (see Insert::_on_rollback_records())
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    auto mvcc_columns = table.get_chunk(chunk_id)->mvcc_columns();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_columns->begin_cids.size(); ++chunk_offset) {
+      if (mvcc_columns->begin_cids[chunk_offset] != Chunk::MAX_COMMIT_ID) continue;
+      mvcc_columns->any_row_invalidated = true;
+      mvcc_columns->end_cids[chunk_offset] = 0u;
+      mvcc_columns->begin_cids[chunk_offset] = 0u;
+    }
+  }
+}
+
+}  // namespace
+
+CommitID Recovery::recover(const std::string& directory) {
+  auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  // Load the tables of the most recent checkpoint
+  auto checkpoint_commit_id = CommitID{0u};
+  auto table_names = std::vector<std::string>{};
+  auto checkpoint_file = std::ifstream{directory + "/" + WriteAheadLog::CHECKPOINT_FILENAME};
+  if (checkpoint_file >> checkpoint_commit_id) {
+    for (auto table_name = std::string{}; std::getline(checkpoint_file >> std::ws, table_name);) {
+      table_names.emplace_back(table_name);
+    }
+
+    const auto checkpoint_directory = directory + "/" + WriteAheadLog::checkpoint_directory_name(checkpoint_commit_id);
+    auto tables = std::vector<std::shared_ptr<Table>>(table_names.size());
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto table_index = size_t{0u}; table_index < table_names.size(); ++table_index) {
+      auto job = std::make_shared<JobTask>([&, table_index]() {
+        tables[table_index] = load_checkpoint_table(checkpoint_directory + "/" + table_names[table_index]);
+      });
+      jobs.emplace_back(job);
+      job->schedule();
+    }
+    for (const auto& job : jobs) job->join();
+
+    for (auto table_index = size_t{0u}; table_index < table_names.size(); ++table_index) {
+      StorageManager::get().add_table(table_names[table_index], tables[table_index]);
+    }
+
+    last_commit_id = std::max(last_commit_id, checkpoint_commit_id);
+  }
+
+  // Read all transactions that committed after the checkpoint. Segments end at the first incomplete record.
+  auto records = std::vector<LogRecord>{};
+  for (const auto segment : WriteAheadLog::find_log_segments(directory)) {
+    auto segment_file = std::ifstream{directory + "/" + WriteAheadLog::log_segment_filename(segment), std::ios::binary};
+    const auto data = std::vector<char>{std::istreambuf_iterator<char>{segment_file}, std::istreambuf_iterator<char>{}};
+
+    auto offset = size_t{0u};
+    while (auto record = LogRecord::deserialize(data, offset)) {
+      if (record->commit_id() > checkpoint_commit_id) records.emplace_back(std::move(*record));
+    }
+  }
+
+  // Replay the transactions table by table. Tables of the checkpoint are recovered even without any entries, as they
+  // might contain placeholders.
+  auto entries_by_table = std::map<std::string, std::vector<ReplayEntry>>{};
+  for (const auto& table_name : table_names) entries_by_table[table_name];
+
+  for (const auto& record : records) {
+    for (const auto& entry : record.entries()) {
+      entries_by_table[entry.table_name].emplace_back(record.commit_id(), &entry);
+    }
+    last_commit_id = std::max(last_commit_id, record.commit_id());
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto& [table_name, entries] : entries_by_table) {
+    Assert(StorageManager::get().has_table(table_name), "Cannot recover table " + table_name + ", it does not exist.");
+    const auto table = StorageManager::get().get_table(table_name);
+
+    auto job = std::make_shared<JobTask>([table, &entries = entries]() { recover_table(*table, entries); });
+    jobs.emplace_back(job);
+    job->schedule();
+  }
+  for (const auto& job : jobs) job->join();
+
+  TransactionManager::get()._set_last_commit_id(last_commit_id);
+  return last_commit_id;
+}
+
+}  // namespace opossum
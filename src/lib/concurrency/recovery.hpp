@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Restores the committed state of the database from the files written by the WriteAheadLog.
+ *
+ * First, the tables of the most recent checkpoint are imported (memory-mapping their dictionary columns, see
+ * ImportBinary) and registered in the StorageManager. Their MVCC columns are restored, so that rows deleted before
+ * the checkpoint stay invisible. Then, the log records of all transactions that committed after the checkpoint are
+ * replayed in commit id order. As transactions on different tables are independent of each other, each table is
+ * recovered by a JobTask of its own. Recovery stops reading a log segment at the first incomplete record, which can
+ * only belong to a transaction that had not been reported as committed.
+ *
+ * The log refers to rows by RowID, i.e., recovery reproduces the physical layout of the tables. Rows that were not
+ * committed when the process ended are left behind invisible, just like rows of rolled back transactions.
+ */
+class Recovery {
+ public:
+  /**
+   * Recovers the tables in `directory`. Tables that are modified by the log but are not part of a checkpoint must
+   * already be in the StorageManager (e.g., because they have been loaded from CSV files). Must be called before any
+   * transaction is started.
+   *
+   * @returns the last recovered commit id, which also becomes the TransactionManager's last commit id
+   */
+  static CommitID recover(const std::string& directory);
+};
+
+}  // namespace opossum
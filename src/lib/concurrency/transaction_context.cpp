@@ -4,15 +4,19 @@
 #include <memory>
 
 #include "commit_context.hpp"
+#include "log_record.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
 #include "utils/assert.hpp"
+#include "write_ahead_log.hpp"
 
 namespace opossum {
 
-TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id,
+                                       const bool is_read_only)
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
+      _is_read_only{is_read_only},
       _phase{TransactionPhase::Active},
       _num_active_operators{0} {}
 
@@ -42,6 +46,8 @@ TransactionContext::~TransactionContext() {
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
 CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+const SnapshotPin& TransactionContext::snapshot_pin() const { return _snapshot_pin; }
+bool TransactionContext::is_read_only() const { return _is_read_only; }
 
 CommitID TransactionContext::commit_id() const {
   Assert((_commit_context != nullptr), "TransactionContext cid only available after commit context has been created.");
@@ -71,6 +77,16 @@ bool TransactionContext::rollback() {
 }
 
 bool TransactionContext::commit_async(std::function<void(TransactionID)> callback) {
+  if (_is_read_only) {
+    // There is nothing to make visible, so read-only transactions neither get a commit id nor wait for others
+    const auto success = _transition(TransactionPhase::Active, TransactionPhase::Committed, TransactionPhase::Committed);
+    if (!success) return false;
+
+    _wait_for_active_operators_to_finish();
+    if (callback) callback(_transaction_id);
+    return true;
+  }
+
   const auto success = _prepare_commit();
 
   if (!success) return false;
@@ -79,7 +95,20 @@ bool TransactionContext::commit_async(std::function<void(TransactionID)> callbac
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  auto& write_ahead_log = WriteAheadLog::get();
+  if (!write_ahead_log.is_enabled() || _rw_operators.empty()) {
+    _mark_as_pending_and_try_commit(callback);
+    return true;
+  }
+
+  // The changes must not become visible before they are durable
+  auto record = LogRecord{commit_id()};
+  for (const auto& op : _rw_operators) {
+    op->log_records(record);
+  }
+
+  auto context = shared_from_this();
+  write_ahead_log.log_commit(record, [context, callback]() { context->_mark_as_pending_and_try_commit(callback); });
 
   return true;
 }
@@ -164,6 +193,11 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
   TransactionManager::get()._try_increment_last_commit_id(_commit_context);
 }
 
+void TransactionContext::register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) {
+  Assert(!_is_read_only, "Read-only transactions cannot modify tables.");
+  _rw_operators.push_back(op);
+}
+
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
 
 void TransactionContext::on_operator_finished() {
@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "transaction_manager.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -46,29 +47,43 @@ enum class TransactionPhase {
 
 /**
  * @brief Representation of a transaction
+ *
+ * Read-only transactions (see TransactionManager::new_read_only_transaction_context()) only consist of a snapshot
+ * commit id. They cannot register read/write operators and are committed without a commit id, i.e., without waiting
+ * for other transactions.
  */
 class TransactionContext : public std::enable_shared_from_this<TransactionContext> {
   friend class TransactionManager;
 
  public:
-  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id,
+                     const bool is_read_only = false);
   ~TransactionContext();
 
   /**
-   * The transaction id used among others to lock records in tables.
+   * The transaction id used among others to lock records in tables. INVALID_TRANSACTION_ID for read-only transactions.
    */
   TransactionID transaction_id() const;
 
+  bool is_read_only() const;
+
   /**
    * The snapshot commit id represents the snapshot in time of the database
    * that the transaction is able to see and access.
    */
   CommitID snapshot_commit_id() const;
 
+  /**
+   * Keeps the snapshot registered with the TransactionManager. Result tables read under this snapshot hold copies of
+   * it, so that they stay readable after the context is gone. Does not pin a snapshot if the context was not created
+   * by the TransactionManager.
+   */
+  const SnapshotPin& snapshot_pin() const;
+
   /**
    * The commit id that this transaction has once it is committed. This is the one that is written to the
    * begin/end commit ids of rows modified by this transaction.
-   * Only available after TransactionManager::prepare_commit has been called
+   * Only available after TransactionManager::prepare_commit has been called, never for read-only transactions.
    */
   CommitID commit_id() const;
 
@@ -90,7 +105,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   bool rollback();
 
   /**
-   * Commits the transaction.
+   * Commits the transaction. If the WriteAheadLog is enabled, the transaction only becomes visible after its log
+   * record is durable.
    *
    * @param callback called when transaction is actually committed
    * @return false if called a second time
@@ -109,8 +125,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Add an operator to the list of read-write operators.
    * Update must not call this because it consists of a Delete and an Insert, which call this themselves.
+   * Fails for read-only transactions.
    */
-  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op);
 
   /**
    * @defgroup Update the counter of active operators
@@ -174,6 +191,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
  private:
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
+  const bool _is_read_only;
+  // Set if the snapshot is tracked by the TransactionManager, i.e., if the context was created by it
+  SnapshotPin _snapshot_pin;
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
 
   std::atomic<TransactionPhase> _phase;
@@ -1,6 +1,8 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <utility>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
@@ -8,6 +10,41 @@
 
 namespace opossum {
 
+SnapshotPin::SnapshotPin(std::atomic<CommitID>& slot, const CommitID snapshot_commit_id)
+    : _slot{&slot}, _snapshot_commit_id{snapshot_commit_id} {}
+
+SnapshotPin::SnapshotPin(SnapshotPin&& other) noexcept
+    : _slot{std::exchange(other._slot, nullptr)}, _snapshot_commit_id{other._snapshot_commit_id} {}
+
+SnapshotPin& SnapshotPin::operator=(SnapshotPin&& other) noexcept {
+  if (this == &other) return *this;
+
+  _release();
+  _slot = std::exchange(other._slot, nullptr);
+  _snapshot_commit_id = other._snapshot_commit_id;
+  return *this;
+}
+
+SnapshotPin::~SnapshotPin() { _release(); }
+
+bool SnapshotPin::is_pinned() const { return _slot != nullptr; }
+
+CommitID SnapshotPin::snapshot_commit_id() const {
+  DebugAssert(is_pinned(), "SnapshotPin does not pin a snapshot.");
+  return _snapshot_commit_id;
+}
+
+SnapshotPin SnapshotPin::copy() const {
+  if (!is_pinned()) return SnapshotPin{};
+  return TransactionManager::get()._pin_snapshot_commit_id(_snapshot_commit_id);
+}
+
+void SnapshotPin::_release() {
+  if (!_slot) return;
+  _slot->store(TransactionManager::FREE_SNAPSHOT_SLOT);
+  _slot = nullptr;
+}
+
 TransactionManager& TransactionManager::get() {
   static TransactionManager instance;
   return instance;
@@ -18,17 +55,71 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  // Snapshots of the previous run must not hold back the garbage collection. Pins that are still alive keep writing
+  // to the slots of the retired blocks, so these are only freed with the TransactionManager.
+  auto all_slots_free = true;
+  for (auto block = manager._snapshot_slot_blocks.load(); block && all_slots_free; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      if (slot.snapshot_commit_id.load() != FREE_SNAPSHOT_SLOT) {
+        all_slots_free = false;
+        break;
+      }
+    }
+  }
+
+  if (!all_slots_free) {
+    manager._retired_snapshot_slot_blocks.emplace_back(manager._snapshot_slot_blocks.exchange(new SnapshotSlotBlock));
+  }
 }
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)},
+      _snapshot_slot_blocks{new SnapshotSlotBlock} {}
+
+TransactionManager::~TransactionManager() {
+  _retired_snapshot_slot_blocks.emplace_back(_snapshot_slot_blocks.load());
+
+  for (auto block : _retired_snapshot_slot_blocks) {
+    while (block) {
+      delete std::exchange(block, block->next.load());
+    }
+  }
+}
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  // The last commit id has to be read before the slots (see _pin_last_commit_id())
+  auto lowest_snapshot_commit_id = _last_commit_id.load();
+
+  for (auto block = _snapshot_slot_blocks.load(); block; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      lowest_snapshot_commit_id = std::min(lowest_snapshot_commit_id, slot.snapshot_commit_id.load());
+    }
+  }
+
+  return lowest_snapshot_commit_id;
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  auto snapshot_pin = _pin_last_commit_id();
+
+  auto transaction_context =
+      std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_pin.snapshot_commit_id());
+  transaction_context->_snapshot_pin = std::move(snapshot_pin);
+  return transaction_context;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_read_only_transaction_context() {
+  auto snapshot_pin = _pin_last_commit_id();
+
+  auto transaction_context =
+      std::make_shared<TransactionContext>(INVALID_TRANSACTION_ID, snapshot_pin.snapshot_commit_id(), true);
+  transaction_context->_snapshot_pin = std::move(snapshot_pin);
+  return transaction_context;
 }
 
 void TransactionManager::run_transaction(const std::function<void(std::shared_ptr<TransactionContext>)>& fn) {
@@ -81,20 +172,104 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
+/**
+ * Logic of the batched commit
+ *
+ * Transactions become visible in commit id order. A thread whose context follows the last committed one publishes
+ * not only its own commit but the whole run of consecutive pending contexts behind it: it walks the run, advances
+ * _last_commit_id to the run's end with a single compare-and-swap, and only then fires the callbacks of all contexts
+ * in the run. Threads that became pending within the run fail their own compare-and-swap and simply return, because
+ * their commit is published on their behalf. Under many small concurrent transactions, this replaces one
+ * compare-and-swap and one visibility step per transaction by one per batch.
+ *
+ * A context that becomes pending after the run has been collected is not lost: either its owner sees the new
+ * _last_commit_id and publishes it, or the publishing thread sees it as pending when it continues after the run.
+ */
 void TransactionManager::_try_increment_last_commit_id(std::shared_ptr<CommitContext> context) {
-  auto current_context = context;
+  auto first_context = std::move(context);
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+  while (first_context->is_pending()) {
+    auto last_context = first_context;
+    while (last_context->has_next()) {
+      auto next_context = last_context->next();
+      if (!next_context->is_pending()) break;
+      last_context = std::move(next_context);
+    }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    auto expected_last_commit_id = first_context->commit_id() - 1;
+    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, last_context->commit_id())) return;
 
-    current_context->fire_callback();
+    for (auto current_context = first_context; current_context != last_context;
+         current_context = current_context->next()) {
+      current_context->fire_callback();
+    }
+    last_context->fire_callback();
 
-    if (!current_context->has_next()) return;
+    if (!last_context->has_next()) return;
 
-    current_context = current_context->next();
+    first_context = last_context->next();
   }
 }
 
+/**
+ * Logic of the snapshot registration
+ *
+ * The last commit id is stored in a slot and then read again until it did not change in between. The re-read value
+ * becomes the snapshot. lowest_active_snapshot_commit_id() reads the last commit id before it scans the slots. If it
+ * scans a slot before the snapshot is stored there, the re-read of the last commit id happens after its own read, so
+ * the snapshot is at least the last commit id it started from. Otherwise, it sees the snapshot or a lower one that was
+ * stored in the slot before. Either way, it never returns a commit id above the snapshot of a starting transaction.
+ */
+SnapshotPin TransactionManager::_pin_last_commit_id() {
+  auto snapshot_commit_id = _last_commit_id.load();
+  auto& slot = _claim_snapshot_slot(snapshot_commit_id);
+
+  auto current_last_commit_id = _last_commit_id.load();
+  while (current_last_commit_id != snapshot_commit_id) {
+    snapshot_commit_id = current_last_commit_id;
+    slot.store(snapshot_commit_id);
+    current_last_commit_id = _last_commit_id.load();
+  }
+
+  return SnapshotPin{slot, snapshot_commit_id};
+}
+
+SnapshotPin TransactionManager::_pin_snapshot_commit_id(const CommitID snapshot_commit_id) {
+  return SnapshotPin{_claim_snapshot_slot(snapshot_commit_id), snapshot_commit_id};
+}
+
+std::atomic<CommitID>& TransactionManager::_claim_snapshot_slot(const CommitID snapshot_commit_id) {
+  // Threads start at different slots, so that they usually claim a slot on the first try
+  static std::atomic<size_t> next_first_slot_offset{0};
+  thread_local const auto first_slot_offset = next_first_slot_offset++ % SNAPSHOT_SLOTS_PER_BLOCK;
+
+  auto block = _snapshot_slot_blocks.load();
+  while (true) {
+    for (auto slot_index = size_t{0}; slot_index < SNAPSHOT_SLOTS_PER_BLOCK; ++slot_index) {
+      auto& slot = block->slots[(first_slot_offset + slot_index) % SNAPSHOT_SLOTS_PER_BLOCK].snapshot_commit_id;
+      auto expected = FREE_SNAPSHOT_SLOT;
+      if (slot.load() == FREE_SNAPSHOT_SLOT && slot.compare_exchange_strong(expected, snapshot_commit_id)) {
+        return slot;
+      }
+    }
+
+    auto next_block = block->next.load();
+    if (!next_block) {
+      // All slots are taken, so append a block whose first slot is already claimed
+      auto new_block = new SnapshotSlotBlock;
+      new_block->slots[0].snapshot_commit_id = snapshot_commit_id;
+      if (block->next.compare_exchange_strong(next_block, new_block)) return new_block->slots[0].snapshot_commit_id;
+
+      // Another thread appended a block first, next_block now points to it
+      delete new_block;
+    }
+    block = next_block;
+  }
+}
+
+void TransactionManager::_set_last_commit_id(const CommitID commit_id) {
+  _last_commit_id = commit_id;
+  std::atomic_store(&_last_commit_context, std::make_shared<CommitContext>(commit_id));
+}
+
 }  // namespace opossum
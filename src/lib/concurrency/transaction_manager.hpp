@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include "types.hpp"
 
@@ -39,6 +42,42 @@ namespace opossum {
 class CommitContext;
 class TransactionContext;
 
+/**
+ * Keeps a snapshot commit id registered as active in the TransactionManager for as long as it exists. It is held by
+ * the TransactionContext of the snapshot, and result tables read under it hold copies (see Table::add_snapshot_pin()),
+ * so that the MvccGarbageCollector does not remove chunks that these tables still reference.
+ *
+ * Each pin occupies a slot of the TransactionManager, which it claims and releases without a lock.
+ */
+class SnapshotPin : private Noncopyable {
+ public:
+  // Creates a pin that does not pin any snapshot
+  SnapshotPin() = default;
+
+  SnapshotPin(SnapshotPin&& other) noexcept;
+  SnapshotPin& operator=(SnapshotPin&& other) noexcept;
+  ~SnapshotPin();
+
+  // Returns false if the pin does not pin any snapshot
+  bool is_pinned() const;
+
+  CommitID snapshot_commit_id() const;
+
+  // Pins the same snapshot again, e.g., for a result table read under it
+  SnapshotPin copy() const;
+
+ private:
+  friend class TransactionManager;
+
+  // Only the TransactionManager creates pins, because it registers the snapshot commit id in the slot before
+  SnapshotPin(std::atomic<CommitID>& slot, const CommitID snapshot_commit_id);
+
+  void _release();
+
+  std::atomic<CommitID>* _slot{nullptr};
+  CommitID _snapshot_commit_id{0};
+};
+
 /**
  * The TransactionManager is responsible for a consistent assignment of
  * transaction and commit ids. It also keeps track of the last commit id
@@ -52,11 +91,27 @@ class TransactionManager : private Noncopyable {
 
   CommitID last_commit_id() const;
 
+  /**
+   * Returns the lowest snapshot commit id of all SnapshotPins that have not been destroyed yet, i.e., of all live
+   * transactions and of the result tables read by them, or the last commit id if there are none. Rows that were
+   * deleted at or before this commit id are invisible to all current and future transactions and can be garbage
+   * collected (see MvccGarbageCollector).
+   */
+  CommitID lowest_active_snapshot_commit_id() const;
+
   /**
    * Creates a new transaction context
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Creates a context for a transaction that only reads. It does not get a transaction id and does not take part in
+   * the ordered commit of the other transactions, but its snapshot is still tracked for the garbage collection.
+   * Neither this nor the end of the transaction takes a lock, so read-only transactions scale with the number of
+   * threads that start them.
+   */
+  std::shared_ptr<TransactionContext> new_read_only_transaction_context();
+
   /**
    * Helper: Executes a function object within a context and commits or rolls it back afterwards.
    *
@@ -70,9 +125,12 @@ class TransactionManager : private Noncopyable {
   void run_transaction(const std::function<void(std::shared_ptr<TransactionContext>)>& fn);
 
  private:
+  friend class Recovery;
+  friend class SnapshotPin;
   friend class TransactionContext;
 
   TransactionManager();
+  ~TransactionManager();
 
   TransactionManager(TransactionManager&&) = delete;
   TransactionManager& operator=(TransactionManager&&) = delete;
@@ -80,6 +138,18 @@ class TransactionManager : private Noncopyable {
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(std::shared_ptr<CommitContext> context);
 
+  // Registers the current last commit id as active snapshot and returns it
+  SnapshotPin _pin_last_commit_id();
+
+  // Registers a snapshot commit id that is kept registered by another pin while this one is created
+  SnapshotPin _pin_snapshot_commit_id(const CommitID snapshot_commit_id);
+
+  // Stores the snapshot commit id in a free slot and returns the slot
+  std::atomic<CommitID>& _claim_snapshot_slot(const CommitID snapshot_commit_id);
+
+  // Continues after the last commit id of a recovered database. Must not be called while transactions are running.
+  void _set_last_commit_id(const CommitID commit_id);
+
  private:
   std::atomic<TransactionID> _next_transaction_id;
   // TransactionID = 0 means "not set" in the MVCC columns
@@ -91,5 +161,28 @@ class TransactionManager : private Noncopyable {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  /**
+   * The snapshot commit ids of the live SnapshotPins, one per slot. Free slots hold FREE_SNAPSHOT_SLOT, so that
+   * lowest_active_snapshot_commit_id() only needs to take the minimum of all slots. Each thread starts looking for a
+   * free slot at a different one, and slots are padded to a cache line, so that threads do not compete for them. If
+   * all slots are taken, another block is appended. Blocks are only freed with the TransactionManager.
+   */
+  static constexpr auto FREE_SNAPSHOT_SLOT = std::numeric_limits<CommitID>::max();
+  static constexpr auto SNAPSHOT_SLOTS_PER_BLOCK = size_t{64};
+
+  struct alignas(64) SnapshotSlot {
+    std::atomic<CommitID> snapshot_commit_id{FREE_SNAPSHOT_SLOT};
+  };
+
+  struct SnapshotSlotBlock {
+    std::array<SnapshotSlot, SNAPSHOT_SLOTS_PER_BLOCK> slots;
+    std::atomic<SnapshotSlotBlock*> next{nullptr};
+  };
+
+  std::atomic<SnapshotSlotBlock*> _snapshot_slot_blocks;
+
+  // Blocks replaced by reset() while pins still occupied some of their slots
+  std::vector<SnapshotSlotBlock*> _retired_snapshot_slot_blocks;
 };
 }  // namespace opossum
@@ -0,0 +1,401 @@
+#include "write_ahead_log.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log_record.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_value_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+namespace {
+
+const auto LOG_SEGMENT_PREFIX = std::string{"log_"};
+const auto CHECKPOINT_DIRECTORY_PREFIX = std::string{"checkpoint_"};
+
+std::vector<std::string> list_directory(const std::string& directory) {
+  auto names = std::vector<std::string>{};
+
+  auto* const dir = opendir(directory.c_str());
+  Assert(dir != nullptr, "Could not open directory " + directory);
+  while (const auto* entry = readdir(dir)) {
+    const auto name = std::string{entry->d_name};
+    if (name != "." && name != "..") names.emplace_back(name);
+  }
+  closedir(dir);
+
+  return names;
+}
+
+void remove_directory(const std::string& directory) {
+  for (const auto& name : list_directory(directory)) unlink((directory + "/" + name).c_str());
+  rmdir(directory.c_str());
+}
+
+// Makes written data, or the creation, renaming, and deletion of files in a directory, durable
+void sync_path(const std::string& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open " + path);
+  const auto result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(result == 0, "Could not sync " + path + ": " + std::strerror(errno));
+}
+
+/**
+ * Copies the rows of `table` that exist when the checkpoint is started, together with their MVCC information as
+ * seen by `commit_id`. Rows that are not committed as of `commit_id` are kept as placeholders, so that the table
+ * keeps its physical layout and the log can refer to its rows by RowID. Their values are not copied, as concurrent
+ * Inserts might still be writing them. Instead, Recovery writes them when replaying the Insert.
+ *
+ * Columns of immutable (i.e., encoded) chunks are shared, mutable chunks are copied.
+ */
+std::shared_ptr<Table> snapshot_table(const Table& table, const CommitID commit_id, std::ofstream& mvcc_file) {
+  auto snapshot = std::make_shared<Table>(table.max_chunk_size());
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    snapshot->add_column_definition(table.column_name(column_id), table.column_type(column_id),
+                                    table.column_is_nullable(column_id));
+  }
+
+  const auto chunk_count = static_cast<uint32_t>(table.chunk_count());
+  mvcc_file.write(reinterpret_cast<const char*>(&chunk_count), sizeof(chunk_count));
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+
+    // Concurrent Inserts grow the columns one after another, so only rows that exist in all columns are copied
+    auto row_count = chunk->size();
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      row_count = std::min(row_count, static_cast<uint32_t>(chunk->get_column(column_id)->size()));
+    }
+
+    auto begin_cids = std::vector<CommitID>(row_count);
+    auto end_cids = std::vector<CommitID>(row_count);
+    {
+      const auto mvcc_columns = chunk->mvcc_columns();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        const auto begin_cid = mvcc_columns->begin_cids[chunk_offset];
+        const auto end_cid = mvcc_columns->end_cids[chunk_offset];
+        begin_cids[chunk_offset] = begin_cid <= commit_id ? begin_cid : Chunk::MAX_COMMIT_ID;
+        end_cids[chunk_offset] = end_cid <= commit_id ? end_cid : Chunk::MAX_COMMIT_ID;
+      }
+    }
+
+    mvcc_file.write(reinterpret_cast<const char*>(&row_count), sizeof(row_count));
+    mvcc_file.write(reinterpret_cast<const char*>(begin_cids.data()), row_count * sizeof(CommitID));
+    mvcc_file.write(reinterpret_cast<const char*>(end_cids.data()), row_count * sizeof(CommitID));
+
+    auto snapshot_chunk = std::make_shared<Chunk>();
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto column = chunk->get_column(column_id);
+      if (!std::dynamic_pointer_cast<const BaseValueColumn>(column)) {
+        snapshot_chunk->add_column(std::const_pointer_cast<BaseColumn>(column));
+        continue;
+      }
+
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        const auto& value_column = static_cast<const ValueColumn<ColumnDataType>&>(*column);
+        auto values = AppendOnlyVector<ColumnDataType>(row_count);
+        auto null_values = AppendOnlyVector<bool>(value_column.is_nullable() ? row_count : 0u);
+
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          if (begin_cids[chunk_offset] == Chunk::MAX_COMMIT_ID) continue;
+          values[chunk_offset] = value_column.values()[chunk_offset];
+          if (value_column.is_nullable()) null_values[chunk_offset] = value_column.null_values()[chunk_offset];
+        }
+
+        if (value_column.is_nullable()) {
+          snapshot_chunk->add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values),
+                                                                                  std::move(null_values)));
+        } else {
+          snapshot_chunk->add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+
+    snapshot->emplace_chunk(snapshot_chunk);
+  }
+
+  return snapshot;
+}
+
+}  // namespace
+
+const std::string WriteAheadLog::CHECKPOINT_FILENAME = "checkpoint";
+
+WriteAheadLog& WriteAheadLog::get() {
+  static WriteAheadLog instance;
+  return instance;
+}
+
+void WriteAheadLog::reset() { get().disable(); }
+
+WriteAheadLog::~WriteAheadLog() { disable(); }
+
+void WriteAheadLog::enable(const std::string& directory, const std::chrono::milliseconds checkpoint_interval) {
+  Assert(!_is_enabled, "The write-ahead log is already enabled.");
+
+  _directory = directory;
+  _shutdown = false;
+  _logged_count = 0u;
+  _durable_count = 0u;
+  _sync_count = 0u;
+
+  // Segments of previous runs have been replayed by Recovery, so they contain no commit id beyond the current one
+  auto segment = uint32_t{0u};
+  for (const auto existing_segment : find_log_segments(directory)) {
+    _segment_max_commit_ids[existing_segment] = TransactionManager::get().last_commit_id();
+    segment = existing_segment + 1u;
+  }
+
+  _checkpoint_commit_id = std::nullopt;
+  auto checkpoint_file = std::ifstream{directory + "/" + CHECKPOINT_FILENAME};
+  auto checkpoint_commit_id = CommitID{0u};
+  if (checkpoint_file >> checkpoint_commit_id) _checkpoint_commit_id = checkpoint_commit_id;
+
+  _start_segment(segment);
+
+  _is_enabled = true;
+  _writer_thread = std::thread(&WriteAheadLog::_write_loop, this);
+
+  if (checkpoint_interval > std::chrono::milliseconds{0}) {
+    _checkpoint_thread = std::make_unique<PausableLoopThread>(checkpoint_interval, [this](size_t) { checkpoint(); });
+  }
+}
+
+void WriteAheadLog::disable() {
+  if (!_is_enabled) return;
+
+  // Stop checkpointing first, as a checkpoint might be running
+  _checkpoint_thread.reset();
+
+  _is_enabled = false;
+  {
+    std::lock_guard<std::mutex> lock(_buffer_mutex);
+    _shutdown = true;
+  }
+  _records_logged.notify_one();
+  _writer_thread.join();
+
+  std::lock_guard<std::mutex> lock(_segment_mutex);
+  close(_file_descriptor);
+  _file_descriptor = -1;
+  _segment_max_commit_ids.clear();
+}
+
+bool WriteAheadLog::is_enabled() const { return _is_enabled; }
+
+const std::string& WriteAheadLog::directory() const { return _directory; }
+
+void WriteAheadLog::log_commit(const LogRecord& record, std::function<void()> on_durable) {
+  DebugAssert(_is_enabled, "The write-ahead log is not enabled.");
+
+  // Serialize outside of the lock so that committing transactions only contend for appending the bytes
+  auto serialized_record = std::vector<char>{};
+  record.serialize(serialized_record);
+
+  {
+    std::lock_guard<std::mutex> lock(_buffer_mutex);
+    _buffer.insert(_buffer.end(), serialized_record.cbegin(), serialized_record.cend());
+    _callbacks.emplace_back(std::move(on_durable));
+    _buffer_max_commit_id = std::max(_buffer_max_commit_id, record.commit_id());
+    ++_logged_count;
+  }
+  _records_logged.notify_one();
+}
+
+void WriteAheadLog::flush() {
+  std::unique_lock<std::mutex> lock(_buffer_mutex);
+  const auto logged_count = _logged_count;
+  _records_durable.wait(lock, [&]() { return _durable_count >= logged_count; });
+}
+
+CommitID WriteAheadLog::checkpoint() {
+  std::lock_guard<std::mutex> checkpoint_lock(_checkpoint_mutex);
+  Assert(_is_enabled, "Checkpoints can only be written while the write-ahead log is enabled.");
+
+  // Transactions logged from now on end up in the new segment. Transactions in the older segments might still commit
+  // after the checkpoint's commit id, so these segments are only deleted if they do not contain such transactions.
+  _start_segment(_segment + 1u);
+
+  const auto commit_id = TransactionManager::get().last_commit_id();
+  const auto checkpoint_directory = _directory + "/" + checkpoint_directory_name(commit_id);
+  const auto table_names = StorageManager::get().table_names();
+
+  // Unless nothing has been committed since the last checkpoint, write the tables into a new directory, which only
+  // replaces the previous checkpoint once it is complete
+  if (_checkpoint_commit_id != commit_id) {
+    if (access(checkpoint_directory.c_str(), F_OK) == 0) remove_directory(checkpoint_directory);
+    Assert(mkdir(checkpoint_directory.c_str(), 0755) == 0, "Could not create directory " + checkpoint_directory);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (const auto& table_name : table_names) {
+      auto job = std::make_shared<JobTask>([&, table_name]() {
+        const auto table = StorageManager::get().get_table(table_name);
+        const auto path = checkpoint_directory + "/" + table_name;
+
+        auto mvcc_file = std::ofstream{};
+        mvcc_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        mvcc_file.open(path + ".mvcc", std::ios::binary);
+        const auto snapshot = snapshot_table(*table, commit_id, mvcc_file);
+        mvcc_file.close();
+
+        auto table_wrapper = std::make_shared<TableWrapper>(snapshot);
+        table_wrapper->execute();
+        auto export_binary = std::make_shared<ExportBinary>(table_wrapper, path + ".bin", BinaryFormat::mapped);
+        export_binary->execute();
+
+        sync_path(path + ".mvcc");
+        sync_path(path + ".bin");
+      });
+      jobs.emplace_back(job);
+      job->schedule();
+    }
+    for (const auto& job : jobs) job->join();
+    sync_path(checkpoint_directory);
+
+    // Atomically replace the description of the previous checkpoint
+    const auto checkpoint_filename = _directory + "/" + CHECKPOINT_FILENAME;
+    {
+      auto checkpoint_file = std::ofstream{};
+      checkpoint_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+      checkpoint_file.open(checkpoint_filename + ".tmp");
+      checkpoint_file << commit_id << '\n';
+      for (const auto& table_name : table_names) checkpoint_file << table_name << '\n';
+    }
+    sync_path(checkpoint_filename + ".tmp");
+    Assert(rename((checkpoint_filename + ".tmp").c_str(), checkpoint_filename.c_str()) == 0,
+           "Could not replace " + checkpoint_filename);
+    sync_path(_directory);
+
+    _checkpoint_commit_id = commit_id;
+  }
+
+  // Delete everything the checkpoint makes obsolete
+  for (const auto& name : list_directory(_directory)) {
+    if (name.compare(0u, CHECKPOINT_DIRECTORY_PREFIX.size(), CHECKPOINT_DIRECTORY_PREFIX) == 0 &&
+        name != checkpoint_directory_name(commit_id)) {
+      remove_directory(_directory + "/" + name);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_segment_mutex);
+    for (auto iter = _segment_max_commit_ids.begin(); iter != _segment_max_commit_ids.end();) {
+      if (iter->first == _segment || iter->second > commit_id) {
+        ++iter;
+        continue;
+      }
+      unlink((_directory + "/" + log_segment_filename(iter->first)).c_str());
+      iter = _segment_max_commit_ids.erase(iter);
+    }
+  }
+  sync_path(_directory);
+
+  return commit_id;
+}
+
+uint64_t WriteAheadLog::sync_count() const { return _sync_count; }
+
+std::string WriteAheadLog::log_segment_filename(const uint32_t segment) {
+  return LOG_SEGMENT_PREFIX + std::to_string(segment);
+}
+
+std::string WriteAheadLog::checkpoint_directory_name(const CommitID commit_id) {
+  return CHECKPOINT_DIRECTORY_PREFIX + std::to_string(commit_id);
+}
+
+std::vector<uint32_t> WriteAheadLog::find_log_segments(const std::string& directory) {
+  auto segments = std::vector<uint32_t>{};
+  for (const auto& name : list_directory(directory)) {
+    if (name.compare(0u, LOG_SEGMENT_PREFIX.size(), LOG_SEGMENT_PREFIX) != 0) continue;
+    segments.emplace_back(static_cast<uint32_t>(std::stoul(name.substr(LOG_SEGMENT_PREFIX.size()))));
+  }
+
+  std::sort(segments.begin(), segments.end());
+  return segments;
+}
+
+void WriteAheadLog::_write_loop() {
+  auto buffer = std::vector<char>{};
+  auto callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    auto max_commit_id = CommitID{0u};
+    {
+      std::unique_lock<std::mutex> lock(_buffer_mutex);
+      _records_logged.wait(lock, [&]() { return !_callbacks.empty() || _shutdown; });
+      if (_callbacks.empty()) return;
+
+      // All records that arrived during the previous write form the next group
+      buffer.swap(_buffer);
+      callbacks.swap(_callbacks);
+      std::swap(max_commit_id, _buffer_max_commit_id);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_segment_mutex);
+
+      auto written = size_t{0u};
+      while (written < buffer.size()) {
+        const auto result = write(_file_descriptor, buffer.data() + written, buffer.size() - written);
+        Assert(result >= 0 || errno == EINTR, std::string{"Could not write the log: "} + std::strerror(errno));
+        if (result > 0) written += static_cast<size_t>(result);
+      }
+      Assert(fdatasync(_file_descriptor) == 0, std::string{"Could not sync the log: "} + std::strerror(errno));
+      ++_sync_count;
+
+      auto& segment_max_commit_id = _segment_max_commit_ids[_segment];
+      segment_max_commit_id = std::max(segment_max_commit_id, max_commit_id);
+    }
+
+    for (const auto& callback : callbacks) callback();
+
+    {
+      std::lock_guard<std::mutex> lock(_buffer_mutex);
+      _durable_count += callbacks.size();
+    }
+    _records_durable.notify_all();
+
+    buffer.clear();
+    callbacks.clear();
+  }
+}
+
+void WriteAheadLog::_start_segment(const uint32_t segment) {
+  const auto filename = _directory + "/" + log_segment_filename(segment);
+
+  std::lock_guard<std::mutex> lock(_segment_mutex);
+  if (_file_descriptor >= 0) close(_file_descriptor);
+
+  _file_descriptor = open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Could not open " + filename);
+  _segment = segment;
+  _segment_max_commit_ids.emplace(segment, CommitID{0u});
+
+  sync_path(_directory);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class LogRecord;
+struct PausableLoopThread;
+
+/**
+ * The WriteAheadLog makes committed transactions durable. It is a singleton and disabled by default.
+ *
+ * Once enabled, TransactionContext::commit_async() passes a LogRecord with the redo information of each transaction
+ * that modified data to log_commit(). The transaction only becomes visible (and its callback is only called) after
+ * the record has been written and synced to disk. Records are collected in a buffer that a background thread writes
+ * using group commit: While it waits for one fsync, newly arriving records queue up and are written with a single
+ * write and a single fsync afterwards. Thus, the number of fsyncs does not grow with the number of committing
+ * transactions, and the callbacks of a whole group are called at once.
+ *
+ * A checkpoint writes all tables of the StorageManager in the mapped binary format (see ExportBinary), together with
+ * their MVCC information, so that the log written before it can be discarded. Checkpoints are written either
+ * periodically or by calling checkpoint(). Recovery loads the most recent checkpoint and replays the log on top of it
+ * (see Recovery).
+ *
+ * All files are stored in one directory:
+ *   log_<segment>                      log records, a new segment is started with each checkpoint
+ *   checkpoint_<commit id>/<table>.bin the tables as of the checkpoint's commit id
+ *   checkpoint_<commit id>/<table>.mvcc
+ *   checkpoint                         the commit id and the tables of the most recent complete checkpoint
+ */
+class WriteAheadLog : private Noncopyable {
+ public:
+  static WriteAheadLog& get();
+
+  // Disables logging, see disable()
+  static void reset();
+
+  /**
+   * Starts logging into `directory`, which must exist. If checkpoint_interval is not zero, a checkpoint is written
+   * each time the interval has passed. A new log segment is started, i.e., existing log files are kept.
+   */
+  void enable(const std::string& directory,
+              const std::chrono::milliseconds checkpoint_interval = std::chrono::milliseconds{0});
+
+  // Waits until all records logged so far are durable and stops logging
+  void disable();
+
+  bool is_enabled() const;
+
+  const std::string& directory() const;
+
+  /**
+   * Appends the record to the log. `on_durable` is called by the log writer as soon as the record has been synced.
+   * Records do not need to be logged in commit id order.
+   */
+  void log_commit(const LogRecord& record, std::function<void()> on_durable);
+
+  // Blocks until all records logged so far are durable
+  void flush();
+
+  /**
+   * Writes a checkpoint of all tables in the StorageManager and deletes the previous checkpoint as well as all log
+   * segments that only contain transactions covered by the new one. Can be called while transactions are running.
+   *
+   * @returns the commit id of the checkpoint, i.e., the checkpoint contains the effects of all transactions up to it
+   */
+  CommitID checkpoint();
+
+  // Number of fsyncs since logging was enabled. As records are grouped, this is usually less than the record count.
+  uint64_t sync_count() const;
+
+  // Names of the files in the log directory
+  static const std::string CHECKPOINT_FILENAME;
+  static std::string log_segment_filename(const uint32_t segment);
+  static std::string checkpoint_directory_name(const CommitID commit_id);
+
+  // Returns the numbers of the log segments in `directory` in ascending order
+  static std::vector<uint32_t> find_log_segments(const std::string& directory);
+
+ private:
+  WriteAheadLog() = default;
+  ~WriteAheadLog();
+
+  void _write_loop();
+
+  // Closes the current log segment and continues logging in the next one
+  void _start_segment(const uint32_t segment);
+
+  std::string _directory;
+  std::atomic_bool _is_enabled{false};
+
+  // Protects the buffer of records that have not been written yet and the counters
+  std::mutex _buffer_mutex;
+  std::condition_variable _records_logged;
+  std::condition_variable _records_durable;
+  std::vector<char> _buffer;
+  std::vector<std::function<void()>> _callbacks;
+  CommitID _buffer_max_commit_id = 0u;
+  uint64_t _logged_count = 0u;
+  uint64_t _durable_count = 0u;
+  bool _shutdown = false;
+
+  // Protects the current segment, which is only written by the writer thread but replaced by checkpoints
+  std::mutex _segment_mutex;
+  int _file_descriptor = -1;
+  uint32_t _segment = 0u;
+  // Highest commit id in each segment that has not been deleted yet
+  std::map<uint32_t, CommitID> _segment_max_commit_ids;
+  std::atomic<uint64_t> _sync_count{0u};
+
+  std::mutex _checkpoint_mutex;
+  std::optional<CommitID> _checkpoint_commit_id;
+  std::thread _writer_thread;
+  std::unique_ptr<PausableLoopThread> _checkpoint_thread;
+};
+
+}  // namespace opossum
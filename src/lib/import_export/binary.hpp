@@ -1,9 +1,31 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace opossum {
 
-enum class BinaryColumnType : uint8_t { value_column = 0, dictionary_column = 1 };
+enum class BinaryColumnType : uint8_t {
+  value_column = 0,
+  dictionary_column = 1,
+  run_length_column = 2,
+  frame_of_reference_column = 3
+};
+
+/**
+ * The stream format is read value by value. The mapped format is a versioned extension of it, which aligns chunks to
+ * pages and the arrays of dictionary columns to MAPPED_BINARY_ALIGNMENT, so that ImportBinary can reference them in a
+ * memory mapping of the file instead of copying them (see ExportBinary for the layout).
+ */
+enum class BinaryFormat { stream, mapped };
 
 using BoolAsByteType = uint8_t;
 
+// Files in the mapped format start with this magic number, followed by MAPPED_BINARY_VERSION as uint32_t
+constexpr char MAPPED_BINARY_MAGIC[] = {'O', 'P', 'O', 'S', 'S', 'U', 'M', 'M'};
+constexpr uint32_t MAPPED_BINARY_VERSION = 1u;
+
+constexpr size_t MAPPED_BINARY_PAGE_SIZE = 4096u;
+constexpr size_t MAPPED_BINARY_ALIGNMENT = 8u;
+
 }  // namespace opossum
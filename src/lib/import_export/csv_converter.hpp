@@ -89,8 +89,8 @@ class CsvConverter : public BaseCsvConverter {
    * csv characters.
    */
   std::function<T(const std::string&)> _get_conversion_function();
-  tbb::concurrent_vector<T> _parsed_values;
-  tbb::concurrent_vector<bool> _null_values;
+  AppendOnlyVector<T> _parsed_values;
+  AppendOnlyVector<bool> _null_values;
   const bool _is_nullable;
   ParseConfig _config;
 };
@@ -33,6 +33,7 @@ enum class LQPNodeType {
   ShowTables,
   Sort,
   StoredTable,
+  TopK,
   Update,
   Union,
   Validate,
@@ -22,13 +22,17 @@ JoinNode::JoinNode(const JoinMode join_mode) : AbstractLQPNode(LQPNodeType::Join
 }
 
 JoinNode::JoinNode(const JoinMode join_mode, const LQPColumnReferencePair& join_column_references,
-                   const ScanType scan_type)
+                   const ScanType scan_type,
+                   const std::vector<LQPColumnReferencePair>& additional_join_column_references)
     : AbstractLQPNode(LQPNodeType::Join),
       _join_mode(join_mode),
       _join_column_references(join_column_references),
-      _scan_type(scan_type) {
+      _scan_type(scan_type),
+      _additional_join_column_references(additional_join_column_references) {
   DebugAssert(join_mode != JoinMode::Cross && join_mode != JoinMode::Natural,
               "Specified JoinMode must specify neither column ids nor scan type.");
+  Assert(additional_join_column_references.empty() || scan_type == ScanType::Equals,
+         "Additional join predicates are only supported for equi-joins.");
 }
 
 std::shared_ptr<AbstractLQPNode> JoinNode::_deep_copy_impl(
@@ -39,11 +43,20 @@ std::shared_ptr<AbstractLQPNode> JoinNode::_deep_copy_impl(
   } else {
     Assert(left_child(), "Can't clone without child");
 
-    const auto join_column_references = LQPColumnReferencePair{
-        adapt_column_reference_to_different_lqp(_join_column_references->first, left_child(), copied_left_child),
-        adapt_column_reference_to_different_lqp(_join_column_references->first, right_child(), copied_right_child),
+    const auto adapt_column_references = [&](const LQPColumnReferencePair& column_references) {
+      return LQPColumnReferencePair{
+          adapt_column_reference_to_different_lqp(column_references.first, left_child(), copied_left_child),
+          adapt_column_reference_to_different_lqp(column_references.second, right_child(), copied_right_child),
+      };
     };
-    return std::make_shared<JoinNode>(_join_mode, join_column_references, *_scan_type);
+
+    auto additional_join_column_references = std::vector<LQPColumnReferencePair>{};
+    for (const auto& column_references : _additional_join_column_references) {
+      additional_join_column_references.emplace_back(adapt_column_references(column_references));
+    }
+
+    return std::make_shared<JoinNode>(_join_mode, adapt_column_references(*_join_column_references), *_scan_type,
+                                      additional_join_column_references);
   }
 }
 
@@ -60,6 +73,12 @@ std::string JoinNode::description() const {
     desc << " " << _join_column_references->second.description();
   }
 
+  for (const auto& column_references : _additional_join_column_references) {
+    desc << " AND " << column_references.first.description();
+    desc << " " << scan_type_to_string.left.at(ScanType::Equals);
+    desc << " " << column_references.second.description();
+  }
+
   return desc.str();
 }
 
@@ -88,6 +107,7 @@ std::shared_ptr<TableStatistics> JoinNode::derive_statistics_from(
            "Only cross joins and joins with join column ids supported for generating join statistics");
     Assert(_scan_type, "Only cross joins and joins with scan type supported for generating join statistics");
 
+    // The statistics only consider the first predicate, so the additional ones are estimated to filter nothing
     ColumnIDPair join_colum_ids{left_child->get_output_column_id(_join_column_references->first),
                                 right_child->get_output_column_id(_join_column_references->second)};
 
@@ -102,6 +122,10 @@ const std::optional<LQPColumnReferencePair>& JoinNode::join_column_references()
 
 const std::optional<ScanType>& JoinNode::scan_type() const { return _scan_type; }
 
+const std::vector<LQPColumnReferencePair>& JoinNode::additional_join_column_references() const {
+  return _additional_join_column_references;
+}
+
 JoinMode JoinNode::join_mode() const { return _join_mode; }
 
 std::string JoinNode::get_verbose_column_name(ColumnID column_id) const {
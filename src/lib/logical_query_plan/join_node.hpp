@@ -24,11 +24,13 @@ class JoinNode : public AbstractLQPNode {
   // Constructor for Natural and Cross Joins
   explicit JoinNode(const JoinMode join_mode);
 
-  // Constructor for predicated Joins
-  JoinNode(const JoinMode join_mode, const LQPColumnReferencePair& join_column_references, const ScanType scan_type);
+  // Constructor for predicated Joins. Equi-Joins can have additional equality predicates on further column pairs.
+  JoinNode(const JoinMode join_mode, const LQPColumnReferencePair& join_column_references, const ScanType scan_type,
+           const std::vector<LQPColumnReferencePair>& additional_join_column_references = {});
 
   const std::optional<LQPColumnReferencePair>& join_column_references() const;
   const std::optional<ScanType>& scan_type() const;
+  const std::vector<LQPColumnReferencePair>& additional_join_column_references() const;
   JoinMode join_mode() const;
 
   std::string description() const override;
@@ -51,6 +53,7 @@ class JoinNode : public AbstractLQPNode {
   JoinMode _join_mode;
   std::optional<LQPColumnReferencePair> _join_column_references;
   std::optional<ScanType> _scan_type;
+  std::vector<LQPColumnReferencePair> _additional_join_column_references;
 
   mutable std::optional<std::vector<std::string>> _output_column_names;
 
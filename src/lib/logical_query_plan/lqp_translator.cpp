@@ -20,6 +20,7 @@
 #include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
+#include "operators/join_bloom_filter.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -27,12 +28,14 @@
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
+#include "operators/pipeline.hpp"
 #include "operators/pqp_expression.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
@@ -41,6 +44,7 @@
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
 #include "stored_table_node.hpp"
+#include "top_k_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 #include "utils/performance_warning.hpp"
@@ -48,6 +52,72 @@
 
 namespace opossum {
 
+namespace {
+
+/**
+ * Lets the operator that produces the probe input of a hash join drop rows without a join partner in the build input
+ * (see JoinBloomFilter). Only TableScans and Validates can apply the filter, and only if their output is not used by
+ * any other operator. Returns whether the filter was applied.
+ */
+bool apply_join_bloom_filter(const std::shared_ptr<AbstractLQPNode>& probe_node,
+                             const std::shared_ptr<AbstractOperator>& probe_operator,
+                             const std::shared_ptr<const AbstractOperator>& build_operator,
+                             const ColumnID build_column_id, const ColumnID probe_column_id) {
+  if (probe_node->parents().size() != 1) return false;
+
+  const auto join_bloom_filter = std::make_shared<JoinBloomFilter>(build_operator, build_column_id, probe_column_id);
+
+  if (const auto table_scan = std::dynamic_pointer_cast<TableScan>(probe_operator)) {
+    table_scan->set_join_bloom_filter(join_bloom_filter);
+    return true;
+  }
+
+  if (const auto validate = std::dynamic_pointer_cast<Validate>(probe_operator)) {
+    validate->set_join_bloom_filter(join_bloom_filter);
+    return true;
+  }
+
+  return false;
+}
+
+bool has_join_bloom_filter(const AbstractOperator& op) {
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&op)) return table_scan->join_bloom_filter() != nullptr;
+  if (const auto validate = dynamic_cast<const Validate*>(&op)) return validate->join_bloom_filter() != nullptr;
+  return false;
+}
+
+/**
+ * Returns a Pipeline that runs `op` on the morsels of `input`, or nullptr if `op` cannot be fused with `input`.
+ * `build_input` is the build input of `op` if it is a JoinHash that is probed with `input`.
+ */
+std::shared_ptr<AbstractOperator> fuse_with_input(const std::shared_ptr<const AbstractOperator>& input,
+                                                  const std::shared_ptr<const AbstractOperator>& op,
+                                                  const std::shared_ptr<const AbstractOperator>& build_input) {
+  // Extend the Pipeline that the input was fused into
+  if (const auto pipeline = std::dynamic_pointer_cast<const Pipeline>(input)) {
+    if (!Pipeline::can_append_stage(pipeline->stages(), *op)) return nullptr;
+
+    auto stages = pipeline->stages();
+    stages.emplace_back(op);
+    return std::make_shared<Pipeline>(pipeline->input_left(), stages,
+                                      build_input ? build_input : pipeline->input_right());
+  }
+
+  // Start a Pipeline. Single operators are not fused, as they would not benefit from it. A JoinHash that was not fused
+  // with its probe input is executed on its own.
+  const auto stages = std::vector<std::shared_ptr<const AbstractOperator>>{input, op};
+  if (!input->input_left() || std::dynamic_pointer_cast<const JoinHash>(input) ||
+      !Pipeline::can_append_stage({}, *input) || !Pipeline::can_append_stage({input}, *op)) {
+    return nullptr;
+  }
+
+  return std::make_shared<Pipeline>(input->input_left(), stages, build_input);
+}
+
+}  // namespace
+
+LQPTranslator::LQPTranslator(const bool use_pipelines) : _use_pipelines(use_pipelines) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -72,11 +142,50 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
     return iter->second;
   }
 
-  const auto pqp = _translate_by_node_type(node->type(), node);
+  auto pqp = _translate_by_node_type(node->type(), node);
+  if (_use_pipelines) pqp = _fuse_into_pipeline(node, pqp);
+
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_fuse_into_pipeline(
+    const std::shared_ptr<AbstractLQPNode>& node, const std::shared_ptr<AbstractOperator>& op) const {
+  /**
+   * A hash join is probed with the morsels of the Pipeline of its probe input, so that the probe input is neither
+   * materialized nor partitioned. Left, Semi, and Anti joins probe with their left input, Right joins with their right
+   * one. Like for the JoinBloomFilter, inner joins are assumed to have a small left and a large right input, so the
+   * right input is tried first. Joins whose inputs apply a JoinBloomFilter already drop most non-matching probe rows
+   * before the join and are not fused.
+   */
+  if (const auto join_hash = std::dynamic_pointer_cast<const JoinHash>(op)) {
+    if (node->left_child() == node->right_child() || has_join_bloom_filter(*op->input_left()) ||
+        has_join_bloom_filter(*op->input_right())) {
+      return op;
+    }
+
+    const auto mode = join_hash->mode();
+    for (const auto probe_is_left : {false, true}) {
+      if (probe_is_left ? mode == JoinMode::Right : mode != JoinMode::Inner && mode != JoinMode::Right) continue;
+
+      const auto& probe_child = probe_is_left ? node->left_child() : node->right_child();
+      if (probe_child->parents().size() > 1) continue;
+
+      const auto probe_input = probe_is_left ? op->input_left() : op->input_right();
+      const auto build_input = probe_is_left ? op->input_right() : op->input_left();
+      if (const auto pipeline = fuse_with_input(probe_input, op, build_input)) return pipeline;
+    }
+
+    return op;
+  }
+
+  const auto input = op->input_left();
+  if (!input || node->left_child()->parents().size() > 1) return op;
+
+  const auto pipeline = fuse_with_input(input, op, nullptr);
+  return pipeline ? pipeline : op;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
@@ -104,11 +213,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     PerformanceWarning("TableScan executes BETWEEN as two separate scans");
 
     auto table_scan_gt = std::make_shared<TableScan>(input_operator, column_id, ScanType::GreaterThanEquals, value);
+    table_scan_gt->set_excluded_chunk_ids(table_scan_node->excluded_chunk_ids());
 
     return std::make_shared<TableScan>(table_scan_gt, column_id, ScanType::LessThanEquals, *table_scan_node->value2());
   }
 
-  return std::make_shared<TableScan>(input_operator, column_id, table_scan_node->scan_type(), value);
+  auto table_scan = std::make_shared<TableScan>(input_operator, column_id, table_scan_node->scan_type(), value);
+  table_scan->set_excluded_chunk_ids(table_scan_node->excluded_chunk_ids());
+  return table_scan;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
@@ -125,25 +237,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_child());
 
-  /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
-   */
-
-  std::shared_ptr<AbstractOperator> result_operator;
-  const auto& definitions = sort_node->order_by_definitions();
-  if (definitions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-  for (auto it = definitions.rbegin(); it != definitions.rend(); it++) {
-    const auto& definition = *it;
-    result_operator = std::make_shared<Sort>(input_operator, node->get_output_column_id(definition.column_reference),
-                                             definition.order_by_mode);
-    input_operator = result_operator;
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (const auto& definition : sort_node->order_by_definitions()) {
+    sort_definitions.emplace_back(node->get_output_column_id(definition.column_reference), definition.order_by_mode);
   }
 
-  return result_operator;
+  return std::make_shared<Sort>(input_operator, sort_definitions);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -165,13 +264,42 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   join_column_ids.first = join_node->left_child()->get_output_column_id(join_node->join_column_references()->first);
   join_column_ids.second = join_node->right_child()->get_output_column_id(join_node->join_column_references()->second);
 
+  auto additional_join_column_ids = std::vector<ColumnIDPair>{};
+  for (const auto& [left_column_reference, right_column_reference] :
+       join_node->additional_join_column_references()) {
+    additional_join_column_ids.emplace_back(join_node->left_child()->get_output_column_id(left_column_reference),
+                                            join_node->right_child()->get_output_column_id(right_column_reference));
+  }
+
   if (*join_node->scan_type() == ScanType::Equals && join_node->join_mode() != JoinMode::Outer) {
+    /**
+     * Inner and semi joins drop rows without a join partner, so these can already be dropped by the operators that
+     * produce the inputs. A semi join always probes with its left input. For inner joins, JoinHash only decides at
+     * runtime which input it builds from. We assume the usual order of a filtered (small) left and a large right input,
+     * but try the other way around if the right input cannot apply the filter. If the build input turns out to be the
+     * larger one, the filter is not applied (see JoinBloomFilter::init()).
+     */
+    const auto left_child = join_node->left_child();
+    const auto right_child = join_node->right_child();
+    if (left_child != right_child) {
+      if (join_node->join_mode() == JoinMode::Semi) {
+        apply_join_bloom_filter(left_child, input_left_operator, input_right_operator, join_column_ids.second,
+                                join_column_ids.first);
+      } else if (join_node->join_mode() == JoinMode::Inner) {
+        if (!apply_join_bloom_filter(right_child, input_right_operator, input_left_operator, join_column_ids.first,
+                                     join_column_ids.second)) {
+          apply_join_bloom_filter(left_child, input_left_operator, input_right_operator, join_column_ids.second,
+                                  join_column_ids.first);
+        }
+      }
+    }
+
     return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode(),
-                                      join_column_ids, *(join_node->scan_type()));
+                                      join_column_ids, *(join_node->scan_type()), additional_join_column_ids);
   }
 
   return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode(),
-                                         join_column_ids, *(join_node->scan_type()));
+                                         join_column_ids, *(join_node->scan_type()), additional_join_column_ids);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
@@ -284,6 +412,19 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
   return std::make_shared<Limit>(input_operator, limit_node->num_rows());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_top_k_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = translate_node(node->left_child());
+  const auto top_k_node = std::dynamic_pointer_cast<TopKNode>(node);
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (const auto& definition : top_k_node->order_by_definitions()) {
+    sort_definitions.emplace_back(node->get_output_column_id(definition.column_reference), definition.order_by_mode);
+  }
+
+  return std::make_shared<TopK>(input_operator, sort_definitions, top_k_node->num_rows());
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_child());
@@ -327,7 +468,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_child());
-  return std::make_shared<Validate>(input_operator);
+  const auto validate_node = std::dynamic_pointer_cast<ValidateNode>(node);
+
+  auto validate = std::make_shared<Validate>(input_operator);
+  validate->set_excluded_chunk_ids(validate_node->excluded_chunk_ids());
+  return validate;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_show_tables_node(
@@ -378,6 +523,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
       return _translate_aggregate_node(node);
     case LQPNodeType::Limit:
       return _translate_limit_node(node);
+    case LQPNodeType::TopK:
+      return _translate_top_k_node(node);
     case LQPNodeType::Insert:
       return _translate_insert_node(node);
     case LQPNodeType::Delete:
@@ -17,12 +17,22 @@ class PQPExpression;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * If use_pipelines is set, chains of TableScans, Validates, and Projections are fused into Pipelines, which execute
+ * them morsel-wise (see Pipeline). Hash joins are fused into the Pipeline of their probe input. An operator is only
+ * fused with its input if no other operator consumes the input.
  */
 class LQPTranslator final : private Noncopyable {
  public:
+  explicit LQPTranslator(const bool use_pipelines = false);
+
   std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
  private:
+  // Returns a Pipeline if the operator translated from node can be fused with its input, otherwise the operator
+  std::shared_ptr<AbstractOperator> _fuse_into_pipeline(const std::shared_ptr<AbstractLQPNode>& node,
+                                                        const std::shared_ptr<AbstractOperator>& op) const;
+
   std::shared_ptr<AbstractOperator> _translate_by_node_type(LQPNodeType type,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
 
@@ -34,6 +44,7 @@ class LQPTranslator final : private Noncopyable {
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_top_k_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_dummy_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -53,6 +64,8 @@ class LQPTranslator final : private Noncopyable {
   std::shared_ptr<AbstractOperator> _translate_create_view_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_drop_view_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  const bool _use_pipelines;
+
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
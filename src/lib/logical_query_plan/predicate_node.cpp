@@ -24,9 +24,11 @@ std::shared_ptr<AbstractLQPNode> PredicateNode::_deep_copy_impl(
     const std::shared_ptr<AbstractLQPNode>& copied_left_child,
     const std::shared_ptr<AbstractLQPNode>& copied_right_child) const {
   DebugAssert(left_child(), "Can't copy without child");
-  return std::make_shared<PredicateNode>(
+  const auto copy = std::make_shared<PredicateNode>(
       adapt_column_reference_to_different_lqp(_column_reference, left_child(), copied_left_child), _scan_type, _value,
       _value2);
+  copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  return copy;
 }
 
 std::string PredicateNode::description() const {
@@ -73,6 +75,10 @@ const AllParameterVariant& PredicateNode::value() const { return _value; }
 
 const std::optional<AllTypeVariant>& PredicateNode::value2() const { return _value2; }
 
+void PredicateNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
+
+const std::vector<ChunkID>& PredicateNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
 std::shared_ptr<TableStatistics> PredicateNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_child, const std::shared_ptr<AbstractLQPNode>& right_child) const {
   DebugAssert(left_child && !right_child, "PredicateNode need left_child and no right_child");
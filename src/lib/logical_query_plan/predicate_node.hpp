@@ -33,6 +33,13 @@ class PredicateNode : public AbstractLQPNode {
   const AllParameterVariant& value() const;
   const std::optional<AllTypeVariant>& value2() const;
 
+  /**
+   * Chunks of the stored table that cannot contain matches, as determined by the ChunkPruningRule.
+   * Only set if this node directly operates on a StoredTableNode, because only then do the ChunkIDs match.
+   */
+  void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
   std::shared_ptr<TableStatistics> derive_statistics_from(
       const std::shared_ptr<AbstractLQPNode>& left_child,
       const std::shared_ptr<AbstractLQPNode>& right_child = nullptr) const override;
@@ -47,6 +54,7 @@ class PredicateNode : public AbstractLQPNode {
   const ScanType _scan_type;
   const AllParameterVariant _value;
   const std::optional<AllTypeVariant> _value2;
+  std::vector<ChunkID> _excluded_chunk_ids;
 };
 
 }  // namespace opossum
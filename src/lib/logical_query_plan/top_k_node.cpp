@@ -0,0 +1,47 @@
+#include "top_k_node.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "constant_mappings.hpp"
+
+namespace opossum {
+
+TopKNode::TopKNode(const OrderByDefinitions& order_by_definitions, const size_t num_rows)
+    : AbstractLQPNode(LQPNodeType::TopK), _order_by_definitions(order_by_definitions), _num_rows(num_rows) {}
+
+std::shared_ptr<AbstractLQPNode> TopKNode::_deep_copy_impl(
+    const std::shared_ptr<AbstractLQPNode>& copied_left_child,
+    const std::shared_ptr<AbstractLQPNode>& copied_right_child) const {
+  OrderByDefinitions order_by_definitions;
+  order_by_definitions.reserve(_order_by_definitions.size());
+
+  for (const auto& order_by_definition : _order_by_definitions) {
+    const auto column_reference =
+        adapt_column_reference_to_different_lqp(order_by_definition.column_reference, left_child(), copied_left_child);
+    order_by_definitions.emplace_back(column_reference, order_by_definition.order_by_mode);
+  }
+
+  return std::make_shared<TopKNode>(order_by_definitions, _num_rows);
+}
+
+std::string TopKNode::description() const {
+  std::ostringstream s;
+
+  s << "[TopK] " << _num_rows << " rows by ";
+
+  for (auto definition_idx = size_t{0}; definition_idx < _order_by_definitions.size(); ++definition_idx) {
+    const auto& definition = _order_by_definitions[definition_idx];
+    if (definition_idx > 0) s << ", ";
+    s << definition.column_reference.description() << " (" << order_by_mode_to_string.at(definition.order_by_mode)
+      << ")";
+  }
+
+  return s.str();
+}
+
+const OrderByDefinitions& TopKNode::order_by_definitions() const { return _order_by_definitions; }
+
+size_t TopKNode::num_rows() const { return _num_rows; }
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_lqp_node.hpp"
+#include "sort_node.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents a LimitNode on top of a SortNode, i.e., the first rows in the order of an ORDER BY clause.
+ * It is only created by the TopKRule.
+ */
+class TopKNode : public AbstractLQPNode {
+ public:
+  TopKNode(const OrderByDefinitions& order_by_definitions, const size_t num_rows);
+
+  std::string description() const override;
+
+  const OrderByDefinitions& order_by_definitions() const;
+  size_t num_rows() const;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
+      const std::shared_ptr<AbstractLQPNode>& copied_left_child,
+      const std::shared_ptr<AbstractLQPNode>& copied_right_child) const override;
+
+ private:
+  const OrderByDefinitions _order_by_definitions;
+  const size_t _num_rows;
+};
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
 #include "validate_node.hpp"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace opossum {
 
@@ -9,9 +11,15 @@ ValidateNode::ValidateNode() : AbstractLQPNode(LQPNodeType::Validate) {}
 std::shared_ptr<AbstractLQPNode> ValidateNode::_deep_copy_impl(
     const std::shared_ptr<AbstractLQPNode>& copied_left_child,
     const std::shared_ptr<AbstractLQPNode>& copied_right_child) const {
-  return std::make_shared<ValidateNode>();
+  const auto copy = std::make_shared<ValidateNode>();
+  copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  return copy;
 }
 
 std::string ValidateNode::description() const { return "[Validate]"; }
 
+void ValidateNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
+
+const std::vector<ChunkID>& ValidateNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 
@@ -15,10 +16,20 @@ class ValidateNode : public AbstractLQPNode {
 
   std::string description() const override;
 
+  /**
+   * Chunks of the stored table that cannot contain matches of the predicates above this node, as determined by the
+   * ChunkPruningRule. Only set if this node directly operates on a StoredTableNode.
+   */
+  void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
  protected:
   std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
       const std::shared_ptr<AbstractLQPNode>& copied_left_child,
       const std::shared_ptr<AbstractLQPNode>& copied_right_child) const override;
+
+ private:
+  std::vector<ChunkID> _excluded_chunk_ids;
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "constant_mappings.hpp"
 
@@ -10,10 +11,17 @@ namespace opossum {
 
 AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
                                            const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
-                                           const ColumnIDPair& column_ids, const ScanType scan_type)
-    : AbstractReadOnlyOperator(left, right), _mode(mode), _column_ids(column_ids), _scan_type(scan_type) {
+                                           const ColumnIDPair& column_ids, const ScanType scan_type,
+                                           const std::vector<ColumnIDPair>& additional_column_ids)
+    : AbstractReadOnlyOperator(left, right),
+      _mode(mode),
+      _column_ids(column_ids),
+      _scan_type(scan_type),
+      _additional_column_ids(additional_column_ids) {
   DebugAssert(mode != JoinMode::Cross && mode != JoinMode::Natural,
               "Specified JoinMode not supported by an AbstractJoin, use Product etc. instead.");
+  Assert(additional_column_ids.empty() || scan_type == ScanType::Equals,
+         "Additional join predicates are only supported for equi-joins.");
 }
 
 JoinMode AbstractJoinOperator::mode() const { return _mode; }
@@ -22,17 +30,27 @@ const ColumnIDPair& AbstractJoinOperator::column_ids() const { return _column_id
 
 ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
 
+const std::vector<ColumnIDPair>& AbstractJoinOperator::additional_column_ids() const { return _additional_column_ids; }
+
 const std::string AbstractJoinOperator::description(DescriptionMode description_mode) const {
-  std::string column_name_left = std::string("Col #") + std::to_string(_column_ids.first);
-  std::string column_name_right = std::string("Col #") + std::to_string(_column_ids.second);
+  const auto predicate_description = [&](const ColumnIDPair& column_ids, const ScanType scan_type) {
+    std::string column_name_left = std::string("Col #") + std::to_string(column_ids.first);
+    std::string column_name_right = std::string("Col #") + std::to_string(column_ids.second);
+
+    if (_input_table_left()) column_name_left = _input_table_left()->column_name(column_ids.first);
+    if (_input_table_right()) column_name_right = _input_table_right()->column_name(column_ids.second);
 
-  if (_input_table_left()) column_name_left = _input_table_left()->column_name(_column_ids.first);
-  if (_input_table_right()) column_name_right = _input_table_right()->column_name(_column_ids.second);
+    return column_name_left + " " + scan_type_to_string.left.at(scan_type) + " " + column_name_right;
+  };
 
   const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
 
-  return name() + separator + "(" + join_mode_to_string.at(_mode) + " Join where " + column_name_left + " " +
-         scan_type_to_string.left.at(_scan_type) + " " + column_name_right + ")";
+  auto predicates = predicate_description(_column_ids, _scan_type);
+  for (const auto& column_ids : _additional_column_ids) {
+    predicates += " AND " + predicate_description(column_ids, ScanType::Equals);
+  }
+
+  return name() + separator + "(" + join_mode_to_string.at(_mode) + " Join where " + predicates + ")";
 }
 
 }  // namespace opossum
@@ -12,7 +12,8 @@ namespace opossum {
 
 // operator to join two tables using one column of each table
 // output is a table with reference columns
-// to filter by multiple criteria, you can chain the operator
+// equi-joins may have additional equality predicates on further pairs of columns, which all rows of the output fulfill
+// (see NormalizedJoinKeys). To filter by other criteria, you can chain the operator
 
 // As with most operators, we do not guarantee a stable operation with regards
 // to positions - i.e., your sorting order might be disturbed
@@ -26,17 +27,20 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
  public:
   AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
                        const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
-                       const ColumnIDPair& column_ids, const ScanType scan_type);
+                       const ColumnIDPair& column_ids, const ScanType scan_type,
+                       const std::vector<ColumnIDPair>& additional_column_ids = {});
 
   JoinMode mode() const;
   const ColumnIDPair& column_ids() const;
   ScanType scan_type() const;
+  const std::vector<ColumnIDPair>& additional_column_ids() const;
   const std::string description(DescriptionMode description_mode) const override;
 
  protected:
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const ScanType _scan_type;
+  const std::vector<ColumnIDPair> _additional_column_ids;
 
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
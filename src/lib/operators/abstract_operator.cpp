@@ -38,6 +38,8 @@ void AbstractOperator::execute() {
     _output = _on_execute(nullptr);
   }
 
+  _pin_snapshots(transaction_context);
+
   // release any temporary data if possible
   _on_cleanup();
 
@@ -74,6 +76,23 @@ std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { retur
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
 
+void AbstractOperator::_pin_snapshots(const std::shared_ptr<TransactionContext>& transaction_context) {
+  if (!_output || _output->row_count() == 0u || _output->get_type() != TableType::References) return;
+
+  // Tables that are passed through unchanged have been pinned by the operator that created them
+  const auto input_left = _input_left ? _input_table_left() : nullptr;
+  const auto input_right = _input_right ? _input_table_right() : nullptr;
+  if (_output == input_left || _output == input_right) return;
+
+  // The output is not visible to other operators before execute() returns
+  const auto output = std::const_pointer_cast<Table>(_output);
+  if (transaction_context) output->add_snapshot_pin(transaction_context->snapshot_pin());
+  for (const auto& input : {input_left, input_right}) {
+    if (!input) continue;
+    for (const auto& snapshot_pin : input->snapshot_pins()) output->add_snapshot_pin(snapshot_pin);
+  }
+}
+
 std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const {
   // https://stackoverflow.com/questions/45507041/how-to-check-if-weak-ptr-is-empty-non-assigned
   DebugAssert(
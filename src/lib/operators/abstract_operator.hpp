@@ -98,6 +98,10 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
+  // Pins the snapshots the output was read under, so that the chunks its ReferenceColumns point to outlive the
+  // transaction (see Table::add_snapshot_pin())
+  void _pin_snapshots(const std::shared_ptr<TransactionContext>& transaction_context);
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _input_left;
   std::shared_ptr<const AbstractOperator> _input_right;
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "storage/reference_column.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -10,4 +11,22 @@ std::shared_ptr<const Table> AbstractReadOnlyOperator::_on_execute(std::shared_p
   return _on_execute();
 }
 
+std::shared_ptr<Chunk> AbstractReadOnlyOperator::_create_empty_reference_chunk(
+    const std::shared_ptr<const Table>& in_table) {
+  const auto chunk_in = in_table->get_chunk(ChunkID{0});
+  const auto pos_list = std::make_shared<PosList>();
+
+  auto chunk_out = std::make_shared<Chunk>();
+  for (ColumnID column_id{0}; column_id < in_table->column_count(); ++column_id) {
+    if (const auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id))) {
+      chunk_out->add_column(std::make_shared<ReferenceColumn>(ref_column->referenced_table(),
+                                                              ref_column->referenced_column_id(), pos_list));
+    } else {
+      chunk_out->add_column(std::make_shared<ReferenceColumn>(in_table, column_id, pos_list));
+    }
+  }
+
+  return chunk_out;
+}
+
 }  // namespace opossum
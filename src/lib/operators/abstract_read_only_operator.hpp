@@ -23,6 +23,11 @@ class AbstractReadOnlyOperator : public AbstractOperator {
 
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // Creates a chunk without rows whose ReferenceColumns point to the columns of `in_table` (or to the columns referenced
+  // by it). Operators that skip chunks of their input use it to keep the layout of their output if all chunks were
+  // skipped.
+  static std::shared_ptr<Chunk> _create_empty_reference_chunk(const std::shared_ptr<const Table>& in_table);
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in table_scan.hpp.
@@ -30,6 +35,11 @@ class AbstractReadOnlyOperator : public AbstractOperator {
    public:
     virtual ~AbstractReadOnlyOperatorImpl() = default;
     virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // Creates a chunk without rows whose ReferenceColumns point to the columns of `in_table` (or to the columns referenced
+  // by it). Operators that skip chunks of their input use it to keep the layout of their output if all chunks were
+  // skipped.
+  static std::shared_ptr<Chunk> _create_empty_reference_chunk(const std::shared_ptr<const Table>& in_table);
   };
 };
 
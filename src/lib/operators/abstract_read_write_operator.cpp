@@ -46,6 +46,12 @@ void AbstractReadWriteOperator::rollback_records() {
   _state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::log_records(LogRecord& record) const {
+  Assert(_state == ReadWriteOperatorState::Committed, "Only committed changes can be logged.");
+
+  _on_log_records(record);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _state == ReadWriteOperatorState::Failed || _state == ReadWriteOperatorState::RolledBack;
 }
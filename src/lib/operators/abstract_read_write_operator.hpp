@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+class LogRecord;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -48,6 +50,11 @@ class AbstractReadWriteOperator : public AbstractOperator,
    */
   void rollback_records();
 
+  /**
+   * Adds the redo information of the committed changes to the record of the transaction (see WriteAheadLog).
+   */
+  void log_records(LogRecord& record) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -81,6 +88,12 @@ class AbstractReadWriteOperator : public AbstractOperator,
    */
   virtual void _finish_commit() {}
 
+  /**
+   * Called by log_records. Operators that only consist of other read/write operators (i.e., Update) do not need to
+   * log anything themselves.
+   */
+  virtual void _on_log_records(LogRecord& record) const {}
+
   /**
    * Called by rollback_records.
    */
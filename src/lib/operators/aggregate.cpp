@@ -1,10 +1,13 @@
 #include "aggregate.hpp"
 
 #include <algorithm>
-#include <map>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -13,9 +16,13 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/iterables/attribute_vector_iterable.hpp"
 #include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/key_hash.hpp"
 
 namespace opossum {
 
@@ -70,53 +77,303 @@ std::shared_ptr<AbstractOperator> Aggregate::recreate(const std::vector<AllParam
   return std::make_shared<Aggregate>(_input_left->recreate(args), _aggregates, _groupby_column_ids);
 }
 
-/*
-Visitor context for the partitioning/grouping visitor
-*/
-struct GroupByContext : ColumnVisitableContext {
-  GroupByContext(std::shared_ptr<const Table> t, ChunkID chunk, ColumnID column,
-                 std::shared_ptr<std::vector<AggregateKey>> keys)
-      : table_in(t), chunk_id(chunk), column_id(column), hash_keys(keys) {}
-
-  // constructor for use in ReferenceColumn::visit_dereferenced
-  GroupByContext(std::shared_ptr<BaseColumn>, const std::shared_ptr<const Table> referenced_table,
-                 std::shared_ptr<ColumnVisitableContext> base_context, ChunkID chunk_id,
-                 std::shared_ptr<std::vector<ChunkOffset>> chunk_offsets)
-      : table_in(referenced_table),
-        chunk_id(chunk_id),
-        column_id(std::static_pointer_cast<GroupByContext>(base_context)->column_id),
-        hash_keys(std::static_pointer_cast<GroupByContext>(base_context)->hash_keys),
-        chunk_offsets_in(chunk_offsets) {}
-
-  std::shared_ptr<const Table> table_in;
-  ChunkID chunk_id;
-  const ColumnID column_id;
-  std::shared_ptr<std::vector<AggregateKey>> hash_keys;
-  std::shared_ptr<std::vector<ChunkOffset>> chunk_offsets_in;
+namespace {
+
+// Groups of a chunk or of a partition
+using GroupID = uint32_t;
+
+constexpr auto INVALID_GROUP_ID = std::numeric_limits<GroupID>::max();
+
+// At most 2^6 partitions are merged in parallel
+constexpr auto MAX_PARTITION_BITS = size_t{6};
+
+// Chunks are grouped by ValueIDs if their dictionaries have at most max(chunk size, 2^12) combinations of ValueIDs
+constexpr auto MIN_DENSE_GROUP_LIMIT = size_t{1} << 12u;
+
+/**
+ * Open-addressing hash table that assigns consecutive GroupIDs to the distinct keys inserted into it. The keys are
+ * stored one after another, so that the groups can be iterated in the order of their GroupIDs.
+ */
+class GroupKeyTable {
+ public:
+  explicit GroupKeyTable(const size_t key_width) : _key_width(key_width), _slots(16u, INVALID_GROUP_ID) {}
+
+  GroupID find_or_insert(const uint64_t* key, const uint64_t hash) {
+    const auto mask = _slots.size() - 1;
+
+    auto slot_index = hash & mask;
+    while (_slots[slot_index] != INVALID_GROUP_ID) {
+      const auto group_id = _slots[slot_index];
+      if (_hashes[group_id] == hash && std::equal(key, key + _key_width, this->key(group_id))) return group_id;
+      slot_index = (slot_index + 1) & mask;
+    }
+
+    const auto group_id = static_cast<GroupID>(_hashes.size());
+    _slots[slot_index] = group_id;
+    _hashes.emplace_back(hash);
+    _keys.insert(_keys.end(), key, key + _key_width);
+
+    // Keep the load factor at or below 1/2
+    if (_hashes.size() * 2 > _slots.size()) _grow();
+
+    return group_id;
+  }
+
+  size_t size() const { return _hashes.size(); }
+
+  const uint64_t* key(const GroupID group_id) const { return _keys.data() + group_id * _key_width; }
+
+  uint64_t hash(const GroupID group_id) const { return _hashes[group_id]; }
+
+ protected:
+  void _grow() {
+    _slots = std::vector<GroupID>(_slots.size() * 2, INVALID_GROUP_ID);
+    const auto mask = _slots.size() - 1;
+
+    for (GroupID group_id{0}; group_id < _hashes.size(); ++group_id) {
+      auto slot_index = _hashes[group_id] & mask;
+      while (_slots[slot_index] != INVALID_GROUP_ID) slot_index = (slot_index + 1) & mask;
+      _slots[slot_index] = group_id;
+    }
+  }
+
+  size_t _key_width;
+  std::vector<uint64_t> _keys;
+  std::vector<uint64_t> _hashes;
+  std::vector<GroupID> _slots;
 };
 
-/*
-Visitor context for the AggregateVisitor.
-*/
-template <typename ColumnType, typename AggregateType>
-struct AggregateContext : ColumnVisitableContext {
-  AggregateContext() {}
-  explicit AggregateContext(std::shared_ptr<GroupByContext> base_context) : groupby_context(base_context) {}
-
-  // constructor for use in ReferenceColumn::visit_dereferenced
-  AggregateContext(std::shared_ptr<BaseColumn>, const std::shared_ptr<const Table>,
-                   std::shared_ptr<ColumnVisitableContext> base_context, ChunkID chunk_id,
-                   std::shared_ptr<std::vector<ChunkOffset>> chunk_offsets)
-      : groupby_context(std::static_pointer_cast<AggregateContext>(base_context)->groupby_context),
-        results(std::static_pointer_cast<AggregateContext>(base_context)->results) {
-    groupby_context->chunk_id = chunk_id;
-    groupby_context->chunk_offsets_in = chunk_offsets;
+template <typename T>
+uint64_t encode_value(const T& value) {
+  if constexpr (std::is_integral<T>::value) {
+    return static_cast<uint64_t>(static_cast<int64_t>(value));
+  } else {
+    // -0.0 and 0.0 belong to the same group
+    const auto normalized_value = normalize_key_value(value);
+    auto word = uint64_t{0};
+    std::memcpy(&word, &normalized_value, sizeof(T));
+    return word;
   }
+}
 
-  std::shared_ptr<GroupByContext> groupby_context;
-  std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results;
+template <typename T>
+T decode_value(const uint64_t word) {
+  if constexpr (std::is_integral<T>::value) {
+    return static_cast<T>(static_cast<int64_t>(word));
+  } else {
+    auto value = T{};
+    std::memcpy(&value, &word, sizeof(T));
+    return value;
+  }
+}
+
+/**
+ * Assigns consecutive indices to the strings of a group-by column, which are then used as their key words. The chunks
+ * collect their distinct strings first and only lock the dictionary once to look all of them up.
+ */
+struct StringGroupDictionary {
+  // The caller has to hold the mutex
+  uint64_t index(const std::string& value) {
+    const auto [iter, inserted] = indices.try_emplace(value, values.size());
+    if (inserted) values.emplace_back(value);
+    return iter->second;
+  }
+
+  std::mutex mutex;
+  std::unordered_map<std::string, uint64_t> indices;
+  std::vector<std::string> values;
 };
 
+// The key words of the values of a dictionary, indexed by their ValueIDs
+template <typename ColumnDataType>
+std::vector<uint64_t> dictionary_key_words(const DictionaryColumn<ColumnDataType>& column,
+                                           StringGroupDictionary& string_dictionary) {
+  const auto& dictionary = *column.dictionary();
+  auto value_id_words = std::vector<uint64_t>{};
+  value_id_words.reserve(dictionary.size());
+
+  if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+    std::lock_guard<std::mutex> lock(string_dictionary.mutex);
+    for (const auto& value : dictionary) value_id_words.emplace_back(string_dictionary.index(value));
+  } else {
+    for (const auto& value : dictionary) value_id_words.emplace_back(encode_value(value));
+  }
+
+  return value_id_words;
+}
+
+/**
+ * Writes the key words of the group-by column with the index `column_index` into the keys of the rows of a chunk.
+ * NULLs are marked in the last word of the key and leave the column's word at 0.
+ */
+template <typename ColumnDataType>
+void encode_groupby_column(const BaseColumn& base_column, const size_t column_index, const size_t key_width,
+                           const bool has_null_word, StringGroupDictionary& string_dictionary,
+                           std::vector<uint64_t>& keys) {
+  const auto set_null = [&](const size_t row) {
+    DebugAssert(has_null_word, "Aggregate: Found NULL in group-by column that is not nullable");
+    keys[row * key_width + key_width - 1] |= uint64_t{1} << column_index;
+  };
+
+  resolve_column_type<ColumnDataType>(base_column, [&](const auto& typed_column) {
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+
+    if constexpr (std::is_same<ColumnType, DictionaryColumn<ColumnDataType>>::value) {
+      // Translate the dictionary into key words once and then only look up the ValueIDs of the rows
+      const auto value_id_words = dictionary_key_words(typed_column, string_dictionary);
+
+      auto row = size_t{0};
+      auto iterable = AttributeVectorIterable{*typed_column.attribute_vector()};
+      iterable.for_each([&](const auto& value_id) {
+        if (value_id.is_null()) {
+          set_null(row);
+        } else {
+          keys[row * key_width + column_index] = value_id_words[value_id.value()];
+        }
+        ++row;
+      });
+    } else if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+      // Number the distinct strings of the chunk first and translate them into the indices of the dictionary afterwards
+      auto chunk_indices = std::unordered_map<std::string, uint64_t>{};
+      auto null_rows = std::vector<bool>(keys.size() / key_width);
+
+      auto row = size_t{0};
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        if (value.is_null()) {
+          set_null(row);
+          null_rows[row] = true;
+        } else {
+          const auto [iter, inserted] = chunk_indices.try_emplace(value.value(), chunk_indices.size());
+          keys[row * key_width + column_index] = iter->second;
+        }
+        ++row;
+      });
+
+      auto dictionary_indices = std::vector<uint64_t>(chunk_indices.size());
+      {
+        std::lock_guard<std::mutex> lock(string_dictionary.mutex);
+        for (const auto& [value, chunk_index] : chunk_indices) {
+          dictionary_indices[chunk_index] = string_dictionary.index(value);
+        }
+      }
+
+      for (auto row_index = size_t{0}; row_index < null_rows.size(); ++row_index) {
+        if (null_rows[row_index]) continue;
+        auto& word = keys[row_index * key_width + column_index];
+        word = dictionary_indices[word];
+      }
+    } else {
+      auto row = size_t{0};
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        if (value.is_null()) {
+          set_null(row);
+        } else {
+          keys[row * key_width + column_index] = encode_value(value.value());
+        }
+        ++row;
+      });
+    }
+  });
+}
+
+/**
+ * Groups the rows of a chunk whose group-by columns are all DictionaryColumns without hashing them: The ValueIDs of a
+ * row (or the dictionary size for NULL) are combined into an index into a dense array that holds the GroupIDs. Only the
+ * first row of each group is encoded into a key and inserted into `groups`. Returns false if any group-by column is not
+ * a DictionaryColumn or if there are too many combinations of ValueIDs.
+ */
+bool group_by_value_ids(const Table& table, const Chunk& chunk, const std::vector<ColumnID>& groupby_column_ids,
+                        const size_t key_width, const bool has_null_word,
+                        std::vector<StringGroupDictionary>& string_dictionaries, GroupKeyTable& groups,
+                        std::vector<GroupID>& row_groups) {
+  const auto chunk_size = chunk.size();
+  const auto dense_group_limit = std::max(static_cast<size_t>(chunk_size), MIN_DENSE_GROUP_LIMIT);
+
+  // The attribute vector, the number of ValueIDs including the one for NULL, and the key words of each column
+  auto attribute_vectors = std::vector<std::shared_ptr<const BaseAttributeVector>>{};
+  auto value_id_counts = std::vector<size_t>{};
+  auto dense_group_count = size_t{1};
+
+  for (const auto column_id : groupby_column_ids) {
+    auto is_dictionary_column = false;
+
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto column =
+          std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(chunk.get_column(column_id));
+      if (!column) return;
+
+      is_dictionary_column = true;
+      attribute_vectors.emplace_back(column->attribute_vector());
+      value_id_counts.emplace_back(column->unique_values_count() + 1);
+    });
+
+    if (!is_dictionary_column) return false;
+
+    dense_group_count *= value_id_counts.back();
+    if (dense_group_count > dense_group_limit) return false;
+  }
+
+  // Combine the ValueIDs of each row column by column
+  auto dense_indices = std::vector<uint32_t>(chunk_size);
+  for (auto column_index = size_t{0}; column_index < attribute_vectors.size(); ++column_index) {
+    const auto null_value_id = static_cast<uint32_t>(value_id_counts[column_index] - 1);
+    const auto value_id_count = static_cast<uint32_t>(value_id_counts[column_index]);
+
+    auto row = size_t{0};
+    auto iterable = AttributeVectorIterable{*attribute_vectors[column_index]};
+    iterable.for_each([&](const auto& value_id) {
+      const auto digit = value_id.is_null() ? null_value_id : static_cast<uint32_t>(value_id.value());
+      dense_indices[row] = dense_indices[row] * value_id_count + digit;
+      ++row;
+    });
+  }
+
+  auto value_id_words = std::vector<std::vector<uint64_t>>(groupby_column_ids.size());
+  for (auto column_index = size_t{0}; column_index < groupby_column_ids.size(); ++column_index) {
+    const auto column_id = groupby_column_ids[column_index];
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto& column = static_cast<const DictionaryColumn<ColumnDataType>&>(*chunk.get_column(column_id));
+      value_id_words[column_index] = dictionary_key_words(column, string_dictionaries[column_index]);
+    });
+  }
+
+  auto dense_groups = std::vector<GroupID>(dense_group_count, INVALID_GROUP_ID);
+  auto key = std::vector<uint64_t>(key_width);
+
+  for (auto row = size_t{0}; row < chunk_size; ++row) {
+    auto& group_id = dense_groups[dense_indices[row]];
+
+    if (group_id == INVALID_GROUP_ID) {
+      // Split the dense index into the ValueIDs of the columns again, starting with the last column
+      std::fill(key.begin(), key.end(), uint64_t{0});
+      auto dense_index = dense_indices[row];
+      for (auto column_index = groupby_column_ids.size(); column_index-- > 0;) {
+        const auto value_id = dense_index % value_id_counts[column_index];
+        dense_index /= value_id_counts[column_index];
+
+        if (value_id == value_id_counts[column_index] - 1) {
+          DebugAssert(has_null_word, "Aggregate: Found NULL in group-by column that is not nullable");
+          key[key_width - 1] |= uint64_t{1} << column_index;
+        } else {
+          key[column_index] = value_id_words[column_index][value_id];
+        }
+      }
+
+      // Different ValueIDs can still have the same key (e.g., for -0.0 and 0.0)
+      group_id = groups.find_or_insert(key.data(), hash_key_words(key.data(), key_width));
+    }
+
+    row_groups[row] = group_id;
+  }
+
+  return true;
+}
+
 /*
 The following structs describe the different aggregate traits.
 Given a ColumnType and AggregateFunction, certain traits like the aggregate type
@@ -192,137 +449,247 @@ struct AggregateTraits<ColumnType, function, typename std::enable_if_t<!std::is_
   static constexpr DataType aggregate_data_type = DataType::Null;
 };
 
-/*
-The AggregateFunctionBuilder is used to create the lambda function that will be used by
-the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
-Therefore, we partially specialize the whole class and define the get_aggregate_function anew every time.
-*/
-template <typename ColumnType, typename AggregateType>
-using AggregateFunctor = std::function<std::optional<AggregateType>(ColumnType, std::optional<AggregateType>)>;
+/**
+ * The AggregateResults of all groups of a chunk or of a partition for one aggregate column
+ */
+class BaseAggregateStates {
+ public:
+  virtual ~BaseAggregateStates() = default;
 
-template <typename ColumnType, typename AggregateType, AggregateFunction function>
-struct AggregateFunctionBuilder {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() { Fail("Invalid aggregate function"); }
+  virtual void resize(const size_t group_count) = 0;
+
+  // Aggregates the values of a column of a chunk, or only counts its rows if `column` is nullptr (i.e., for COUNT(*))
+  virtual void aggregate(const BaseColumn* column, const std::vector<GroupID>& row_groups,
+                         const size_t group_count) = 0;
+
+  // Merges the results of the groups of `other` into those of the groups of this, given as (other group, group) pairs
+  virtual void merge(const BaseAggregateStates& other, const std::vector<std::pair<GroupID, GroupID>>& group_pairs) = 0;
+
+  virtual DataType data_type() const = 0;
+  virtual bool is_nullable() const = 0;
+
+  // Writes the aggregates of all groups of all partitions, in this order, into a ValueColumn
+  virtual std::shared_ptr<BaseColumn> make_output_column(
+      const std::vector<const BaseAggregateStates*>& partition_states, const size_t group_count) const = 0;
 };
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Min> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      if (!current_aggregate || value_smaller(new_value, *current_aggregate)) {
-        // New minimum found
-        return new_value;
+template <typename ColumnDataType, AggregateFunction function>
+class AggregateStates : public BaseAggregateStates {
+ public:
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::aggregate_type;
+  using Result = AggregateResult<AggregateType, ColumnDataType>;
+
+  static constexpr auto NULLABLE = function != AggregateFunction::Count && function != AggregateFunction::CountDistinct;
+
+  void resize(const size_t group_count) override { _results.resize(group_count); }
+
+  void aggregate(const BaseColumn* column, const std::vector<GroupID>& row_groups, const size_t group_count) override {
+    _results.resize(group_count);
+
+    if (!column) {
+      for (const auto group_id : row_groups) ++_results[group_id].aggregate_count;
+      return;
+    }
+
+    resolve_column_type<ColumnDataType>(*column, [&](const auto& typed_column) {
+      using ColumnType = std::decay_t<decltype(typed_column)>;
+
+      if constexpr (std::is_same<ColumnType, DictionaryColumn<ColumnDataType>>::value &&
+                    (function == AggregateFunction::Min || function == AggregateFunction::Max ||
+                     function == AggregateFunction::Count)) {
+        _aggregate_value_ids(typed_column, row_groups, group_count);
+      } else {
+        auto row = size_t{0};
+        auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+        iterable.for_each([&](const auto& value) {
+          // NULLs do not change the aggregate, but the group still exists
+          auto& result = _results[row_groups[row++]];
+          if (value.is_null()) return;
+
+          ++result.aggregate_count;
+          _add_value(result, value.value());
+        });
       }
-      return *current_aggregate;
-    };
+    });
   }
-};
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Max> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      if (!current_aggregate || value_greater(new_value, *current_aggregate)) {
-        // New maximum found
-        return new_value;
+  void merge(const BaseAggregateStates& other, const std::vector<std::pair<GroupID, GroupID>>& group_pairs) override {
+    const auto& other_results = static_cast<const AggregateStates&>(other)._results;
+
+    for (const auto& [other_group_id, group_id] : group_pairs) {
+      auto& result = _results[group_id];
+      const auto& other_result = other_results[other_group_id];
+
+      result.aggregate_count += other_result.aggregate_count;
+
+      if constexpr (function == AggregateFunction::CountDistinct) {
+        result.distinct_values.insert(other_result.distinct_values.cbegin(), other_result.distinct_values.cend());
       }
-      return *current_aggregate;
-    };
-  }
-};
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Sum> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      // add new value to sum
-      return new_value + (!current_aggregate ? 0 : *current_aggregate);
-    };
-  }
-};
+      if (!other_result.current_aggregate) continue;
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Avg> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      // add new value to sum
-      return new_value + (!current_aggregate ? 0 : *current_aggregate);
-    };
+      if (!result.current_aggregate) {
+        result.current_aggregate = other_result.current_aggregate;
+      } else if constexpr (function == AggregateFunction::Min) {
+        if (value_smaller(*other_result.current_aggregate, *result.current_aggregate)) {
+          result.current_aggregate = other_result.current_aggregate;
+        }
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (value_greater(*other_result.current_aggregate, *result.current_aggregate)) {
+          result.current_aggregate = other_result.current_aggregate;
+        }
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        *result.current_aggregate += *other_result.current_aggregate;
+      }
+    }
   }
-};
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Count> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType, std::optional<AggregateType> current_aggregate) { return std::nullopt; };
-  }
-};
+  DataType data_type() const override { return data_type_from_type<AggregateType>(); }
+
+  bool is_nullable() const override { return NULLABLE; }
+
+  std::shared_ptr<BaseColumn> make_output_column(const std::vector<const BaseAggregateStates*>& partition_states,
+                                                 const size_t group_count) const override {
+    auto values = AppendOnlyVector<AggregateType>(group_count);
+    auto null_values = AppendOnlyVector<bool>(NULLABLE ? group_count : 0u);
+
+    auto output_offset = size_t{0};
+    for (const auto* states : partition_states) {
+      for (const auto& result : static_cast<const AggregateStates*>(states)->_results) {
+        if constexpr (function == AggregateFunction::Count) {
+          values[output_offset] = result.aggregate_count;
+        } else if constexpr (function == AggregateFunction::CountDistinct) {
+          values[output_offset] = result.distinct_values.size();
+        } else {
+          if (!result.current_aggregate) {
+            null_values[output_offset] = true;
+          } else if constexpr (function == AggregateFunction::Avg) {
+            values[output_offset] = *result.current_aggregate / static_cast<AggregateType>(result.aggregate_count);
+          } else {
+            values[output_offset] = *result.current_aggregate;
+          }
+        }
+        ++output_offset;
+      }
+    }
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::CountDistinct> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType, std::optional<AggregateType> current_aggregate) { return std::nullopt; };
+    if constexpr (NULLABLE) {
+      return std::make_shared<ValueColumn<AggregateType>>(std::move(values), std::move(null_values));
+    } else {
+      return std::make_shared<ValueColumn<AggregateType>>(std::move(values));
+    }
   }
-};
 
-template <typename ColumnDataType, AggregateFunction function>
-void Aggregate::_aggregate_column(ChunkID chunk_id, ColumnID column_index, const BaseColumn& base_column) {
-  using AggregateType = typename AggregateTraits<ColumnDataType, function>::aggregate_type;
+ protected:
+  static void _add_value(Result& result, const ColumnDataType& value) {
+    if constexpr (function == AggregateFunction::Min) {
+      if (!result.current_aggregate || value_smaller(value, *result.current_aggregate)) {
+        result.current_aggregate = value;
+      }
+    } else if constexpr (function == AggregateFunction::Max) {
+      if (!result.current_aggregate || value_greater(value, *result.current_aggregate)) {
+        result.current_aggregate = value;
+      }
+    } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      result.current_aggregate = value + (result.current_aggregate ? *result.current_aggregate : 0);
+    } else if constexpr (function == AggregateFunction::CountDistinct) {
+      result.distinct_values.insert(value);
+    }
+  }
 
-  auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+  // Dictionaries are sorted, so MIN and MAX compare the ValueIDs of a group and only decode the one of its result
+  void _aggregate_value_ids(const DictionaryColumn<ColumnDataType>& column, const std::vector<GroupID>& row_groups,
+                            const size_t group_count) {
+    // NULL_VALUE_ID is greater than all other ValueIDs and marks groups without values
+    auto group_value_ids = std::vector<ValueID>(function == AggregateFunction::Count ? 0u : group_count, NULL_VALUE_ID);
+
+    auto row = size_t{0};
+    auto iterable = AttributeVectorIterable{*column.attribute_vector()};
+    iterable.for_each([&](const auto& value_id) {
+      const auto group_id = row_groups[row++];
+      if (value_id.is_null()) return;
+
+      ++_results[group_id].aggregate_count;
+
+      if constexpr (function == AggregateFunction::Min) {
+        group_value_ids[group_id] = std::min(group_value_ids[group_id], value_id.value());
+      } else if constexpr (function == AggregateFunction::Max) {
+        auto& group_value_id = group_value_ids[group_id];
+        if (group_value_id == NULL_VALUE_ID || value_id.value() > group_value_id) group_value_id = value_id.value();
+      }
+    });
 
-  // create context if it doesn't exist yet
-  if (!_contexts_per_column[column_index]) {
-    _contexts_per_column[column_index] = std::make_shared<AggregateContext<ColumnDataType, AggregateType>>();
+    const auto& dictionary = *column.dictionary();
+    for (auto group_id = size_t{0}; group_id < group_value_ids.size(); ++group_id) {
+      const auto value_id = group_value_ids[group_id];
+      if (value_id != NULL_VALUE_ID) _add_value(_results[group_id], dictionary[value_id]);
+    }
   }
 
-  auto& context =
-      *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType>>(_contexts_per_column[column_index]);
+  std::vector<Result> _results;
+};
 
-  if (!context.results) {
-    context.results = std::make_shared<std::map<AggregateKey, AggregateResult<AggregateType, ColumnDataType>>>();
+template <typename ColumnDataType, AggregateFunction function>
+std::unique_ptr<BaseAggregateStates> make_aggregate_states() {
+  if constexpr (!std::is_arithmetic<ColumnDataType>::value &&
+                (function == AggregateFunction::Sum || function == AggregateFunction::Avg)) {
+    Fail("Aggregate: Cannot calculate SUM or AVG on string column");
+  } else {
+    return std::make_unique<AggregateStates<ColumnDataType, function>>();
   }
+}
 
-  auto& results = *context.results;
-  auto& hash_keys = _keys_per_chunk[chunk_id];
+std::unique_ptr<BaseAggregateStates> make_aggregate_states(const DataType data_type, const AggregateFunction function) {
+  auto states = std::unique_ptr<BaseAggregateStates>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (function) {
+      case AggregateFunction::Min:
+        states = make_aggregate_states<ColumnDataType, AggregateFunction::Min>();
+        break;
+      case AggregateFunction::Max:
+        states = make_aggregate_states<ColumnDataType, AggregateFunction::Max>();
+        break;
+      case AggregateFunction::Sum:
+        states = make_aggregate_states<ColumnDataType, AggregateFunction::Sum>();
+        break;
+      case AggregateFunction::Avg:
+        states = make_aggregate_states<ColumnDataType, AggregateFunction::Avg>();
+        break;
+      case AggregateFunction::Count:
+        states = make_aggregate_states<ColumnDataType, AggregateFunction::Count>();
+        break;
+      case AggregateFunction::CountDistinct:
+        states = make_aggregate_states<ColumnDataType, AggregateFunction::CountDistinct>();
+        break;
+    }
+  });
 
-  resolve_column_type<ColumnDataType>(base_column, [&results, &hash_keys, aggregator](const auto& typed_column) {
-    auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+  return states;
+}
 
-    ChunkOffset chunk_offset{0};
+// The groups of a chunk or of a partition together with their AggregateResults, one BaseAggregateStates per aggregate
+struct Groups {
+  GroupKeyTable keys;
+  std::vector<std::unique_ptr<BaseAggregateStates>> states;
+};
 
-    // Now that all relevant types have been resolved, we can iterate over the column and build the aggregations.
-    iterable.for_each([&, aggregator](const auto& value) {
-      if (value.is_null()) {
-        /**
-         * If the value is NULL, the current aggregate value does not change.
-         * However, if we do not have a result entry for the current hash key, i.e., group value,
-         * we need to insert an empty AggregateResult into the results.
-         * Hence, the try_emplace with no constructing arguments.
-         */
-        results.try_emplace((*hash_keys)[chunk_offset]);
-      } else {
-        // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-        results[(*hash_keys)[chunk_offset]].current_aggregate =
-            aggregator(value.value(), results[(*hash_keys)[chunk_offset]].current_aggregate);
+}  // namespace
 
-        // increase value counter
-        ++results[(*hash_keys)[chunk_offset]].aggregate_count;
+std::string Aggregate::_aggregate_column_name(const AggregateColumnDefinition& aggregate) const {
+  if (aggregate.alias) return *aggregate.alias;
+  if (!aggregate.column) return "COUNT(*)";
 
-        if (function == AggregateFunction::CountDistinct) {
-          // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-          results[(*hash_keys)[chunk_offset]].distinct_values.insert(value.value());
-        }
-      }
+  const auto& column_name = _input_table_left()->column_name(*aggregate.column);
+  if (aggregate.function == AggregateFunction::CountDistinct) return "COUNT(DISTINCT " + column_name + ")";
 
-      ++chunk_offset;
-    });
-  });
+  return aggregate_function_to_string.left.at(aggregate.function) + "(" + column_name + ")";
 }
 
 std::shared_ptr<const Table> Aggregate::_on_execute() {
-  auto input_table = _input_table_left();
-  _out_chunk = std::make_shared<Chunk>();
+  const auto input_table = _input_table_left();
 
   // check for invalid aggregates
   for (const auto& aggregate : _aggregates) {
@@ -336,47 +703,86 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
     }
   }
 
+  const auto groupby_column_count = _groupby_column_ids.size();
+  const auto has_null_word =
+      std::any_of(_groupby_column_ids.cbegin(), _groupby_column_ids.cend(),
+                  [&](const ColumnID column_id) { return input_table->column_is_nullable(column_id); });
+  Assert(!has_null_word || groupby_column_count <= 64u, "Aggregate: Cannot group by more than 64 nullable columns");
+  const auto key_width = groupby_column_count + (has_null_word ? 1u : 0u);
+
+  auto string_dictionaries = std::vector<StringGroupDictionary>(groupby_column_count);
+
+  const auto make_groups = [&]() {
+    auto groups = Groups{GroupKeyTable{key_width}, {}};
+    for (const auto& aggregate : _aggregates) {
+      // COUNT(*) counts rows of a dummy int column, because it does not have a column
+      const auto data_type = aggregate.column ? input_table->column_type(*aggregate.column) : DataType::Int;
+      groups.states.emplace_back(make_aggregate_states(data_type, aggregate.function));
+    }
+    return groups;
+  };
+
+  // Use enough partitions to merge the groups of many chunks in parallel
+  const auto chunk_count = input_table->chunk_count();
+  auto partition_bits = size_t{0};
+  while (partition_bits < MAX_PARTITION_BITS && (size_t{1} << partition_bits) < static_cast<size_t>(chunk_count)) {
+    ++partition_bits;
+  }
+  const auto partition_count = size_t{1} << partition_bits;
+  const auto partition_of = [partition_bits](const uint64_t hash) {
+    return partition_bits == 0 ? size_t{0} : static_cast<size_t>(hash >> (64u - partition_bits));
+  };
+
   /*
-  PARTITIONING PHASE
-  First we partition the input chunks by the given group key(s).
-  This is done by creating a vector that contains the AggregateKey for each row.
-  It is gradually built by visitors, one for each group column.
+  PRE-AGGREGATION PHASE
+  Each chunk is aggregated into a GroupKeyTable of its own. Its groups are then sorted into the partitions.
   */
-  _keys_per_chunk = std::vector<std::shared_ptr<std::vector<AggregateKey>>>(input_table->chunk_count());
-
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(input_table->chunk_count());
-
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, this]() {
-      auto chunk_in = input_table->get_chunk(chunk_id);
-
-      auto hash_keys = std::make_shared<std::vector<AggregateKey>>(chunk_in->size());
-
-      // Partition by group columns
-      for (const auto column_id : _groupby_column_ids) {
-        auto base_column = chunk_in->get_column(column_id);
-        auto column_type = input_table->column_type(column_id);
-
-        resolve_data_and_column_type(column_type, *base_column, [&](auto type, auto& typed_column) {
-          using ColumnDataType = typename decltype(type)::type;
+  auto chunk_groups = std::vector<std::optional<Groups>>(chunk_count);
+  auto chunk_groups_per_partition = std::vector<std::vector<std::vector<GroupID>>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_in = input_table->get_chunk(chunk_id);
+      const auto chunk_size = chunk_in->size();
+
+      auto groups = make_groups();
+      auto row_groups = std::vector<GroupID>(chunk_size);
+
+      if (!group_by_value_ids(*input_table, *chunk_in, _groupby_column_ids, key_width, has_null_word,
+                              string_dictionaries, groups.keys, row_groups)) {
+        auto keys = std::vector<uint64_t>(chunk_size * key_width);
+        for (auto column_index = size_t{0}; column_index < groupby_column_count; ++column_index) {
+          const auto column_id = _groupby_column_ids[column_index];
+
+          resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            encode_groupby_column<ColumnDataType>(*chunk_in->get_column(column_id), column_index, key_width,
+                                                  has_null_word, string_dictionaries[column_index], keys);
+          });
+        }
 
-          auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+        for (auto row = size_t{0}; row < chunk_size; ++row) {
+          const auto* key = keys.data() + row * key_width;
+          row_groups[row] = groups.keys.find_or_insert(key, hash_key_words(key, key_width));
+        }
+      }
 
-          ChunkOffset chunk_offset{0};
-          iterable.for_each([&](const auto& value) {
-            if (value.is_null()) {
-              (*hash_keys)[chunk_offset].emplace_back(NULL_VALUE);
-            } else {
-              (*hash_keys)[chunk_offset].emplace_back(value.value());
-            }
+      for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+        const auto& column_id = _aggregates[aggregate_index].column;
+        const auto column = column_id ? chunk_in->get_column(*column_id) : nullptr;
+        groups.states[aggregate_index]->aggregate(column.get(), row_groups, groups.keys.size());
+      }
 
-            ++chunk_offset;
-          });
-        });
+      auto& groups_per_partition = chunk_groups_per_partition[chunk_id];
+      groups_per_partition.resize(partition_count);
+      for (GroupID group_id{0}; group_id < groups.keys.size(); ++group_id) {
+        groups_per_partition[partition_of(groups.keys.hash(group_id))].emplace_back(group_id);
       }
 
-      _keys_per_chunk[chunk_id] = hash_keys;
+      chunk_groups[chunk_id] = std::move(groups);
     }));
     jobs.back()->schedule();
   }
@@ -384,345 +790,96 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   CurrentScheduler::wait_for_tasks(jobs);
 
   /*
-  AGGREGATION PHASE
+  MERGE PHASE
+  The groups of all chunks that belong to the same partition are merged. Partitions do not share any groups.
   */
-  _contexts_per_column = std::vector<std::shared_ptr<ColumnVisitableContext>>(_aggregates.size());
+  auto partition_groups = std::vector<std::optional<Groups>>(partition_count);
 
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+  jobs.clear();
+  jobs.reserve(partition_count);
 
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType>>();
-    context->results =
-        std::make_shared<std::map<AggregateKey, AggregateResult<DistinctAggregateType, DistinctColumnType>>>();
+  for (auto partition_index = size_t{0}; partition_index < partition_count; ++partition_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_index]() {
+      auto groups = make_groups();
+      auto group_pairs = std::vector<std::pair<GroupID, GroupID>>{};
 
-    _contexts_per_column.push_back(context);
-  }
+      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& chunk = *chunk_groups[chunk_id];
 
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    auto chunk_in = input_table->get_chunk(chunk_id);
-
-    auto hash_keys = _keys_per_chunk[chunk_id];
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType>>(
-          _contexts_per_column[0]);
-      auto& results = *context->results;
-      for (auto& chunk : _keys_per_chunk) {
-        for (auto& keys : *chunk) {
-          // insert dummy value to make sure we have the key in our map
-          results[keys] = AggregateResult<DistinctAggregateType, DistinctColumnType>();
+        group_pairs.clear();
+        for (const auto chunk_group_id : chunk_groups_per_partition[chunk_id][partition_index]) {
+          const auto* key = chunk.keys.key(chunk_group_id);
+          group_pairs.emplace_back(chunk_group_id, groups.keys.find_or_insert(key, chunk.keys.hash(chunk_group_id)));
         }
-      }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then basically go through the _keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          // We know the template arguments, so we don't need a visitor
-          if (!_contexts_per_column[column_index]) {
-            _contexts_per_column[column_index] =
-                std::make_shared<AggregateContext<CountColumnType, CountAggregateType>>();
-          }
-
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType>>(
-              _contexts_per_column[column_index]);
-
-          if (!context->results) {
-            // create result map for the first time if necessary
-            context->results =
-                std::make_shared<std::map<AggregateKey, AggregateResult<CountAggregateType, CountColumnType>>>();
-          }
-
-          auto& results = *context->results;
-
-          // count occurrences for each group key
-          for (const auto& hash_key : *hash_keys) {
-            ++results[hash_key].aggregate_count;
-          }
 
-          ++column_index;
-          continue;
+        for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+          groups.states[aggregate_index]->resize(groups.keys.size());
+          groups.states[aggregate_index]->merge(*chunk.states[aggregate_index], group_pairs);
         }
-
-        auto base_column = chunk_in->get_column(*aggregate.column);
-        auto data_type = input_table->column_type(*aggregate.column);
-
-        /*
-        Invoke correct aggregator for each column
-        */
-
-        resolve_data_type(data_type, [&, this, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_column<ColumnDataType, AggregateFunction::Min>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_column<ColumnDataType, AggregateFunction::Max>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_column<ColumnDataType, AggregateFunction::Sum>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_column<ColumnDataType, AggregateFunction::Avg>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_column<ColumnDataType, AggregateFunction::Count>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_column<ColumnDataType, AggregateFunction::CountDistinct>(chunk_id, column_index, *base_column);
-              break;
-          }
-        });
-
-        ++column_index;
       }
-    }
-  }
-
-  // Write the output
-  _output = std::make_shared<Table>();
 
-  // add group by columns
-  for (const auto column_id : _groupby_column_ids) {
-    const auto& column_type = input_table->column_type(column_id);
-    const auto& column_name = input_table->column_name(column_id);
-
-    _output->add_column_definition(column_name, column_type, true);
-
-    _groupby_columns.emplace_back(make_shared_by_data_type<BaseColumn, ValueColumn>(column_type, true));
-    _out_chunk->add_column(_groupby_columns.back());
+      partition_groups[partition_index] = std::move(groups);
+    }));
+    jobs.back()->schedule();
   }
 
-  /**
-   * Write group-by columns.
-   *
-   * 'results_per_column' always contains at least one element, since there are either GroupBy or Aggregate columns.
-   * However, we need to look only at the first element, because the keys for all columns are the same.
-   *
-   * The following loop is used for both, actual GroupBy columns and DISTINCT columns.
-   **/
-  if (_aggregates.empty()) {
-    auto context =
-        std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType>>(_contexts_per_column[0]);
-    for (auto& map : *context->results) {
-      for (size_t group_column_index = 0; group_column_index < map.first.size(); ++group_column_index) {
-        _groupby_columns[group_column_index]->append(map.first[group_column_index]);
-      }
-    }
-  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  chunk_groups.clear();
 
   /*
-  Write the aggregated columns to the output
+  OUTPUT PHASE
+  The partitions are written one after another.
   */
-  ColumnID column_index{0};
-  for (const auto& aggregate : _aggregates) {
-    const auto column = aggregate.column;
-
-    // Output column for COUNT(*). int is chosen arbitrarily.
-    const auto data_type = !column ? DataType::Int : input_table->column_type(*column);
-
-    resolve_data_type(
-        data_type, [&, column_index](auto type) { _write_aggregate_output(type, column_index, aggregate.function); });
-
-    ++column_index;
-  }
-
-  _output->emplace_chunk(std::move(_out_chunk));
-
-  return _output;
-}
-
-/*
-The following template functions write the aggregated values for the different aggregate functions.
-They are separate and templated to avoid compiler errors for invalid type/function combinations.
-*/
-// MIN, MAX, SUM write the current aggregated value
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<
-    func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum, void>::type
-_write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
-                        std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(column->is_nullable(), "Aggregate: Output column needs to be nullable");
-
-  auto& values = column->values();
-  auto& null_values = column->null_values();
-
-  for (auto& kv : *results) {
-    null_values.push_back(!kv.second.current_aggregate);
-
-    if (!kv.second.current_aggregate) {
-      values.push_back(AggregateType());
-    } else {
-      values.push_back(*kv.second.current_aggregate);
-    }
-  }
-}
-
-// COUNT writes the aggregate counter
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::Count, void>::type _write_aggregate_values(
-    std::shared_ptr<ValueColumn<AggregateType>> column,
-    std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(!column->is_nullable(), "Aggregate: Output column for COUNT shouldn't be nullable");
-
-  auto& values = column->values();
-
-  for (auto& kv : *results) {
-    values.push_back(kv.second.aggregate_count);
-  }
-}
-
-// COUNT(DISTINCT) writes the number of distinct values
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::CountDistinct, void>::type _write_aggregate_values(
-    std::shared_ptr<ValueColumn<AggregateType>> column,
-    std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(!column->is_nullable(), "Aggregate: Output column for COUNT shouldn't be nullable");
-
-  auto& values = column->values();
-
-  for (auto& kv : *results) {
-    values.push_back(kv.second.distinct_values.size());
-  }
-}
-
-// AVG writes the calculated average from current aggregate and the aggregate counter
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::Avg && std::is_arithmetic<AggregateType>::value, void>::type
-_write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
-                        std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(column->is_nullable(), "Aggregate: Output column needs to be nullable");
-
-  auto& values = column->values();
-  auto& null_values = column->null_values();
-
-  for (auto& kv : *results) {
-    null_values.push_back(!kv.second.current_aggregate);
-
-    if (!kv.second.current_aggregate) {
-      values.push_back(AggregateType());
-    } else {
-      values.push_back(*kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count));
-    }
-  }
-}
-
-// AVG is not defined for non-arithmetic types. Avoiding compiler errors.
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::Avg && !std::is_arithmetic<AggregateType>::value, void>::type
-    _write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>>,
-                            std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>>) {
-  Fail("Invalid aggregate");
-}
-
-template <typename ColumnType>
-void Aggregate::_write_aggregate_output(boost::hana::basic_type<ColumnType> type, ColumnID column_index,
-                                        AggregateFunction function) {
-  switch (function) {
-    case AggregateFunction::Min:
-      write_aggregate_output<ColumnType, AggregateFunction::Min>(column_index);
-      break;
-    case AggregateFunction::Max:
-      write_aggregate_output<ColumnType, AggregateFunction::Max>(column_index);
-      break;
-    case AggregateFunction::Sum:
-      write_aggregate_output<ColumnType, AggregateFunction::Sum>(column_index);
-      break;
-    case AggregateFunction::Avg:
-      write_aggregate_output<ColumnType, AggregateFunction::Avg>(column_index);
-      break;
-    case AggregateFunction::Count:
-      write_aggregate_output<ColumnType, AggregateFunction::Count>(column_index);
-      break;
-    case AggregateFunction::CountDistinct:
-      write_aggregate_output<ColumnType, AggregateFunction::CountDistinct>(column_index);
-      break;
-  }
-}
-
-template <typename ColumnType, AggregateFunction function>
-void Aggregate::write_aggregate_output(ColumnID column_index) {
-  // retrieve type information from the aggregation traits
-  typename AggregateTraits<ColumnType, function>::aggregate_type aggregate_type;
-  auto aggregate_data_type = AggregateTraits<ColumnType, function>::aggregate_data_type;
-
-  const auto& aggregate = _aggregates[column_index];
+  auto group_count = size_t{0};
+  for (const auto& groups : partition_groups) group_count += groups->keys.size();
+
+  auto output = std::make_shared<Table>();
+  auto output_chunk = std::make_shared<Chunk>();
+
+  for (auto column_index = size_t{0}; column_index < groupby_column_count; ++column_index) {
+    const auto column_id = _groupby_column_ids[column_index];
+    const auto data_type = input_table->column_type(column_id);
+    output->add_column_definition(input_table->column_name(column_id), data_type, true);
+
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = AppendOnlyVector<ColumnDataType>(group_count);
+      auto null_values = AppendOnlyVector<bool>(group_count);
+
+      auto output_offset = size_t{0};
+      for (const auto& groups : partition_groups) {
+        for (GroupID group_id{0}; group_id < groups->keys.size(); ++group_id, ++output_offset) {
+          const auto* key = groups->keys.key(group_id);
+
+          if (has_null_word && (key[key_width - 1] >> column_index) & 1u) {
+            null_values[output_offset] = true;
+          } else if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+            values[output_offset] = string_dictionaries[column_index].values[key[column_index]];
+          } else {
+            values[output_offset] = decode_value<ColumnDataType>(key[column_index]);
+          }
+        }
+      }
 
-  if (aggregate_data_type == DataType::Null) {
-    // if not specified, it’s the input column’s type
-    aggregate_data_type = _input_table_left()->column_type(*aggregate.column);
+      output_chunk->add_column(
+          std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values)));
+    });
   }
 
-  // use the alias or generate the name, e.g. MAX(column_a)
-  std::string output_column_name;
-  if (aggregate.alias) {
-    output_column_name = *aggregate.alias;
-  } else if (!aggregate.column) {
-    output_column_name = "COUNT(*)";
-  } else {
-    const auto& column_name = _input_table_left()->column_name(*aggregate.column);
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    auto partition_states = std::vector<const BaseAggregateStates*>{};
+    for (const auto& groups : partition_groups) partition_states.emplace_back(groups->states[aggregate_index].get());
 
-    if (aggregate.function == AggregateFunction::CountDistinct) {
-      output_column_name = std::string("COUNT(DISTINCT ") + column_name + ")";
-    } else {
-      output_column_name = aggregate_function_to_string.left.at(function) + "(" + column_name + ")";
-    }
+    const auto& states = *partition_states.front();
+    output->add_column_definition(_aggregate_column_name(_aggregates[aggregate_index]), states.data_type(),
+                                  states.is_nullable());
+    output_chunk->add_column(states.make_output_column(partition_states, group_count));
   }
 
-  constexpr bool needs_null = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
-  _output->add_column_definition(output_column_name, aggregate_data_type, needs_null);
-
-  auto col = std::make_shared<ValueColumn<decltype(aggregate_type)>>(needs_null);
-
-  auto context = std::static_pointer_cast<AggregateContext<ColumnType, decltype(aggregate_type)>>(
-      _contexts_per_column[column_index]);
-
-  // write all group keys into the respective columns
-  if (column_index == 0) {
-    for (auto& map : *context->results) {
-      for (size_t group_column_index = 0; group_column_index < map.first.size(); ++group_column_index) {
-        _groupby_columns[group_column_index]->append(map.first[group_column_index]);
-      }
-    }
-  }
+  output->emplace_chunk(std::move(output_chunk));
 
-  // write aggregated values into the column
-  _write_aggregate_values<ColumnType, decltype(aggregate_type), function>(col, context->results);
-  _out_chunk->add_column(col);
+  return output;
 }
 
 }  // namespace opossum
@@ -22,8 +22,6 @@
 
 namespace opossum {
 
-struct GroupByContext;
-
 /**
  * Aggregates are defined by the Column (ColumnID for Operators, ColumnReference in LQP) they operate on and the aggregate
  * function they use. COUNT() is the exception that doesn't use a Column, which is why column is optional
@@ -42,9 +40,18 @@ struct AggregateColumnDefinitionTemplate {
 
 /*
 Operator to aggregate columns by certain functions, such as min, max, sum, average, and count. The output is a table
- with reference columns. As with most operators we do not guarantee a stable operation with regards to positions -
+ with value columns. As with most operators we do not guarantee a stable operation with regards to positions -
  i.e. your sorting order.
 
+The aggregation is hash-based and runs in three phases:
+ 1. For each input chunk, the values of the group-by columns of each row are packed into a fixed-width key of one 64-bit
+    word per column (plus one word with a NULL bit per column if any of them is nullable). Numbers are stored by their
+    bits, strings by their index in a dictionary of all group-by strings of the column. For DictionaryColumns, the key
+    words are computed once per ValueID instead of once per row.
+ 2. Each chunk is pre-aggregated into a hash table of its own groups, so that the workers do not share any state.
+ 3. The groups of all chunks are partitioned by their hash and the partitions are merged in parallel. Every partition
+    is then written directly into the typed ValueColumns of the output.
+
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Aggregate-Operator
 */
 
@@ -59,24 +66,14 @@ struct AggregateResult {
   std::set<ColumnDataType> distinct_values;
 };
 
-/*
-The key type that is used for the aggregation map.
-*/
-using AggregateKey = std::vector<AllTypeVariant>;
-
 using AggregateColumnDefinition = AggregateColumnDefinitionTemplate<ColumnID>;
 
 /**
- * Types that are used for the special COUNT(*) and DISTINCT implementations
+ * Types that are used for the special COUNT(*) implementation
  */
 using CountColumnType = int32_t;
 using CountAggregateType = int64_t;
-using DistinctColumnType = int8_t;
-using DistinctAggregateType = int8_t;
 
-/**
- * Note: Aggregate does not support null values at the moment
- */
 class Aggregate : public AbstractReadOnlyOperator {
  public:
   Aggregate(const std::shared_ptr<AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
@@ -89,39 +86,14 @@ class Aggregate : public AbstractReadOnlyOperator {
   const std::string description(DescriptionMode description_mode) const override;
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
-  // write the aggregated output for a given aggregate column
-  template <typename ColumnType, AggregateFunction function>
-  void write_aggregate_output(ColumnID column_index);
-
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
-  template <typename ColumnType>
-  static void _create_aggregate_context(boost::hana::basic_type<ColumnType> type,
-                                        std::shared_ptr<ColumnVisitableContext>& aggregate_context,
-                                        AggregateFunction function);
-
-  template <typename ColumnType>
-  static void _create_aggregate_visitor(boost::hana::basic_type<ColumnType> type,
-                                        std::shared_ptr<ColumnVisitable>& builder,
-                                        std::shared_ptr<ColumnVisitableContext> context,
-                                        std::shared_ptr<GroupByContext> groupby_context, AggregateFunction function);
-
-  template <typename ColumnType>
-  void _write_aggregate_output(boost::hana::basic_type<ColumnType> type, ColumnID column_index,
-                               AggregateFunction function);
-
-  template <typename ColumnDataType, AggregateFunction function>
-  void _aggregate_column(ChunkID chunk_id, ColumnID column_index, const BaseColumn& base_column);
+  // The name of the output column of an aggregate, e.g., MAX(column_a)
+  std::string _aggregate_column_name(const AggregateColumnDefinition& aggregate) const;
 
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
-
-  std::shared_ptr<Table> _output;
-  std::shared_ptr<Chunk> _out_chunk;
-  std::vector<std::shared_ptr<BaseColumn>> _groupby_columns;
-  std::vector<std::shared_ptr<ColumnVisitableContext>> _contexts_per_column;
-  std::vector<std::shared_ptr<std::vector<AggregateKey>>> _keys_per_chunk;
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 
+#include "concurrency/log_record.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "optimizer/table_statistics.hpp"
 #include "storage/reference_column.hpp"
@@ -37,11 +38,14 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
     for (const auto& row_id : *pos_list) {
       auto referenced_chunk = _table->get_chunk(row_id.chunk_id);
+      auto mvcc_columns = referenced_chunk->mvcc_columns();
+
+      // Validate has to check the rows of this chunk one by one from now on
+      mvcc_columns->any_row_invalidated = true;
 
       auto expected = 0u;
       // Actual row lock for delete happens here
-      const auto success = referenced_chunk->mvcc_columns()->tids[row_id.chunk_offset].compare_exchange_strong(
-          expected, _transaction_id);
+      const auto success = mvcc_columns->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
 
       // the row is already locked and the transaction needs to be rolled back
       if (!success) {
@@ -74,6 +78,12 @@ void Delete::_finish_commit() {
   }
 }
 
+void Delete::_on_log_records(LogRecord& record) const {
+  for (const auto& pos_list : _pos_lists) {
+    record.add_delete(_table_name, *pos_list);
+  }
+}
+
 void Delete::_on_rollback_records() {
   for (const auto& pos_list : _pos_lists) {
     for (const auto& row_id : *pos_list) {
@@ -4,10 +4,15 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "import_export/binary.hpp"
+#include "storage/append_only_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/compressed_string_dictionary.hpp"
 #include "storage/fitted_attribute_vector.hpp"
+#include "storage/mapped_vector.hpp"
 #include "storage/reference_column.hpp"
 
 #include "constant_mappings.hpp"
@@ -28,8 +33,8 @@ void _export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values
  * this size.
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
-template <typename T = opossum::StringLength, typename Alloc>
-void _export_string_values(std::ofstream& ofstream, const std::vector<std::string, Alloc>& values) {
+template <typename T = opossum::StringLength, typename StringVector>
+void _export_string_values(std::ofstream& ofstream, const StringVector& values) {
   std::vector<T> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -77,30 +82,52 @@ void _export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
   _export_values(ofstream, writable_bools);
 }
+template <>
+void _export_values(std::ofstream& ofstream, const opossum::pmr_vector<bool>& values) {
+  // Cast to fixed-size format used in binary file
+  const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
+  _export_values(ofstream, writable_bools);
+}
 
+// The values of a ValueColumn are stored contiguously, so they can be written without prior conversion
 template <typename T>
-void _export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<T>& values) {
-  // TODO(all): could be faster if we directly write the values into the stream without prior conversion
-  const auto value_block = std::vector<T>{values.begin(), values.end()};
-  ofstream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
+void _export_values(std::ofstream& ofstream, const opossum::AppendOnlyVector<T>& values) {
+  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void _export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<std::string>& values) {
-  // TODO(all): could be faster if we directly write the values into the stream without prior conversion
-  const auto value_block = std::vector<std::string>{values.begin(), values.end()};
-  _export_string_values(ofstream, value_block);
+void _export_values(std::ofstream& ofstream, const opossum::AppendOnlyVector<std::string>& values) {
+  _export_string_values(ofstream, values);
 }
 
 // specialized implementation for bool values
 template <>
-void _export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<bool>& values) {
+void _export_values(std::ofstream& ofstream, const opossum::AppendOnlyVector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
   _export_values(ofstream, writable_bools);
 }
 
+// String dictionaries are decoded and written like any other string vector
+void _export_values(std::ofstream& ofstream, const opossum::CompressedStringDictionary& values) {
+  _export_string_values(ofstream, values);
+}
+
+template <typename T>
+void _export_values(std::ofstream& ofstream, const opossum::MappedVector<T>& values) {
+  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+// Writes zeros until the position in the file is a multiple of the alignment
+void _export_padding(std::ofstream& ofstream, const size_t alignment) {
+  const auto position = static_cast<size_t>(ofstream.tellp());
+  const auto padding = (alignment - position % alignment) % alignment;
+
+  static const auto zeros = std::vector<char>(opossum::MAPPED_BINARY_PAGE_SIZE);
+  ofstream.write(zeros.data(), padding);
+}
+
 // Writes a shallow copy of the given value to the ofstream
 template <typename T>
 void _export_value(std::ofstream& ofstream, const T& value) {
@@ -110,8 +137,9 @@ void _export_value(std::ofstream& ofstream, const T& value) {
 
 namespace opossum {
 
-ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& filename)
-    : AbstractReadOnlyOperator(in), _filename(filename) {}
+ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& filename,
+                           const BinaryFormat format)
+    : AbstractReadOnlyOperator(in), _filename(filename), _format(format) {}
 
 const std::string ExportBinary::name() const { return "ExportBinary"; }
 
@@ -121,10 +149,17 @@ std::shared_ptr<const Table> ExportBinary::_on_execute() {
   ofstream.open(_filename, std::ios::binary);
 
   const auto table = _input_left->get_output();
+
+  if (_format == BinaryFormat::mapped) {
+    ofstream.write(MAPPED_BINARY_MAGIC, sizeof(MAPPED_BINARY_MAGIC));
+    _export_value(ofstream, MAPPED_BINARY_VERSION);
+  }
+
   _write_header(table, ofstream);
 
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+    if (_format == BinaryFormat::mapped) _export_padding(ofstream, MAPPED_BINARY_PAGE_SIZE);
+    _write_chunk(table, ofstream, chunk_id, _format);
   }
 
   return _input_left->get_output();
@@ -151,9 +186,9 @@ void ExportBinary::_write_header(const std::shared_ptr<const Table>& table, std:
 }
 
 void ExportBinary::_write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream,
-                                const ChunkID& chunk_id) {
+                                const ChunkID& chunk_id, const BinaryFormat format) {
   const auto chunk = table->get_chunk(chunk_id);
-  const auto context = std::make_shared<ExportContext>(ofstream);
+  const auto context = std::make_shared<ExportContext>(ofstream, format);
 
   _export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
 
@@ -227,14 +262,93 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_dictionary_column(
   auto context = std::static_pointer_cast<ExportContext>(base_context);
   const auto& column = static_cast<const DictionaryColumn<T>&>(base_column);
 
+  // Bit-packed attribute vectors are written as fitted attribute vectors so that the file format does not change
+  auto attribute_vector = column.attribute_vector();
+  if (auto bit_packed_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(attribute_vector)) {
+    attribute_vector = _unpack_attribute_vector(*bit_packed_vector);
+  }
+
   _export_value(context->ofstream, BinaryColumnType::dictionary_column);
-  _export_value(context->ofstream, static_cast<const AttributeVectorWidth>(column.attribute_vector()->width()));
+  _export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector->width()));
 
   // Write the dictionary size and dictionary
   _export_value(context->ofstream, static_cast<ValueID>(column.unique_values_count()));
-  _export_values(context->ofstream, *column.dictionary());
 
-  _export_attribute_vector(context->ofstream, *column.attribute_vector());
+  if (context->format == BinaryFormat::stream) {
+    _export_values(context->ofstream, *column.dictionary());
+    _export_attribute_vector(context->ofstream, *attribute_vector);
+    return;
+  }
+
+  // In the mapped format, the dictionary is written as it is stored in memory, so that it can be mapped
+  const auto& dictionary = *column.dictionary();
+  if constexpr (std::is_same<T, std::string>::value) {
+    _export_value(context->ofstream, static_cast<uint32_t>(dictionary.data().size()));
+    _export_padding(context->ofstream, MAPPED_BINARY_ALIGNMENT);
+    _export_values(context->ofstream, dictionary.offsets());
+    _export_padding(context->ofstream, MAPPED_BINARY_ALIGNMENT);
+    _export_values(context->ofstream, dictionary.data());
+  } else {
+    _export_padding(context->ofstream, MAPPED_BINARY_ALIGNMENT);
+    _export_values(context->ofstream, dictionary);
+  }
+
+  _export_padding(context->ofstream, MAPPED_BINARY_ALIGNMENT);
+  _export_attribute_vector(context->ofstream, *attribute_vector);
+}
+
+template <typename T>
+void ExportBinary::ExportBinaryVisitor<T>::handle_encoded_column(const BaseEncodedColumn& base_column,
+                                                                 std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<ExportContext>(base_context);
+
+  resolve_encoded_column_type<T>(
+      base_column, [&](const auto& column) { _export_encoded_column(context->ofstream, column); });
+}
+
+template <typename T>
+template <typename ColumnDataType>
+void ExportBinary::ExportBinaryVisitor<T>::_export_encoded_column(std::ofstream& ofstream,
+                                                                  const RunLengthColumn<ColumnDataType>& column) {
+  _export_value(ofstream, BinaryColumnType::run_length_column);
+
+  _export_value(ofstream, static_cast<ChunkOffset>(column.run_count()));
+  _export_values(ofstream, *column.values());
+  _export_values(ofstream, *column.null_values());
+  _export_values(ofstream, *column.end_positions());
+}
+
+template <typename T>
+template <typename ColumnDataType>
+void ExportBinary::ExportBinaryVisitor<T>::_export_encoded_column(
+    std::ofstream& ofstream, const FrameOfReferenceColumn<ColumnDataType>& column) {
+  _export_value(ofstream, BinaryColumnType::frame_of_reference_column);
+
+  _export_value(ofstream, static_cast<ChunkOffset>(column.frame_count()));
+  _export_values(ofstream, *column.frame_minima());
+  _export_values(ofstream, *column.frame_maxima());
+  _export_value(ofstream, column.offsets()->bit_width());
+  _export_values(ofstream, column.offsets()->words());
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> ExportBinary::ExportBinaryVisitor<T>::_unpack_attribute_vector(
+    const BitPackedAttributeVector& attribute_vector) {
+  auto fitted_attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+
+  if (attribute_vector.bit_width() <= 8u) {
+    fitted_attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(attribute_vector.size());
+  } else if (attribute_vector.bit_width() <= 16u) {
+    fitted_attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(attribute_vector.size());
+  } else {
+    fitted_attribute_vector = std::make_shared<FittedAttributeVector<uint32_t>>(attribute_vector.size());
+  }
+
+  for (ChunkOffset chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+    fitted_attribute_vector->set(chunk_offset, attribute_vector.get(chunk_offset));
+  }
+
+  return fitted_attribute_vector;
 }
 
 template <typename T>
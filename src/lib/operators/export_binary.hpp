@@ -8,18 +8,27 @@
 #include "import_export/binary.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class BitPackedAttributeVector;
+
 /**
  * Note: ExportBinary does not support null values at the moment
+ *
+ * In the mapped format (see BinaryFormat), the file starts with MAPPED_BINARY_MAGIC and MAPPED_BINARY_VERSION, each
+ * chunk starts at a multiple of MAPPED_BINARY_PAGE_SIZE, and dictionary columns are written in their in-memory layout
+ * (see handle_dictionary_column). Everything else is written as in the stream format.
  */
 class ExportBinary : public AbstractReadOnlyOperator {
  public:
-  explicit ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& filename);
+  explicit ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& filename,
+                        const BinaryFormat format = BinaryFormat::stream);
 
   /**
    * Executes the export operator
@@ -35,6 +44,7 @@ class ExportBinary : public AbstractReadOnlyOperator {
  private:
   // Path of the binary file
   const std::string _filename;
+  const BinaryFormat _format;
 
   /**
    * This methods writes the header of this table into the given ofstream.
@@ -68,16 +78,19 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * @param table The table we are currently exporting
    * @param ofstream The output stream to write to
    * @param chunkId The id of the chunk that is to be worked on now
+   * @param format The format in which the columns are written
    *
    */
-  static void _write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream, const ChunkID& chunk_id,
+                           const BinaryFormat format);
 
   template <typename T>
   class ExportBinaryVisitor;
 
   struct ExportContext : ColumnVisitableContext {
-    explicit ExportContext(std::ofstream& ofstream) : ofstream(ofstream) {}
+    ExportContext(std::ofstream& ofstream, const BinaryFormat format) : ofstream(ofstream), format(format) {}
     std::ofstream& ofstream;
+    const BinaryFormat format;
   };
 };
 
@@ -148,14 +161,84 @@ class ExportBinary::ExportBinaryVisitor : public ColumnVisitable {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
    *
+   * In the mapped format, the dictionary and the attribute vector are aligned, and string dictionaries are written in
+   * their front-coded form (see CompressedStringDictionary):
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Width of attribute v. | AttributeVectorWidth                  |   1
+   * Size of dictionary v. | ValueID                               |   4
+   * Size of dict. data^   | uint32_t                              |   4
+   * Padding               |                                       |   up to MAPPED_BINARY_ALIGNMENT
+   * Dictionary Values°    | T (int, float, double, long)          |   dict. size * sizeof(T)
+   * Dict. Offsets^        | uint32_t                              |   (dict. size + 1) * 4
+   * Padding^              |                                       |   up to MAPPED_BINARY_ALIGNMENT
+   * Dict. Data^           | char                                  |   size of dict. data
+   * Padding               |                                       |   up to MAPPED_BINARY_ALIGNMENT
+   * Attribute v. values   | uintX                                 |   rows * width of attribute v.
+   *
    * @param base_column The Column to export
    * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
    */
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  /**
+   * Encoded columns are dumped depending on their encoding.
+   *
+   * Run-length encoded columns are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Number of runs        | ChunkOffset                           |   4
+   * Values°               | T (int, float, double, long)          |   runs * sizeof(T)
+   * Length of Strings^    | vector<StringLength>                  |   runs * 2
+   * Values^               | std::string                           |   Sum of all string lengths
+   * Null Values           | vector<bool> (BoolAsByteType)         |   runs * 1
+   * End Positions         | ChunkOffset                           |   runs * 4
+   *
+   * Frame-of-reference encoded columns (only int and long) are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Number of frames      | ChunkOffset                           |   4
+   * Frame Minima          | T (int, long)                         |   frames * sizeof(T)
+   * Frame Maxima          | T (int, long)                         |   frames * sizeof(T)
+   * Bit width of offsets  | uint8_t                               |   1
+   * Packed offsets        | uint32_t                              |   words * 4
+   *
+   * The number of packed words is derived from the number of rows and the bit width
+   * (see BitPackedAttributeVector).
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ^: These fields are only written if the type of the column IS a string.
+   * °: This field is writen if the type of the column is NOT a string
+   *
+   * @param base_column The Column to export
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   */
+  void handle_encoded_column(const BaseEncodedColumn& base_column,
+                             std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   // Chooses the right FittedAttributeVector depending on the attribute_vector_width and exports it.
   static void _export_attribute_vector(std::ofstream& ofstream, const BaseAttributeVector& attribute_vector);
+
+  // Exports the encoded column using the layout described at handle_encoded_column.
+  // These are templates so that FrameOfReferenceColumn is never instantiated for unsupported types.
+  template <typename ColumnDataType>
+  static void _export_encoded_column(std::ofstream& ofstream, const RunLengthColumn<ColumnDataType>& column);
+
+  template <typename ColumnDataType>
+  static void _export_encoded_column(std::ofstream& ofstream, const FrameOfReferenceColumn<ColumnDataType>& column);
+
+  // Converts a BitPackedAttributeVector into the smallest FittedAttributeVector that can hold its values.
+  static std::shared_ptr<const BaseAttributeVector> _unpack_attribute_vector(
+      const BitPackedAttributeVector& attribute_vector);
 };
 }  // namespace opossum
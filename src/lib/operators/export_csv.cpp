@@ -121,6 +121,13 @@ class ExportCsv::ExportCsvVisitor : public ColumnVisitable {
 
     context->csv_writer.write((*column.dictionary())[(column.attribute_vector()->get(context->current_row))]);
   }
+
+  void handle_encoded_column(const BaseEncodedColumn& base_column,
+                             std::shared_ptr<ColumnVisitableContext> base_context) final {
+    auto context = std::static_pointer_cast<ExportCsv::ExportCsvContext>(base_context);
+
+    context->csv_writer.write(base_column[context->current_row]);
+  }
 };
 
 }  // namespace opossum
@@ -2,23 +2,55 @@
 
 #include <boost/hana/for_each.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "constant_mappings.hpp"
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/chunk.hpp"
 #include "storage/fitted_attribute_vector.hpp"
+#include "storage/mapped_vector.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// Lets the stream-based import functions read from a mapped file. The buffer is never written to, std::streambuf
+// merely lacks a const interface.
+class MappedFileBuffer : public std::streambuf {
+ public:
+  explicit MappedFileBuffer(const opossum::MemoryMappedFile& file) {
+    auto* begin = const_cast<char*>(file.data());
+    setg(begin, begin, begin + file.size());
+  }
+
+ protected:
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override {
+    auto* position = direction == std::ios_base::beg ? eback() : direction == std::ios_base::cur ? gptr() : egptr();
+    position += offset;
+    if (position < eback() || position > egptr()) return pos_type(off_type(-1));
+
+    setg(eback(), position, egptr());
+    return pos_type(position - eback());
+  }
+
+  pos_type seekpos(pos_type position, std::ios_base::openmode which) override {
+    return seekoff(off_type(position), std::ios_base::beg, which);
+  }
+};
+
+}  // namespace
+
 namespace opossum {
 
 ImportBinary::ImportBinary(const std::string& filename, const std::optional<std::string> tablename)
@@ -27,7 +59,7 @@ ImportBinary::ImportBinary(const std::string& filename, const std::optional<std:
 const std::string ImportBinary::name() const { return "ImportBinary"; }
 
 template <typename T>
-pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> ImportBinary::_read_values(std::istream& file, const size_t count) {
   pmr_vector<T> values(count);
   file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
   return values;
@@ -35,20 +67,20 @@ pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count
 
 // specialized implementation for string values
 template <>
-pmr_vector<std::string> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<std::string> ImportBinary::_read_values(std::istream& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<bool> ImportBinary::_read_values(std::istream& file, const size_t count) {
   pmr_vector<BoolAsByteType> readable_bools(count);
   file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
 template <typename T>
-pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<std::string> ImportBinary::_read_string_values(std::istream& file, const size_t count) {
   const auto string_lengths = _read_values<T>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
   const auto buffer = _read_values<char>(file, total_length);
@@ -65,7 +97,7 @@ pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, c
 }
 
 template <typename T>
-T ImportBinary::_read_value(std::ifstream& file) {
+T ImportBinary::_read_value(std::istream& file) {
   T result;
   file.read(reinterpret_cast<char*>(&result), sizeof(T));
   return result;
@@ -81,13 +113,33 @@ std::shared_ptr<const Table> ImportBinary::_on_execute() {
 
   Assert(file.is_open(), "ImportBinary: Could not find file " + _filename);
 
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  // Files in the mapped format are recognized by their magic number
+  char magic[sizeof(MAPPED_BINARY_MAGIC)];
+  file.read(magic, sizeof(magic));
+  const auto is_mapped = static_cast<size_t>(file.gcount()) == sizeof(magic) &&
+                         std::equal(magic, magic + sizeof(magic), MAPPED_BINARY_MAGIC);
 
   std::shared_ptr<Table> table;
-  ChunkID chunk_count;
-  std::tie(table, chunk_count) = _read_header(file);
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    table->emplace_chunk(_import_chunk(file, table));
+  if (is_mapped) {
+    file.close();
+    _mapped_file = std::make_shared<MemoryMappedFile>(_filename);
+
+    auto buffer = MappedFileBuffer{*_mapped_file};
+    auto mapped_stream = std::istream{&buffer};
+    mapped_stream.exceptions(std::istream::failbit | std::istream::badbit);
+    mapped_stream.seekg(sizeof(MAPPED_BINARY_MAGIC));
+
+    const auto version = _read_value<uint32_t>(mapped_stream);
+    Assert(version == MAPPED_BINARY_VERSION,
+           "ImportBinary: Unsupported version " + std::to_string(version) + " of file " + _filename);
+
+    table = _import_table(mapped_stream);
+  } else {
+    file.clear();
+    file.seekg(0);
+    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+    table = _import_table(file);
   }
 
   if (_tablename) {
@@ -97,7 +149,20 @@ std::shared_ptr<const Table> ImportBinary::_on_execute() {
   return table;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstream& file) {
+std::shared_ptr<Table> ImportBinary::_import_table(std::istream& file) {
+  std::shared_ptr<Table> table;
+  ChunkID chunk_count;
+  std::tie(table, chunk_count) = _read_header(file);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    // Chunks of mapped files start at page boundaries
+    if (_mapped_file) _skip_padding(file, MAPPED_BINARY_PAGE_SIZE);
+    table->emplace_chunk(_import_chunk(file, table));
+  }
+
+  return table;
+}
+
+std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::istream& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -117,7 +182,7 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-std::shared_ptr<Chunk> ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+std::shared_ptr<Chunk> ImportBinary::_import_chunk(std::istream& file, std::shared_ptr<Table>& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
   const auto chunk = std::make_shared<Chunk>(ChunkUseMvcc::Yes);
 
@@ -128,7 +193,7 @@ std::shared_ptr<Chunk> ImportBinary::_import_chunk(std::ifstream& file, std::sha
   return chunk;
 }
 
-std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::istream& file, ChunkOffset row_count, DataType data_type,
                                                          bool is_nullable) {
   std::shared_ptr<BaseColumn> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -140,7 +205,7 @@ std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, Ch
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, ChunkOffset row_count, bool is_nullable) {
+std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::istream& file, ChunkOffset row_count, bool is_nullable) {
   const auto column_type = _read_value<BinaryColumnType>(file);
 
   switch (column_type) {
@@ -148,6 +213,13 @@ std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, Ch
       return _import_value_column<ColumnDataType>(file, row_count, is_nullable);
     case BinaryColumnType::dictionary_column:
       return _import_dictionary_column<ColumnDataType>(file, row_count);
+    case BinaryColumnType::run_length_column:
+      return _import_run_length_column<ColumnDataType>(file);
+    case BinaryColumnType::frame_of_reference_column:
+      if constexpr (std::is_integral<ColumnDataType>::value) {
+        return _import_frame_of_reference_column<ColumnDataType>(file, row_count);
+      }
+      Fail("Cannot import column: frame-of-reference encoding is only supported for int and long columns");
     default:
       // This case happens if the read column type is not a valid BinaryColumnType.
       Fail("Cannot import column: invalid column type");
@@ -155,43 +227,110 @@ std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, Ch
 }
 
 std::shared_ptr<BaseAttributeVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FittedAttributeVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fitted_attribute_vector<uint8_t>(file, row_count);
     case 2:
-      return std::make_shared<FittedAttributeVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fitted_attribute_vector<uint16_t>(file, row_count);
     case 4:
-      return std::make_shared<FittedAttributeVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fitted_attribute_vector<uint32_t>(file, row_count);
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
+template <typename uintX_t>
+std::shared_ptr<BaseAttributeVector> ImportBinary::_import_fitted_attribute_vector(std::istream& file,
+                                                                                   ChunkOffset row_count) {
+  if (_mapped_file) {
+    return std::make_shared<FittedAttributeVector<uintX_t>>(_map_values<uintX_t>(file, row_count));
+  }
+
+  return std::make_shared<FittedAttributeVector<uintX_t>>(_read_values<uintX_t>(file, row_count));
+}
+
+template <typename T>
+MappedVector<T> ImportBinary::_map_values(std::istream& file, const size_t count) {
+  _skip_padding(file, MAPPED_BINARY_ALIGNMENT);
+
+  const auto offset = static_cast<size_t>(file.tellg());
+  Assert(offset + count * sizeof(T) <= _mapped_file->size(), "ImportBinary: Unexpected end of file " + _filename);
+  file.seekg(count * sizeof(T), std::ios_base::cur);
+
+  return MappedVector<T>{_mapped_file, reinterpret_cast<const T*>(_mapped_file->data() + offset), count};
+}
+
+void ImportBinary::_skip_padding(std::istream& file, const size_t alignment) {
+  const auto position = static_cast<size_t>(file.tellg());
+  file.seekg((alignment - position % alignment) % alignment, std::ios_base::cur);
+}
+
 template <typename T>
-std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(std::istream& file, ChunkOffset row_count,
                                                                    bool is_nullable) {
-  // TODO(unknown): Ideally _read_values would directly write into a tbb::concurrent_vector so that no conversion is
+  // TODO(unknown): Ideally _read_values would directly write into an AppendOnlyVector so that no conversion is
   // needed
   if (is_nullable) {
     const auto nullables = _read_values<bool>(file, row_count);
     const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueColumn<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()},
-                                            tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
+    return std::make_shared<ValueColumn<T>>(AppendOnlyVector<T>(values.begin(), values.end()),
+                                            AppendOnlyVector<bool>(nullables.begin(), nullables.end()));
   } else {
     const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueColumn<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()});
+    return std::make_shared<ValueColumn<T>>(AppendOnlyVector<T>(values.begin(), values.end()));
   }
 }
 
 template <typename T>
-std::shared_ptr<DictionaryColumn<T>> ImportBinary::_import_dictionary_column(std::ifstream& file,
+std::shared_ptr<DictionaryColumn<T>> ImportBinary::_import_dictionary_column(std::istream& file,
                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
-  auto dictionary = _read_values<T>(file, dictionary_size);
+
+  if (!_mapped_file) {
+    auto dictionary = _read_values<T>(file, dictionary_size);
+    auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+    return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), std::move(attribute_vector));
+  }
+
+  auto dictionary = std::shared_ptr<typename DictionaryColumn<T>::Dictionary>{};
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto data_size = _read_value<uint32_t>(file);
+    auto offsets = _map_values<uint32_t>(file, dictionary_size + 1u);
+    auto data = _map_values<char>(file, data_size);
+    dictionary = std::make_shared<CompressedStringDictionary>(std::move(data), std::move(offsets));
+  } else {
+    dictionary = std::make_shared<MappedVector<T>>(_map_values<T>(file, dictionary_size));
+  }
+
   auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
-  return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), std::move(attribute_vector));
+  return std::make_shared<DictionaryColumn<T>>(dictionary, attribute_vector);
+}
+
+template <typename T>
+std::shared_ptr<RunLengthColumn<T>> ImportBinary::_import_run_length_column(std::istream& file) {
+  const auto run_count = _read_value<ChunkOffset>(file);
+  auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, run_count));
+  auto null_values = std::make_shared<pmr_vector<bool>>(_read_values<bool>(file, run_count));
+  auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(_read_values<ChunkOffset>(file, run_count));
+  return std::make_shared<RunLengthColumn<T>>(values, null_values, end_positions);
+}
+
+template <typename T>
+std::shared_ptr<FrameOfReferenceColumn<T>> ImportBinary::_import_frame_of_reference_column(std::istream& file,
+                                                                                          ChunkOffset row_count) {
+  const auto frame_count = _read_value<ChunkOffset>(file);
+  auto frame_minima = std::make_shared<pmr_vector<T>>(_read_values<T>(file, frame_count));
+  auto frame_maxima = std::make_shared<pmr_vector<T>>(_read_values<T>(file, frame_count));
+
+  const auto bit_width = _read_value<uint8_t>(file);
+  constexpr auto block_size = BitPackedAttributeVector::BLOCK_SIZE;
+  const auto block_count = (row_count + block_size - 1u) / block_size;
+  auto words = _read_values<uint32_t>(file, block_count * BitPackedAttributeVector::LANE_COUNT * bit_width);
+  auto offsets = std::make_shared<BitPackedAttributeVector>(row_count, bit_width, std::move(words));
+
+  return std::make_shared<FrameOfReferenceColumn<T>>(frame_minima, frame_maxima, offsets);
 }
 
 }  // namespace opossum
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <fstream>
+#include <istream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -12,9 +12,12 @@
 #include "storage/base_column.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
@@ -24,6 +27,10 @@ namespace opossum {
  * already exists, it is returned and no import is performed.
  *
  * Note: ImportBinary does not support null values at the moment
+ *
+ * Files in the mapped format (see BinaryFormat) are memory-mapped instead of read. Dictionaries and attribute vectors
+ * of dictionary columns then reference the mapping instead of being copied, so that they are only loaded from disk
+ * when they are accessed. All other columns are copied from the mapping.
  */
 class ImportBinary : public AbstractReadOnlyOperator {
  public:
@@ -63,7 +70,10 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::istream& file);
+
+  // Reads the header and all chunks of the table
+  std::shared_ptr<Table> _import_table(std::istream& file);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -77,15 +87,15 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static std::shared_ptr<Chunk> _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  std::shared_ptr<Chunk> _import_chunk(std::istream& file, std::shared_ptr<Table>& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseColumn> _import_column(std::ifstream& file, ChunkOffset row_count, DataType data_type,
-                                                    bool is_nullable);
+  std::shared_ptr<BaseColumn> _import_column(std::istream& file, ChunkOffset row_count, DataType data_type,
+                                             bool is_nullable);
 
   // Reads the column type from the given file and chooses a column import function from it.
   template <typename ColumnDataType>
-  static std::shared_ptr<BaseColumn> _import_column(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  std::shared_ptr<BaseColumn> _import_column(std::istream& file, ChunkOffset row_count, bool is_nullable);
 
   /*
    * Imports a serialized ValueColumn from the given file.
@@ -113,7 +123,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    */
   template <typename T>
-  static std::shared_ptr<ValueColumn<T>> _import_value_column(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueColumn<T>> _import_value_column(std::istream& file, ChunkOffset row_count,
                                                               bool is_nullable);
 
   /*
@@ -131,31 +141,83 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ^: These fields are only needed if the type of the column is a string.
    * °: This field is needed if the type of the column is NOT a string
+   *
+   * In mapped files, the column has the layout described at ExportBinaryVisitor::handle_dictionary_column.
+   */
+  template <typename T>
+  std::shared_ptr<DictionaryColumn<T>> _import_dictionary_column(std::istream& file, ChunkOffset row_count);
+
+  /*
+   * Imports a serialized RunLengthColumn from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Number of runs        | ChunkOffset                           |   4
+   * Values°               | T (int, float, double, long)          |   runs * sizeof(T)
+   * Length of Strings^    | StringLength                          |   runs * 2
+   * Values^               | std::string                           |   Sum of all string lengths
+   * Null Values           | bool (stored as BoolAsByteType)       |   runs * 1
+   * End Positions         | ChunkOffset                           |   runs * 4
+   *
+   * ^: These fields are only needed if the type of the column is a string.
+   * °: This field is needed if the type of the column is NOT a string
    */
   template <typename T>
-  static std::shared_ptr<DictionaryColumn<T>> _import_dictionary_column(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthColumn<T>> _import_run_length_column(std::istream& file);
+
+  /*
+   * Imports a serialized FrameOfReferenceColumn from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Number of frames      | ChunkOffset                           |   4
+   * Frame Minima          | T (int, long)                         |   frames * sizeof(T)
+   * Frame Maxima          | T (int, long)                         |   frames * sizeof(T)
+   * Bit width of offsets  | uint8_t                               |   1
+   * Packed offsets        | uint32_t                              |   words * 4
+   *
+   * The number of packed words is derived from row_count and the bit width (see BitPackedAttributeVector).
+   */
+  template <typename T>
+  static std::shared_ptr<FrameOfReferenceColumn<T>> _import_frame_of_reference_column(std::istream& file,
+                                                                                      ChunkOffset row_count);
+
+  // Calls the _import_fitted_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
+  std::shared_ptr<BaseAttributeVector> _import_attribute_vector(std::istream& file, ChunkOffset row_count,
+                                                                AttributeVectorWidth attribute_vector_width);
+
+  // Reads or, for mapped files, maps a FittedAttributeVector with row_count values
+  template <typename uintX_t>
+  std::shared_ptr<BaseAttributeVector> _import_fitted_attribute_vector(std::istream& file, ChunkOffset row_count);
+
+  // Skips the padding up to MAPPED_BINARY_ALIGNMENT and returns count many values that reference the mapped file
+  template <typename T>
+  MappedVector<T> _map_values(std::istream& file, const size_t count);
 
-  // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseAttributeVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
-                                                                       AttributeVectorWidth attribute_vector_width);
+  // Advances the file to the next multiple of the alignment
+  static void _skip_padding(std::istream& file, const size_t alignment);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(std::istream& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
   template <typename T = StringLength>
-  static pmr_vector<std::string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<std::string> _read_string_values(std::istream& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(std::istream& file);
 
  private:
   // Name of the import file
   const std::string _filename;
   // Name for adding the table to the StorageManager
   const std::optional<std::string> _tablename;
+  // Mapping of the file if it is in the mapped format, nullptr otherwise
+  std::shared_ptr<const MemoryMappedFile> _mapped_file;
 };
 
 }  // namespace opossum
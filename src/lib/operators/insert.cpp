@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
+#include "concurrency/log_record.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
-#include "storage/base_dictionary_column.hpp"
+#include "storage/base_value_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
 #include "type_cast.hpp"
@@ -29,6 +31,8 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
   void resize_vector(std::shared_ptr<BaseColumn> column, size_t new_size) override {
     auto val_column = std::dynamic_pointer_cast<ValueColumn<T>>(column);
     DebugAssert(static_cast<bool>(val_column), "Type mismatch");
+    // Reallocating would invalidate the writes of concurrent inserts into the same chunk
+    Assert(new_size <= val_column->capacity(), "Cannot grow column beyond its capacity");
     auto& values = val_column->values();
 
     values.resize(new_size);
@@ -114,6 +118,8 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   auto start_index = 0u;
   auto start_chunk_id = ChunkID{0};
   auto total_chunks_inserted = 0u;
+  // Keeps reserve_chunk_capacity() from copying the columns while we write to our rows
+  auto column_write_lock = std::shared_lock<std::shared_mutex>{};
   {
     auto scoped_lock = _target_table->acquire_append_mutex();
 
@@ -122,21 +128,26 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     start_index = last_chunk->size();
 
     // If last chunk is compressed, add a new uncompressed chunk
-    if (std::dynamic_pointer_cast<const BaseDictionaryColumn>(last_chunk->get_column(ColumnID{0})) != nullptr) {
+    if (std::dynamic_pointer_cast<const BaseValueColumn>(last_chunk->get_column(ColumnID{0})) == nullptr) {
       _target_table->create_new_chunk();
       total_chunks_inserted++;
     }
 
     auto remaining_rows = total_rows_to_insert;
     while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
+      const auto current_chunk_id = static_cast<ChunkID>(_target_table->chunk_count() - 1);
+      auto current_chunk = _target_table->get_chunk(current_chunk_id);
       auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
 
+      // Make room in the value columns. They are never reallocated, because other Inserts might still be writing into
+      // rows they reserved earlier.
+      auto old_size = current_chunk->size();
+      _target_table->reserve_chunk_capacity(current_chunk_id, old_size + rows_to_insert_this_loop);
+
       // Resize MVCC vectors.
       current_chunk->grow_mvcc_column_size_by(rows_to_insert_this_loop, Chunk::MAX_COMMIT_ID);
 
       // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
       for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
         typed_column_processors[column_id]->resize_vector(current_chunk->get_mutable_column(column_id),
                                                           old_size + rows_to_insert_this_loop);
@@ -150,6 +161,8 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         total_chunks_inserted++;
       }
     }
+
+    column_write_lock = _target_table->acquire_column_write_lock();
   }
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
@@ -168,8 +181,8 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     auto target_start_index = start_index;
     auto still_to_insert = current_num_rows_to_insert;
 
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
+    // Concurrent Inserts might have reserved the rows following ours in the same chunk, so we must not fill the chunk
+    while (still_to_insert > 0) {
       const auto source_chunk = _input_table_left()->get_chunk(source_chunk_id);
       auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
@@ -216,9 +229,15 @@ void Insert::_on_commit_records(const CommitID cid) {
   }
 }
 
+void Insert::_on_log_records(LogRecord& record) const {
+  record.add_insert(_target_table_name, *_target_table, _inserted_rows);
+}
+
 void Insert::_on_rollback_records() {
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
+    chunk->mvcc_columns()->any_row_invalidated = true;
+
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
     chunk->mvcc_columns()->end_cids[row_id.chunk_offset] = 0u;
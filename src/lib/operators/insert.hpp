@@ -28,6 +28,7 @@ class Insert : public AbstractReadWriteOperator {
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   void _on_commit_records(const CommitID cid) override;
+  void _on_log_records(LogRecord& record) const override;
   void _on_rollback_records() override;
 
  private:
@@ -0,0 +1,89 @@
+#include "join_bloom_filter.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class JoinBloomFilter::BaseImpl {
+ public:
+  virtual ~BaseImpl() = default;
+
+  virtual std::vector<bool> may_match(const BaseColumn& column) const = 0;
+};
+
+template <typename T>
+class JoinBloomFilter::Impl : public JoinBloomFilter::BaseImpl {
+ public:
+  Impl(const Table& build_table, const ColumnID build_column_id) : _filter(build_table.row_count()) {
+    for (ChunkID chunk_id{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+      const auto column = build_table.get_chunk(chunk_id)->get_column(build_column_id);
+
+      resolve_column_type<T>(*column, [&](const auto& typed_column) {
+        auto iterable = create_iterable_from_column<T>(typed_column);
+        iterable.for_each([&](const auto& value) {
+          if (!value.is_null()) _filter.insert(value.value());
+        });
+      });
+    }
+  }
+
+  std::vector<bool> may_match(const BaseColumn& column) const override {
+    auto result = std::vector<bool>(column.size());
+
+    resolve_column_type<T>(column, [&](const auto& typed_column) {
+      // The chunk offsets of the values of ReferenceColumns are those in the referenced columns
+      auto chunk_offset = ChunkOffset{0};
+      auto iterable = create_iterable_from_column<T>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        result[chunk_offset++] = !value.is_null() && _filter.may_contain(value.value());
+      });
+    });
+
+    return result;
+  }
+
+ protected:
+  BloomFilter<T> _filter;
+};
+
+JoinBloomFilter::JoinBloomFilter(const std::shared_ptr<const AbstractOperator>& build_operator,
+                                 const ColumnID build_column_id, const ColumnID probe_column_id)
+    : _build_operator(build_operator), _build_column_id(build_column_id), _probe_column_id(probe_column_id) {}
+
+JoinBloomFilter::~JoinBloomFilter() = default;
+
+const std::shared_ptr<const AbstractOperator>& JoinBloomFilter::build_operator() const { return _build_operator; }
+
+ColumnID JoinBloomFilter::build_column_id() const { return _build_column_id; }
+
+ColumnID JoinBloomFilter::probe_column_id() const { return _probe_column_id; }
+
+void JoinBloomFilter::init(const Table& probe_table) {
+  const auto build_table = _build_operator->get_output();
+  DebugAssert(build_table, "The build operator has to be executed before the JoinBloomFilter is created.");
+
+  // The Bloom filter hashes values by their own type, so that equal values of different types do not match
+  const auto data_type = build_table->column_type(_build_column_id);
+  if (data_type != probe_table.column_type(_probe_column_id)) return;
+
+  if (build_table->row_count() > probe_table.row_count()) return;
+
+  _impl = make_unique_by_data_type<BaseImpl, Impl>(data_type, *build_table, _build_column_id);
+}
+
+bool JoinBloomFilter::is_active() const { return _impl != nullptr; }
+
+std::vector<bool> JoinBloomFilter::may_match(const BaseColumn& column) const {
+  DebugAssert(is_active(), "JoinBloomFilter is not active.");
+  return _impl->may_match(column);
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class BaseColumn;
+class Table;
+
+/**
+ * Semi-join reduction of the probe input of a hash join (sideways information passing). The JoinBloomFilter is a Bloom
+ * filter over the join column of the build input. The operator that produces the probe input (TableScan or Validate,
+ * see their set_join_bloom_filter()) uses it to drop rows that cannot find a join partner, so that the join does not
+ * need to materialize and partition them. This only preserves the result of joins that drop probe rows without a
+ * partner, i.e., of inner and semi joins.
+ *
+ * The build operator becomes the right input of the probe-side operator, so that it is executed first. The filter is
+ * created from its output when the probe-side operator is executed (see init()).
+ */
+class JoinBloomFilter {
+ public:
+  JoinBloomFilter(const std::shared_ptr<const AbstractOperator>& build_operator, const ColumnID build_column_id,
+                  const ColumnID probe_column_id);
+  ~JoinBloomFilter();
+
+  const std::shared_ptr<const AbstractOperator>& build_operator() const;
+  ColumnID build_column_id() const;
+  ColumnID probe_column_id() const;
+
+  /**
+   * Creates the filter from the output of the build operator. The filter is not applied (i.e., is_active() returns
+   * false) if the columns have different types or if the build input has more rows than the probe table, because
+   * hardly any probe rows would be dropped then.
+   */
+  void init(const Table& probe_table);
+
+  bool is_active() const;
+
+  /**
+   * Returns for each row of the column, which is the probe column of a chunk of the probe table, whether its value
+   * might occur in the build input. NULL values never do.
+   */
+  std::vector<bool> may_match(const BaseColumn& column) const;
+
+ protected:
+  class BaseImpl;
+
+  template <typename T>
+  class Impl;
+
+  const std::shared_ptr<const AbstractOperator> _build_operator;
+  const ColumnID _build_column_id;
+  const ColumnID _probe_column_id;
+
+  std::unique_ptr<BaseImpl> _impl;
+};
+
+}  // namespace opossum
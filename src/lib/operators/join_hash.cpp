@@ -1,39 +1,97 @@
 #include "join_hash.hpp"
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "join_bloom_filter.hpp"
+#include "normalized_join_keys.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_statistics.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/iterables/create_iterable_from_column.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/value_column.hpp"
+#include "table_scan.hpp"
 #include "type_comparison.hpp"
+#include "validate.hpp"
 #include "utils/assert.hpp"
-#include "utils/cuckoo_hashtable.hpp"
+#include "utils/hash_table.hpp"
+#include "utils/key_hash.hpp"
 #include "utils/murmur_hash.hpp"
 
+namespace {
+
+// Returns a cache parameter as reported by the OS, or `fallback` if it is not available
+size_t cache_parameter([[maybe_unused]] const int name, const size_t fallback) {
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  const auto value = sysconf(name);
+  if (value > 0) return static_cast<size_t>(value);
+#endif
+  return fallback;
+}
+
+}  // namespace
+
 namespace opossum {
 
+namespace {
+
+/**
+ * If `probe_operator` applies a JoinBloomFilter built from `build_operator`, applies the same filter to the recreated
+ * probe operator, with the recreated build operator as its build operator.
+ */
+void recreate_join_bloom_filter(const AbstractOperator& probe_operator,
+                                const std::shared_ptr<AbstractOperator>& recreated_probe_operator,
+                                const std::shared_ptr<const AbstractOperator>& build_operator,
+                                const std::shared_ptr<AbstractOperator>& recreated_build_operator) {
+  const auto table_scan = dynamic_cast<const TableScan*>(&probe_operator);
+  const auto validate = dynamic_cast<const Validate*>(&probe_operator);
+  const auto join_bloom_filter =
+      table_scan ? table_scan->join_bloom_filter() : validate ? validate->join_bloom_filter() : nullptr;
+  if (!join_bloom_filter || join_bloom_filter->build_operator() != build_operator) return;
+
+  const auto recreated_join_bloom_filter = std::make_shared<JoinBloomFilter>(
+      recreated_build_operator, join_bloom_filter->build_column_id(), join_bloom_filter->probe_column_id());
+  if (table_scan) {
+    std::static_pointer_cast<TableScan>(recreated_probe_operator)->set_join_bloom_filter(recreated_join_bloom_filter);
+  } else {
+    std::static_pointer_cast<Validate>(recreated_probe_operator)->set_join_bloom_filter(recreated_join_bloom_filter);
+  }
+}
+
+}  // namespace
+
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
                    const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
-                   const ColumnIDPair& column_ids, const ScanType scan_type)
-    : AbstractJoinOperator(left, right, mode, column_ids, scan_type) {
+                   const ColumnIDPair& column_ids, const ScanType scan_type,
+                   const std::vector<ColumnIDPair>& additional_column_ids, const std::optional<size_t>& radix_bits)
+    : AbstractJoinOperator(left, right, mode, column_ids, scan_type, additional_column_ids), _radix_bits(radix_bits) {
   DebugAssert(scan_type == ScanType::Equals, "Operator not supported by Hash Join.");
 }
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
 std::shared_ptr<AbstractOperator> JoinHash::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<JoinHash>(_input_left->recreate(args), _input_right->recreate(args), _mode, _column_ids,
-                                    _scan_type);
+  const auto input_left = _input_left->recreate(args);
+  const auto input_right = _input_right->recreate(args);
+
+  // TableScan and Validate do not recreate their JoinBloomFilter, as its build operator is the other input of this
+  // join and would be recreated a second time. The filter is re-applied with the recreated input instead.
+  recreate_join_bloom_filter(*_input_left, input_left, _input_right, input_right);
+  recreate_join_bloom_filter(*_input_right, input_right, _input_left, input_left);
+
+  return std::make_shared<JoinHash>(input_left, input_right, _mode, _column_ids, _scan_type, _additional_column_ids,
+                                    _radix_bits);
 }
 
 std::shared_ptr<const Table> JoinHash::_on_execute() {
@@ -47,8 +105,10 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   // (2) for a semi and anti join the inputs are always swapped
   bool inputs_swapped = (_mode == JoinMode::Left || _mode == JoinMode::Anti || _mode == JoinMode::Semi);
 
-  // (3) else the smaller relation will become build relation, the larger probe relation
-  if (!inputs_swapped && _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
+  // (3) else the smaller relation will become build relation, the larger probe relation. This is only possible for
+  // inner joins, because the outer relation of right outer joins has to remain the probe relation.
+  if (_mode == JoinMode::Inner &&
+      _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
     inputs_swapped = true;
   }
 
@@ -71,9 +131,25 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
+  auto build_data_type = build_input->column_type(build_column_id);
+  auto probe_data_type = probe_input->column_type(probe_column_id);
+
+  // With additional predicates, the inputs are joined on the hashes of the keys of all predicates
+  auto keys = std::shared_ptr<const NormalizedJoinKeys>{};
+  if (!_additional_column_ids.empty()) {
+    auto key_column_ids = std::vector<ColumnIDPair>{adjusted_column_ids};
+    for (const auto& [left_column_id, right_column_id] : _additional_column_ids) {
+      key_column_ids.emplace_back(inputs_swapped ? ColumnIDPair{right_column_id, left_column_id}
+                                                 : ColumnIDPair{left_column_id, right_column_id});
+    }
+    keys = std::make_shared<NormalizedJoinKeys>(*build_input, *probe_input, key_column_ids);
+    build_data_type = DataType::Long;
+    probe_data_type = DataType::Long;
+  }
+
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
-      build_input->column_type(build_column_id), probe_input->column_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _scan_type, inputs_swapped);
+      build_data_type, probe_data_type, build_operator, probe_operator, _mode, adjusted_column_ids, _scan_type,
+      inputs_swapped, _radix_bits, keys);
   return _impl->_on_execute();
 }
 
@@ -87,13 +163,16 @@ template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
   JoinHashImpl(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
-               const JoinMode mode, const ColumnIDPair& column_ids, const ScanType scan_type, const bool inputs_swapped)
+               const JoinMode mode, const ColumnIDPair& column_ids, const ScanType scan_type, const bool inputs_swapped,
+               const std::optional<size_t>& radix_bits, const std::shared_ptr<const NormalizedJoinKeys>& keys)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _scan_type(scan_type),
         _inputs_swapped(inputs_swapped),
+        _radix_bits(radix_bits),
+        _keys(keys),
         _output_table(std::make_shared<Table>()) {}
 
   virtual ~JoinHashImpl() = default;
@@ -105,10 +184,20 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const ScanType _scan_type;
 
   const bool _inputs_swapped;
+  const std::optional<size_t> _radix_bits;
+
+  // Only set for joins with additional predicates. Then, LeftType and RightType are int64_t, the type of key hashes.
+  const std::shared_ptr<const NormalizedJoinKeys> _keys;
+
   const std::shared_ptr<Table> _output_table;
 
   const unsigned int _partitioning_seed = 13;
-  const size_t _radix_bits = 9;
+
+  // Number of radix bits used by each partitioning pass, empty if the inputs are not partitioned at all
+  std::vector<size_t> _pass_radix_bits;
+
+  // The hash is 32 bits wide. More partitions than this would only contain a handful of rows each.
+  static constexpr size_t MAX_RADIX_BITS = 20;
 
   /*
   This is how elements of the input relations are saved after materialization.
@@ -140,7 +229,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   template <typename T>
   std::shared_ptr<Partition<T>> _materialize_input(const std::shared_ptr<const Table> in_table, ColumnID column_id,
                                                    std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
-                                                   bool keep_nulls = false) {
+                                                   bool keep_nulls = false,
+                                                   const std::vector<bool>& skipped_chunks = {}) {
     // list of all elements that will be partitioned
     auto elements = std::make_shared<Partition<T>>();
     elements->resize(in_table->row_count());
@@ -148,12 +238,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // arbitrary seed for the first hash iteration
     unsigned int seed = _partitioning_seed;
 
-    // fan-out
-    const size_t num_partitions = 1 << _radix_bits;
-
-    // currently, we just do one pass
-    size_t pass = 0;
-    size_t mask = static_cast<uint32_t>(pow(2, _radix_bits * (pass + 1)) - 1);
+    // The histograms are those of the first partitioning pass
+    const auto radix_bits = _pass_radix_bits.empty() ? size_t{0} : _pass_radix_bits.front();
+    const size_t num_partitions = size_t{1} << radix_bits;
 
     auto chunk_offsets = std::vector<size_t>(in_table->chunk_count());
 
@@ -185,6 +272,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
         auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
 
+        // The reserved elements of skipped chunks keep their NULL_ROW_ID and are ignored by the partitioning
+        if (!skipped_chunks.empty() && skipped_chunks[chunk_id]) return;
+
         auto materialized_chunk = std::vector<std::pair<RowID, T>>();
 
         // Materialize the chunk
@@ -214,11 +304,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           ChunkOffset offset = 0;
           for (auto&& elem : materialized_chunk) {
             if (elem.first.chunk_offset != INVALID_CHUNK_OFFSET) {
-              output[row_id] =
-                  PartitionedElement<T>{RowID{chunk_id, offset}, murmur2<T>(elem.second, seed), elem.second};
+              // -0.0 and 0.0 are equal join keys and must end up in the same partition
+              const auto hash = murmur2<T>(normalize_key_value(elem.second), seed);
+              output[row_id] = PartitionedElement<T>{RowID{chunk_id, offset}, hash, elem.second};
 
-              const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
-              histogram[radix]++;
+              histogram[_radix(output[row_id].partition_hash, 0, radix_bits)]++;
 
               row_id++;
             }
@@ -230,10 +320,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           for (auto&& elem : materialized_chunk) {
             if (elem.first.chunk_offset == INVALID_CHUNK_OFFSET) continue;
 
-            output[row_id] = PartitionedElement<T>{elem.first, murmur2<T>(elem.second, seed), elem.second};
+            const auto hash = murmur2<T>(normalize_key_value(elem.second), seed);
+            output[row_id] = PartitionedElement<T>{elem.first, hash, elem.second};
 
-            const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
-            histogram[radix]++;
+            histogram[_radix(output[row_id].partition_hash, 0, radix_bits)]++;
 
             row_id++;
           }
@@ -247,17 +337,141 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     return elements;
   }
 
+  /*
+  Returns which chunks of the probe relation cannot contain any value of the build relation according to their zone
+  maps and Bloom filters. Checking all build values against a chunk's filter is only cheaper than materializing the
+  chunk if there are fewer build values than rows in the chunk.
+  */
+  std::vector<bool> _find_prunable_probe_chunks(const Partition<LeftType>& build_elements,
+                                                const std::shared_ptr<const Table>& probe_table,
+                                                const ColumnID probe_column_id) {
+    auto prunable_chunks = std::vector<bool>(probe_table->chunk_count(), false);
+
+    // The filters hash values by their own type, so they cannot be probed with values of another type
+    if constexpr (std::is_same<LeftType, RightType>::value) {
+      for (ChunkID chunk_id{0}; chunk_id < probe_table->chunk_count(); ++chunk_id) {
+        const auto chunk = probe_table->get_chunk(chunk_id);
+        if (build_elements.size() >= chunk->size()) continue;
+
+        const auto column_statistics = std::dynamic_pointer_cast<const ChunkColumnStatistics<RightType>>(
+            origin_column_statistics(*chunk, probe_column_id));
+        if (!column_statistics) continue;
+
+        const auto& min = column_statistics->min();
+        const auto& max = column_statistics->max();
+        const auto& filter = column_statistics->filter();
+
+        const auto may_match = [&](const PartitionedElement<LeftType>& element) {
+          if (element.row_id.chunk_offset == INVALID_CHUNK_OFFSET || !min) return false;
+          const auto& value = element.value;
+          if (value < *min || value > *max) return false;
+          return !filter || filter->may_contain(value);
+        };
+
+        prunable_chunks[chunk_id] = std::none_of(build_elements.cbegin(), build_elements.cend(), may_match);
+      }
+    }
+
+    return prunable_chunks;
+  }
+
+  /*
+  Chooses the radix bits of each partitioning pass. The inputs are partitioned so that the hash table of a build
+  partition fits into half of the L2 cache, leaving the other half to the probe side. Each pass creates at most as
+  many partitions as there are cache lines in the L1 cache, so that the write-combining buffers of the scatter (see
+  _scatter()) stay in the L1 cache.
+  */
+  void _plan_radix_passes(const size_t build_row_count) {
+    static const auto l1_cache_size = cache_parameter(_SC_LEVEL1_DCACHE_SIZE, 32 * 1024);
+    static const auto l2_cache_size = cache_parameter(_SC_LEVEL2_CACHE_SIZE, 256 * 1024);
+    static const auto cache_line_size = cache_parameter(_SC_LEVEL1_DCACHE_LINESIZE, 64);
+
+    auto radix_bits = size_t{0};
+    if (_radix_bits) {
+      radix_bits = std::min(*_radix_bits, MAX_RADIX_BITS);
+    } else {
+      const auto build_size = build_row_count * HashTable<LeftType>::estimated_bytes_per_row();
+      while (radix_bits < MAX_RADIX_BITS && (build_size >> radix_bits) > l2_cache_size / 2) ++radix_bits;
+    }
+
+    _pass_radix_bits.clear();
+    if (radix_bits == 0) return;
+
+    auto max_bits_per_pass = size_t{1};
+    while ((size_t{2} << max_bits_per_pass) <= l1_cache_size / cache_line_size) ++max_bits_per_pass;
+
+    const auto pass_count = (radix_bits + max_bits_per_pass - 1) / max_bits_per_pass;
+    for (auto pass = size_t{0}; pass < pass_count; ++pass) {
+      _pass_radix_bits.emplace_back(radix_bits / pass_count + (pass < radix_bits % pass_count ? 1 : 0));
+    }
+  }
+
+  // Returns the `bits` bits of the hash that follow its `preceding_bits` most significant bits
+  static size_t _radix(const Hash hash, const size_t preceding_bits, const size_t bits) {
+    if (bits == 0) return 0;
+    return (hash >> (sizeof(Hash) * 8 - preceding_bits - bits)) & ((size_t{1} << bits) - 1);
+  }
+
+  /*
+  Writes the elements to their partitions, starting at the given output offset of each partition, which are advanced.
+  The elements are collected in a buffer of one cache line per partition first (software write-combining), so that
+  the output is written one cache line at a time and each partition only occupies one cache line while scattering.
+  */
+  template <typename T>
+  static void _scatter(const PartitionedElement<T>* begin, const PartitionedElement<T>* end, Partition<T>& output,
+                       std::vector<size_t>& output_offsets, const size_t preceding_bits, const size_t bits,
+                       const bool keep_nulls) {
+    static const auto cache_line_size = cache_parameter(_SC_LEVEL1_DCACHE_LINESIZE, 64);
+    const auto buffer_size = std::max(cache_line_size / sizeof(PartitionedElement<T>), size_t{1});
+
+    const auto num_partitions = size_t{1} << bits;
+    auto buffers = std::vector<PartitionedElement<T>>(num_partitions * buffer_size);
+    auto buffer_fill_levels = std::vector<size_t>(num_partitions);
+
+    for (auto element = begin; element != end; ++element) {
+      if (!keep_nulls && element->row_id.chunk_offset == INVALID_CHUNK_OFFSET) continue;
+
+      const auto radix = _radix(element->partition_hash, preceding_bits, bits);
+      auto& fill_level = buffer_fill_levels[radix];
+      const auto buffer_begin = buffers.begin() + radix * buffer_size;
+
+      buffer_begin[fill_level++] = *element;
+      if (fill_level == buffer_size) {
+        std::move(buffer_begin, buffer_begin + buffer_size, output.begin() + output_offsets[radix]);
+        output_offsets[radix] += buffer_size;
+        fill_level = 0;
+      }
+    }
+
+    for (auto radix = size_t{0}; radix < num_partitions; ++radix) {
+      const auto buffer_begin = buffers.begin() + radix * buffer_size;
+      std::move(buffer_begin, buffer_begin + buffer_fill_levels[radix], output.begin() + output_offsets[radix]);
+      output_offsets[radix] += buffer_fill_levels[radix];
+    }
+  }
+
   template <typename T>
   RadixContainer<T> _partition_radix_parallel(std::shared_ptr<Partition<T>> materialized,
                                               std::shared_ptr<std::vector<size_t>> chunk_offsets,
                                               std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
                                               bool keep_nulls = false) {
-    // fan-out
-    const size_t num_partitions = 1 << _radix_bits;
+    RadixContainer<T> radix_output;
+
+    // Without partitioning, the materialized elements form a single partition. Only the NULL values need to be removed.
+    if (_pass_radix_bits.empty()) {
+      if (!keep_nulls) {
+        const auto is_null = [](const auto& element) { return element.row_id.chunk_offset == INVALID_CHUNK_OFFSET; };
+        materialized->erase(std::remove_if(materialized->begin(), materialized->end(), is_null), materialized->end());
+      }
+
+      radix_output.elements = materialized;
+      radix_output.partition_offsets = {0, materialized->size()};
+      return radix_output;
+    }
 
-    // currently, we just do one pass
-    size_t pass = 0;
-    size_t mask = static_cast<uint32_t>(pow(2, _radix_bits * (pass + 1)) - 1);
+    // fan-out of the first pass
+    const auto radix_bits = _pass_radix_bits.front();
+    const size_t num_partitions = size_t{1} << radix_bits;
 
     // allocate new (shared) output
     auto output = std::make_shared<Partition<T>>();
@@ -265,22 +479,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     auto& offsets = static_cast<std::vector<size_t>&>(*chunk_offsets);
 
-    RadixContainer<T> radix_output;
     radix_output.elements = output;
     radix_output.partition_offsets.resize(num_partitions + 1);
 
-    // use histograms to calculate partition offsets
+    // use histograms to calculate partition sizes
     for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
-      size_t local_sum = 0;
-      auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
-
+      const auto& histogram = *histograms[chunk_id];
       for (size_t partition_id = 0; partition_id < num_partitions; ++partition_id) {
-        // update local prefix sum
-        local_sum += histogram[partition_id];
-        // update output partition offsets
         radix_output.partition_offsets[partition_id] += histogram[partition_id];
-        // save offsets
-        histogram[partition_id] = local_sum;
       }
     }
 
@@ -295,25 +501,25 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       offset = next_offset;
     }
 
+    // Each chunk writes its elements of a partition behind those of the preceding chunks. The histograms are turned
+    // into these output offsets in a single pass over all chunks.
+    auto next_output_offsets = std::vector<size_t>(radix_output.partition_offsets.begin(),
+                                                   radix_output.partition_offsets.end() - 1);
+    for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
+      auto& histogram = *histograms[chunk_id];
+      for (size_t partition_id = 0; partition_id < num_partitions; ++partition_id) {
+        const auto chunk_partition_size = histogram[partition_id];
+        histogram[partition_id] = next_output_offsets[partition_id];
+        next_output_offsets[partition_id] += chunk_partition_size;
+      }
+    }
+
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(offsets.size());
 
     for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id] {
-        // calculate output offsets for each partition
-        auto output_offsets = std::vector<size_t>(num_partitions, 0);
-
-        // add up the output offsets for chunks before this one
-        for (ChunkID i{0}; i < chunk_id; ++i) {
-          for (size_t j = 0; j < num_partitions; ++j) {
-            output_offsets[j] += histograms[i]->operator[](j);
-          }
-        }
-        for (auto i = chunk_id; i < offsets.size(); ++i) {
-          for (size_t j = 1; j < num_partitions; ++j) {
-            output_offsets[j] += histograms[i]->operator[](j - 1);
-          }
-        }
+        auto& output_offsets = *histograms[chunk_id];
 
         size_t input_offset = offsets[chunk_id];
 
@@ -324,24 +530,63 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           input_size = materialized->size() - input_offset;
         }
 
-        auto& out = static_cast<Partition<T>&>(*output);
-        for (size_t column_offset = input_offset; column_offset < input_offset + input_size; ++column_offset) {
-          auto& element = (*materialized)[column_offset];
-
-          if (!keep_nulls && element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-            continue;
-          }
-
-          const size_t radix = (element.partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
-
-          out[output_offsets[radix]++] = element;
-        }
+        const auto input_begin = materialized->data() + input_offset;
+        _scatter(input_begin, input_begin + input_size, *output, output_offsets, 0, radix_bits, keep_nulls);
       }));
       jobs.back()->schedule();
     }
 
     CurrentScheduler::wait_for_tasks(jobs);
 
+    // Each further pass splits all partitions of the previous pass. The elements are moved back and forth between the
+    // two buffers.
+    auto preceding_bits = radix_bits;
+    for (auto pass = size_t{1}; pass < _pass_radix_bits.size(); ++pass) {
+      const auto pass_bits = _pass_radix_bits[pass];
+      const auto pass_fan_out = size_t{1} << pass_bits;
+      const auto input = radix_output.elements;
+      const auto& input_offsets = radix_output.partition_offsets;
+      const auto input_partition_count = input_offsets.size() - 1;
+
+      auto pass_output = RadixContainer<T>{};
+      pass_output.elements = materialized;
+      pass_output.partition_offsets.resize(input_partition_count * pass_fan_out + 1);
+      pass_output.partition_offsets.back() = input_offsets.back();
+
+      jobs.clear();
+      for (auto partition_id = size_t{0}; partition_id < input_partition_count; ++partition_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, partition_id] {
+          const auto partition_begin = input->data() + input_offsets[partition_id];
+          const auto partition_end = input->data() + input_offsets[partition_id + 1];
+
+          auto output_offsets = std::vector<size_t>(pass_fan_out);
+          for (auto element = partition_begin; element != partition_end; ++element) {
+            ++output_offsets[_radix(element->partition_hash, preceding_bits, pass_bits)];
+          }
+
+          auto output_offset = input_offsets[partition_id];
+          for (auto radix = size_t{0}; radix < pass_fan_out; ++radix) {
+            const auto partition_size = output_offsets[radix];
+            output_offsets[radix] = output_offset;
+            pass_output.partition_offsets[partition_id * pass_fan_out + radix] = output_offset;
+            output_offset += partition_size;
+          }
+
+          // NULL values have already been removed by the first pass
+          _scatter(partition_begin, partition_end, *pass_output.elements, output_offsets, preceding_bits, pass_bits,
+                   true);
+        }));
+        jobs.back()->schedule();
+      }
+
+      CurrentScheduler::wait_for_tasks(jobs);
+
+      // The materialized elements are not needed anymore, so their buffer is reused by the next pass
+      materialized = input;
+      radix_output = std::move(pass_output);
+      preceding_bits += pass_bits;
+    }
+
     return radix_output;
   }
 
@@ -373,6 +618,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           auto& element = partition_left[partition_offset];
           hashtable->put(element.value, element.row_id);
         }
+        hashtable->finalize();
 
         hashtables[current_partition_id] = hashtable;
       }));
@@ -382,6 +628,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     CurrentScheduler::wait_for_tasks(jobs);
   }
 
+  // Whether a build and a probe row that share their join value fulfill the additional predicates
+  bool _keys_equal(const RowID& build_row_id, const RowID& probe_row_id) const {
+    return !_keys || _keys->keys_equal(build_row_id, probe_row_id);
+  }
+
   /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
@@ -420,31 +671,35 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         if (hashtables[current_partition_id]) {
           auto& hashtable = hashtables.at(current_partition_id);
 
-          for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-            auto& row = partition[partition_offset];
+          // This is where the actual comparison happens. `probe` only returns values that match and eliminates hash
+          // collisions. The rows are looked up in batches, see HashTable::probe().
+          const auto get_value = [&](const size_t index) -> const RightType& {
+            return partition[partition_begin + index].value;
+          };
+
+          hashtable->probe(partition_end - partition_begin, get_value, [&](const size_t index, const auto& row_ids) {
+            const auto& row = partition[partition_begin + index];
 
             if (_mode == JoinMode::Inner && row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-              continue;
+              return;
             }
 
-            // This is where the actual comparison happens. `get` only returns values that match and eliminates hash
-            // collisions.
-            auto row_ids = hashtable->get(row.value);
-
-            if (row_ids) {
-              for (const auto& row_id : *row_ids) {
-                if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                  pos_list_left_local.emplace_back(row_id);
-                  pos_list_right_local.emplace_back(row.row_id);
-                }
+            auto has_match = false;
+            for (const auto& row_id : row_ids) {
+              if (row_id.chunk_offset != INVALID_CHUNK_OFFSET && _keys_equal(row_id, row.row_id)) {
+                pos_list_left_local.emplace_back(row_id);
+                pos_list_right_local.emplace_back(row.row_id);
+                has_match = true;
               }
-              // We assume that the relations have been swapped previously,
-              // so that the outer relation is the probing relation.
-            } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+            }
+
+            // We assume that the relations have been swapped previously,
+            // so that the outer relation is the probing relation.
+            if (!has_match && (_mode == JoinMode::Left || _mode == JoinMode::Right)) {
               pos_list_left_local.emplace_back(RowID{ChunkID{0}, INVALID_CHUNK_OFFSET});
               pos_list_right_local.emplace_back(row.row_id);
             }
-          }
+          });
         } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
           /*
           We assume that the relations have been swapped previously,
@@ -497,21 +752,25 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         if (auto& hashtable = hashtables[current_partition_id]) {
           // Valid hashtable found, so there is at least one match in this partition
 
-          for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-            auto& row = partition[partition_offset];
+          const auto get_value = [&](const size_t index) -> const RightType& {
+            return partition[partition_begin + index].value;
+          };
+
+          hashtable->probe(partition_end - partition_begin, get_value, [&](const size_t index, const auto& row_ids) {
+            const auto& row = partition[partition_begin + index];
 
             if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-              continue;
+              return;
             }
 
-            auto matching_rows = hashtable->get(row.value);
-
-            if ((_mode == JoinMode::Semi && matching_rows) || (_mode == JoinMode::Anti && !matching_rows)) {
+            const auto has_match = std::any_of(row_ids.begin(), row_ids.end(),
+                                               [&](const RowID& row_id) { return _keys_equal(row_id, row.row_id); });
+            if ((_mode == JoinMode::Semi && has_match) || (_mode == JoinMode::Anti && !has_match)) {
               // Semi: found at least one match for this row -> match
               // Anti: no matching rows found -> match
               pos_list_local.emplace_back(row.row_id);
             }
-          }
+          });
         } else if (_mode == JoinMode::Anti) {
           // no hashtable on other side, but we are in Anti mode
           for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
@@ -591,6 +850,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       offset_right += _right_in_table->get_chunk(i)->size();
     }
 
+    // The partitioning of both relations is chosen by the size of the build relation
+    _plan_radix_passes(_left_in_table->row_count());
+
     // Materialization phase
     std::vector<std::shared_ptr<std::vector<size_t>>> histograms_left;
     std::vector<std::shared_ptr<std::vector<size_t>>> histograms_right;
@@ -601,10 +863,24 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     This helps choosing a scheduler node for the radix phase (see below).
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto materialized_left = _materialize_input<LeftType>(_left_in_table, _column_ids.first, histograms_left);
+    // With additional predicates, the relations are joined on the hashes of their keys instead of the join columns
+    const auto left_join_table = _keys ? _keys->left_key_hashes() : _left_in_table;
+    const auto right_join_table = _keys ? _keys->right_key_hashes() : _right_in_table;
+    const auto left_join_column_id = _keys ? ColumnID{0} : _column_ids.first;
+    const auto right_join_column_id = _keys ? ColumnID{0} : _column_ids.second;
+
+    auto materialized_left = _materialize_input<LeftType>(left_join_table, left_join_column_id, histograms_left);
+
+    // Rows of the right relation without a match are only dropped by inner and semi joins, so only these can skip the
+    // chunks that cannot contain matches. Key hashes have no statistics to do so.
+    auto skipped_right_chunks = std::vector<bool>{};
+    if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) && !_keys) {
+      skipped_right_chunks = _find_prunable_probe_chunks(*materialized_left, _right_in_table, _column_ids.second);
+    }
+
     // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
-    auto materialized_right =
-        _materialize_input<RightType>(_right_in_table, _column_ids.second, histograms_right, keep_nulls);
+    auto materialized_right = _materialize_input<RightType>(right_join_table, right_join_column_id, histograms_right,
+                                                            keep_nulls, skipped_right_chunks);
 
     // Radix Partitioning phase
     /*
@@ -661,6 +937,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
                              ? true
                              : false;
 
+    const auto left_pos_lists_by_column = ref_col_left ? setup_pos_lists_by_column(_left_in_table) : PosListsByColumn{};
+    const auto right_pos_lists_by_column =
+        ref_col_right ? setup_pos_lists_by_column(_right_in_table) : PosListsByColumn{};
+
     for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
       auto& left = left_pos_lists[partition_id];
       auto& right = right_pos_lists[partition_id];
@@ -673,15 +953,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       // we need to swap back the inputs, so that the order of the output columns is not harmed
       if (_inputs_swapped) {
-        write_output_chunks(output_chunk, _right_in_table, right, ref_col_right);
+        write_output_chunks(output_chunk, _right_in_table, right, ref_col_right, right_pos_lists_by_column);
 
         // Semi/Anti joins are always swapped but do not need the outer relation
         if (_mode != JoinMode::Semi && _mode != JoinMode::Anti) {
-          write_output_chunks(output_chunk, _left_in_table, left, ref_col_left);
+          write_output_chunks(output_chunk, _left_in_table, left, ref_col_left, left_pos_lists_by_column);
         }
       } else {
-        write_output_chunks(output_chunk, _left_in_table, left, ref_col_left);
-        write_output_chunks(output_chunk, _right_in_table, right, ref_col_right);
+        write_output_chunks(output_chunk, _left_in_table, left, ref_col_left, left_pos_lists_by_column);
+        write_output_chunks(output_chunk, _right_in_table, right, ref_col_right, right_pos_lists_by_column);
       }
       _output_table->emplace_chunk(std::move(output_chunk));
     }
@@ -689,11 +969,30 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     return _output_table;
   }
 
+  using PosListsByColumn = std::vector<std::vector<std::shared_ptr<const PosList>>>;
+
+  /*
+  Returns the PosLists of all chunks for each column of a table consisting of ReferenceColumns, so that the columns
+  are only pointer cast once and not for every output chunk.
+  */
+  static PosListsByColumn setup_pos_lists_by_column(const std::shared_ptr<const Table>& input_table) {
+    auto pos_lists_by_column = PosListsByColumn(input_table->column_count());
+    for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+      auto& pos_lists = pos_lists_by_column[column_id];
+      pos_lists.reserve(input_table->chunk_count());
+      for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
+        // This works because we assume that the columns have to be either all ReferenceColumns or none.
+        auto ref_column =
+            std::dynamic_pointer_cast<const ReferenceColumn>(input_table->get_chunk(chunk_id)->get_column(column_id));
+        pos_lists.push_back(ref_column->pos_list());
+      }
+    }
+    return pos_lists_by_column;
+  }
+
   static void write_output_chunks(const std::shared_ptr<Chunk>& output_chunk,
                                   const std::shared_ptr<const Table> input_table, PosList& pos_list,
-                                  bool is_ref_column) {
-    if (pos_list.empty()) return;
-
+                                  bool is_ref_column, const PosListsByColumn& input_pos_lists_by_column) {
     // Add columns from input table to output chunk
     for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
       std::shared_ptr<BaseColumn> column;
@@ -701,18 +1000,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       if (is_ref_column) {
         auto ref_col =
             std::dynamic_pointer_cast<const ReferenceColumn>(input_table->get_chunk(ChunkID{0})->get_column(column_id));
-
-        // Get all the input pos lists so that we only have to pointer cast the columns once
-        auto input_pos_lists = std::vector<std::shared_ptr<const PosList>>();
-        for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
-          // This works because we assume that the columns have to be either all ReferenceColumns or none.
-          auto ref_column =
-              std::dynamic_pointer_cast<const ReferenceColumn>(input_table->get_chunk(chunk_id)->get_column(column_id));
-          input_pos_lists.push_back(ref_column->pos_list());
-        }
+        const auto& input_pos_lists = input_pos_lists_by_column[column_id];
 
         // Get the row ids that are referenced
         auto new_pos_list = std::make_shared<PosList>();
+        new_pos_list->reserve(pos_list.size());
         for (const auto& row : pos_list) {
           if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
             new_pos_list->push_back(row);
@@ -729,6 +1021,156 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       output_chunk->add_column(column);
     }
   }
+
+ public:
+  /*
+  Builds a single hash table of the build relation _left and returns a function that probes a chunk of the probe
+  relation _right with it (see JoinHash::create_probe_function()). The hash table is not partitioned, as every morsel
+  probes all of it.
+  */
+  ProbeFunction create_probe_function(const std::shared_ptr<const Table>& build_table,
+                                      const std::shared_ptr<const Table>& probe_table) {
+    auto hashtables = std::vector<std::shared_ptr<HashTable<LeftType>>>(1);
+    if (build_table->row_count() > 0) {
+      _pass_radix_bits.clear();
+      auto histograms = std::vector<std::shared_ptr<std::vector<size_t>>>{};
+      auto materialized = _materialize_input<LeftType>(build_table, _column_ids.first, histograms);
+      const auto radix_container = _partition_radix_parallel<LeftType>(
+          materialized, std::make_shared<std::vector<size_t>>(), histograms);
+      _build(radix_container, hashtables);
+    }
+
+    const auto hashtable = hashtables.front();
+    const auto build_is_reference =
+        build_table->chunk_count() > 0 && build_table->get_chunk(ChunkID{0})->column_count() > 0 &&
+        std::dynamic_pointer_cast<const ReferenceColumn>(build_table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+    const auto build_pos_lists_by_column =
+        build_is_reference ? setup_pos_lists_by_column(build_table) : PosListsByColumn{};
+
+    const auto mode = _mode;
+    const auto probe_column_id = _column_ids.second;
+    const auto probe_is_left = _inputs_swapped;
+    const auto keep_nulls = (mode == JoinMode::Left || mode == JoinMode::Right);
+
+    return [=](const Chunk& chunk_in, const ChunkID chunk_id) {
+      // Like in _materialize_input(), rows are identified by their offset in chunk_in, also for ReferenceColumns
+      auto probe_offsets = std::vector<ChunkOffset>{};
+      auto probe_values = std::vector<RightType>{};
+
+      auto probe_pos_list = std::make_shared<PosList>();
+      auto build_pos_list = PosList{};
+
+      resolve_column_type<RightType>(*chunk_in.get_column(probe_column_id), [&](auto& typed_column) {
+        auto chunk_offset = ChunkOffset{0};
+        create_iterable_from_column<RightType>(typed_column).for_each([&](const auto& value) {
+          if (!value.is_null()) {
+            probe_offsets.emplace_back(chunk_offset);
+            probe_values.emplace_back(value.value());
+          } else if (keep_nulls) {
+            // NULL values have no join partner, but outer joins keep their rows
+            probe_pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+            build_pos_list.emplace_back(NULL_ROW_ID);
+          }
+          ++chunk_offset;
+        });
+      });
+
+      const auto emit_match = [&](const size_t index, const RowID& build_row_id) {
+        probe_pos_list->emplace_back(RowID{chunk_id, probe_offsets[index]});
+        if (mode != JoinMode::Semi && mode != JoinMode::Anti) build_pos_list.emplace_back(build_row_id);
+      };
+
+      if (hashtable) {
+        const auto get_value = [&](const size_t index) -> const RightType& { return probe_values[index]; };
+
+        hashtable->probe(probe_values.size(), get_value, [&](const size_t index, const auto& row_ids) {
+          if (mode == JoinMode::Semi || mode == JoinMode::Anti) {
+            if (row_ids.empty() == (mode == JoinMode::Anti)) emit_match(index, NULL_ROW_ID);
+            return;
+          }
+
+          for (const auto& row_id : row_ids) emit_match(index, row_id);
+          if (row_ids.empty() && keep_nulls) emit_match(index, NULL_ROW_ID);
+        });
+      } else if (mode == JoinMode::Anti || keep_nulls) {
+        // Without a build relation, no row has a join partner
+        for (auto index = size_t{0}; index < probe_values.size(); ++index) emit_match(index, NULL_ROW_ID);
+      }
+
+      auto chunk_out = TableScan::create_reference_chunk(probe_table, chunk_in, probe_pos_list);
+
+      // Semi/Anti joins do not need the build relation
+      if (mode == JoinMode::Semi || mode == JoinMode::Anti) return chunk_out;
+
+      if (probe_is_left) {
+        write_output_chunks(chunk_out, build_table, build_pos_list, build_is_reference, build_pos_lists_by_column);
+        return chunk_out;
+      }
+
+      // The build relation is the left input, so its columns come first
+      auto joined_chunk = std::make_shared<Chunk>(chunk_in.get_allocator(), chunk_in.access_counter());
+      write_output_chunks(joined_chunk, build_table, build_pos_list, build_is_reference, build_pos_lists_by_column);
+      for (ColumnID column_id{0}; column_id < chunk_out->column_count(); ++column_id) {
+        joined_chunk->add_column(std::const_pointer_cast<BaseColumn>(chunk_out->get_column(column_id)));
+      }
+      return joined_chunk;
+    };
+  }
 };
 
+std::shared_ptr<const Table> JoinHash::create_output_layout(const std::shared_ptr<const Table>& build_table,
+                                                            const std::shared_ptr<const Table>& probe_table,
+                                                            const bool probe_is_left) const {
+  auto output_layout = std::make_shared<Table>();
+
+  const auto add_columns = [&](const Table& input_table) {
+    for (ColumnID column_id{0}; column_id < input_table.column_count(); ++column_id) {
+      // Like in _on_execute(), all columns are nullable
+      output_layout->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                           true);
+    }
+  };
+
+  add_columns(probe_is_left ? *probe_table : *build_table);
+
+  // Semi/Anti joins do not need the build relation
+  if (_mode != JoinMode::Semi && _mode != JoinMode::Anti) add_columns(probe_is_left ? *build_table : *probe_table);
+
+  return output_layout;
+}
+
+JoinHash::ProbeFunction JoinHash::create_probe_function(const std::shared_ptr<const Table>& build_table,
+                                                        const std::shared_ptr<const Table>& probe_table,
+                                                        const bool probe_is_left) const {
+  Assert(_additional_column_ids.empty(), "Joins with additional predicates cannot probe single chunks.");
+  Assert(_mode == JoinMode::Inner || _mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::Semi ||
+             _mode == JoinMode::Anti,
+         "Join mode cannot probe single chunks.");
+  Assert(probe_is_left ? _mode != JoinMode::Right : _mode == JoinMode::Inner || _mode == JoinMode::Right,
+         "The outer relation of an outer join and the left input of a Semi/Anti join must be the probe relation.");
+
+  // The impl expects the build relation as its left and the probe relation as its right input
+  const auto build_operator = probe_is_left ? _input_right : _input_left;
+  const auto probe_operator = probe_is_left ? _input_left : _input_right;
+  const auto build_column_id = probe_is_left ? _column_ids.second : _column_ids.first;
+  const auto probe_column_id = probe_is_left ? _column_ids.first : _column_ids.second;
+
+  auto probe_function = ProbeFunction{};
+
+  resolve_data_type(build_table->column_type(build_column_id), [&](auto build_type) {
+    using BuildType = typename decltype(build_type)::type;
+
+    resolve_data_type(probe_table->column_type(probe_column_id), [&](auto probe_type) {
+      using ProbeType = typename decltype(probe_type)::type;
+
+      auto impl = JoinHashImpl<BuildType, ProbeType>{build_operator, probe_operator, _mode,
+                                                     ColumnIDPair{build_column_id, probe_column_id}, _scan_type,
+                                                     probe_is_left, _radix_bits, nullptr};
+      probe_function = impl.create_probe_function(build_table, probe_table);
+    });
+  });
+
+  return probe_function;
+}
+
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,30 +13,64 @@
 
 namespace opossum {
 
+class Chunk;
+
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
- * If you want to filter by multiple criteria, you can chain this operator.
+ * Further equality predicates can be passed as additional_column_ids. The inputs are then joined on the hashes of
+ * their NormalizedJoinKeys, and rows whose keys only share the hash are not joined.
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
  *
  * Note: JoinHash does not support null values at the moment
  *
+ * Both inputs are radix partitioned so that the hash table of each partition of the build relation fits into the L2
+ * cache. The number of radix bits is derived from the size of the build relation and the cache sizes reported by the
+ * OS, unless it is passed to the constructor. If more bits are needed than can be partitioned efficiently at once,
+ * the inputs are partitioned in multiple passes. Build relations that already fit into the cache are not partitioned.
+ *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Radix-Partitioned-and-Hash-Based-Join
  */
 class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
-           const JoinMode mode, const ColumnIDPair& column_ids, const ScanType scan_type);
+           const JoinMode mode, const ColumnIDPair& column_ids, const ScanType scan_type,
+           const std::vector<ColumnIDPair>& additional_column_ids = {},
+           const std::optional<size_t>& radix_bits = std::nullopt);
 
   const std::string name() const override;
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
+  // Probes a chunk of the probe input and returns the output chunk of its matches
+  using ProbeFunction = std::function<std::shared_ptr<Chunk>(const Chunk& chunk_in, const ChunkID chunk_id)>;
+
+  /**
+   * @defgroup Probing single chunks without executing the JoinHash, so that a Pipeline can probe morsel-wise
+   *
+   * The join is executed with `build_table` as the build relation and chunks with the layout of `probe_table` as the
+   * probe relation, which is the left input if `probe_is_left` is set. Only joins without additional predicates are
+   * supported. Inner joins can probe with either input, Left, Semi, and Anti joins only with the left one, and Right
+   * joins only with the right one.
+   *
+   * create_output_layout() returns a table without rows that has the output's columns. create_probe_function() builds
+   * a single, unpartitioned hash table of `build_table` and returns a function that probes a chunk with it. If the
+   * chunk holds data, it must be the chunk with the given id of `probe_table`.
+   * @{
+   */
+  std::shared_ptr<const Table> create_output_layout(const std::shared_ptr<const Table>& build_table,
+                                                    const std::shared_ptr<const Table>& probe_table,
+                                                    const bool probe_is_left) const;
+  ProbeFunction create_probe_function(const std::shared_ptr<const Table>& build_table,
+                                      const std::shared_ptr<const Table>& probe_table, const bool probe_is_left) const;
+  /**@}*/
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
 
+  const std::optional<size_t> _radix_bits;
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
 
   template <typename LeftType, typename RightType>
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "join_sort_merge/radix_cluster_sort.hpp"
+#include "normalized_join_keys.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
@@ -36,8 +37,9 @@ namespace opossum {
 **/
 JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
                              const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
-                             const ColumnIDPair& column_ids, const ScanType op)
-    : AbstractJoinOperator(left, right, mode, column_ids, op) {
+                             const ColumnIDPair& column_ids, const ScanType op,
+                             const std::vector<ColumnIDPair>& additional_column_ids)
+    : AbstractJoinOperator(left, right, mode, column_ids, op, additional_column_ids) {
   // Validate the parameters
   DebugAssert(mode != JoinMode::Cross, "This operator does not support cross joins.");
   DebugAssert(left != nullptr, "The left input operator is null.");
@@ -51,10 +53,21 @@ JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
 
 std::shared_ptr<AbstractOperator> JoinSortMerge::recreate(const std::vector<AllParameterVariant>& args) const {
   return std::make_shared<JoinSortMerge>(_input_left->recreate(args), _input_right->recreate(args), _mode, _column_ids,
-                                         _scan_type);
+                                         _scan_type, _additional_column_ids);
 }
 
 std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  // With additional predicates, the inputs are joined on the hashes of the keys of all predicates
+  if (!_additional_column_ids.empty()) {
+    auto key_column_ids = std::vector<ColumnIDPair>{_column_ids};
+    key_column_ids.insert(key_column_ids.end(), _additional_column_ids.begin(), _additional_column_ids.end());
+    const auto keys = std::make_shared<NormalizedJoinKeys>(*_input_table_left(), *_input_table_right(), key_column_ids);
+
+    _impl = make_unique_by_data_type<AbstractJoinOperatorImpl, JoinSortMergeImpl>(
+        DataType::Long, *this, ColumnID{0}, ColumnID{0}, _scan_type, _mode, keys);
+    return _impl->_on_execute();
+  }
+
   // Check column types
   const auto& left_column_type = _input_table_left()->column_type(_column_ids.first);
   DebugAssert(left_column_type == _input_table_right()->column_type(_column_ids.second),
@@ -62,7 +75,7 @@ std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
 
   // Create implementation to compute the join result
   _impl = make_unique_by_data_type<AbstractJoinOperatorImpl, JoinSortMergeImpl>(
-      left_column_type, *this, _column_ids.first, _column_ids.second, _scan_type, _mode);
+      left_column_type, *this, _column_ids.first, _column_ids.second, _scan_type, _mode, nullptr);
 
   return _impl->_on_execute();
 }
@@ -78,12 +91,13 @@ template <typename T>
 class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
  public:
   JoinSortMergeImpl<T>(JoinSortMerge& sort_merge_join, ColumnID left_column_id, ColumnID right_column_id,
-                       const ScanType op, JoinMode mode)
+                       const ScanType op, JoinMode mode, const std::shared_ptr<const NormalizedJoinKeys>& keys)
       : _sort_merge_join{sort_merge_join},
         _left_column_id{left_column_id},
         _right_column_id{right_column_id},
         _op{op},
-        _mode{mode} {
+        _mode{mode},
+        _keys{keys} {
     _cluster_count = _determine_number_of_clusters();
     _output_pos_lists_left.resize(_cluster_count);
     _output_pos_lists_right.resize(_cluster_count);
@@ -106,6 +120,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   const ScanType _op;
   const JoinMode _mode;
 
+  // Only set for joins with additional predicates. Then, the join columns are the key hashes of the inputs.
+  const std::shared_ptr<const NormalizedJoinKeys> _keys;
+
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   size_t _cluster_count;
 
@@ -190,7 +207,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     size_t cluster_number = left_run.start.cluster;
     switch (_op) {
       case ScanType::Equals:
-        if (compare_result == CompareResult::Equal) {
+        if (compare_result == CompareResult::Equal && _keys) {
+          _emit_combinations_with_equal_keys(cluster_number, left_run, right_run);
+        } else if (compare_result == CompareResult::Equal) {
           _emit_all_combinations(cluster_number, left_run, right_run);
         } else if (compare_result == CompareResult::Less) {
           if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
@@ -261,6 +280,39 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     });
   }
 
+  /**
+  * Emits the combinations of row ids from two runs with the same key hash whose keys are equal. For outer joins, the
+  * rows without an equal key are emitted with a NULL value on the other side.
+  **/
+  void _emit_combinations_with_equal_keys(size_t output_cluster, TableRange left_run, TableRange right_run) {
+    auto left_row_ids = PosList{};
+    auto right_row_ids = PosList{};
+    left_run.for_every_row_id(_sorted_left_table, [&](RowID row_id) { left_row_ids.push_back(row_id); });
+    right_run.for_every_row_id(_sorted_right_table, [&](RowID row_id) { right_row_ids.push_back(row_id); });
+
+    auto right_has_match = std::vector<bool>(right_row_ids.size(), false);
+    for (const auto& left_row_id : left_row_ids) {
+      auto left_has_match = false;
+      for (auto right_index = size_t{0}; right_index < right_row_ids.size(); ++right_index) {
+        if (_keys->keys_equal(left_row_id, right_row_ids[right_index])) {
+          _emit_combination(output_cluster, left_row_id, right_row_ids[right_index]);
+          left_has_match = true;
+          right_has_match[right_index] = true;
+        }
+      }
+
+      if (!left_has_match && (_mode == JoinMode::Left || _mode == JoinMode::Outer)) {
+        _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
+      }
+    }
+
+    if (_mode == JoinMode::Right || _mode == JoinMode::Outer) {
+      for (auto right_index = size_t{0}; right_index < right_row_ids.size(); ++right_index) {
+        if (!right_has_match[right_index]) _emit_combination(output_cluster, NULL_ROW_ID, right_row_ids[right_index]);
+      }
+    }
+  }
+
   /**
   * Emits all combinations of row ids from the left table range and a NULL value on the right side to the join output.
   **/
@@ -630,9 +682,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   std::shared_ptr<const Table> _on_execute() {
     bool include_null_left = (_mode == JoinMode::Left || _mode == JoinMode::Outer);
     bool include_null_right = (_mode == JoinMode::Right || _mode == JoinMode::Outer);
-    auto radix_clusterer = RadixClusterSort<T>(
-        _sort_merge_join._input_table_left(), _sort_merge_join._input_table_right(), _sort_merge_join._column_ids,
-        _op == ScanType::Equals, include_null_left, include_null_right, _cluster_count);
+    const auto left_join_table = _keys ? _keys->left_key_hashes() : _sort_merge_join._input_table_left();
+    const auto right_join_table = _keys ? _keys->right_key_hashes() : _sort_merge_join._input_table_right();
+    auto radix_clusterer = RadixClusterSort<T>(left_join_table, right_join_table,
+                                               ColumnIDPair{_left_column_id, _right_column_id}, _op == ScanType::Equals,
+                                               include_null_left, include_null_right, _cluster_count);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
     _sorted_left_table = std::move(sort_output.clusters_left);
@@ -17,6 +17,9 @@ namespace opossum {
    * As with most operators, we do not guarantee a stable operation with regards to positions -
    * i.e., your sorting order might be disturbed.
    *
+   * Equi-joins can have further equality predicates, passed as additional_column_ids. The inputs are then sorted and
+   * merged by the hashes of their NormalizedJoinKeys, and rows whose keys only share the hash are not joined.
+   *
    * Note: SortMergeJoin does not support null values in the input at the moment.
    * Note: Cross joins are not supported. Use the product operator instead.
    * Note: Outer joins are only implemented for the equi-join case, i.e. the "=" operator.
@@ -24,7 +27,8 @@ namespace opossum {
 class JoinSortMerge : public AbstractJoinOperator {
  public:
   JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
-                const JoinMode mode, const ColumnIDPair& column_ids, const ScanType op);
+                const JoinMode mode, const ColumnIDPair& column_ids, const ScanType op,
+                const std::vector<ColumnIDPair>& additional_column_ids = {});
 
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
@@ -5,8 +5,6 @@
 #include <utility>
 #include <vector>
 
-#include "tbb/concurrent_vector.h"
-
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -35,12 +33,12 @@ std::shared_ptr<const Table> ShowColumns::_on_execute() {
 
   const auto& column_names = table->column_names();
   const auto vc_names = std::make_shared<ValueColumn<std::string>>(
-      tbb::concurrent_vector<std::string>(column_names.begin(), column_names.end()));
+      AppendOnlyVector<std::string>(column_names.begin(), column_names.end()));
   chunk->add_column(vc_names);
 
   const auto& column_types = table->column_types();
 
-  auto data_types = tbb::concurrent_vector<std::string>{};
+  auto data_types = AppendOnlyVector<std::string>{};
   for (const auto column_type : column_types) {
     data_types.push_back(data_type_to_string.left.at(column_type));
   }
@@ -50,7 +48,7 @@ std::shared_ptr<const Table> ShowColumns::_on_execute() {
 
   const auto& column_nullables = table->column_nullables();
   const auto vc_nullables = std::make_shared<ValueColumn<int32_t>>(
-      tbb::concurrent_vector<int32_t>(column_nullables.begin(), column_nullables.end()));
+      AppendOnlyVector<int32_t>(column_nullables.begin(), column_nullables.end()));
   chunk->add_column(vc_nullables);
 
   out_table->emplace_chunk(std::move(chunk));
@@ -5,8 +5,6 @@
 #include <utility>
 #include <vector>
 
-#include "tbb/concurrent_vector.h"
-
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -26,7 +24,7 @@ std::shared_ptr<const Table> ShowTables::_on_execute() {
 
   const auto table_names = StorageManager::get().table_names();
   const auto column = std::make_shared<ValueColumn<std::string>>(
-      tbb::concurrent_vector<std::string>(table_names.begin(), table_names.end()));
+      AppendOnlyVector<std::string>(table_names.begin(), table_names.end()));
 
   auto chunk = std::make_shared<Chunk>();
   chunk->add_column(column);
@@ -0,0 +1,176 @@
+#include "normalized_join_keys.hpp"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/key_hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+enum class WordType { Integer, Double, String };
+
+using StringDictionary = std::unordered_map<std::string, uint64_t>;
+
+// The index of the right strings that are not in the dictionary of the left strings
+constexpr auto UNKNOWN_STRING = std::numeric_limits<uint64_t>::max();
+
+// One column of one side of a join predicate
+struct KeyColumn {
+  ColumnID column_id;
+  DataType data_type;
+  WordType word_type;
+  const StringDictionary* dictionary;
+};
+
+template <typename T>
+uint64_t normalize(const T& value, const WordType word_type, const StringDictionary* dictionary) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto iter = dictionary->find(value);
+    return iter != dictionary->cend() ? iter->second : UNKNOWN_STRING;
+  } else {
+    if (word_type == WordType::Integer) return static_cast<uint64_t>(static_cast<int64_t>(value));
+
+    const auto double_value = static_cast<double>(normalize_key_value(value));
+    auto word = uint64_t{0};
+    std::memcpy(&word, &double_value, sizeof(word));
+    return word;
+  }
+}
+
+template <typename TableKeys>
+void normalize_table(const Table& table, const std::vector<KeyColumn>& key_columns, TableKeys& table_keys) {
+  const auto word_count = key_columns.size();
+  const auto chunk_count = table.chunk_count();
+
+  table_keys.chunks.resize(chunk_count);
+  auto hash_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table.get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+
+      auto& chunk_keys = table_keys.chunks[chunk_id];
+      chunk_keys.words.resize(chunk_size * word_count);
+      chunk_keys.nulls.resize(chunk_size);
+
+      for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+        const auto& key_column = key_columns[word_index];
+
+        resolve_data_type(key_column.data_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          resolve_column_type<ColumnDataType>(*chunk->get_column(key_column.column_id), [&](const auto& typed_column) {
+            auto chunk_offset = size_t{0};
+            auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+            iterable.for_each([&](const auto& value) {
+              if (value.is_null()) {
+                chunk_keys.nulls[chunk_offset] = true;
+              } else {
+                chunk_keys.words[chunk_offset * word_count + word_index] =
+                    normalize(value.value(), key_column.word_type, key_column.dictionary);
+              }
+              ++chunk_offset;
+            });
+          });
+        });
+      }
+
+      auto hashes = AppendOnlyVector<int64_t>(chunk_size);
+      auto null_values = AppendOnlyVector<bool>(chunk_size);
+      for (auto chunk_offset = size_t{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (chunk_keys.nulls[chunk_offset]) {
+          null_values[chunk_offset] = true;
+        } else {
+          hashes[chunk_offset] =
+              static_cast<int64_t>(hash_key_words(chunk_keys.words.data() + chunk_offset * word_count, word_count));
+        }
+      }
+
+      auto hash_chunk = std::make_shared<Chunk>();
+      hash_chunk->add_column(std::make_shared<ValueColumn<int64_t>>(std::move(hashes), std::move(null_values)));
+      hash_chunks[chunk_id] = std::move(hash_chunk);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  auto key_hashes = std::make_shared<Table>(table.max_chunk_size());
+  key_hashes->add_column_definition("key_hash", DataType::Long, true);
+  for (auto& hash_chunk : hash_chunks) key_hashes->emplace_chunk(std::move(hash_chunk));
+  table_keys.key_hashes = std::move(key_hashes);
+}
+
+}  // namespace
+
+NormalizedJoinKeys::NormalizedJoinKeys(const Table& left_table, const Table& right_table,
+                                       const std::vector<ColumnIDPair>& column_ids)
+    : _word_count(column_ids.size()) {
+  Assert(!column_ids.empty(), "Expected at least one join predicate.");
+
+  // Dictionaries are only referenced by pointer, so their addresses must not change
+  auto dictionaries = std::vector<StringDictionary>(column_ids.size());
+
+  auto left_key_columns = std::vector<KeyColumn>{};
+  auto right_key_columns = std::vector<KeyColumn>{};
+
+  for (auto predicate_index = size_t{0}; predicate_index < column_ids.size(); ++predicate_index) {
+    const auto& [left_column_id, right_column_id] = column_ids[predicate_index];
+    const auto left_data_type = left_table.column_type(left_column_id);
+    const auto right_data_type = right_table.column_type(right_column_id);
+
+    auto word_type = WordType::Integer;
+    if (left_data_type == DataType::String || right_data_type == DataType::String) {
+      Assert(left_data_type == right_data_type, "Cannot join strings with numbers.");
+      word_type = WordType::String;
+
+      auto& dictionary = dictionaries[predicate_index];
+      for (ChunkID chunk_id{0}; chunk_id < left_table.chunk_count(); ++chunk_id) {
+        const auto column = left_table.get_chunk(chunk_id)->get_column(left_column_id);
+        resolve_column_type<std::string>(*column, [&](const auto& typed_column) {
+          auto iterable = create_iterable_from_column<std::string>(typed_column);
+          iterable.for_each([&](const auto& value) {
+            if (!value.is_null()) dictionary.emplace(value.value(), dictionary.size());
+          });
+        });
+      }
+    } else if (left_data_type == DataType::Float || left_data_type == DataType::Double ||
+               right_data_type == DataType::Float || right_data_type == DataType::Double) {
+      word_type = WordType::Double;
+    }
+
+    left_key_columns.emplace_back(KeyColumn{left_column_id, left_data_type, word_type, &dictionaries[predicate_index]});
+    right_key_columns.emplace_back(
+        KeyColumn{right_column_id, right_data_type, word_type, &dictionaries[predicate_index]});
+  }
+
+  normalize_table(left_table, left_key_columns, _left);
+  normalize_table(right_table, right_key_columns, _right);
+}
+
+const std::shared_ptr<const Table>& NormalizedJoinKeys::left_key_hashes() const { return _left.key_hashes; }
+
+const std::shared_ptr<const Table>& NormalizedJoinKeys::right_key_hashes() const { return _right.key_hashes; }
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Join keys of joins with multiple equality predicates (see AbstractJoinOperator::additional_column_ids()). The values
+ * of all join columns of a row are normalized into a fixed-width key of one 64-bit word per predicate, so that a row of
+ * the left and a row of the right table fulfill all predicates iff their keys are equal:
+ *  - If a column of a predicate is floating-point, the values of both columns are converted to double. Otherwise, they
+ *    are widened to int64_t.
+ *  - Strings are replaced by their index in a dictionary of the strings of the left column. Strings of the right
+ *    column that are not in the dictionary are replaced by an index that no left string has.
+ *
+ * The join operators join on a 64-bit hash of the keys (see left_key_hashes()) instead of a single column and use
+ * keys_equal() to drop the candidate pairs whose keys only share their hash.
+ */
+class NormalizedJoinKeys {
+ public:
+  // column_ids.front() is the primary predicate of the join
+  NormalizedJoinKeys(const Table& left_table, const Table& right_table, const std::vector<ColumnIDPair>& column_ids);
+
+  /**
+   * Tables with a single nullable Long column that holds the hash of the key of each row of the left and right table,
+   * respectively, or NULL if any of the row's join columns is NULL. Their chunks have the sizes of the input chunks.
+   */
+  const std::shared_ptr<const Table>& left_key_hashes() const;
+  const std::shared_ptr<const Table>& right_key_hashes() const;
+
+  /**
+   * Returns whether a row of the left and a row of the right table fulfill all join predicates. The rows are addressed
+   * by their chunk and their index in it, even in tables of ReferenceColumns. Rows with NULL keys never match.
+   */
+  bool keys_equal(const RowID& left_row_id, const RowID& right_row_id) const {
+    const auto& left_chunk = _left.chunks[left_row_id.chunk_id];
+    const auto& right_chunk = _right.chunks[right_row_id.chunk_id];
+    if (left_chunk.nulls[left_row_id.chunk_offset] || right_chunk.nulls[right_row_id.chunk_offset]) return false;
+
+    const auto* left_key = left_chunk.words.data() + left_row_id.chunk_offset * _word_count;
+    const auto* right_key = right_chunk.words.data() + right_row_id.chunk_offset * _word_count;
+    return std::equal(left_key, left_key + _word_count, right_key);
+  }
+
+ protected:
+  struct ChunkKeys {
+    // The keys of all rows of the chunk, one after another
+    std::vector<uint64_t> words;
+    std::vector<bool> nulls;
+  };
+
+  struct TableKeys {
+    std::vector<ChunkKeys> chunks;
+    std::shared_ptr<const Table> key_hashes;
+  };
+
+  const size_t _word_count;
+  TableKeys _left;
+  TableKeys _right;
+};
+
+}  // namespace opossum
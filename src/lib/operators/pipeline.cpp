@@ -0,0 +1,263 @@
+#include "pipeline.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "join_hash.hpp"
+#include "projection.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "table_scan/base_table_scan_impl.hpp"
+#include "utils/assert.hpp"
+#include "validate.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::vector<ChunkID> get_excluded_chunk_ids(const AbstractOperator& stage) {
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&stage)) return table_scan->excluded_chunk_ids();
+  if (const auto validate = dynamic_cast<const Validate*>(&stage)) return validate->excluded_chunk_ids();
+  return {};
+}
+
+// Whether a JoinHash stage probes with its left input, i.e., with the output of the preceding stage
+bool probes_left_input(const AbstractOperator& join_hash, const std::shared_ptr<const AbstractOperator>& build_input) {
+  return join_hash.input_right() == build_input;
+}
+
+/**
+ * Creates an operator with the configuration of `stage` on top of `input`, and of `build_input` for a JoinHash. Like in
+ * AbstractOperator::recreate(), placeholders are replaced by the given arguments.
+ */
+std::shared_ptr<AbstractOperator> recreate_stage(const AbstractOperator& stage,
+                                                 const std::shared_ptr<AbstractOperator>& input,
+                                                 const std::shared_ptr<AbstractOperator>& build_input,
+                                                 const bool probe_is_left,
+                                                 const std::vector<AllParameterVariant>& args,
+                                                 const std::vector<ChunkID>& excluded_chunk_ids) {
+  if (const auto table_scan = dynamic_cast<const TableScan*>(&stage)) {
+    auto right_parameter = table_scan->right_parameter();
+    if (is_placeholder(right_parameter)) {
+      const auto index = boost::get<ValuePlaceholder>(right_parameter).index();
+      if (index < args.size()) right_parameter = args[index];
+    }
+
+    const auto new_table_scan = std::make_shared<TableScan>(input, table_scan->left_column_id(),
+                                                            table_scan->scan_type(), right_parameter);
+    new_table_scan->set_excluded_chunk_ids(excluded_chunk_ids);
+    return new_table_scan;
+  }
+
+  if (dynamic_cast<const Validate*>(&stage)) {
+    const auto new_validate = std::make_shared<Validate>(input);
+    new_validate->set_excluded_chunk_ids(excluded_chunk_ids);
+    return new_validate;
+  }
+
+  if (const auto projection = dynamic_cast<const Projection*>(&stage)) {
+    return std::make_shared<Projection>(input, projection->column_expressions());
+  }
+
+  if (const auto join_hash = dynamic_cast<const JoinHash*>(&stage)) {
+    return std::make_shared<JoinHash>(probe_is_left ? input : build_input, probe_is_left ? build_input : input,
+                                      join_hash->mode(), join_hash->column_ids(), join_hash->scan_type(),
+                                      join_hash->additional_column_ids());
+  }
+
+  Fail("Operator " + stage.name() + " cannot be a stage of a Pipeline.");
+}
+
+}  // namespace
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator> in,
+                   const std::vector<std::shared_ptr<const AbstractOperator>>& stages,
+                   const std::shared_ptr<const AbstractOperator> build_input)
+    : AbstractReadOnlyOperator(in, build_input), _stages(stages) {
+  Assert(!_stages.empty(), "Expected at least one stage.");
+
+  auto has_join_stage = false;
+  for (auto stage_idx = size_t{0}; stage_idx < _stages.size(); ++stage_idx) {
+    const auto previous_stages = std::vector<std::shared_ptr<const AbstractOperator>>(
+        _stages.begin(), _stages.begin() + stage_idx);
+    Assert(can_append_stage(previous_stages, *_stages[stage_idx]),
+           "Operator " + _stages[stage_idx]->name() + " cannot be a stage at this position.");
+
+    if (std::dynamic_pointer_cast<const JoinHash>(_stages[stage_idx])) {
+      has_join_stage = true;
+      Assert(build_input && (_stages[stage_idx]->input_left() == build_input) !=
+                                (_stages[stage_idx]->input_right() == build_input),
+             "The build input must be exactly one of the inputs of the JoinHash stage.");
+    }
+  }
+
+  Assert(has_join_stage == static_cast<bool>(build_input), "Only Pipelines with a JoinHash stage have a build input.");
+}
+
+bool Pipeline::can_append_stage(const std::vector<std::shared_ptr<const AbstractOperator>>& stages,
+                                const AbstractOperator& op) {
+  if (dynamic_cast<const Projection*>(&op)) return true;
+
+  const auto table_scan = dynamic_cast<const TableScan*>(&op);
+  const auto validate = dynamic_cast<const Validate*>(&op);
+
+  if (const auto join_hash = dynamic_cast<const JoinHash*>(&op)) {
+    const auto mode = join_hash->mode();
+    if (mode != JoinMode::Inner && mode != JoinMode::Left && mode != JoinMode::Right && mode != JoinMode::Semi &&
+        mode != JoinMode::Anti) {
+      return false;
+    }
+    if (!join_hash->additional_column_ids().empty()) return false;
+  } else if (table_scan || validate) {
+    if (table_scan ? table_scan->join_bloom_filter() != nullptr : validate->join_bloom_filter() != nullptr) {
+      return false;
+    }
+  } else {
+    return false;
+  }
+
+  if (stages.empty()) return true;
+
+  // The ids of excluded chunks only match those of the morsels for the first stage
+  if (!get_excluded_chunk_ids(op).empty()) return false;
+
+  // If the last stage is a TableScan or Validate, all stages are
+  const auto& last_stage = *stages.back();
+  return dynamic_cast<const TableScan*>(&last_stage) || dynamic_cast<const Validate*>(&last_stage);
+}
+
+const std::vector<std::shared_ptr<const AbstractOperator>>& Pipeline::stages() const { return _stages; }
+
+const std::string Pipeline::name() const { return "Pipeline"; }
+
+const std::string Pipeline::description(DescriptionMode description_mode) const {
+  std::stringstream desc;
+  desc << name() << (description_mode == DescriptionMode::MultiLine ? "\n" : " ") << "(";
+  for (auto stage_idx = size_t{0}; stage_idx < _stages.size(); ++stage_idx) {
+    desc << _stages[stage_idx]->description(DescriptionMode::SingleLine);
+    if (stage_idx + 1 < _stages.size()) desc << " -> ";
+  }
+  desc << ")";
+  return desc.str();
+}
+
+std::shared_ptr<AbstractOperator> Pipeline::recreate(const std::vector<AllParameterVariant>& args) const {
+  const auto input = _input_left->recreate(args);
+  const auto build_input = _input_right ? _input_right->recreate(args) : nullptr;
+
+  auto stages = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  auto stage_input = input;
+  for (const auto& stage : _stages) {
+    stage_input = recreate_stage(*stage, stage_input, build_input, probes_left_input(*stage, _input_right), args,
+                                 get_excluded_chunk_ids(*stage));
+    stages.emplace_back(stage_input);
+  }
+
+  return std::make_shared<Pipeline>(input, stages, build_input);
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() { return _on_execute(nullptr); }
+
+std::shared_ptr<const Table> Pipeline::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
+  const auto input_table = _input_table_left();
+  auto output = Table::create_with_layout_from(_prepare_stages(input_table, transaction_context));
+
+  // Without a chunk that has columns, there is nothing to derive the columns of an empty output chunk from
+  if (input_table->chunk_count() == 0 || input_table->get_chunk(ChunkID{0})->column_count() == 0) return output;
+
+  // The first stage skips the morsels of the chunks that the stage template excludes
+  const auto excluded_chunk_ids = get_excluded_chunk_ids(*_stages.front());
+  const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
+
+  const auto chunk_count = input_table->chunk_count();
+  auto morsel_outputs = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (excluded_chunk_set.count(chunk_id)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_guard = input_table->get_chunk_with_access_counting(chunk_id);
+      morsel_outputs[chunk_id] = _execute_morsel(*input_table->get_chunk(chunk_id), chunk_id);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto& morsel_output : morsel_outputs) {
+    if (!morsel_output) continue;
+
+    if (morsel_output->size() > 0 || output->get_chunk(ChunkID{0})->size() == 0) {
+      output->emplace_chunk(std::move(morsel_output));
+    }
+  }
+
+  // All morsels were excluded, so the stages create the empty output chunk from an empty one of the input
+  if (output->get_chunk(ChunkID{0})->column_count() == 0) {
+    output->emplace_chunk(_execute_morsel(*_create_empty_reference_chunk(input_table), ChunkID{0}));
+  }
+
+  return output;
+}
+
+void Pipeline::_on_cleanup() { _stage_functions.clear(); }
+
+std::shared_ptr<const Table> Pipeline::_prepare_stages(
+    const std::shared_ptr<const Table>& input_table, const std::shared_ptr<TransactionContext>& transaction_context) {
+  _stage_functions.clear();
+
+  // TableScans and Validates only follow each other, so their input always has the layout of the Pipeline's input
+  auto stage_input_layout = input_table;
+
+  for (const auto& stage : _stages) {
+    if (const auto table_scan = std::dynamic_pointer_cast<const TableScan>(stage)) {
+      const auto impl = std::shared_ptr<BaseTableScanImpl>{table_scan->create_impl(input_table)};
+      _stage_functions.emplace_back([table_scan, impl, input_table](const Chunk& chunk_in, const ChunkID chunk_id) {
+        return table_scan->scan_chunk(*impl, input_table, chunk_in, chunk_id);
+      });
+    } else if (std::dynamic_pointer_cast<const Validate>(stage)) {
+      Assert(transaction_context != nullptr, "Validate can't be called without a transaction context.");
+      _stage_functions.emplace_back([input_table, transaction_context](const Chunk& chunk_in, const ChunkID chunk_id) {
+        return Validate::validate_chunk(input_table, chunk_in, chunk_id, *transaction_context);
+      });
+    } else if (const auto projection = std::dynamic_pointer_cast<const Projection>(stage)) {
+      const auto output_layout = projection->create_output_layout(stage_input_layout);
+      _stage_functions.emplace_back([projection, output_layout](const Chunk& chunk_in, const ChunkID) {
+        return projection->project_chunk(*output_layout, chunk_in);
+      });
+      stage_input_layout = output_layout;
+    } else if (const auto join_hash = std::dynamic_pointer_cast<const JoinHash>(stage)) {
+      // The hash table is built once per execution, before any morsel is probed
+      const auto build_table = _input_table_right();
+      const auto probe_is_left = probes_left_input(*join_hash, _input_right);
+      _stage_functions.emplace_back(join_hash->create_probe_function(build_table, input_table, probe_is_left));
+      stage_input_layout = join_hash->create_output_layout(build_table, input_table, probe_is_left);
+    } else {
+      Fail("Operator " + stage->name() + " cannot be a stage of a Pipeline.");
+    }
+  }
+
+  return stage_input_layout;
+}
+
+std::shared_ptr<Chunk> Pipeline::_execute_morsel(const Chunk& chunk_in, const ChunkID chunk_id) const {
+  auto chunk_out = _stage_functions.front()(chunk_in, chunk_id);
+  for (auto stage_idx = size_t{1}; stage_idx < _stage_functions.size(); ++stage_idx) {
+    chunk_out = _stage_functions[stage_idx](*chunk_out, chunk_id);
+  }
+
+  return chunk_out;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that executes a chain of streaming operators, its stages, morsel-wise instead of one operator at a time.
+ * The LQPTranslator fuses TableScans, Validates, and Projections into Pipelines, which are thus delimited by the
+ * operators that need their whole input, e.g., aggregates, sorts, and the build side of hash joins.
+ *
+ * A Pipeline can probe a hash join with its morsels: The build input of the JoinHash stage is the right input of the
+ * Pipeline, which is executed before the Pipeline like any other input. The JoinHash stage builds its hash table once
+ * per execution, and each morsel is then probed right after the stages before the join have run on it.
+ *
+ * Every chunk of the input is a morsel that is processed by its own task: The task runs the whole chain of stages on
+ * the morsel, so that the intermediate results of a stage are consumed while they are still cached and are released
+ * right after. The output contains the output chunks of the morsels in the order of the input chunks.
+ *
+ * The stage operators are only used as templates and are never executed themselves. Each of them is prepared once per
+ * execution for the layout of its input, and the chunk of a morsel is then passed from one stage directly to the next
+ * one without creating operators or intermediate tables.
+ */
+class Pipeline : public AbstractReadOnlyOperator {
+ public:
+  /**
+   * The stages are ordered from the one that consumes the input to the one that produces the output. If one of them is
+   * a JoinHash, `build_input` must be its other input.
+   */
+  Pipeline(const std::shared_ptr<const AbstractOperator> in,
+           const std::vector<std::shared_ptr<const AbstractOperator>>& stages,
+           const std::shared_ptr<const AbstractOperator> build_input = nullptr);
+
+  /**
+   * Returns whether `op` can follow the given stages. Projections can follow any stage. TableScans and Validates can
+   * only follow each other, as they would otherwise reference the output of a Projection for a single morsel. They
+   * also must not apply a JoinBloomFilter, and only the first stage may exclude chunks of the input. A JoinHash
+   * without additional predicates can follow TableScans and Validates for the same reason, but only Projections can
+   * follow it, and a Pipeline probes at most one join. Which side of the join a Pipeline can probe with depends on the
+   * join mode, see JoinHash::create_probe_function().
+   */
+  static bool can_append_stage(const std::vector<std::shared_ptr<const AbstractOperator>>& stages,
+                               const AbstractOperator& op);
+
+  const std::vector<std::shared_ptr<const AbstractOperator>>& stages() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
+
+ protected:
+  // Runs a stage on a chunk that is either the chunk with the given id of the input table or derived from it
+  using StageFunction = std::function<std::shared_ptr<Chunk>(const Chunk& chunk_in, const ChunkID chunk_id)>;
+
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_cleanup() override;
+
+  // Prepares the stages for chunks of `input_table` and returns a table without rows that has the output's columns
+  std::shared_ptr<const Table> _prepare_stages(const std::shared_ptr<const Table>& input_table,
+                                               const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Runs all stages on a chunk of the input and returns their output
+  std::shared_ptr<Chunk> _execute_morsel(const Chunk& chunk_in, const ChunkID chunk_id) const;
+
+  const std::vector<std::shared_ptr<const AbstractOperator>> _stages;
+  std::vector<StageFunction> _stage_functions;
+};
+
+}  // namespace opossum
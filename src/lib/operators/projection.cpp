@@ -5,6 +5,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -40,12 +41,12 @@ std::shared_ptr<AbstractOperator> Projection::recreate(const std::vector<AllPara
 
 template <typename T>
 void Projection::_create_column(boost::hana::basic_type<T> type, const std::shared_ptr<Chunk>& chunk,
-                                const ChunkID chunk_id, const std::shared_ptr<PQPExpression>& expression,
-                                std::shared_ptr<const Table> input_table_left, bool reuse_column_from_input) {
+                                const Chunk& chunk_in, const std::shared_ptr<PQPExpression>& expression,
+                                bool reuse_column_from_input) {
   // check whether term is a just a simple column and bypass this column
   if (reuse_column_from_input) {
     // we have to use get_mutable_column here because we cannot add a const column to the chunk
-    auto bypassed_column = input_table_left->get_chunk(chunk_id)->get_mutable_column(expression->column_id());
+    auto bypassed_column = chunk_in.get_mutable_column(expression->column_id());
     return chunk->add_column(bypassed_column);
   }
 
@@ -53,19 +54,19 @@ void Projection::_create_column(boost::hana::basic_type<T> type, const std::shar
 
   if (expression->is_null_literal()) {
     // fill a nullable column with NULLs
-    auto row_count = input_table_left->get_chunk(chunk_id)->size();
-    auto null_values = pmr_concurrent_vector<bool>(row_count, true);
+    auto row_count = chunk_in.size();
+    auto null_values = AppendOnlyVector<bool>(row_count, true);
     // Explicitly pass T{} because in some cases it won't initialize otherwise
-    auto values = pmr_concurrent_vector<T>(row_count, T{});
+    auto values = AppendOnlyVector<T>(row_count, T{});
 
     column = std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
   } else {
     // fill a value column with the specified expression
-    auto values = _evaluate_expression<T>(expression, input_table_left, chunk_id);
+    auto values = _evaluate_expression<T>(expression, chunk_in);
 
-    pmr_concurrent_vector<T> non_null_values;
+    AppendOnlyVector<T> non_null_values;
     non_null_values.reserve(values.size());
-    pmr_concurrent_vector<bool> null_values;
+    AppendOnlyVector<bool> null_values;
     null_values.reserve(values.size());
 
     for (const auto value : values) {
@@ -79,9 +80,8 @@ void Projection::_create_column(boost::hana::basic_type<T> type, const std::shar
   chunk->add_column(column);
 }
 
-std::shared_ptr<const Table> Projection::_on_execute() {
+std::shared_ptr<Table> Projection::create_output_layout(const std::shared_ptr<const Table>& in_table) const {
   auto output = std::make_shared<Table>();
-  auto reuse_column_from_input = true;
 
   // Prepare terms and output table for each column to project
   for (const auto& column_expression : _column_expressions) {
@@ -90,18 +90,14 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     if (column_expression->alias()) {
       name = *column_expression->alias();
     } else if (column_expression->type() == ExpressionType::Column) {
-      name = _input_table_left()->column_name(column_expression->column_id());
+      name = in_table->column_name(column_expression->column_id());
     } else if (column_expression->is_arithmetic_operator() || column_expression->type() == ExpressionType::Literal) {
-      name = column_expression->to_string(_input_table_left()->column_names());
+      name = column_expression->to_string(in_table->column_names());
     } else {
       Fail("Expression type is not supported.");
     }
 
-    if (column_expression->type() != ExpressionType::Column) {
-      reuse_column_from_input = false;
-    }
-
-    const auto type = _get_type_of_expression(column_expression, _input_table_left());
+    const auto type = _get_type_of_expression(column_expression, in_table);
     if (type == DataType::Null) {
       // in case of a NULL literal, simply add a nullable int column
       output->add_column_definition(name, DataType::Int, true);
@@ -110,18 +106,31 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     }
   }
 
-  for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    // fill the new table
-    auto chunk_out = std::make_shared<Chunk>();
+  return output;
+}
 
-    for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
-      resolve_data_type(output->column_type(ColumnID{expression_index}), [&](auto type) {
-        _create_column(type, chunk_out, chunk_id, _column_expressions[expression_index], _input_table_left(),
-                       reuse_column_from_input);
-      });
-    }
+std::shared_ptr<Chunk> Projection::project_chunk(const Table& output_layout, const Chunk& chunk_in) const {
+  const auto reuse_column_from_input =
+      std::all_of(_column_expressions.cbegin(), _column_expressions.cend(),
+                  [](const auto& column_expression) { return column_expression->type() == ExpressionType::Column; });
+
+  auto chunk_out = std::make_shared<Chunk>();
 
-    output->emplace_chunk(std::move(chunk_out));
+  for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
+    resolve_data_type(output_layout.column_type(ColumnID{expression_index}), [&](auto type) {
+      _create_column(type, chunk_out, chunk_in, _column_expressions[expression_index], reuse_column_from_input);
+    });
+  }
+
+  return chunk_out;
+}
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  auto output = create_output_layout(_input_table_left());
+
+  for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
+    // fill the new table
+    output->emplace_chunk(project_chunk(*output, *_input_table_left()->get_chunk(chunk_id)));
   }
 
   return output;
@@ -157,36 +166,34 @@ DataType Projection::_get_type_of_expression(const std::shared_ptr<PQPExpression
 
 template <typename T>
 const pmr_concurrent_vector<std::optional<T>> Projection::_evaluate_expression(
-    const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-    const ChunkID chunk_id) {
+    const std::shared_ptr<PQPExpression>& expression, const Chunk& chunk) {
   /**
    * Handle Literal
    * This is only used if the Literal represents a constant column, e.g. in 'SELECT 5 FROM table_a'.
    * On the other hand this is not used for nested arithmetic Expressions, such as 'SELECT a + 5 FROM table_a'.
    */
   if (expression->type() == ExpressionType::Literal) {
-    return pmr_concurrent_vector<std::optional<T>>(table->get_chunk(chunk_id)->size(),
-                                                   boost::get<T>(expression->value()));
+    return pmr_concurrent_vector<std::optional<T>>(chunk.size(), boost::get<T>(expression->value()));
   }
 
   /**
    * Handle column reference
    */
   if (expression->type() == ExpressionType::Column) {
-    auto column = table->get_chunk(chunk_id)->get_column(expression->column_id());
+    auto column = chunk.get_column(expression->column_id());
 
-    if (auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
-      // values are copied
-      return value_column->materialize_values();
-    }
-    if (auto dict_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
-      return dict_column->materialize_values();
-    }
-    if (auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
-      return ref_column->template materialize_values<T>();  // Clang needs the template prefix
-    }
+    auto values = pmr_concurrent_vector<std::optional<T>>{};
+    resolve_column_type<T>(*column, [&](const auto& typed_column) {
+      using ColumnType = std::decay_t<decltype(typed_column)>;
 
-    Fail("Materializing chunk failed.");
+      // values are copied
+      if constexpr (std::is_same<ColumnType, ReferenceColumn>::value) {
+        values = typed_column.template materialize_values<T>();  // Clang needs the template prefix
+      } else {
+        values = typed_column.materialize_values();
+      }
+    });
+    return values;
   }
 
   /**
@@ -197,7 +204,7 @@ const pmr_concurrent_vector<std::optional<T>> Projection::_evaluate_expression(
   const auto& arithmetic_operator_function = _get_operator_function<T>(expression->type());
 
   pmr_concurrent_vector<std::optional<T>> values;
-  values.resize(table->get_chunk(chunk_id)->size());
+  values.resize(chunk.size());
 
   const auto& left = expression->left_child();
   const auto& right = expression->right_child();
@@ -211,7 +218,7 @@ const pmr_concurrent_vector<std::optional<T>> Projection::_evaluate_expression(
     std::fill(values.begin(), values.end(),
               arithmetic_operator_function(boost::get<T>(left->value()), boost::get<T>(right->value())));
   } else if (right_is_literal) {
-    auto left_values = _evaluate_expression<T>(left, table, chunk_id);
+    auto left_values = _evaluate_expression<T>(left, chunk);
     auto right_value = boost::get<T>(right->value());
     // apply operator function to both vectors
     auto func = [&](std::optional<T> left_value) -> std::optional<T> {
@@ -221,7 +228,7 @@ const pmr_concurrent_vector<std::optional<T>> Projection::_evaluate_expression(
     std::transform(left_values.begin(), left_values.end(), values.begin(), func);
 
   } else if (left_is_literal) {
-    auto right_values = _evaluate_expression<T>(right, table, chunk_id);
+    auto right_values = _evaluate_expression<T>(right, chunk);
     auto left_value = boost::get<T>(left->value());
     // apply operator function to both vectors
     auto func = [&](std::optional<T> right_value) -> std::optional<T> {
@@ -231,8 +238,8 @@ const pmr_concurrent_vector<std::optional<T>> Projection::_evaluate_expression(
     std::transform(right_values.begin(), right_values.end(), values.begin(), func);
 
   } else {
-    auto left_values = _evaluate_expression<T>(left, table, chunk_id);
-    auto right_values = _evaluate_expression<T>(right, table, chunk_id);
+    auto left_values = _evaluate_expression<T>(left, chunk);
+    auto right_values = _evaluate_expression<T>(right, chunk);
 
     // apply operator function to both vectors
     auto func = [&](std::optional<T> left, std::optional<T> right) -> std::optional<T> {
@@ -38,6 +38,18 @@ class Projection : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
+  /**
+   * @defgroup Projecting single chunks without executing the Projection, e.g., to pass the output of one stage of a
+   * Pipeline directly to the next one
+   *
+   * create_output_layout() returns a table without rows that has the columns of the Projection's output for an input
+   * with the layout of `in_table`. project_chunk() evaluates the expressions on a chunk of such an input.
+   * @{
+   */
+  std::shared_ptr<Table> create_output_layout(const std::shared_ptr<const Table>& in_table) const;
+  std::shared_ptr<Chunk> project_chunk(const Table& output_layout, const Chunk& chunk_in) const;
+  /**@}*/
+
   /**
    * The dummy table is used for literal projections that have no input table.
    * This was introduce to allow queries like INSERT INTO tbl VALUES (1, 2, 3);
@@ -62,8 +74,8 @@ class Projection : public AbstractReadOnlyOperator {
 
   template <typename T>
   static void _create_column(boost::hana::basic_type<T> type, const std::shared_ptr<Chunk>& chunk,
-                             const ChunkID chunk_id, const std::shared_ptr<PQPExpression>& expression,
-                             std::shared_ptr<const Table> input_table_left, bool reuse_column_from_input);
+                             const Chunk& chunk_in, const std::shared_ptr<PQPExpression>& expression,
+                             bool reuse_column_from_input);
 
   static DataType _get_type_of_expression(const std::shared_ptr<PQPExpression>& expression,
                                           const std::shared_ptr<const Table>& table);
@@ -74,8 +86,7 @@ class Projection : public AbstractReadOnlyOperator {
    */
   template <typename T>
   static const pmr_concurrent_vector<std::optional<T>> _evaluate_expression(
-      const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-      const ChunkID chunk_id);
+      const std::shared_ptr<PQPExpression>& expression, const Chunk& chunk);
 
   /**
    * Operators that all numerical types support.
@@ -1,222 +1,449 @@
 #include "sort.hpp"
 
-#include <functional>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <numeric>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "storage/base_attribute_vector.hpp"
-#include "storage/column_visitable.hpp"
-#include "storage/iterables/chunk_offset_mapping.hpp"
-#include "storage/iterables/dictionary_column_iterable.hpp"
-#include "storage/iterables/value_column_iterable.hpp"
-#include "storage/reference_column.hpp"
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
 #include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/key_hash.hpp"
 
 namespace opossum {
 
-Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
-    : AbstractReadOnlyOperator(in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+namespace {
 
-ColumnID Sort::column_id() const { return _column_id; }
+// Strings contribute this many bytes to the normalized keys. Rows with equal prefixes compare the full strings.
+constexpr auto STRING_PREFIX_LENGTH = size_t{8};
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+// The sample sort uses one bucket per 2^16 rows, but at most 64 buckets
+constexpr auto MIN_ROWS_PER_BUCKET = size_t{1} << 16u;
+constexpr auto MAX_BUCKET_COUNT = size_t{64};
+constexpr auto SAMPLES_PER_BUCKET = size_t{32};
 
-const std::string Sort::name() const { return "Sort"; }
+// Values of the NULL byte that precedes the value of each sort column in the normalized key
+constexpr auto NULL_FIRST = uint8_t{0};
+constexpr auto NOT_NULL = uint8_t{1};
+constexpr auto NULL_LAST = uint8_t{2};
 
-std::shared_ptr<AbstractOperator> Sort::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Sort>(_input_left->recreate(args), _column_id, _order_by_mode, _output_chunk_size);
+template <typename T>
+constexpr size_t encoded_value_width() {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return STRING_PREFIX_LENGTH;
+  } else {
+    return sizeof(T);
+  }
 }
 
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(_input_table_left()->column_type(_column_id),
-                                                                           _input_table_left(), _column_id,
-                                                                           _order_by_mode, _output_chunk_size);
-  return _impl->_on_execute();
+template <typename UnsignedT>
+void write_big_endian(const UnsignedT value, uint8_t* out) {
+  for (auto byte_index = size_t{0}; byte_index < sizeof(UnsignedT); ++byte_index) {
+    out[byte_index] = static_cast<uint8_t>(value >> ((sizeof(UnsignedT) - 1 - byte_index) * 8));
+  }
 }
 
-void Sort::_on_cleanup() { _impl.reset(); }
+// Writes a value so that the byte order of the encoded values matches the order of the values
+template <typename T>
+void encode_value(const T& value, uint8_t* out) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    std::memcpy(out, value.data(), std::min(value.size(), STRING_PREFIX_LENGTH));
+  } else if constexpr (std::is_integral<T>::value) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = UnsignedT{1} << (sizeof(T) * 8 - 1);
+    write_big_endian(static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ sign_bit), out);
+  } else {
+    using UnsignedT = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = UnsignedT{1} << (sizeof(T) * 8 - 1);
+
+    const auto normalized_value = normalize_key_value(value);
+    auto bits = UnsignedT{0};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+
+    // Negative numbers are ordered inversely to their bit patterns
+    write_big_endian(static_cast<UnsignedT>((bits & sign_bit) ? ~bits : bits ^ sign_bit), out);
+  }
+}
 
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
+/**
+ * The values of one column of the input table, indexed by the position of their row in the input table
+ */
+class BaseMaterializedColumn {
  public:
-  // creates a new table with reference columns
-  SortImplMaterializeOutput(std::shared_ptr<const Table> in,
-                            std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
-
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = Table::create_with_layout_from(_table_in, _output_chunk_size);
-
-    // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
-
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input column with a reference
-    // to the output column. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
-
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
-
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
-
-    auto chunks_out = std::vector<std::shared_ptr<Chunk>>(chunk_count_out);
-    std::generate(chunks_out.begin(), chunks_out.end(), []() { return std::make_shared<Chunk>(); });
-
-    // Materialize column-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_type(column_id);
-
-      resolve_data_type(column_data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
-
-        // Initialize value columns
-        auto columns_out = std::vector<std::shared_ptr<ValueColumn<ColumnDataType>>>(chunk_count_out);
-        std::generate(columns_out.begin(), columns_out.end(),
-                      []() { return std::make_shared<ValueColumn<ColumnDataType>>(true); });
-
-        auto column_it = columns_out.begin();
-        auto chunk_it = chunks_out.begin();
-        auto chunk_offset_out = 0u;
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto[chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;
-
-          const auto column = _table_in->get_chunk(chunk_id)->get_column(column_id);
-
-          // Previously the value was retrieved by calling a virtual method,
-          // which was just as slow as using the subscript operator.
-          const auto value = (*column)[chunk_offset];
-          (*column_it)->append(value);
-
-          ++chunk_offset_out;
-
-          // Check if value column is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            (*chunk_it)->add_column(*column_it);
-            ++column_it;
-            ++chunk_it;
-          }
-        }
+  virtual ~BaseMaterializedColumn() = default;
+
+  virtual void materialize(const BaseColumn& column, const size_t first_row) = 0;
+
+  // Writes the NULL byte and the encoded value of each row of [row_begin, row_end) to its key at `offset`
+  virtual void encode_keys(const size_t row_begin, const size_t row_end, const SortColumnDefinition& definition,
+                           const size_t offset, const size_t key_width, std::vector<uint8_t>& keys) const = 0;
 
-        // Last column has not been added
-        if (chunk_offset_out > 0u) {
-          (*chunk_it)->add_column(*column_it);
+  // Moves the values of `rows` into a ValueColumn
+  virtual std::shared_ptr<BaseColumn> gather(const std::vector<size_t>::const_iterator rows_begin,
+                                             const std::vector<size_t>::const_iterator rows_end) = 0;
+};
+
+template <typename T>
+class MaterializedColumn : public BaseMaterializedColumn {
+ public:
+  explicit MaterializedColumn(const size_t row_count) : values(row_count), null_values(row_count) {}
+
+  void materialize(const BaseColumn& column, const size_t first_row) override {
+    resolve_column_type<T>(column, [&](const auto& typed_column) {
+      auto row = first_row;
+      auto iterable = create_iterable_from_column<T>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        if (value.is_null()) {
+          null_values[row] = true;
+        } else {
+          values[row] = value.value();
         }
+        ++row;
       });
+    });
+  }
+
+  void encode_keys(const size_t row_begin, const size_t row_end, const SortColumnDefinition& definition,
+                   const size_t offset, const size_t key_width, std::vector<uint8_t>& keys) const override {
+    const auto order_by_mode = definition.order_by_mode;
+    const auto descending =
+        order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+    const auto null_byte = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending
+                               ? NULL_FIRST
+                               : NULL_LAST;
+
+    for (auto row = row_begin; row < row_end; ++row) {
+      auto* key = keys.data() + row * key_width + offset;
+
+      if (null_values[row]) {
+        key[0] = null_byte;
+        continue;
+      }
+
+      key[0] = NOT_NULL;
+      encode_value(values[row], key + 1);
+
+      if (descending) {
+        for (auto byte_index = size_t{1}; byte_index <= encoded_value_width<T>(); ++byte_index) {
+          key[byte_index] = ~key[byte_index];
+        }
+      }
     }
+  }
 
-    for (auto& chunk : chunks_out) {
-      output->emplace_chunk(std::move(chunk));
+  std::shared_ptr<BaseColumn> gather(const std::vector<size_t>::const_iterator rows_begin,
+                                     const std::vector<size_t>::const_iterator rows_end) override {
+    const auto row_count = static_cast<size_t>(std::distance(rows_begin, rows_end));
+    auto output_values = AppendOnlyVector<T>(row_count);
+    auto output_null_values = AppendOnlyVector<bool>(row_count);
+
+    // Every row is gathered exactly once, so its value can be moved
+    auto output_offset = size_t{0};
+    for (auto row_iter = rows_begin; row_iter != rows_end; ++row_iter, ++output_offset) {
+      if (null_values[*row_iter]) {
+        output_null_values[output_offset] = true;
+      } else {
+        output_values[output_offset] = std::move(values[*row_iter]);
+      }
     }
 
-    return output;
+    return std::make_shared<ValueColumn<T>>(std::move(output_values), std::move(output_null_values));
   }
 
-  const std::shared_ptr<const Table> _table_in;
-  const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
+  std::vector<T> values;
+  // Not std::vector<bool>, because the chunks are materialized concurrently
+  std::vector<uint8_t> null_values;
 };
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
+/**
+ * Compares two rows by their normalized keys. The keys are compared in segments that end after the prefix of a string
+ * column: If the prefixes of two rows are equal, their full strings decide. Rows with equal keys keep their order.
+ */
+class RowComparator {
  public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table> table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
-
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      sort_with_operator<std::less<>>();
-    } else {
-      sort_with_operator<std::greater<>>();
+  struct Segment {
+    size_t end;
+    // The strings of the string column whose prefix ends the segment, nullptr otherwise
+    const std::vector<std::string>* strings;
+    size_t null_byte_offset;
+    bool descending;
+  };
+
+  RowComparator(const std::vector<uint8_t>& keys, const size_t key_width, std::vector<Segment> segments)
+      : _keys(keys), _key_width(key_width), _segments(std::move(segments)) {}
+
+  bool operator()(const size_t left_row, const size_t right_row) const {
+    const auto* left_key = _keys.data() + left_row * _key_width;
+    const auto* right_key = _keys.data() + right_row * _key_width;
+
+    auto begin = size_t{0};
+    for (const auto& segment : _segments) {
+      const auto result = std::memcmp(left_key + begin, right_key + begin, segment.end - begin);
+      if (result != 0) return result < 0;
+
+      if (segment.strings && left_key[segment.null_byte_offset] == NOT_NULL) {
+        const auto& left_string = (*segment.strings)[left_row];
+        const auto& right_string = (*segment.strings)[right_row];
+        if (left_string != right_string) {
+          return segment.descending ? right_string < left_string : left_string < right_string;
+        }
+      }
+
+      begin = segment.end;
     }
 
-    // 2b. Insert null rows if necessary
-    if (_null_value_rows->size()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
+    return left_row < right_row;
+  }
+
+ protected:
+  const std::vector<uint8_t>& _keys;
+  const size_t _key_width;
+  const std::vector<Segment> _segments;
+};
+
+// Returns the rows in sorted order
+std::vector<size_t> sample_sort(const size_t row_count, const RowComparator& comparator) {
+  auto sorted_rows = std::vector<size_t>(row_count);
+
+  const auto bucket_count = std::clamp(row_count / MIN_ROWS_PER_BUCKET, size_t{1}, MAX_BUCKET_COUNT);
+  if (bucket_count == 1) {
+    std::iota(sorted_rows.begin(), sorted_rows.end(), size_t{0});
+    std::sort(sorted_rows.begin(), sorted_rows.end(), comparator);
+    return sorted_rows;
+  }
+
+  // Choose the splitters between the buckets from an evenly spaced sample of the rows
+  auto sample = std::vector<size_t>(bucket_count * SAMPLES_PER_BUCKET);
+  for (auto sample_index = size_t{0}; sample_index < sample.size(); ++sample_index) {
+    sample[sample_index] = sample_index * row_count / sample.size();
+  }
+  std::sort(sample.begin(), sample.end(), comparator);
+
+  auto splitters = std::vector<size_t>(bucket_count - 1);
+  for (auto bucket_index = size_t{1}; bucket_index < bucket_count; ++bucket_index) {
+    splitters[bucket_index - 1] = sample[bucket_index * SAMPLES_PER_BUCKET];
+  }
+
+  // Each task classifies a range of the rows and counts the rows per bucket
+  const auto rows_per_task = (row_count + bucket_count - 1) / bucket_count;
+  auto row_buckets = std::vector<uint8_t>(row_count);
+  auto bucket_sizes_per_task = std::vector<std::vector<size_t>>(bucket_count, std::vector<size_t>(bucket_count));
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(bucket_count);
+
+  for (auto task_index = size_t{0}; task_index < bucket_count; ++task_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, task_index]() {
+      const auto row_end = std::min(row_count, (task_index + 1) * rows_per_task);
+      for (auto row = task_index * rows_per_task; row < row_end; ++row) {
+        const auto bucket_index = std::upper_bound(splitters.cbegin(), splitters.cend(), row, comparator) -
+                                  splitters.cbegin();
+        row_buckets[row] = static_cast<uint8_t>(bucket_index);
+        ++bucket_sizes_per_task[task_index][bucket_index];
       }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // The position at which each task writes its first row of each bucket
+  auto bucket_offsets = std::vector<size_t>(bucket_count + 1);
+  auto task_offsets = std::vector<std::vector<size_t>>(bucket_count, std::vector<size_t>(bucket_count));
+  auto offset = size_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < bucket_count; ++bucket_index) {
+    bucket_offsets[bucket_index] = offset;
+    for (auto task_index = size_t{0}; task_index < bucket_count; ++task_index) {
+      task_offsets[task_index][bucket_index] = offset;
+      offset += bucket_sizes_per_task[task_index][bucket_index];
     }
+  }
+  bucket_offsets[bucket_count] = offset;
+
+  jobs.clear();
+  for (auto task_index = size_t{0}; task_index < bucket_count; ++task_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, task_index]() {
+      auto& offsets = task_offsets[task_index];
+      const auto row_end = std::min(row_count, (task_index + 1) * rows_per_task);
+      for (auto row = task_index * rows_per_task; row < row_end; ++row) {
+        sorted_rows[offsets[row_buckets[row]]++] = row;
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    return materialization->execute();
+  // Every row of a bucket is smaller than every row of the following buckets, so they can be sorted independently
+  jobs.clear();
+  for (auto bucket_index = size_t{0}; bucket_index < bucket_count; ++bucket_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, bucket_index]() {
+      std::sort(sorted_rows.begin() + bucket_offsets[bucket_index],
+                sorted_rows.begin() + bucket_offsets[bucket_index + 1], comparator);
+    }));
+    jobs.back()->schedule();
   }
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+  CurrentScheduler::wait_for_tasks(jobs);
 
-    auto& null_value_rows = *_null_value_rows;
+  return sorted_rows;
+}
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto chunk = _table_in->get_chunk(chunk_id);
+}  // namespace
 
-      auto base_column = chunk->get_column(_column_id);
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{{column_id, order_by_mode}}, output_chunk_size) {}
 
-      resolve_column_type<SortColumnType>(*base_column, [&](auto& typed_column) {
-        auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(in), _sort_definitions(sort_definitions), _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Expected at least one column to sort by.");
+}
 
-        iterable.for_each([&](const auto& value) {
-          if (value.is_null()) {
-            null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortColumnType{});
-          } else {
-            row_id_value_vector.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
-          }
-        });
-      });
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+ColumnID Sort::column_id() const { return _sort_definitions.front().column_id; }
+
+OrderByMode Sort::order_by_mode() const { return _sort_definitions.front().order_by_mode; }
+
+const std::string Sort::name() const { return "Sort"; }
+
+const std::string Sort::description(DescriptionMode description_mode) const {
+  std::stringstream desc;
+  desc << name() << (description_mode == DescriptionMode::MultiLine ? "\n" : " ") << "(";
+  for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+    const auto& definition = _sort_definitions[definition_idx];
+    if (_input_table_left()) {
+      desc << _input_table_left()->column_name(definition.column_id);
+    } else {
+      desc << "Col #" << definition.column_id;
     }
+    desc << " " << order_by_mode_to_string.at(definition.order_by_mode);
+
+    if (definition_idx + 1 < _sort_definitions.size()) desc << ", ";
+  }
+  desc << ")";
+  return desc.str();
+}
+
+std::shared_ptr<AbstractOperator> Sort::recreate(const std::vector<AllParameterVariant>& args) const {
+  return std::make_shared<Sort>(_input_left->recreate(args), _sort_definitions, _output_chunk_size);
+}
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto row_count = static_cast<size_t>(input_table->row_count());
+  const auto chunk_count = input_table->chunk_count();
+
+  // 1. Materialize all columns, one task per input chunk
+  auto materialized_columns = std::vector<std::unique_ptr<BaseMaterializedColumn>>{};
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      materialized_columns.emplace_back(std::make_unique<MaterializedColumn<ColumnDataType>>(row_count));
+    });
   }
 
-  template <typename Comparator>
-  void sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+  auto first_rows = std::vector<size_t>(chunk_count + 1);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    first_rows[chunk_id + 1] = first_rows[chunk_id] + input_table->get_chunk(chunk_id)->size();
   }
 
-  const std::shared_ptr<const Table> _table_in;
+  // 2. Encode the sort columns into normalized keys in the same tasks
+  auto key_width = size_t{0};
+  auto key_offsets = std::vector<size_t>{};
+  auto segments = std::vector<RowComparator::Segment>{};
+  for (const auto& definition : _sort_definitions) {
+    key_offsets.emplace_back(key_width);
+
+    resolve_data_type(input_table->column_type(definition.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      key_width += 1 + encoded_value_width<ColumnDataType>();
+
+      if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+        const auto& materialized_column =
+            static_cast<const MaterializedColumn<std::string>&>(*materialized_columns[definition.column_id]);
+        const auto descending = definition.order_by_mode == OrderByMode::Descending ||
+                                definition.order_by_mode == OrderByMode::DescendingNullsLast;
+        segments.emplace_back(
+            RowComparator::Segment{key_width, &materialized_column.values, key_offsets.back(), descending});
+      }
+    });
+  }
+  if (segments.empty() || segments.back().end != key_width) {
+    segments.emplace_back(RowComparator::Segment{key_width, nullptr, 0, false});
+  }
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
+  auto keys = std::vector<uint8_t>(row_count * key_width);
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+        materialized_columns[column_id]->materialize(*chunk->get_column(column_id), first_rows[chunk_id]);
+      }
+
+      for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+        const auto& definition = _sort_definitions[definition_idx];
+        materialized_columns[definition.column_id]->encode_keys(first_rows[chunk_id], first_rows[chunk_id + 1],
+                                                                definition, key_offsets[definition_idx], key_width,
+                                                                keys);
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 3. Sort the rows by their keys
+  const auto sorted_rows = sample_sort(row_count, RowComparator{keys, key_width, std::move(segments)});
+
+  // 4. Materialize the output, one task per output chunk. We have decided against duplicating MVCC columns in
+  // https://github.com/hyrise/hyrise/issues/408
+  const auto output_chunk_count = (row_count + _output_chunk_size - 1) / _output_chunk_size;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(output_chunk_count);
+
+  jobs.clear();
+  jobs.reserve(output_chunk_count);
+
+  for (auto output_chunk_idx = size_t{0}; output_chunk_idx < output_chunk_count; ++output_chunk_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_idx]() {
+      const auto rows_begin = sorted_rows.cbegin() + output_chunk_idx * _output_chunk_size;
+      const auto rows_end = sorted_rows.cbegin() + std::min(row_count, (output_chunk_idx + 1) * _output_chunk_size);
+
+      auto output_chunk = std::make_shared<Chunk>();
+      for (auto& materialized_column : materialized_columns) {
+        output_chunk->add_column(materialized_column->gather(rows_begin, rows_end));
+      }
+      output_chunks[output_chunk_idx] = std::move(output_chunk);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  auto output = Table::create_with_layout_from(input_table, _output_chunk_size);
+  for (auto& output_chunk : output_chunks) {
+    output->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output;
+}
 
 }  // namespace opossum
@@ -1,23 +1,37 @@
 #pragma once
 
-#include <algorithm>
-#include <functional>
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
-#include "resolve_type.hpp"
-#include "storage/iterables/create_iterable_from_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * A column to sort by and its sort order. The first SortColumnDefinition of a Sort is the primary sort criterion, the
+ * following ones break its ties.
+ */
+struct SortColumnDefinition {
+  SortColumnDefinition(const ColumnID column_id, const OrderByMode order_by_mode = OrderByMode::Ascending)
+      : column_id(column_id), order_by_mode(order_by_mode) {}
+
+  ColumnID column_id;
+  OrderByMode order_by_mode;
+};
+
+/**
+ * Operator to sort a table by one or more columns. This implements a stable sort, i.e., rows that share the same values
+ * will maintain their relative order.
+ *
+ * The values of the sort columns of each row are encoded into a normalized key that can be compared with memcmp():
+ * Numbers are stored big-endian with their sign bits flipped, so that their byte order matches their numeric order.
+ * Strings contribute a fixed-length prefix, and only rows with equal prefixes compare the full strings. Descending
+ * columns have all bits of their values inverted, and a leading byte per column sorts NULLs first or last.
+ *
+ * The rows are sorted in parallel by a sample sort: Splitters drawn from a sample of the keys assign the rows to
+ * buckets, which are then sorted independently. Finally, every output chunk is materialized by its own task.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -25,27 +39,23 @@ class Sort : public AbstractReadOnlyOperator {
   Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE);
 
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  // The column and sort order of the primary sort criterion
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
-
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
@@ -1,5 +1,6 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -11,11 +12,13 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "join_bloom_filter.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/base_column.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_statistics.hpp"
 #include "storage/proxy_chunk.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
@@ -40,6 +43,15 @@ TableScan::~TableScan() = default;
 
 void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
 
+const std::vector<ChunkID>& TableScan::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
+void TableScan::set_join_bloom_filter(const std::shared_ptr<JoinBloomFilter>& join_bloom_filter) {
+  _join_bloom_filter = join_bloom_filter;
+  _input_right = join_bloom_filter->build_operator();
+}
+
+std::shared_ptr<const JoinBloomFilter> TableScan::join_bloom_filter() const { return _join_bloom_filter; }
+
 ColumnID TableScan::left_column_id() const { return _left_column_id; }
 
 ScanType TableScan::scan_type() const { return _scan_type; }
@@ -61,20 +73,67 @@ const std::string TableScan::description(DescriptionMode description_mode) const
 }
 
 std::shared_ptr<AbstractOperator> TableScan::recreate(const std::vector<AllParameterVariant>& args) const {
+  auto right_parameter = _right_parameter;
+
   // Replace value in the new operator, if it’s a parameter and an argument is available.
   if (is_placeholder(_right_parameter)) {
     const auto index = boost::get<ValuePlaceholder>(_right_parameter).index();
-    if (index < args.size()) {
-      return std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _scan_type, args[index]);
-    }
+    if (index < args.size()) right_parameter = args[index];
   }
-  return std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _scan_type, _right_parameter);
+
+  const auto table_scan =
+      std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _scan_type, right_parameter);
+  table_scan->set_excluded_chunk_ids(_excluded_chunk_ids);
+
+  // The JoinBloomFilter is re-applied by JoinHash::recreate(), which also recreates its build operator
+  return table_scan;
+}
+
+std::unique_ptr<BaseTableScanImpl> TableScan::create_impl(const std::shared_ptr<const Table>& in_table) const {
+  if (_scan_type == ScanType::Like || _scan_type == ScanType::NotLike) {
+    const auto left_column_type = in_table->column_type(_left_column_id);
+    Assert((left_column_type == DataType::String), "LIKE operator only applicable on string columns.");
+
+    DebugAssert(is_variant(_right_parameter), "Right parameter must be variant.");
+
+    const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
+
+    DebugAssert(!variant_is_null(right_value), "Right value must not be NULL.");
+
+    const auto right_wildcard = type_cast<std::string>(right_value);
+
+    return std::make_unique<LikeTableScanImpl>(in_table, _left_column_id, _scan_type, right_wildcard);
+  }
+
+  if (_scan_type == ScanType::IsNull || _scan_type == ScanType::IsNotNull) {
+    return std::make_unique<IsNullTableScanImpl>(in_table, _left_column_id, _scan_type);
+  }
+
+  if (is_variant(_right_parameter)) {
+    const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
+
+    return std::make_unique<SingleColumnTableScanImpl>(in_table, _left_column_id, _scan_type, right_value);
+  } else /* is_column_name(_right_parameter) */ {
+    const auto right_column_id = boost::get<ColumnID>(_right_parameter);
+
+    return std::make_unique<ColumnComparisonTableScanImpl>(in_table, _left_column_id, _scan_type, right_column_id);
+  }
+}
+
+std::shared_ptr<Chunk> TableScan::scan_chunk(BaseTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                             const Chunk& chunk_in, const ChunkID chunk_id) const {
+  auto matches_out = std::make_shared<PosList>();
+  if (!_can_prune_chunk(chunk_in)) *matches_out = impl.scan_chunk(chunk_in, chunk_id);
+
+  return create_reference_chunk(in_table, chunk_in, matches_out);
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
   _in_table = _input_table_left();
 
-  _init_scan();
+  DebugAssert(_in_table->chunk_count() > 0u, "Input table must contain at least 1 chunk.");
+  _impl = create_impl(_in_table);
+  if (_join_bloom_filter) _join_bloom_filter->init(*_in_table);
 
   _output_table = Table::create_with_layout_from(_in_table);
 
@@ -89,63 +148,22 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
     auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
+      const auto chunk_in = _in_table->get_chunk(chunk_id);
+      if (_can_prune_chunk(*chunk_in)) return;
+
       const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
       // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = std::make_shared<PosList>(_impl->scan_chunk(chunk_id));
-
-      // The output chunk is allocated on the same NUMA node as the input chunk. Also, the AccessCounter is
-      // reused to track accesses of the output chunk. Accesses of derived chunks are counted towards the
-      // original chunk.
-      auto chunk_out = std::make_shared<Chunk>(chunk_guard->get_allocator(), chunk_guard->access_counter());
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference columns of the output. If it is a reference column,
-       * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between columns as much as possible. Position lists can be shared between two columns iff
-       * (a) they point to the same table and
-       * (b) the reference columns of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->get_type() == TableType::References) {
-        const auto chunk_in = _in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+      const auto matches_out = std::make_shared<PosList>(_impl->scan_chunk(*chunk_in, chunk_id));
 
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto column_in = chunk_in->get_column(column_id);
-
-          auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
-          DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
-
-          const auto pos_list_in = ref_column_in->pos_list();
-
-          const auto table_out = ref_column_in->referenced_table();
-          const auto column_id_out = ref_column_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
-
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
-          }
-
-          auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
-          chunk_out->add_column(ref_column_out);
-        }
-      } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-          chunk_out->add_column(ref_column_out);
-        }
+      if (_join_bloom_filter && _join_bloom_filter->is_active() && !matches_out->empty()) {
+        const auto probe_column = chunk_in->get_column(_join_bloom_filter->probe_column_id());
+        const auto may_match = _join_bloom_filter->may_match(*probe_column);
+        const auto cannot_match = [&](const auto& match) { return !may_match[match.chunk_offset]; };
+        matches_out->erase(std::remove_if(matches_out->begin(), matches_out->end(), cannot_match), matches_out->end());
       }
 
+      auto chunk_out = create_reference_chunk(_in_table, *chunk_in, matches_out);
+
       std::lock_guard<std::mutex> lock(output_mutex);
       if (chunk_out->size() > 0 || _output_table->get_chunk(ChunkID{0})->size() == 0) {
         _output_table->emplace_chunk(std::move(chunk_out));
@@ -158,45 +176,80 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  // All chunks were pruned
+  if (_output_table->get_chunk(ChunkID{0})->column_count() == 0) {
+    _output_table->emplace_chunk(_create_empty_reference_chunk(_in_table));
+  }
+
   return _output_table;
 }
 
-void TableScan::_on_cleanup() { _impl.reset(); }
-
-void TableScan::_init_scan() {
-  DebugAssert(_in_table->chunk_count() > 0u, "Input table must contain at least 1 chunk.");
-
-  if (_scan_type == ScanType::Like || _scan_type == ScanType::NotLike) {
-    const auto left_column_type = _in_table->column_type(_left_column_id);
-    Assert((left_column_type == DataType::String), "LIKE operator only applicable on string columns.");
-
-    DebugAssert(is_variant(_right_parameter), "Right parameter must be variant.");
-
-    const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
-
-    DebugAssert(!variant_is_null(right_value), "Right value must not be NULL.");
-
-    const auto right_wildcard = type_cast<std::string>(right_value);
-
-    _impl = std::make_unique<LikeTableScanImpl>(_in_table, _left_column_id, _scan_type, right_wildcard);
+std::shared_ptr<Chunk> TableScan::create_reference_chunk(const std::shared_ptr<const Table>& in_table,
+                                                         const Chunk& chunk_in,
+                                                         const std::shared_ptr<const PosList>& matches) {
+  // The output chunk is allocated on the same NUMA node as the input chunk. Also, the AccessCounter is
+  // reused to track accesses of the output chunk. Accesses of derived chunks are counted towards the
+  // original chunk.
+  auto chunk_out = std::make_shared<Chunk>(chunk_in.get_allocator(), chunk_in.access_counter());
+
+  /**
+   * matches contains a list of row IDs into this chunk. If this is not a reference chunk, we can
+   * directly use the matches to construct the reference columns of the output. If it is a reference chunk,
+   * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between columns as much as possible. Position lists can be shared between two columns iff
+   * (a) they point to the same table and
+   * (b) the reference columns of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in.get_column(ColumnID{0u}))) {
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    for (ColumnID column_id{0u}; column_id < chunk_in.column_count(); ++column_id) {
+      auto column_in = chunk_in.get_column(column_id);
+
+      auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
+      DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+
+      const auto pos_list_in = ref_column_in->pos_list();
+
+      const auto table_out = ref_column_in->referenced_table();
+      const auto column_id_out = ref_column_in->referenced_column_id();
+
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(matches->size());
+
+        for (const auto& match : *matches) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          filtered_pos_list->push_back(row_id);
+        }
+      }
 
-    return;
+      auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
+      chunk_out->add_column(ref_column_out);
+    }
+  } else {
+    for (ColumnID column_id{0u}; column_id < chunk_in.column_count(); ++column_id) {
+      auto ref_column_out = std::make_shared<ReferenceColumn>(in_table, column_id, matches);
+      chunk_out->add_column(ref_column_out);
+    }
   }
 
-  if (_scan_type == ScanType::IsNull || _scan_type == ScanType::IsNotNull) {
-    _impl = std::make_unique<IsNullTableScanImpl>(_in_table, _left_column_id, _scan_type);
-    return;
-  }
+  return chunk_out;
+}
 
-  if (is_variant(_right_parameter)) {
-    const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
+bool TableScan::_can_prune_chunk(const Chunk& chunk) const {
+  if (!is_variant(_right_parameter)) return false;
 
-    _impl = std::make_unique<SingleColumnTableScanImpl>(_in_table, _left_column_id, _scan_type, right_value);
-  } else /* is_column_name(_right_parameter) */ {
-    const auto right_column_id = boost::get<ColumnID>(_right_parameter);
+  const auto column_statistics = origin_column_statistics(chunk, _left_column_id);
+  if (!column_statistics) return false;
 
-    _impl = std::make_unique<ColumnComparisonTableScanImpl>(_in_table, _left_column_id, _scan_type, right_column_id);
-  }
+  return column_statistics->can_prune(_scan_type, boost::get<AllTypeVariant>(_right_parameter));
 }
 
+void TableScan::_on_cleanup() { _impl.reset(); }
+
 }  // namespace opossum
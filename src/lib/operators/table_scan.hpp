@@ -13,6 +13,8 @@
 namespace opossum {
 
 class BaseTableScanImpl;
+class Chunk;
+class JoinBloomFilter;
 class Table;
 
 class TableScan : public AbstractReadOnlyOperator {
@@ -37,6 +39,15 @@ class TableScan : public AbstractReadOnlyOperator {
    * excluded chunks and all others a list of included chunks.
    */
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
+  /**
+   * @brief If set, rows that cannot find a join partner in the build input of a subsequent hash join are not emitted.
+   *
+   * The build operator of the filter becomes the right input of the TableScan (see JoinBloomFilter).
+   */
+  void set_join_bloom_filter(const std::shared_ptr<JoinBloomFilter>& join_bloom_filter);
+  std::shared_ptr<const JoinBloomFilter> join_bloom_filter() const;
 
   ColumnID left_column_id() const;
   ScanType scan_type() const;
@@ -47,11 +58,33 @@ class TableScan : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
+  /**
+   * @defgroup Scanning single chunks without executing the TableScan, e.g., to pass the output of one stage of a
+   * Pipeline directly to the next one
+   *
+   * create_impl() prepares the scan of chunks with the layout of `in_table`. scan_chunk() returns a chunk that
+   * references the rows of `chunk_in` that match. If `chunk_in` holds data, it must be the chunk with the given id of
+   * `in_table`. Neither applies the JoinBloomFilter or the excluded chunks.
+   * @{
+   */
+  std::unique_ptr<BaseTableScanImpl> create_impl(const std::shared_ptr<const Table>& in_table) const;
+  std::shared_ptr<Chunk> scan_chunk(BaseTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                    const Chunk& chunk_in, const ChunkID chunk_id) const;
+  /**@}*/
+
+  // Creates a chunk that references the rows of `chunk_in` in `matches`, resolving the references of a reference chunk.
+  // Also used by JoinHash to create the probe side of the output of a morsel.
+  static std::shared_ptr<Chunk> create_reference_chunk(const std::shared_ptr<const Table>& in_table,
+                                                       const Chunk& chunk_in,
+                                                       const std::shared_ptr<const PosList>& matches);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
 
-  void _init_scan();
+  // Returns true if the zone map or Bloom filter of the stored chunk that the scanned column of the chunk comes from
+  // rules out any match
+  bool _can_prune_chunk(const Chunk& chunk) const;
 
  private:
   const ColumnID _left_column_id;
@@ -59,6 +92,7 @@ class TableScan : public AbstractReadOnlyOperator {
   const AllParameterVariant _right_parameter;
 
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::shared_ptr<JoinBloomFilter> _join_bloom_filter;
 
   std::shared_ptr<const Table> _in_table;
   std::unique_ptr<BaseTableScanImpl> _impl;
@@ -18,9 +18,8 @@ BaseSingleColumnTableScanImpl::BaseSingleColumnTableScanImpl(std::shared_ptr<con
                                                              const bool skip_null_row_ids)
     : BaseTableScanImpl{in_table, left_column_id, scan_type}, _skip_null_row_ids{skip_null_row_ids} {}
 
-PosList BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
-  const auto left_column = chunk->get_column(_left_column_id);
+PosList BaseSingleColumnTableScanImpl::scan_chunk(const Chunk& chunk, ChunkID chunk_id) {
+  const auto left_column = chunk.get_column(_left_column_id);
 
   auto matches_out = PosList{};
   auto context = std::make_shared<Context>(chunk_id, matches_out);
@@ -8,6 +8,7 @@
 
 namespace opossum {
 
+class Chunk;
 class Table;
 
 /**
@@ -20,7 +21,8 @@ class BaseTableScanImpl {
 
   virtual ~BaseTableScanImpl() = default;
 
-  virtual PosList scan_chunk(ChunkID chunk_id) = 0;
+  // Scans a chunk with the layout of the input table. Matches are emitted as rows of the chunk with the given id.
+  virtual PosList scan_chunk(const Chunk& chunk, ChunkID chunk_id) = 0;
 
  protected:
   /**
@@ -20,13 +20,12 @@ ColumnComparisonTableScanImpl::ColumnComparisonTableScanImpl(std::shared_ptr<con
                                                              const ColumnID right_column_id)
     : BaseTableScanImpl{in_table, left_column_id, scan_type}, _right_column_id{right_column_id} {}
 
-PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
+PosList ColumnComparisonTableScanImpl::scan_chunk(const Chunk& chunk, ChunkID chunk_id) {
   const auto left_column_type = _in_table->column_type(_left_column_id);
   const auto right_column_type = _in_table->column_type(_right_column_id);
 
-  const auto left_column = chunk->get_column(_left_column_id);
-  const auto right_column = chunk->get_column(_right_column_id);
+  const auto left_column = chunk.get_column(_left_column_id);
+  const auto right_column = chunk.get_column(_right_column_id);
 
   auto matches_out = PosList{};
 
@@ -5,8 +5,10 @@
 #include "storage/base_dictionary_column.hpp"
 #include "storage/base_value_column.hpp"
 #include "storage/iterables/attribute_vector_iterable.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
 #include "storage/iterables/null_value_vector_iterable.hpp"
 
+#include "resolve_type.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -51,6 +53,25 @@ void IsNullTableScanImpl::handle_dictionary_column(const BaseDictionaryColumn& b
                                       [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
 }
 
+void IsNullTableScanImpl::handle_encoded_column(const BaseEncodedColumn& base_column,
+                                                std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+
+  const auto left_column_type = _in_table->column_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    resolve_encoded_column_type<ColumnDataType>(base_column, [&](const auto& left_column) {
+      auto left_column_iterable = create_iterable_from_column(left_column);
+
+      left_column_iterable.with_iterators(
+          mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+    });
+  });
+}
+
 bool IsNullTableScanImpl::_matches_all(const BaseValueColumn& column) {
   switch (_scan_type) {
     case ScanType::IsNull:
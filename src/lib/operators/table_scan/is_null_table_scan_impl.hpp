@@ -23,6 +23,9 @@ class IsNullTableScanImpl : public BaseSingleColumnTableScanImpl {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  void handle_encoded_column(const BaseEncodedColumn& base_column,
+                             std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   /**
    * @defgroup Methods used for handling value columns
@@ -15,9 +15,12 @@
 #include "storage/dictionary_column.hpp"
 #include "storage/iterables/attribute_vector_iterable.hpp"
 #include "storage/iterables/constant_value_iterable.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
 #include "storage/iterables/value_column_iterable.hpp"
 #include "storage/value_column.hpp"
 
+#include "resolve_type.hpp"
+
 namespace opossum {
 
 LikeTableScanImpl::LikeTableScanImpl(std::shared_ptr<const Table> in_table, const ColumnID left_column_id,
@@ -85,8 +88,26 @@ void LikeTableScanImpl::handle_dictionary_column(const BaseDictionaryColumn& bas
   });
 }
 
+void LikeTableScanImpl::handle_encoded_column(const BaseEncodedColumn& base_column,
+                                              std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  auto& matches_out = context->_matches_out;
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+  const auto chunk_id = context->_chunk_id;
+
+  const auto regex_match = [this](const std::string& str) { return std::regex_match(str, _regex) ^ _invert_results; };
+
+  resolve_encoded_column_type<std::string>(base_column, [&](const auto& left_column) {
+    auto left_iterable = create_iterable_from_column(left_column);
+
+    left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      this->_unary_scan(regex_match, left_it, left_end, chunk_id, matches_out);
+    });
+  });
+}
+
 std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_dictionary(
-    const pmr_vector<std::string>& dictionary) {
+    const CompressedStringDictionary& dictionary) {
   auto result = std::pair<size_t, std::vector<bool>>{};
 
   auto& count = result.first;
@@ -95,7 +116,9 @@ std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_diction
   count = 0u;
   dictionary_matches.reserve(dictionary.size());
 
-  for (const auto& value : dictionary) {
+  auto value = std::string{};
+  for (auto index = size_t{0u}; index < dictionary.size(); ++index) {
+    dictionary.decode(index, value);
     const auto result = std::regex_match(value, _regex) ^ _invert_results;
     count += static_cast<size_t>(result);
     dictionary_matches.push_back(result);
@@ -9,6 +9,7 @@
 
 #include "base_single_column_table_scan_impl.hpp"
 
+#include "storage/compressed_string_dictionary.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -23,6 +24,7 @@ class Table;
  * - For dictionary columns, we check the values in the dictionary and store the results in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - Encoded columns are scanned sequentially using their iterables
  */
 class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -35,6 +37,9 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  void handle_encoded_column(const BaseEncodedColumn& base_column,
+                             std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   /**
    * @defgroup Methods used for handling dictionary columns
@@ -42,9 +47,11 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
    */
 
   /**
+   * Evaluates the expression on the front-coded dictionary, decoding each entry into the same buffer
+   *
    * @returns number of matches and the result of each dictionary entry
    */
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary);
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const CompressedStringDictionary& dictionary);
 
   /**@}*/
 
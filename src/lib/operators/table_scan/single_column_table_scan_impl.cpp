@@ -1,15 +1,18 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/iterables/attribute_vector_iterable.hpp"
 #include "storage/iterables/constant_value_iterable.hpp"
 #include "storage/iterables/create_iterable_from_column.hpp"
 
 #include "resolve_type.hpp"
+#include "type_cast.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
@@ -19,7 +22,7 @@ SingleColumnTableScanImpl::SingleColumnTableScanImpl(std::shared_ptr<const Table
                                                      const AllTypeVariant& right_value)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, scan_type}, _right_value{right_value} {}
 
-PosList SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+PosList SingleColumnTableScanImpl::scan_chunk(const Chunk& chunk, ChunkID chunk_id) {
   // early outs for specific NULL semantics
   if (variant_is_null(_right_value)) {
     /**
@@ -31,7 +34,7 @@ PosList SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
     return PosList{};
   }
 
-  return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
+  return BaseSingleColumnTableScanImpl::scan_chunk(chunk, chunk_id);
 }
 
 void SingleColumnTableScanImpl::handle_value_column(const BaseValueColumn& base_column,
@@ -127,6 +130,20 @@ void SingleColumnTableScanImpl::handle_dictionary_column(const BaseDictionaryCol
   });
 }
 
+void SingleColumnTableScanImpl::handle_encoded_column(const BaseEncodedColumn& base_column,
+                                                      std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+
+  const auto left_column_type = _in_table->column_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    resolve_encoded_column_type<ColumnDataType>(
+        base_column, [&](const auto& left_column) { this->_scan_encoded_column(left_column, *context); });
+  });
+}
+
 ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionaryColumn& column) {
   switch (_scan_type) {
     case ScanType::Equals:
@@ -189,4 +206,159 @@ bool SingleColumnTableScanImpl::_right_value_matches_none(const BaseDictionaryCo
   }
 }
 
+template <typename T>
+void SingleColumnTableScanImpl::_scan_encoded_column(const RunLengthColumn<T>& left_column, Context& context) {
+  auto& matches_out = context._matches_out;
+  const auto chunk_id = context._chunk_id;
+  const auto& mapped_chunk_offsets = context._mapped_chunk_offsets;
+
+  const auto& values = *left_column.values();
+  const auto& null_values = *left_column.null_values();
+  const auto& end_positions = *left_column.end_positions();
+
+  // Evaluate the predicate once per run
+  const auto right_value = type_cast<T>(_right_value);
+
+  auto run_matches = std::vector<bool>(values.size());
+  auto match_count = size_t{0u};
+
+  with_comparator(_scan_type, [&](auto comparator) {
+    for (auto run_index = size_t{0u}; run_index < values.size(); ++run_index) {
+      const auto matches = !null_values[run_index] && comparator(values[run_index], right_value);
+      run_matches[run_index] = matches;
+      match_count += static_cast<size_t>(matches);
+    }
+  });
+
+  if (match_count == 0u) return;
+
+  if (mapped_chunk_offsets) {
+    for (const auto& chunk_offsets : *mapped_chunk_offsets) {
+      if (chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET) continue;
+
+      const auto end_position_it =
+          std::lower_bound(end_positions.cbegin(), end_positions.cend(), chunk_offsets.into_referenced);
+      const auto run_index = std::distance(end_positions.cbegin(), end_position_it);
+
+      if (run_matches[run_index]) {
+        matches_out.push_back(RowID{chunk_id, chunk_offsets.into_referencing});
+      }
+    }
+
+    return;
+  }
+
+  // Without a position list, all rows of a matching run are added at once
+  auto run_begin = ChunkOffset{0u};
+  for (auto run_index = size_t{0u}; run_index < values.size(); ++run_index) {
+    const auto run_end = end_positions[run_index];
+
+    if (run_matches[run_index]) {
+      for (auto chunk_offset = run_begin; chunk_offset <= run_end; ++chunk_offset) {
+        matches_out.push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+
+    run_begin = run_end + 1u;
+  }
+}
+
+template <typename T>
+void SingleColumnTableScanImpl::_scan_encoded_column(const FrameOfReferenceColumn<T>& left_column,
+                                                     Context& context) {
+  auto& matches_out = context._matches_out;
+  const auto chunk_id = context._chunk_id;
+  const auto& mapped_chunk_offsets = context._mapped_chunk_offsets;
+
+  const auto& frame_minima = *left_column.frame_minima();
+  const auto& frame_maxima = *left_column.frame_maxima();
+  const auto& offsets = *left_column.offsets();
+
+  const auto right_value = type_cast<T>(_right_value);
+
+  // Rule out frames using their minimum and maximum
+  auto frame_may_match = std::vector<bool>(left_column.frame_count());
+  auto candidate_frame_count = size_t{0u};
+
+  for (auto frame_index = size_t{0u}; frame_index < left_column.frame_count(); ++frame_index) {
+    const auto may_match = _value_range_may_match(frame_minima[frame_index], frame_maxima[frame_index], right_value);
+    frame_may_match[frame_index] = may_match;
+    candidate_frame_count += static_cast<size_t>(may_match);
+  }
+
+  if (candidate_frame_count == 0u) return;
+
+  constexpr auto frame_size = FrameOfReferenceColumn<T>::FRAME_SIZE;
+  constexpr auto block_size = BitPackedAttributeVector::BLOCK_SIZE;
+
+  with_comparator(_scan_type, [&](auto comparator) {
+    if (mapped_chunk_offsets) {
+      for (const auto& chunk_offsets : *mapped_chunk_offsets) {
+        if (chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET) continue;
+        if (!frame_may_match[chunk_offsets.into_referenced / frame_size]) continue;
+
+        const auto value = left_column.get_typed_value(chunk_offsets.into_referenced);
+        if (value && comparator(*value, right_value)) {
+          matches_out.push_back(RowID{chunk_id, chunk_offsets.into_referencing});
+        }
+      }
+
+      return;
+    }
+
+    // Without a position list, the candidate frames are decoded block by block
+    auto decoded_block = BitPackedAttributeVector::DecodedBlock{};
+
+    for (auto frame_index = size_t{0u}; frame_index < left_column.frame_count(); ++frame_index) {
+      if (!frame_may_match[frame_index]) continue;
+
+      const auto frame_minimum = frame_minima[frame_index];
+      const auto first_block_index = frame_index * (frame_size / block_size);
+      const auto last_block_index = std::min(first_block_index + frame_size / block_size, offsets.block_count());
+
+      for (auto block_index = first_block_index; block_index < last_block_index; ++block_index) {
+        offsets.decode_block(block_index, decoded_block);
+
+        const auto block_begin = block_index * block_size;
+        const auto value_count = std::min(block_size, offsets.size() - block_begin);
+
+        for (auto index = size_t{0u}; index < value_count; ++index) {
+          const auto offset = decoded_block[index];
+          if (ValueID{offset} == NULL_VALUE_ID) continue;
+
+          if (comparator(FrameOfReferenceColumn<T>::decode(frame_minimum, offset), right_value)) {
+            matches_out.push_back(RowID{chunk_id, static_cast<ChunkOffset>(block_begin + index)});
+          }
+        }
+      }
+    }
+  });
+}
+
+template <typename T>
+bool SingleColumnTableScanImpl::_value_range_may_match(const T& min, const T& max, const T& right_value) const {
+  switch (_scan_type) {
+    case ScanType::Equals:
+      return min <= right_value && right_value <= max;
+
+    case ScanType::NotEquals:
+      return !(min == right_value && max == right_value);
+
+    case ScanType::LessThan:
+      return min < right_value;
+
+    case ScanType::LessThanEquals:
+      return min <= right_value;
+
+    case ScanType::GreaterThan:
+      return max > right_value;
+
+    case ScanType::GreaterThanEquals:
+      return max >= right_value;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
 }  // namespace opossum
@@ -15,6 +15,12 @@ namespace opossum {
 
 class BaseDictionaryColumn;
 
+template <typename T>
+class FrameOfReferenceColumn;
+
+template <typename T>
+class RunLengthColumn;
+
 /**
  * @brief Compares one column to a constant value
  *
@@ -22,13 +28,16 @@ class BaseDictionaryColumn;
  * - For dictionary columns, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - For run-length encoded columns, the expression is evaluated once per run instead of once per row.
+ * - For frame-of-reference encoded columns, frames whose minimum and maximum rule out any match are skipped
+ *   without decoding them.
  */
 class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
   SingleColumnTableScanImpl(std::shared_ptr<const Table> in_table, const ColumnID left_column_id,
                             const ScanType& scan_type, const AllTypeVariant& right_value);
 
-  PosList scan_chunk(ChunkID) override;
+  PosList scan_chunk(const Chunk& chunk, ChunkID chunk_id) override;
 
   void handle_value_column(const BaseValueColumn& base_column,
                            std::shared_ptr<ColumnVisitableContext> base_context) override;
@@ -36,6 +45,9 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  void handle_encoded_column(const BaseEncodedColumn& base_column,
+                             std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   /**
    * @defgroup Methods used for handling dictionary columns
@@ -76,6 +88,23 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   /**@}*/
 
+  /**
+   * @defgroup Methods used for handling encoded columns
+   * @{
+   */
+
+  template <typename T>
+  void _scan_encoded_column(const RunLengthColumn<T>& left_column, Context& context);
+
+  template <typename T>
+  void _scan_encoded_column(const FrameOfReferenceColumn<T>& left_column, Context& context);
+
+  // returns false if no value in [min, max] can satisfy the expression
+  template <typename T>
+  bool _value_range_may_match(const T& min, const T& max, const T& right_value) const;
+
+  /**@}*/
+
  private:
   const AllTypeVariant _right_value;
 };
@@ -0,0 +1,278 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A row of the input, addressed by its chunk and its index in the materialized values of that chunk
+struct Candidate {
+  ChunkID chunk_id;
+  size_t index;
+};
+
+/**
+ * The values of one sort column, materialized per input chunk. Once the candidates of a chunk are chosen, only their
+ * values are kept.
+ */
+class BaseCandidateColumn {
+ public:
+  virtual ~BaseCandidateColumn() = default;
+
+  virtual void materialize(const ChunkID chunk_id, const BaseColumn& column) = 0;
+
+  // Keeps only the values of `candidates`, in their order
+  virtual void shrink(const ChunkID chunk_id, const std::vector<Candidate>& candidates) = 0;
+
+  // Returns a negative number if `left` comes before `right` in the output, a positive one if it comes after it, and
+  // zero if this column does not decide
+  virtual int compare(const Candidate& left, const Candidate& right) const = 0;
+};
+
+template <typename T>
+class CandidateColumn : public BaseCandidateColumn {
+ public:
+  CandidateColumn(const ChunkID chunk_count, const OrderByMode order_by_mode)
+      : _values(chunk_count),
+        _null_values(chunk_count),
+        _descending(order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast),
+        _nulls_first(order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending) {}
+
+  void materialize(const ChunkID chunk_id, const BaseColumn& column) override {
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(column.size());
+    null_values.resize(column.size());
+
+    resolve_column_type<T>(column, [&](const auto& typed_column) {
+      auto index = size_t{0};
+      auto iterable = create_iterable_from_column<T>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        if (value.is_null()) {
+          null_values[index] = true;
+        } else {
+          values[index] = value.value();
+        }
+        ++index;
+      });
+    });
+  }
+
+  void shrink(const ChunkID chunk_id, const std::vector<Candidate>& candidates) override {
+    auto values = std::vector<T>(candidates.size());
+    auto null_values = std::vector<bool>(candidates.size());
+    for (auto new_index = size_t{0}; new_index < candidates.size(); ++new_index) {
+      values[new_index] = std::move(_values[chunk_id][candidates[new_index].index]);
+      null_values[new_index] = _null_values[chunk_id][candidates[new_index].index];
+    }
+    _values[chunk_id] = std::move(values);
+    _null_values[chunk_id] = std::move(null_values);
+  }
+
+  int compare(const Candidate& left, const Candidate& right) const override {
+    const auto left_is_null = _null_values[left.chunk_id][left.index];
+    const auto right_is_null = _null_values[right.chunk_id][right.index];
+    if (left_is_null || right_is_null) {
+      if (left_is_null == right_is_null) return 0;
+      return left_is_null == _nulls_first ? -1 : 1;
+    }
+
+    const auto& left_value = _values[left.chunk_id][left.index];
+    const auto& right_value = _values[right.chunk_id][right.index];
+    if (left_value == right_value) return 0;
+    return (left_value < right_value) != _descending ? -1 : 1;
+  }
+
+ protected:
+  std::vector<std::vector<T>> _values;
+  std::vector<std::vector<bool>> _null_values;
+  const bool _descending;
+  const bool _nulls_first;
+};
+
+// Orders candidates like a stable sort: Rows whose sort columns are equal keep their order in the input
+class CandidateComparator {
+ public:
+  explicit CandidateComparator(const std::vector<std::unique_ptr<BaseCandidateColumn>>& columns) : _columns(columns) {}
+
+  bool operator()(const Candidate& left, const Candidate& right) const {
+    for (const auto& column : _columns) {
+      const auto result = column->compare(left, right);
+      if (result != 0) return result < 0;
+    }
+    return std::tie(left.chunk_id, left.index) < std::tie(right.chunk_id, right.index);
+  }
+
+ protected:
+  const std::vector<std::unique_ptr<BaseCandidateColumn>>& _columns;
+};
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t num_rows)
+    : AbstractReadOnlyOperator(in), _sort_definitions(sort_definitions), _num_rows(num_rows) {
+  Assert(!_sort_definitions.empty(), "Expected at least one column to sort by.");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+size_t TopK::num_rows() const { return _num_rows; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::string TopK::description(DescriptionMode description_mode) const {
+  std::stringstream desc;
+  desc << name() << (description_mode == DescriptionMode::MultiLine ? "\n" : " ") << "(" << _num_rows
+       << " rows by ";
+  for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+    const auto& definition = _sort_definitions[definition_idx];
+    if (_input_table_left()) {
+      desc << _input_table_left()->column_name(definition.column_id);
+    } else {
+      desc << "Col #" << definition.column_id;
+    }
+    desc << " " << order_by_mode_to_string.at(definition.order_by_mode);
+
+    if (definition_idx + 1 < _sort_definitions.size()) desc << ", ";
+  }
+  desc << ")";
+  return desc.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::recreate(const std::vector<AllParameterVariant>& args) const {
+  return std::make_shared<TopK>(_input_left->recreate(args), _sort_definitions, _num_rows);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto output = Table::create_with_layout_from(input_table);
+  if (_num_rows == 0) return output;
+
+  auto columns = std::vector<std::unique_ptr<BaseCandidateColumn>>{};
+  for (const auto& definition : _sort_definitions) {
+    resolve_data_type(input_table->column_type(definition.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      columns.emplace_back(std::make_unique<CandidateColumn<ColumnDataType>>(chunk_count, definition.order_by_mode));
+    });
+  }
+
+  const auto comparator = CandidateComparator{columns};
+
+  // 1. Find the best _num_rows rows of each chunk. The heap has the worst of them at its front.
+  auto chunk_offsets = std::vector<std::vector<ChunkOffset>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+        columns[definition_idx]->materialize(chunk_id, *chunk->get_column(_sort_definitions[definition_idx].column_id));
+      }
+
+      auto heap = std::vector<Candidate>{};
+      heap.reserve(std::min(_num_rows, static_cast<size_t>(chunk->size())));
+
+      for (auto index = size_t{0}; index < chunk->size(); ++index) {
+        const auto candidate = Candidate{chunk_id, index};
+        if (heap.size() < _num_rows) {
+          heap.emplace_back(candidate);
+          std::push_heap(heap.begin(), heap.end(), comparator);
+        } else if (comparator(candidate, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), comparator);
+          heap.back() = candidate;
+          std::push_heap(heap.begin(), heap.end(), comparator);
+        }
+      }
+
+      // Sorting the candidates keeps their indices in the order of their chunk offsets wherever the comparator relies
+      // on them to break ties
+      std::sort_heap(heap.begin(), heap.end(), comparator);
+
+      for (auto& column : columns) {
+        column->shrink(chunk_id, heap);
+      }
+
+      auto& offsets = chunk_offsets[chunk_id];
+      offsets.reserve(heap.size());
+      for (const auto& candidate : heap) {
+        offsets.emplace_back(static_cast<ChunkOffset>(candidate.index));
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 2. Merge the candidates of all chunks
+  auto candidates = std::vector<Candidate>{};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    for (auto index = size_t{0}; index < chunk_offsets[chunk_id].size(); ++index) {
+      candidates.emplace_back(Candidate{chunk_id, index});
+    }
+  }
+
+  const auto output_row_count = std::min(_num_rows, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + output_row_count, candidates.end(), comparator);
+  candidates.resize(output_row_count);
+
+  if (output_row_count == 0) return output;
+
+  // 3. Output the candidates as references into the input, like Limit does. Their values do not have to be copied.
+  const auto input_is_reference_table = input_table->get_type() == TableType::References;
+
+  auto output_chunk = std::make_shared<Chunk>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    auto output_pos_list = std::make_shared<PosList>();
+    output_pos_list->reserve(output_row_count);
+    auto referenced_table = input_table;
+    auto referenced_column_id = column_id;
+
+    for (const auto& candidate : candidates) {
+      const auto chunk_offset = chunk_offsets[candidate.chunk_id][candidate.index];
+      if (!input_is_reference_table) {
+        output_pos_list->emplace_back(RowID{candidate.chunk_id, chunk_offset});
+        continue;
+      }
+
+      const auto column = input_table->get_chunk(candidate.chunk_id)->get_column(column_id);
+      const auto reference_column = std::static_pointer_cast<const ReferenceColumn>(column);
+      DebugAssert(output_pos_list->empty() || (referenced_table == reference_column->referenced_table() &&
+                                               referenced_column_id == reference_column->referenced_column_id()),
+                  "All chunks of a column have to reference the same column.");
+      referenced_table = reference_column->referenced_table();
+      referenced_column_id = reference_column->referenced_column_id();
+      output_pos_list->emplace_back((*reference_column->pos_list())[chunk_offset]);
+    }
+
+    output_chunk->add_column(
+        std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, output_pos_list));
+  }
+  output->emplace_chunk(std::move(output_chunk));
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first num_rows rows of its input in the order given by the sort definitions, i.e., the
+ * result of a Sort followed by a Limit (see TopKRule). Like Sort, it is stable. Like Limit, it outputs references into
+ * its input instead of materializing the rows.
+ *
+ * Instead of sorting the whole input, every input chunk is scanned by its own task, which keeps the best num_rows rows
+ * of the chunk in a bounded heap. Only the candidates of the chunks are merged at the end.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t num_rows);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  size_t num_rows() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const size_t _num_rows;
+};
+
+}  // namespace opossum
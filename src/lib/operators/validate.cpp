@@ -1,11 +1,15 @@
 #include "validate.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "join_bloom_filter.hpp"
 #include "storage/reference_column.hpp"
 #include "utils/assert.hpp"
 
@@ -28,6 +32,15 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+// Returns true if the snapshot sees the first `row_count` rows of the chunk, which is the case if all of them have been
+// committed before the snapshot and none of them has been invalidated since (see MvccColumns::any_row_invalidated).
+bool is_chunk_visible(const CommitID snapshot_commit_id, const ChunkOffset row_count,
+                      const Chunk::MvccColumns& columns) {
+  // An Insert that is rolled back sets the flag before changing its begin cids, so it is checked last
+  const auto max_begin_cid = columns.max_begin_cid(row_count);
+  return max_begin_cid <= snapshot_commit_id && !columns.any_row_invalidated;
+}
+
 }  // namespace
 
 Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractReadOnlyOperator(in) {}
@@ -35,9 +48,24 @@ Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractReadOnl
 const std::string Validate::name() const { return "Validate"; }
 
 std::shared_ptr<AbstractOperator> Validate::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Validate>(_input_left->recreate(args));
+  const auto validate = std::make_shared<Validate>(_input_left->recreate(args));
+  validate->set_excluded_chunk_ids(_excluded_chunk_ids);
+
+  // The JoinBloomFilter is re-applied by JoinHash::recreate(), which also recreates its build operator
+  return validate;
+}
+
+void Validate::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
+
+const std::vector<ChunkID>& Validate::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
+void Validate::set_join_bloom_filter(const std::shared_ptr<JoinBloomFilter>& join_bloom_filter) {
+  _join_bloom_filter = join_bloom_filter;
+  _input_right = join_bloom_filter->build_operator();
 }
 
+std::shared_ptr<const JoinBloomFilter> Validate::join_bloom_filter() const { return _join_bloom_filter; }
+
 std::shared_ptr<const Table> Validate::_on_execute() {
   Fail("Validate can't be called without a transaction context.");
 }
@@ -48,71 +76,150 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto _in_table = _input_table_left();
   auto output = Table::create_with_layout_from(_in_table);
 
-  const auto our_tid = transaction_context->transaction_id();
-  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  if (_join_bloom_filter) _join_bloom_filter->init(*_in_table);
+  const auto apply_join_bloom_filter = _join_bloom_filter && _join_bloom_filter->is_active();
+
+  const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
   for (ChunkID chunk_id{0}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+    if (excluded_chunk_set.count(chunk_id)) continue;
+
     const auto chunk_in = _in_table->get_chunk(chunk_id);
 
-    auto chunk_out = std::make_shared<Chunk>();
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
+    // Rows that cannot find a join partner are treated like invisible ones
+    auto may_match = std::vector<bool>{};
+    if (apply_join_bloom_filter) {
+      may_match = _join_bloom_filter->may_match(*chunk_in->get_column(_join_bloom_filter->probe_column_id()));
+    }
 
-    // If the columns in this chunk reference a column, build a poslist for a reference column.
-    if (ref_col_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+    auto chunk_out = validate_chunk(_in_table, *chunk_in, chunk_id, *transaction_context, may_match);
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_col_in->referenced_table();
-      DebugAssert(referenced_table->get_chunk(ChunkID{0})->has_mvcc_columns(),
-                  "Trying to use Validate on a table that has no MVCC columns");
+    if (chunk_out->size() > 0 || output->get_chunk(ChunkID{0})->size() == 0) {
+      output->emplace_chunk(std::move(chunk_out));
+    }
+  }
 
-      for (auto row_id : *ref_col_in->pos_list()) {
-        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+  // All chunks were excluded
+  if (output->get_chunk(ChunkID{0})->column_count() == 0) {
+    output->emplace_chunk(_create_empty_reference_chunk(_in_table));
+  }
 
-        auto mvcc_columns = referenced_chunk->mvcc_columns();
+  return output;
+}
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
-          pos_list_out->emplace_back(row_id);
-        }
+std::shared_ptr<Chunk> Validate::validate_chunk(const std::shared_ptr<const Table>& in_table, const Chunk& chunk_in,
+                                                const ChunkID chunk_id, const TransactionContext& transaction_context,
+                                                const std::vector<bool>& may_match) {
+  const auto apply_join_bloom_filter = !may_match.empty();
+
+  const auto our_tid = transaction_context.transaction_id();
+  const auto snapshot_commit_id = transaction_context.snapshot_commit_id();
+
+  auto chunk_out = std::make_shared<Chunk>();
+  auto pos_list_out = std::make_shared<PosList>();
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in.get_column(ColumnID{0}));
+
+  // If the columns in this chunk reference a column, build a poslist for a reference column.
+  if (ref_col_in) {
+    DebugAssert(chunk_in.references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
+
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_col_in->referenced_table();
+    DebugAssert(referenced_table->get_chunk(ChunkID{0})->has_mvcc_columns(),
+                "Trying to use Validate on a table that has no MVCC columns");
+
+    const auto& pos_list_in = *ref_col_in->pos_list();
+    pos_list_out->reserve(pos_list_in.size());
+
+    // Rows are usually sorted by chunk, so the MVCC columns of a referenced chunk are only locked once per run of
+    // rows that reference it. Chunks that are visible as a whole do not need to be checked row by row.
+    auto referenced_chunk_id = ChunkID{0};
+    auto mvcc_columns = std::optional<SharedScopedLockingPtr<const Chunk::MvccColumns>>{};
+    auto referenced_chunk_is_visible = false;
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < pos_list_in.size(); ++chunk_offset) {
+      if (apply_join_bloom_filter && !may_match[chunk_offset]) continue;
+
+      const auto& row_id = pos_list_in[chunk_offset];
+      if (!mvcc_columns || row_id.chunk_id != referenced_chunk_id) {
+        referenced_chunk_id = row_id.chunk_id;
+        const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+        mvcc_columns.reset();
+        mvcc_columns.emplace(referenced_chunk->mvcc_columns());
+        referenced_chunk_is_visible = is_chunk_visible(snapshot_commit_id, referenced_chunk->size(), **mvcc_columns);
       }
 
-      // Construct the actual ReferenceColumn objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
-        const auto referenced_column_id = column->referenced_column_id();
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
-        chunk_out->add_column(ref_col_out);
+      if (referenced_chunk_is_visible || is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset,
+                                                        **mvcc_columns)) {
+        pos_list_out->emplace_back(row_id);
       }
+    }
+    mvcc_columns.reset();
+
+    // If all rows are visible, the input's PosList is shared instead of the copy
+    const auto output_pos_list = pos_list_out->size() == pos_list_in.size()
+                                     ? ref_col_in->pos_list()
+                                     : std::shared_ptr<const PosList>{pos_list_out};
+
+    // Construct the actual ReferenceColumn objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in.column_count(); ++column_id) {
+      const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in.get_column(column_id));
+      const auto referenced_column_id = column->referenced_column_id();
+      auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, output_pos_list);
+      chunk_out->add_column(ref_col_out);
+    }
+
+    // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in.has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
+    const auto mvcc_columns = chunk_in.mvcc_columns();
 
-      // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
+    // Generate pos_list_out.
+    const auto chunk_size = chunk_in.size();
+    pos_list_out->resize(chunk_size);
+
+    if (is_chunk_visible(snapshot_commit_id, chunk_size, *mvcc_columns)) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        (*pos_list_out)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
     } else {
-      referenced_table = _in_table;
-      DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
-      const auto mvcc_columns = chunk_in->mvcc_columns();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_columns)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
-        }
+      // Branch-free: Every row is written, but the output position only advances for visible rows. The MVCC
+      // columns are concurrent vectors and thus walked with iterators instead of being indexed.
+      auto tid_iter = mvcc_columns->tids.cbegin();
+      auto begin_cid_iter = mvcc_columns->begin_cids.cbegin();
+      auto end_cid_iter = mvcc_columns->end_cids.cbegin();
+      auto output_size = size_t{0u};
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size;
+           ++chunk_offset, ++tid_iter, ++begin_cid_iter, ++end_cid_iter) {
+        const auto row_tid = tid_iter->load();
+        const auto is_visible = (snapshot_commit_id < *end_cid_iter) &
+                                ((snapshot_commit_id >= *begin_cid_iter) != (row_tid == our_tid));
+
+        (*pos_list_out)[output_size] = RowID{chunk_id, chunk_offset};
+        output_size += is_visible;
       }
 
-      // Create actual ReferenceColumn objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
-        chunk_out->add_column(ref_col_out);
-      }
+      pos_list_out->resize(output_size);
     }
 
-    if (chunk_out->size() > 0 || output->get_chunk(ChunkID{0})->size() == 0) {
-      output->emplace_chunk(std::move(chunk_out));
+    if (apply_join_bloom_filter) {
+      const auto cannot_match = [&](const auto& row_id) { return !may_match[row_id.chunk_offset]; };
+      pos_list_out->erase(std::remove_if(pos_list_out->begin(), pos_list_out->end(), cannot_match),
+                          pos_list_out->end());
+    }
+
+    // Create actual ReferenceColumn objects.
+    for (ColumnID column_id{0}; column_id < chunk_in.column_count(); ++column_id) {
+      auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
+      chunk_out->add_column(ref_col_out);
     }
   }
-  return output;
+
+  return chunk_out;
 }
 
 }  // namespace opossum
@@ -10,11 +10,19 @@
 
 namespace opossum {
 
+class Chunk;
+class JoinBloomFilter;
+class Table;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
  *
  * Assumption: Validate happens before joins.
+ *
+ * Chunks whose rows have all been committed before the snapshot and of which no row has been invalidated are
+ * emitted without checking each row (see Chunk::MvccColumns::max_begin_cid()). If all rows of a referencing input
+ * chunk are visible, its PosList is shared with the output.
  */
 class Validate : public AbstractReadOnlyOperator {
  public:
@@ -24,9 +32,40 @@ class Validate : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
+  /**
+   * @brief If set, the specified chunks will be left out of the output.
+   *
+   * @see TableScan::set_excluded_chunk_ids
+   */
+  void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
+  /**
+   * @brief If set, rows that cannot find a join partner in the build input of a subsequent hash join are left out.
+   *
+   * @see TableScan::set_join_bloom_filter
+   */
+  void set_join_bloom_filter(const std::shared_ptr<JoinBloomFilter>& join_bloom_filter);
+  std::shared_ptr<const JoinBloomFilter> join_bloom_filter() const;
+
+  /**
+   * @brief Validates a single chunk without executing the Validate, e.g., to pass the output of one stage of a
+   * Pipeline directly to the next one
+   *
+   * Returns a chunk that references the rows of `chunk_in` that are visible to the transaction. If `chunk_in` holds
+   * data, it must be the chunk with the given id of `in_table`. If `may_match` is not empty, rows for which it is false
+   * are left out as well.
+   */
+  static std::shared_ptr<Chunk> validate_chunk(const std::shared_ptr<const Table>& in_table, const Chunk& chunk_in,
+                                               const ChunkID chunk_id, const TransactionContext& transaction_context,
+                                               const std::vector<bool>& may_match = {});
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<ChunkID> _excluded_chunk_ids;
+  std::shared_ptr<JoinBloomFilter> _join_bloom_filter;
 };
 
 }  // namespace opossum
@@ -3,8 +3,10 @@
 #include <memory>
 
 #include "logical_query_plan/logical_plan_root_node.hpp"
+#include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/join_detection_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 
 namespace opossum {
 
@@ -23,6 +25,14 @@ Optimizer Optimizer::create_default_optimizer() {
 
   optimizer.add_rule_batch(main_batch);
 
+  // Chunks are pruned once the order of the predicates is settled
+  RuleBatch final_batch(RuleBatchExecutionPolicy::Once);
+
+  final_batch.add_rule(std::make_shared<ChunkPruningRule>());
+  final_batch.add_rule(std::make_shared<TopKRule>());
+
+  optimizer.add_rule_batch(final_batch);
+
   return optimizer;
 }
 
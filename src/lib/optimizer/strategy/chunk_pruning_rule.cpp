@@ -0,0 +1,81 @@
+#include "chunk_pruning_rule.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "all_parameter_variant.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::string ChunkPruningRule::name() const { return "Chunk Pruning Rule"; }
+
+bool ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->type() != LQPNodeType::Predicate) return _apply_to_children(node);
+
+  // Gather the chain of PredicateNodes. Nodes below the top of the chain must not have other parents, because these
+  // would see the pruned output as well.
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{std::static_pointer_cast<PredicateNode>(node)};
+  auto lowest_node = node;
+  auto current_node = node->left_child();
+
+  while (current_node->type() == LQPNodeType::Predicate && current_node->parents().size() == 1) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(current_node));
+    lowest_node = current_node;
+    current_node = current_node->left_child();
+  }
+
+  if (current_node->type() == LQPNodeType::Validate && current_node->parents().size() == 1) {
+    lowest_node = current_node;
+    current_node = current_node->left_child();
+  }
+
+  if (current_node->type() != LQPNodeType::StoredTable) return _apply_to_children(lowest_node);
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(current_node);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name());
+
+  auto excluded_chunk_ids = std::set<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    // Only compressed chunks have statistics
+    const auto statistics = table->get_chunk(chunk_id)->statistics();
+    if (!statistics) continue;
+
+    for (const auto& predicate_node : predicate_nodes) {
+      const auto& column_reference = predicate_node->column_reference();
+      if (column_reference.original_node() != stored_table_node || !is_variant(predicate_node->value())) continue;
+
+      const auto& value = boost::get<AllTypeVariant>(predicate_node->value());
+      if (statistics->can_prune(column_reference.original_column_id(), predicate_node->scan_type(), value,
+                                predicate_node->value2())) {
+        excluded_chunk_ids.insert(chunk_id);
+        break;
+      }
+    }
+  }
+
+  const auto excluded_chunk_id_vector = std::vector<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
+
+  if (lowest_node->type() == LQPNodeType::Validate) {
+    const auto validate_node = std::static_pointer_cast<ValidateNode>(lowest_node);
+    if (validate_node->excluded_chunk_ids() == excluded_chunk_id_vector) return false;
+    validate_node->set_excluded_chunk_ids(excluded_chunk_id_vector);
+  } else {
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(lowest_node);
+    if (predicate_node->excluded_chunk_ids() == excluded_chunk_id_vector) return false;
+    predicate_node->set_excluded_chunk_ids(excluded_chunk_id_vector);
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule uses the zone maps of compressed chunks (see ChunkStatistics) to find chunks that cannot contain
+ * matches of a predicate, e.g., because the predicate asks for dates after the chunk's maximum. These chunks are
+ * excluded from the operator that reads the stored table.
+ *
+ * The rule looks for chains of PredicateNodes, optionally followed by a ValidateNode, on top of a StoredTableNode.
+ * Since the predicates of a chain form a conjunction, a chunk that is ruled out by any of them can be skipped. The
+ * excluded chunks are attached to the lowest node of the chain (the PredicateNode or ValidateNode directly on top of
+ * the StoredTableNode), because only there do the ChunkIDs refer to the stored table.
+ *
+ * The rule must run after all rules that reorder predicates, as moving the lowest node would invalidate its excluded
+ * chunks. Only predicates comparing a column of the stored table to a literal value are considered.
+ */
+class ChunkPruningRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+};
+
+}  // namespace opossum
@@ -27,20 +27,41 @@ bool JoinDetectionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
        * If we find a predicate with a condition that operates on the cross-joined tables,
        * replace the cross join and the predicate with a conditional inner join
        */
-      auto join_condition = _find_predicate_for_cross_join(cross_join_node);
-      if (join_condition) {
-        LQPColumnReferencePair join_column_ids(join_condition->left_column_reference,
-                                               join_condition->right_column_reference);
+      const auto join_conditions = _find_predicates_for_cross_join(cross_join_node);
+      if (!join_conditions.empty()) {
+        const auto& join_condition = join_conditions.front();
+        LQPColumnReferencePair join_column_ids(join_condition.left_column_reference,
+                                               join_condition.right_column_reference);
+
+        const auto scan_type = join_condition.predicate_node->scan_type();
+        auto merged_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{join_condition.predicate_node};
+
+        /**
+         * All further equality conditions become additional predicates of an equi-join, so that composite keys are
+         * joined at once instead of filtering the result of a join on one of their columns
+         */
+        auto additional_join_column_ids = std::vector<LQPColumnReferencePair>{};
+        if (scan_type == ScanType::Equals) {
+          for (auto condition_idx = size_t{1}; condition_idx < join_conditions.size(); ++condition_idx) {
+            const auto& additional_condition = join_conditions[condition_idx];
+            if (additional_condition.predicate_node->scan_type() != ScanType::Equals) continue;
+
+            additional_join_column_ids.emplace_back(additional_condition.left_column_reference,
+                                                    additional_condition.right_column_reference);
+            merged_predicate_nodes.emplace_back(additional_condition.predicate_node);
+          }
+        }
 
-        auto predicate_node = join_condition->predicate_node;
         const auto new_join_node =
-            std::make_shared<JoinNode>(JoinMode::Inner, join_column_ids, predicate_node->scan_type());
+            std::make_shared<JoinNode>(JoinMode::Inner, join_column_ids, scan_type, additional_join_column_ids);
 
         /**
-         * Place the conditional join where the cross join was and remove the predicate node
+         * Place the conditional join where the cross join was and remove the predicate nodes
          */
         cross_join_node->replace_with(new_join_node);
-        predicate_node->remove_from_tree();
+        for (const auto& predicate_node : merged_predicate_nodes) {
+          predicate_node->remove_from_tree();
+        }
 
         return true;
       }
@@ -50,10 +71,12 @@ bool JoinDetectionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
   return _apply_to_children(node);
 }
 
-std::optional<JoinDetectionRule::JoinCondition> JoinDetectionRule::_find_predicate_for_cross_join(
+std::vector<JoinDetectionRule::JoinCondition> JoinDetectionRule::_find_predicates_for_cross_join(
     const std::shared_ptr<JoinNode>& cross_join) {
   Assert(cross_join->left_child() && cross_join->right_child(), "Cross Join must have two children");
 
+  std::vector<JoinCondition> join_conditions;
+
   // Everytime we traverse a node which we're the right child of, the ColumnIDs a predicate needs to reference become
   // offset
   auto column_id_offset = 0;
@@ -85,7 +108,7 @@ std::optional<JoinDetectionRule::JoinCondition> JoinDetectionRule::_find_predica
      * Detecting Join Conditions across other node types may be possible by applying 'Predicate Pushdown' first.
      */
     if (node->type() != LQPNodeType::Join && node->type() != LQPNodeType::Predicate) {
-      return std::nullopt;
+      break;
     }
 
     if (node->type() == LQPNodeType::Predicate) {
@@ -108,19 +131,22 @@ std::optional<JoinDetectionRule::JoinCondition> JoinDetectionRule::_find_predica
       const auto right_in_right = cross_join->right_child()->find_output_column_id(predicate_right_column_reference);
 
       if (left_in_left && right_in_right) {
-        return JoinCondition{predicate_node, predicate_left_column_reference, predicate_right_column_reference};
+        join_conditions.emplace_back(
+            JoinCondition{predicate_node, predicate_left_column_reference, predicate_right_column_reference});
+        continue;
       }
 
       const auto left_in_right = cross_join->right_child()->find_output_column_id(predicate_left_column_reference);
       const auto right_in_left = cross_join->left_child()->find_output_column_id(predicate_right_column_reference);
 
       if (right_in_left && left_in_right) {
-        return JoinCondition{predicate_node, predicate_right_column_reference, predicate_left_column_reference};
+        join_conditions.emplace_back(
+            JoinCondition{predicate_node, predicate_right_column_reference, predicate_left_column_reference});
       }
     }
   }
 
-  return std::nullopt;
+  return join_conditions;
 }
 
 }  // namespace opossum
@@ -34,6 +34,12 @@ struct ColumnID;
  * by searching the parent nodes for PredicateNodes. Each PredicateNode is a potential candidate
  * but only those that compare two columns are interesting enough to check.
  * When such a PredicateNode is found, the rule will check whether each ColumnID comes from the left/right input.
+ * The lowest of these predicates becomes the join condition. If it is an equality, all further equalities between the
+ * inputs become additional predicates of the join, e.g., for composite keys:
+ *
+ * SELECT * FROM a, b WHERE a.id = b.id AND a.version = b.version;
+ * =>
+ * SELECT * FROM a INNER JOIN b ON a.id = b.id AND a.version = b.version
  *
  * Note: Limited first iteration. This will only work on subtrees consisting of Joins and Predicates, so we don't
  * have to deal with ColumnID re-mappings for now. Projections, Aggregates, etc. amidst Joins and Predicates
@@ -52,7 +58,8 @@ class JoinDetectionRule : public AbstractRule {
     LQPColumnReference right_column_reference;
   };
 
-  std::optional<JoinCondition> _find_predicate_for_cross_join(const std::shared_ptr<JoinNode>& cross_join);
+  // Returns the conditions of all PredicateNodes that can be joined with the cross join, lowest first
+  std::vector<JoinCondition> _find_predicates_for_cross_join(const std::shared_ptr<JoinNode>& cross_join);
 
   /**
    * Used to check whether a Predicate working on the ColumnIDs left and right could be used as a JoinCondition
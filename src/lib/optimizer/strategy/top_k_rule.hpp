@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule replaces a LimitNode directly on top of a SortNode with a TopKNode, so that ORDER BY ... LIMIT
+ * does not sort its whole input (see TopK). SortNodes with other parents than the LimitNode are left alone, because
+ * these parents need all sorted rows.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+};
+
+}  // namespace opossum
@@ -10,8 +10,12 @@
 #include <utility>
 
 #include "all_type_variant.hpp"
+#include "storage/base_encoded_column.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/resolve_encoded_column_type.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
 
@@ -172,7 +176,7 @@ void resolve_data_type(DataType data_type, const Functor& func) {
  * Given a BaseColumn and its known column type, resolve the column implementation and call the lambda
  *
  * @param func is a generic lambda or similar accepting a reference to a specialized column (value, dictionary,
- * reference)
+ * encoded, reference)
  *
  *
  * Example:
@@ -189,21 +193,21 @@ void resolve_data_type(DataType data_type, const Functor& func) {
  *     process_column(typed_column);
  *   });
  */
-template <typename In, typename Out>
-using ConstOutIfConstIn = std::conditional_t<std::is_const<In>::value, const Out, Out>;
-
 template <typename ColumnDataType, typename BaseColumnType, typename Functor>
 // BaseColumnType allows column to be const and non-const
 std::enable_if_t<std::is_same<BaseColumn, std::remove_const_t<BaseColumnType>>::value>
     /*void*/ resolve_column_type(BaseColumnType& column, const Functor& func) {
   using ValueColumnPtr = ConstOutIfConstIn<BaseColumnType, ValueColumn<ColumnDataType>>*;
   using DictionaryColumnPtr = ConstOutIfConstIn<BaseColumnType, DictionaryColumn<ColumnDataType>>*;
+  using EncodedColumnPtr = ConstOutIfConstIn<BaseColumnType, BaseEncodedColumn>*;
   using ReferenceColumnPtr = ConstOutIfConstIn<BaseColumnType, ReferenceColumn>*;
 
   if (auto value_column = dynamic_cast<ValueColumnPtr>(&column)) {
     func(*value_column);
   } else if (auto dict_column = dynamic_cast<DictionaryColumnPtr>(&column)) {
     func(*dict_column);
+  } else if (auto encoded_column = dynamic_cast<EncodedColumnPtr>(&column)) {
+    resolve_encoded_column_type<ColumnDataType>(*encoded_column, func);
   } else if (auto ref_column = dynamic_cast<ReferenceColumnPtr>(&column)) {
     func(*ref_column);
   } else {
@@ -216,7 +220,7 @@ std::enable_if_t<std::is_same<BaseColumn, std::remove_const_t<BaseColumnType>>::
  *
  * @param data_type is an enum value of any of the supported column types
  * @param func is a generic lambda or similar accepting two parameters: a hana::type object and
- *   a reference to a specialized column (value, dictionary, reference)
+ *   a reference to a specialized column (value, dictionary, encoded, reference)
  *
  *
  * Example:
@@ -7,6 +7,7 @@
 
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
+#include "query_context.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
@@ -41,6 +42,14 @@ void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
 bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
 
+void AbstractTask::set_query_context(const std::shared_ptr<QueryContext>& query_context) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the QueryContext after the Task was scheduled");
+
+  _query_context = query_context;
+}
+
+const std::shared_ptr<QueryContext>& AbstractTask::query_context() const { return _query_context; }
+
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
 
@@ -50,6 +59,8 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 void AbstractTask::schedule(NodeID preferred_node_id, SchedulePriority priority) {
   _mark_as_scheduled();
 
+  if (!_query_context) _query_context = QueryContext::current();
+
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, priority);
   } else {
@@ -85,7 +96,10 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
+  // Tasks scheduled by this one inherit its QueryContext
+  auto previous_query_context = QueryContext::_exchange_current(_query_context);
   _on_execute();
+  QueryContext::_exchange_current(std::move(previous_query_context));
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -115,7 +129,7 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      worker->_schedule_task(shared_from_this(), SchedulePriority::High);
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
@@ -12,6 +12,7 @@
 
 namespace opossum {
 
+class QueryContext;
 class Worker;
 
 /**
@@ -63,6 +64,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The QueryContext determines how the task is scheduled relative to the tasks of other queries. If none is set, the
+   * task inherits the QueryContext of the task that schedules it.
+   */
+  void set_query_context(const std::shared_ptr<QueryContext>& query_context);
+  const std::shared_ptr<QueryContext>& query_context() const;
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -126,6 +134,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   NodeID _node_id = INVALID_NODE_ID;
   bool _done = false;
   std::function<void()> _done_callback;
+  std::shared_ptr<QueryContext> _query_context;
 
   // For dependencies
   std::atomic_uint _predecessor_counter{0};
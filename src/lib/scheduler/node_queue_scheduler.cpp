@@ -13,11 +13,17 @@
 #include "topology.hpp"
 
 #include "uid_allocator.hpp"
+#include "worker.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler(std::shared_ptr<Topology> topology) : AbstractScheduler(topology) {
+NodeQueueScheduler::NodeQueueScheduler(std::shared_ptr<Topology> topology, const QueryClassConfigs& query_class_configs)
+    : AbstractScheduler(topology), _query_class_configs(query_class_configs) {
+  for (const auto& config : _query_class_configs) {
+    Assert(config.weight > 0, "Weight of a query class must be positive");
+  }
+
   _worker_id_allocator = std::make_shared<UidAllocator>();
 }
 
@@ -34,7 +40,7 @@ void NodeQueueScheduler::begin() {
   _queues.reserve(_topology->nodes().size());
 
   for (NodeID q{0}; q < _topology->nodes().size(); q++) {
-    auto queue = std::make_shared<TaskQueue>(q);
+    auto queue = std::make_shared<TaskQueue>(q, _query_class_configs);
 
     _queues.emplace_back(queue);
 
@@ -91,6 +97,14 @@ void NodeQueueScheduler::finish() {
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<ProcessingUnit>>& NodeQueueScheduler::processing_units() const {
+  return _processing_units;
+}
+
+const QueryClassConfig& NodeQueueScheduler::query_class_config(QueryClass query_class) const {
+  return _query_class_configs[static_cast<size_t>(query_class)];
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -104,11 +118,18 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  const auto& query_context = task->query_context();
+  if (query_context && priority == SchedulePriority::Normal) {
+    priority = query_class_config(query_context->query_class()).priority;
+  }
+
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
-      preferred_node_id = worker->queue()->node_id();
+      // Jobs spawned by a task stay with the worker's processing unit, unless they are stolen
+      worker->_schedule_task(std::move(task), priority);
+      return;
     } else {
       // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
       preferred_node_id = NodeID{0};
@@ -120,5 +141,30 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   auto queue = _queues[preferred_node_id];
   queue->push(std::move(task), static_cast<uint32_t>(priority));
+
+  _wake_parked_worker(preferred_node_id, priority);
 }
+
+void NodeQueueScheduler::_wake_parked_worker(NodeID node_id, SchedulePriority priority) {
+  // Orders the push of the task before reading the counter. Together with the fence in Worker::_park(), either a
+  // parking worker sees the task when it checks for tasks a last time, or we see that the worker parks.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_num_parked_workers.load(std::memory_order_relaxed) == 0) return;
+
+  for (const auto& processing_unit : _processing_units) {
+    if (processing_unit->node_id() == node_id && processing_unit->try_wake_parked_worker()) return;
+  }
+
+  if (priority == SchedulePriority::Unstealable) return;
+
+  for (const auto& processing_unit : _processing_units) {
+    if (processing_unit->node_id() != node_id && processing_unit->try_wake_parked_worker()) return;
+  }
+}
+
+uint32_t NodeQueueScheduler::_max_concurrent_tasks(const std::shared_ptr<QueryContext>& query_context) const {
+  if (!query_context) return 0;
+  return query_class_config(query_context->query_class()).max_concurrent_tasks;
+}
+
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "query_context.hpp"
 
 namespace opossum {
 
@@ -56,18 +57,32 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Tasks that a worker schedules while it executes another task, typically JobTasks working on a chunk each, do not go
+ * to the queue of the node. Instead, they are pushed to a work-stealing deque of the worker's ProcessingUnit (one per
+ * priority level, see WorkStealingDeque). The active worker of a ProcessingUnit pops the most recently pushed task
+ * first, as its data is most likely still in the CPU's cache, and this does not contend with the other workers.
+ *
+ * A worker gets idle if its ProcessingUnit's deques and its node's queue are empty. It then steals the oldest task of
+ * another ProcessingUnit, trying the ProcessingUnits of its own node first, starting at a random one so that idle
+ * workers do not all compete for the same victim. Only then does it steal from other nodes, i.e., from their queues
+ * and ProcessingUnits. As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
+ * accessing a local node. [1] Tasks scheduled with SchedulePriority::Unstealable are never stolen by other nodes.
+ *
+ * IDLE WORKERS
+ *
+ * A worker that finds no task checks again for a bounded number of rounds, as new tasks often follow shortly. After
+ * that, it parks on a condition variable of its ProcessingUnit. Whenever a task is added to a queue or deque, the
+ * scheduler wakes up one parked worker, preferring those of the task's node, so that no more workers wake up than
+ * there are tasks. If no worker is parked, scheduling a task only costs a check of an atomic counter.
+ *
+ * QUERIES
+ *
+ * Tasks can be tagged with a QueryContext, which the tasks scheduled by them inherit. The class of the query determines
+ * the priority of its tasks, its weight in the round robin over the queries of a TaskQueue (see TaskQueue::pull()),
+ * and the maximum number of its tasks that are executed at the same time. This way, the short transactions of a mixed
+ * workload are not kept waiting by the many jobs of a long analytical query. The tasks of a query whose class has a
+ * limit are always added to the node's queue, as only TaskQueue::pull() enforces the limit. A worker executing such a
+ * task releases its slot while it waits for other tasks, so that they can be executed.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -82,7 +97,8 @@ class UidAllocator;
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  explicit NodeQueueScheduler(std::shared_ptr<Topology> setup);
+  explicit NodeQueueScheduler(std::shared_ptr<Topology> setup,
+                              const QueryClassConfigs& query_class_configs = default_query_class_configs());
   ~NodeQueueScheduler();
 
   /**
@@ -95,20 +111,40 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<ProcessingUnit>>& processing_units() const;
+
+  const QueryClassConfig& query_class_config(QueryClass query_class) const;
+
   /**
    * @param task
-   * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
-   * @param priority Determines whether tasks are inserted at the beginning or end of the queue.
+   * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later.
+   *                          Tasks scheduled with CURRENT_NODE_ID by the active worker of a ProcessingUnit are added
+   *                          to the ProcessingUnit's deques instead.
+   * @param priority Determines whether tasks are inserted at the beginning or end of the queue. Tasks of a query
+   *                 that are scheduled with SchedulePriority::Normal get the priority of the query's class instead.
    */
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Normal) override;
 
  private:
+  friend class Worker;
+
+  /**
+   * To be called after a task was added to a queue or deque of node_id. If workers are parked, wakes up one of the
+   * node_id, or, if there is none and the task may be stolen by other nodes, one of another node.
+   */
+  void _wake_parked_worker(NodeID node_id, SchedulePriority priority);
+
+  // Returns the limit of the class of the query, 0 if there is none or if the task does not belong to a query
+  uint32_t _max_concurrent_tasks(const std::shared_ptr<QueryContext>& query_context) const;
+
+  const QueryClassConfigs _query_class_configs;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<ProcessingUnit>> _processing_units;
   std::atomic_bool _shut_down{false};
+  std::atomic_uint _num_parked_workers{0};  // Includes the workers that announced to park, see Worker::_park()
 };
 
 }  // namespace opossum
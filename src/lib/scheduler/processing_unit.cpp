@@ -2,7 +2,9 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 
+#include "abstract_task.hpp"
 #include "uid_allocator.hpp"
 #include "worker.hpp"
 
@@ -52,6 +54,38 @@ void ProcessingUnit::hibernate_calling_worker() {
   _num_hibernated_workers--;
 }
 
+void ProcessingUnit::announce_parking() { _parked = true; }
+
+void ProcessingUnit::cancel_parking() {
+  if (_parked.exchange(false)) return;
+
+  // Someone claimed the wakeup in the meantime. Consume it, so that it does not cut the next parking short.
+  std::unique_lock<std::mutex> lock(_hibernation_mutex);
+  _park_cv.wait(lock, [&]() { return _wakeup_pending || _shutdown_flag; });
+  _wakeup_pending = false;
+}
+
+void ProcessingUnit::park_calling_worker() {
+  std::unique_lock<std::mutex> lock(_hibernation_mutex);
+
+  _park_cv.wait(lock, [&]() { return _wakeup_pending || _shutdown_flag; });
+
+  _wakeup_pending = false;
+  _parked = false;
+}
+
+bool ProcessingUnit::try_wake_parked_worker() {
+  // Reading first avoids invalidating the cache line of workers that are not parked
+  if (!_parked || !_parked.exchange(false)) return false;
+
+  {
+    std::unique_lock<std::mutex> lock(_hibernation_mutex);
+    _wakeup_pending = true;
+  }
+  _park_cv.notify_one();
+  return true;
+}
+
 void ProcessingUnit::wake_or_create_worker() {
   if (_num_hibernated_workers == 0) {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -81,10 +115,41 @@ void ProcessingUnit::shutdown() {
     _shutdown_flag = true;
   }
   _hibernation_cv.notify_all();
+  _park_cv.notify_all();
 }
 
 bool ProcessingUnit::shutdown_flag() const { return _shutdown_flag; }
 
+NodeID ProcessingUnit::node_id() const { return _queue->node_id(); }
+
+void ProcessingUnit::push_task(std::shared_ptr<AbstractTask> task, SchedulePriority priority) {
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deques[static_cast<uint32_t>(priority)].push(std::move(task));
+}
+
+std::shared_ptr<AbstractTask> ProcessingUnit::pop_task() {
+  for (auto& deque : _deques) {
+    auto task = deque.pop();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> ProcessingUnit::steal_task(bool include_unstealable) {
+  for (auto priority : {SchedulePriority::High, SchedulePriority::Normal, SchedulePriority::Unstealable}) {
+    if (priority == SchedulePriority::Unstealable && !include_unstealable) break;
+
+    auto task = _deques[static_cast<uint32_t>(priority)].steal();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+bool ProcessingUnit::is_active_worker(WorkerID worker_id) const { return _active_worker_token == worker_id; }
+
 void ProcessingUnit::on_worker_finished_task() { _num_finished_tasks++; }
 
 uint64_t ProcessingUnit::num_finished_tasks() const { return _num_finished_tasks; }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <memory>
@@ -7,17 +8,22 @@
 #include <thread>
 #include <vector>
 
+#include "task_queue.hpp"
 #include "types.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class UidAllocator;
-class TaskQueue;
 class Worker;
 
 /**
  * Encapsulates the concept of a CPU. Mainly makes sure that there is always a Worker active per CPU, but only one of
- * these Workers is able to pull new tasks from the TaskQueue
+ * these Workers is able to pull new tasks from the TaskQueue.
+ *
+ * Every ProcessingUnit has a WorkStealingDeque per priority level for the tasks spawned by its active worker. Only the
+ * active worker may push to and pop from them, all other workers can only steal from them.
  */
 class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit> {
  public:
@@ -25,6 +31,28 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
 
   bool shutdown_flag() const;
 
+  NodeID node_id() const;
+
+  /**
+   * Only to be called by the active worker. Adds a task to the deque of its priority level, unless it has already been
+   * enqueued elsewhere.
+   */
+  void push_task(std::shared_ptr<AbstractTask> task, SchedulePriority priority);
+
+  /**
+   * Only to be called by the active worker. Returns the task that was pushed last, trying the priority levels in the
+   * same order as TaskQueue::pull(), or nullptr if the deques are empty.
+   */
+  std::shared_ptr<AbstractTask> pop_task();
+
+  /**
+   * Returns the oldest task of the highest priority level that has one, or nullptr if no task could be stolen. Unless
+   * include_unstealable is set, tasks scheduled with SchedulePriority::Unstealable are not considered.
+   */
+  std::shared_ptr<AbstractTask> steal_task(bool include_unstealable);
+
+  bool is_active_worker(WorkerID worker_id) const;
+
   /**
    * In order to be allowed to pull new Tasks, a Worker must be the active worker, i.e. call this method with its id
    * and receive true from it.
@@ -44,6 +72,21 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
    */
   void hibernate_calling_worker();
 
+  /**
+   * The active worker parks when it found no task to execute. Before it checks for tasks a last time, it announces
+   * this, so that tasks scheduled concurrently wake it up. If the check finds a task after all, the worker cancels the
+   * parking, otherwise it parks until try_wake_parked_worker() is called or the Scheduler is shutting down.
+   */
+  void announce_parking();
+  void cancel_parking();
+  void park_calling_worker();
+
+  /**
+   * Wakes up the active worker if it is parked or about to park. Returns false if it is not or if someone else
+   * already woke it up.
+   */
+  bool try_wake_parked_worker();
+
   /**
    * When hibernated workers are available, wake one of them up. Otherwise create a new worker.
    */
@@ -64,6 +107,7 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
 
  private:
   std::shared_ptr<TaskQueue> _queue;
+  std::array<WorkStealingDeque, TaskQueue::NUM_PRIORITY_LEVELS> _deques;
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   CpuID _cpu_id;
   std::mutex _mutex;  // Synchronizes access to _threads, _workers
@@ -74,6 +118,9 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
   std::mutex _hibernation_mutex;
   std::condition_variable _hibernation_cv;
   std::atomic_uint _num_hibernated_workers{0};
+  std::condition_variable _park_cv;  // Uses _hibernation_mutex
+  std::atomic_bool _parked{false};
+  bool _wakeup_pending{false};  // Guarded by _hibernation_mutex
   std::atomic<uint64_t> _num_finished_tasks{0};
 };
 }  // namespace opossum
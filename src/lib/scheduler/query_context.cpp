@@ -0,0 +1,52 @@
+#include "query_context.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace {
+
+std::atomic<uint64_t> next_query_id{0};
+
+thread_local std::shared_ptr<opossum::QueryContext> this_thread_query_context;
+
+}  // namespace
+
+namespace opossum {
+
+const QueryClassConfigs& default_query_class_configs() {
+  static const auto configs = QueryClassConfigs{{
+      {SchedulePriority::Normal, 1, 0},  // Default
+      {SchedulePriority::High, 4, 0},    // Transactional
+      {SchedulePriority::Normal, 1, 0},  // Analytical
+  }};
+  return configs;
+}
+
+QueryContext::QueryContext(const QueryClass query_class) : _id(next_query_id++), _query_class(query_class) {}
+
+uint64_t QueryContext::id() const { return _id; }
+
+QueryClass QueryContext::query_class() const { return _query_class; }
+
+const std::shared_ptr<QueryContext>& QueryContext::current() { return ::this_thread_query_context; }
+
+uint32_t QueryContext::num_running_tasks() const { return _num_running_tasks; }
+
+std::shared_ptr<QueryContext> QueryContext::_exchange_current(std::shared_ptr<QueryContext> query_context) {
+  std::swap(::this_thread_query_context, query_context);
+  return query_context;
+}
+
+bool QueryContext::_try_acquire_slot(const uint32_t max_concurrent_tasks) {
+  auto num_running_tasks = _num_running_tasks.load();
+  do {
+    if (num_running_tasks >= max_concurrent_tasks) return false;
+  } while (!_num_running_tasks.compare_exchange_weak(num_running_tasks, num_running_tasks + 1));
+  return true;
+}
+
+void QueryContext::_acquire_slot() { ++_num_running_tasks; }
+
+void QueryContext::_release_slot() { --_num_running_tasks; }
+
+}  // namespace opossum
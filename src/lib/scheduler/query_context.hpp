@@ -0,0 +1,97 @@
+#pragma once
+
+#include <tbb/concurrent_unordered_map.h>
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class TaskQueue;
+class Worker;
+struct QueuedQueryTasks;
+
+/**
+ * Queries of different classes are scheduled differently, e.g., the short transactions and the long analytical queries
+ * of a mixed workload. Tasks without a QueryContext are treated as if they belonged to a query of the Default class.
+ */
+enum class QueryClass { Default, Transactional, Analytical };
+
+constexpr size_t NUM_QUERY_CLASSES = 3;
+
+struct QueryClassConfig {
+  // The priority that the tasks of the class are scheduled with, unless another one than SchedulePriority::Normal is
+  // requested explicitly, e.g., for tasks whose predecessors are done
+  SchedulePriority priority;
+
+  // The number of tasks that TaskQueue::pull() returns for a query of this class in a row before it moves on to the
+  // next query with tasks of the same priority
+  uint32_t weight;
+
+  // The number of tasks of a query of this class that workers may execute at the same time, 0 for no limit
+  uint32_t max_concurrent_tasks;
+};
+
+using QueryClassConfigs = std::array<QueryClassConfig, NUM_QUERY_CLASSES>;
+
+/**
+ * Transactional queries are preferred over all others and get four times the share of the workers that the queries of
+ * other classes get. No class is limited in its concurrency by default, as a sensible limit depends on the number of
+ * workers.
+ */
+const QueryClassConfigs& default_query_class_configs();
+
+/**
+ * Tags all tasks of a query, so that the scheduler can choose fairly between the tasks of concurrent queries and limit
+ * the number of workers that a single query occupies. Tasks that are scheduled while another task is executed inherit
+ * the QueryContext of that task, so that only the tasks scheduled from outside of the scheduler, typically the
+ * OperatorTasks of a query, need to be tagged with AbstractTask::set_query_context().
+ */
+class QueryContext {
+  friend class AbstractTask;
+  friend class TaskQueue;
+  friend class Worker;
+
+ public:
+  explicit QueryContext(const QueryClass query_class = QueryClass::Default);
+
+  /**
+   * Unique ID of a query. Currently not in use, but really helpful for debugging.
+   */
+  uint64_t id() const;
+  QueryClass query_class() const;
+
+  /**
+   * The QueryContext of the task that the calling thread executes, nullptr if it executes none or one without a
+   * QueryContext
+   */
+  static const std::shared_ptr<QueryContext>& current();
+
+  // Number of tasks of the query that are executed by workers right now, not counting those that wait for other tasks.
+  // Only tracked if the class of the query has a limit.
+  uint32_t num_running_tasks() const;
+
+ private:
+  // Sets the QueryContext of the calling thread and returns the previous one
+  static std::shared_ptr<QueryContext> _exchange_current(std::shared_ptr<QueryContext> query_context);
+
+  /**
+   * A worker needs a slot of the query to execute one of its tasks if its class has a limit. The slot is acquired when
+   * the task is taken from a TaskQueue and released while the task waits for other tasks and once it is done.
+   */
+  bool _try_acquire_slot(const uint32_t max_concurrent_tasks);
+  void _acquire_slot();
+  void _release_slot();
+
+  const uint64_t _id;
+  const QueryClass _query_class;
+  std::atomic_uint _num_running_tasks{0};
+
+  // The queued tasks of the query per TaskQueue. A TaskQueue adds them when it gets the first task of the query.
+  tbb::concurrent_unordered_map<const TaskQueue*, std::shared_ptr<QueuedQueryTasks>> _queued_tasks;
+};
+
+}  // namespace opossum
@@ -2,16 +2,32 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "abstract_task.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
+QueuedQueryTasks::QueuedQueryTasks(QueryContext* query_context) {
+  for (auto& query_tasks : levels) query_tasks.query_context = query_context;
+}
+
+TaskQueue::TaskQueue(NodeID node_id, const QueryClassConfigs& query_class_configs)
+    : _node_id(node_id),
+      _query_class_configs(query_class_configs),
+      _untagged_tasks(std::make_shared<QueuedQueryTasks>(nullptr)) {
+  for ([[gnu::unused]] const auto& config : _query_class_configs) {
+    DebugAssert(config.weight > 0, "Weight of a query class must be positive");
+  }
+}
 
 bool TaskQueue::empty() const { return _num_tasks == 0; }
 
+bool TaskQueue::has_tasks(SchedulePriority priority) const {
+  return _levels[static_cast<uint32_t>(priority)].num_tasks > 0;
+}
+
 NodeID TaskQueue::node_id() const { return _node_id; }
 
 void TaskQueue::push(std::shared_ptr<AbstractTask> task, uint32_t priority) {
@@ -21,36 +37,100 @@ void TaskQueue::push(std::shared_ptr<AbstractTask> task, uint32_t priority) {
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
 
+  auto& level = _levels[priority];
+  auto query_tasks = _query_tasks(task->query_context(), priority);
+  query_tasks->tasks.push(std::move(task));
+
+  level.num_tasks++;
   _num_tasks++;
+
+  // A query that has no queued tasks gets its turn after all others. If it has some, a worker passes its turn on.
+  if (query_tasks->num_tasks++ == 0) level.next_turns.push(std::move(query_tasks));
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    queue.try_pop(task);
+  if (empty()) return nullptr;
 
-    if (task) {
-      _num_tasks--;
-      return task;
-    }
+  for (auto& level : _levels) {
+    auto task = _pull_from_level(level);
+    if (task) return task;
   }
   return nullptr;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
+  if (empty()) return nullptr;
+
   for (auto i : {SchedulePriority::High, SchedulePriority::Normal}) {
-    auto& queue = _queues[static_cast<uint32_t>(i)];
-    queue.try_pop(task);
+    auto task = _pull_from_level(_levels[static_cast<uint32_t>(i)]);
+    if (task) return task;
+  }
+  return nullptr;
+}
 
-    if (task) {
-      _num_tasks--;
-      return task;
+std::shared_ptr<QueryTasks> TaskQueue::_query_tasks(const std::shared_ptr<QueryContext>& query_context,
+                                                    uint32_t priority) {
+  auto queued_tasks = _untagged_tasks;
+  if (query_context) {
+    auto& queued_tasks_by_queue = query_context->_queued_tasks;
+    auto queued_tasks_iter = queued_tasks_by_queue.find(this);
+    if (queued_tasks_iter == queued_tasks_by_queue.end()) {
+      // If another thread inserts first, its tasks are used
+      const auto new_queued_tasks = std::make_shared<QueuedQueryTasks>(query_context.get());
+      queued_tasks_iter = queued_tasks_by_queue.insert(std::make_pair(this, new_queued_tasks)).first;
     }
+    queued_tasks = queued_tasks_iter->second;
   }
-  return nullptr;
+
+  // Shares the ownership of the tasks of all levels
+  return std::shared_ptr<QueryTasks>(queued_tasks, &queued_tasks->levels[priority]);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::_pull_from_level(PriorityLevel& level) {
+  if (level.num_tasks == 0) return nullptr;
+
+  auto task = std::shared_ptr<AbstractTask>{};
+  auto skipped_queries = std::vector<std::shared_ptr<QueryTasks>>{};
+
+  auto query_tasks = std::shared_ptr<QueryTasks>{};
+  while (level.current_turns.try_pop(query_tasks) || level.next_turns.try_pop(query_tasks)) {
+    const auto query_context = query_tasks->query_context;
+    const auto query_class = query_context ? query_context->query_class() : QueryClass::Default;
+    const auto& config = _query_class_configs[static_cast<size_t>(query_class)];
+
+    // The query keeps its turn while it is at its limit, so that it continues once one of its tasks is done
+    if (query_context && config.max_concurrent_tasks > 0 &&
+        !query_context->_try_acquire_slot(config.max_concurrent_tasks)) {
+      skipped_queries.emplace_back(std::move(query_tasks));
+      continue;
+    }
+
+    // The query has a task, as it only waits for its turn while it has some, and only this worker pulls them now
+    [[gnu::unused]] const auto has_task = query_tasks->tasks.try_pop(task);
+    DebugAssert(has_task, "Query waited for its turn without queued tasks");
+
+    level.num_tasks--;
+    _num_tasks--;
+
+    if (query_tasks->num_turns_left == 0) query_tasks->num_turns_left = config.weight;
+    --query_tasks->num_turns_left;
+
+    // The worker that pulls the last task of a query drops its turn. The next push gives the query a new one.
+    // Turns that are left over are used when the query gets new tasks.
+    if (query_tasks->num_tasks-- > 1) {
+      if (query_tasks->num_turns_left > 0) {
+        level.current_turns.push(std::move(query_tasks));
+      } else {
+        level.next_turns.push(std::move(query_tasks));
+      }
+    }
+    break;
+  }
+
+  for (auto& skipped_query : skipped_queries) level.current_turns.push(std::move(skipped_query));
+
+  return task;
 }
 
 }  // namespace opossum
@@ -6,41 +6,97 @@
 #include <atomic>
 #include <memory>
 
+#include "query_context.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+struct QueryTasks;
+struct QueuedQueryTasks;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Within a priority level, the tasks are queued per query and pulled in a weighted round robin over the queries: Each
+ * query gets as many tasks in a row as the weight of its class before it is the next query's turn. Thus, a query that
+ * spawns a lot of tasks does not delay the tasks of the queries that were scheduled after it. Queries whose class
+ * limits the number of their concurrently executed tasks are skipped while they are at that limit.
+ *
+ * Pushing and pulling do not take a lock. The queries with queued tasks wait for their turn in concurrent queues, and
+ * the worker that takes a query from there is the only one that pulls its tasks until it passes the turn on.
  */
 class TaskQueue {
  public:
   static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
 
-  explicit TaskQueue(NodeID node_id);
+  explicit TaskQueue(NodeID node_id, const QueryClassConfigs& query_class_configs = default_query_class_configs());
 
   bool empty() const;
 
+  /**
+   * Returns whether tasks of the given priority are queued, even if they cannot be pulled right now because of the
+   * concurrency limits of their queries
+   */
+  bool has_tasks(SchedulePriority priority) const;
+
   NodeID node_id() const;
 
   void push(std::shared_ptr<AbstractTask> task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Returns a Tasks that is ready to be executed and removes it from the queue. If the class of the task's query has a
+   * concurrency limit, the caller owns a slot of the query (see QueryContext).
    */
   std::shared_ptr<AbstractTask> pull();
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues, like pull()
    */
   std::shared_ptr<AbstractTask> steal();
 
  private:
+  struct PriorityLevel {
+    // Queries whose turn continues, because they have turns left or were skipped at their concurrency limit
+    tbb::concurrent_queue<std::shared_ptr<QueryTasks>> current_turns;
+    // Queries with queued tasks in the order of their next turn
+    tbb::concurrent_queue<std::shared_ptr<QueryTasks>> next_turns;
+    std::atomic_uint num_tasks{0};
+  };
+
+  // Returns the tasks of the query queued on the given level of this queue
+  std::shared_ptr<QueryTasks> _query_tasks(const std::shared_ptr<QueryContext>& query_context, uint32_t priority);
+
+  std::shared_ptr<AbstractTask> _pull_from_level(PriorityLevel& level);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  const QueryClassConfigs _query_class_configs;
+  std::array<PriorityLevel, NUM_PRIORITY_LEVELS> _levels;
   std::atomic_uint _num_tasks{0};
+
+  // The queued tasks without a QueryContext are treated as one query
+  const std::shared_ptr<QueuedQueryTasks> _untagged_tasks;
+};
+
+// The queued tasks of one query, or of all tasks without a QueryContext, on one priority level of a TaskQueue
+struct QueryTasks {
+  // nullptr for the tasks without a QueryContext. The queued tasks keep the QueryContext alive.
+  QueryContext* query_context{nullptr};
+
+  tbb::concurrent_queue<std::shared_ptr<AbstractTask>> tasks;
+
+  // Counts a task after it is pushed to `tasks`. The query waits for its turn in the TaskQueue while this is not zero.
+  std::atomic_uint num_tasks{0};
+
+  // Only accessed by the worker that took the query from the turn queues
+  uint32_t num_turns_left{0};
+};
+
+// The queued tasks of one query in one TaskQueue. The QueryContext owns them, so that they are found without a lock.
+struct QueuedQueryTasks {
+  explicit QueuedQueryTasks(QueryContext* query_context);
+
+  std::array<QueryTasks, TaskQueue::NUM_PRIORITY_LEVELS> levels;
 };
 
 }  // namespace opossum
@@ -0,0 +1,119 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(size_t capacity)
+    : _capacity(capacity), _slots(std::make_unique<std::atomic<std::shared_ptr<AbstractTask>*>[]>(capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity has to be a power of two");
+}
+
+size_t WorkStealingDeque::Buffer::capacity() const { return _capacity; }
+
+std::shared_ptr<AbstractTask>* WorkStealingDeque::Buffer::get(int64_t index) const {
+  return _slots[static_cast<size_t>(index) & (_capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(int64_t index, std::shared_ptr<AbstractTask>* task) {
+  _slots[static_cast<size_t>(index) & (_capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  const auto top = _top.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  for (auto index = top; index < bottom; ++index) {
+    delete buffer->get(index);
+  }
+}
+
+void WorkStealingDeque::push(std::shared_ptr<AbstractTask> task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity()) - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(std::move(task)));
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task = buffer->get(bottom);
+
+  if (top == bottom) {
+    // This is the last task, thieves might be trying to steal it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!task) return nullptr;
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  // The slot is only dereferenced once this thread won the race for it
+  const auto buffer = _buffer.load(std::memory_order_acquire);
+  auto* task = buffer->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+bool WorkStealingDeque::empty() const {
+  return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, int64_t top, int64_t bottom) {
+  _buffers.emplace_back(std::make_unique<Buffer>(buffer->capacity() * 2));
+  auto new_buffer = _buffers.back().get();
+
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+
+  _buffer.store(new_buffer, std::memory_order_release);
+  return new_buffer;
+}
+
+}  // namespace opossum
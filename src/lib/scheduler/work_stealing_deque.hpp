@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * A Chase-Lev work-stealing deque of tasks ("Dynamic Circular Work-Stealing Deque", Chase and Lev, SPAA 2005, with the
+ * memory orderings of "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al., PPoPP 2013).
+ *
+ * One thread, the owner, pushes and pops tasks at the bottom of the deque (LIFO), so that it continues with the tasks
+ * it spawned most recently while their data is still in its cache. Any other thread may steal the oldest task from
+ * the top of the deque (FIFO). Only steals that race for the same task use a compare-and-swap, pushes and pops are
+ * free of atomic read-modify-write operations otherwise.
+ *
+ * The owner of a ProcessingUnit's deques is whichever Worker holds the processing unit's active worker token.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 64);
+  ~WorkStealingDeque();
+
+  // Owner only
+  void push(std::shared_ptr<AbstractTask> task);
+
+  // Owner only. Returns the most recently pushed task or nullptr if the deque is empty.
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Any thread. Returns the least recently pushed task, or nullptr if the deque is empty or another thread took that
+   * task first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  // Might be outdated as soon as it returns
+  bool empty() const;
+
+ private:
+  /**
+   * A ring buffer of tasks. The slots hold owning pointers to shared_ptrs, so that they can be read and written
+   * atomically. Whoever removes a task from the deque takes ownership of its slot's pointer.
+   */
+  class Buffer {
+   public:
+    explicit Buffer(size_t capacity);
+
+    size_t capacity() const;
+    std::shared_ptr<AbstractTask>* get(int64_t index) const;
+    void put(int64_t index, std::shared_ptr<AbstractTask>* task);
+
+   private:
+    const size_t _capacity;
+    std::unique_ptr<std::atomic<std::shared_ptr<AbstractTask>*>[]> _slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  // _top is written by thieves, _bottom only by the owner. Keep them on different cache lines.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // All buffers ever used. Replaced buffers stay alive until the deque is destroyed, since thieves might still read
+  // from them.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -4,7 +4,7 @@
 #include <sched.h>
 #include <unistd.h>
 
-#include <chrono>
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <thread>
@@ -13,6 +13,8 @@
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "node_queue_scheduler.hpp"
+#include "query_context.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -22,6 +24,15 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
+
+/**
+ * Before an idle worker parks, it checks for tasks this many more times. New tasks often follow shortly, e.g., the
+ * next batch of jobs of an operator, and waking a parked worker takes a lot longer than a few rounds of checks.
+ */
+constexpr auto MAX_SPIN_ROUNDS = size_t{64};
+
+// The number of tasks that a worker executes nested in each other while waiting for tasks
+constexpr auto MAX_NESTED_WAITS = size_t{8};
 }  // namespace
 
 namespace opossum {
@@ -30,7 +41,7 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_
 
 Worker::Worker(std::weak_ptr<ProcessingUnit> processing_unit, std::shared_ptr<TaskQueue> queue, WorkerID id,
                CpuID cpu_id)
-    : _processing_unit(processing_unit), _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _processing_unit(processing_unit), _queue(queue), _id(id), _cpu_id(cpu_id), _random_engine(id + 1) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -55,6 +66,23 @@ void Worker::operator()() {
 
   DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
 
+  // Workers only run as part of a NodeQueueScheduler
+  auto& node_queue_scheduler = static_cast<NodeQueueScheduler&>(*scheduler);
+
+  for (const auto& other_processing_unit : node_queue_scheduler.processing_units()) {
+    if (other_processing_unit == processing_unit) continue;
+
+    if (other_processing_unit->node_id() == processing_unit->node_id()) {
+      _local_processing_units.emplace_back(other_processing_unit);
+    } else {
+      _remote_processing_units.emplace_back(other_processing_unit);
+    }
+  }
+
+  for (const auto& queue : node_queue_scheduler.queues()) {
+    if (queue != _queue) _remote_queues.emplace_back(queue);
+  }
+
   while (!processing_unit->shutdown_flag()) {
     // Hibernate if this is not the active worker.
     {
@@ -65,41 +93,143 @@ void Worker::operator()() {
       }
     }
 
-    auto task = _queue->pull();
+    auto task = _find_task(*processing_unit);
 
-    // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
-    // Figure out how we want to deal with that later.
-    if (!task) {
-      // Simple work stealing without explicitly transferring data between nodes.
-      auto work_stealing_successful = false;
-      for (auto& queue : scheduler->queues()) {
-        if (queue == _queue) {
-          continue;
-        }
-
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          work_stealing_successful = true;
-          break;
-        }
-      }
+    for (auto spin_round = size_t{0}; !task && spin_round < MAX_SPIN_ROUNDS; ++spin_round) {
+      std::this_thread::yield();
+      task = _find_task(*processing_unit);
+    }
 
-      // Sleep iff there is no ready task in our queue and work stealing was not successful.
-      if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        continue;
-      }
+    // Park iff there is no ready task in our queue and work stealing was not successful.
+    if (!task) {
+      task = _park(*processing_unit, node_queue_scheduler);
+      if (!task) continue;
     }
 
     task->execute();
 
+    // The slot was acquired when the task was pulled from a queue
+    const auto& query_context = task->query_context();
+    if (node_queue_scheduler._max_concurrent_tasks(query_context) > 0) query_context->_release_slot();
+
     // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
     // Scheduler to determine whether all tasks finished
     processing_unit->on_worker_finished_task();
   }
 
   processing_unit->yield_active_worker_token(_id);
+
+  // The other processing units must not be kept alive by their workers
+  _local_processing_units.clear();
+  _remote_processing_units.clear();
+  _remote_queues.clear();
+}
+
+void Worker::_schedule_task(std::shared_ptr<AbstractTask> task, SchedulePriority priority) {
+  auto& scheduler = static_cast<NodeQueueScheduler&>(*CurrentScheduler::get());
+
+  auto processing_unit = _processing_unit.lock();
+  if (processing_unit && processing_unit->is_active_worker(_id) &&
+      scheduler._max_concurrent_tasks(task->query_context()) == 0) {
+    processing_unit->push_task(std::move(task), priority);
+  } else {
+    _queue->push(std::move(task), static_cast<uint32_t>(priority));
+  }
+
+  scheduler._wake_parked_worker(_queue->node_id(), priority);
+}
+
+bool Worker::_try_execute_own_task(ProcessingUnit& processing_unit) {
+  if (_num_nested_waits == MAX_NESTED_WAITS || !processing_unit.is_active_worker(_id)) return false;
+
+  const auto task = processing_unit.pop_task();
+  if (!task) return false;
+
+  ++_num_nested_waits;
+  task->execute();
+  --_num_nested_waits;
+
+  processing_unit.on_worker_finished_task();
+  return true;
+}
+
+std::shared_ptr<AbstractTask> Worker::_find_task(ProcessingUnit& processing_unit) {
+  // Tasks of high priority, e.g., those of transactional queries, are not kept waiting by the jobs in the deques
+  auto task = std::shared_ptr<AbstractTask>{};
+  if (_queue->has_tasks(SchedulePriority::High)) task = _queue->pull();
+
+  // Prefer the most recently spawned task of this processing unit, as its data is most likely still cached
+  if (!task) task = processing_unit.pop_task();
+
+  // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
+  // Figure out how we want to deal with that later.
+  if (!task) task = _queue->pull();
+  if (!task) task = _steal_task();
+  return task;
+}
+
+std::shared_ptr<QueryContext> Worker::_release_query_slot_of_waiting_task() {
+  const auto& query_context = QueryContext::current();
+  auto& scheduler = static_cast<NodeQueueScheduler&>(*CurrentScheduler::get());
+  if (scheduler._max_concurrent_tasks(query_context) == 0) return nullptr;
+
+  query_context->_release_slot();
+
+  // Tasks of the query that were held back by the limit may be executed now
+  scheduler._wake_parked_worker(_queue->node_id(), SchedulePriority::Normal);
+  return query_context;
+}
+
+std::shared_ptr<AbstractTask> Worker::_park(ProcessingUnit& processing_unit, NodeQueueScheduler& scheduler) {
+  /**
+   * The worker announces that it parks before it checks for tasks a last time. A task that is scheduled concurrently
+   * is either found by this check, or the scheduler sees the announcement after pushing the task and wakes the worker
+   * (see NodeQueueScheduler::_wake_parked_worker()). The fences order the announcement and the push before the
+   * respective check.
+   */
+  ++scheduler._num_parked_workers;
+  processing_unit.announce_parking();
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto task = _find_task(processing_unit);
+  if (task) {
+    processing_unit.cancel_parking();
+  } else {
+    processing_unit.park_calling_worker();
+  }
+
+  --scheduler._num_parked_workers;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_task() {
+  // Within the node, even unstealable tasks may be taken, as they could have been pulled from the node's queue as well
+  if (!_local_processing_units.empty()) {
+    const auto offset = _random_engine() % _local_processing_units.size();
+    for (auto index = size_t{0}; index < _local_processing_units.size(); ++index) {
+      auto task = _local_processing_units[(offset + index) % _local_processing_units.size()]->steal_task(true);
+      if (task) return task;
+    }
+  }
+
+  // Simple work stealing across nodes without explicitly transferring data between them
+  auto task = std::shared_ptr<AbstractTask>{};
+  if (!_remote_queues.empty()) {
+    const auto offset = _random_engine() % _remote_queues.size();
+    for (auto index = size_t{0}; index < _remote_queues.size() && !task; ++index) {
+      task = _remote_queues[(offset + index) % _remote_queues.size()]->steal();
+    }
+  }
+
+  if (!task && !_remote_processing_units.empty()) {
+    const auto offset = _random_engine() % _remote_processing_units.size();
+    for (auto index = size_t{0}; index < _remote_processing_units.size() && !task; ++index) {
+      task = _remote_processing_units[(offset + index) % _remote_processing_units.size()]->steal_task(false);
+    }
+  }
+
+  if (task) task->set_node_id(_queue->node_id());
+  return task;
 }
 
 void Worker::_set_affinity() {
@@ -1,14 +1,18 @@
 #pragma once
 
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "processing_unit.hpp"
+#include "query_context.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class AbstractTask;
+class NodeQueueScheduler;
 class TaskQueue;
 
 /**
@@ -43,20 +47,74 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     /**
      * This method blocks the calling thread (worker) until all tasks have been completed.
-     * It hands off the active worker token so that another worker can execute tasks while the calling worker is blocked.
+     * The tasks were most likely pushed to the deques of the processing unit right before. As long as it is the active
+     * worker, the worker executes the tasks of the deques itself, as handing off the processing unit is expensive.
+     * Otherwise, it hands off the active worker token so that another worker can execute tasks while the calling
+     * worker is blocked.
      */
     auto processing_unit = _processing_unit.lock();
     DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
 
-    processing_unit->yield_active_worker_token(_id);
-    processing_unit->wake_or_create_worker();
+    const auto waiting_query_context = _release_query_slot_of_waiting_task();
 
-    for (auto& task : tasks) {
-      task->_join_without_replacement_worker();
+    auto num_done_tasks = size_t{0};
+    const auto all_tasks_done = [&]() {
+      while (num_done_tasks < tasks.size() && tasks[num_done_tasks]->is_done()) ++num_done_tasks;
+      return num_done_tasks == tasks.size();
+    };
+
+    while (!all_tasks_done()) {
+      if (!_try_execute_own_task(*processing_unit)) break;
+    }
+
+    if (!all_tasks_done()) {
+      processing_unit->yield_active_worker_token(_id);
+      processing_unit->wake_or_create_worker();
+
+      for (auto& task : tasks) {
+        task->_join_without_replacement_worker();
+      }
     }
+
+    if (waiting_query_context) waiting_query_context->_acquire_slot();
   }
 
  private:
+  /**
+   * Tasks scheduled by the active worker of a processing unit go to the processing unit's deques, all others to the
+   * queue of the node. So do the tasks of queries whose class has a concurrency limit.
+   */
+  void _schedule_task(std::shared_ptr<AbstractTask> task, SchedulePriority priority);
+
+  /**
+   * Executes the task that was pushed last to the deques of the processing unit, if this worker is the active worker.
+   * Returns false if no task was executed. Tasks executed this way can wait for tasks themselves, so the nesting is
+   * limited to keep the stack small.
+   */
+  bool _try_execute_own_task(ProcessingUnit& processing_unit);
+
+  // Returns a task from this worker's processing unit, its node's queue, or another processing unit or node
+  std::shared_ptr<AbstractTask> _find_task(ProcessingUnit& processing_unit);
+
+  /**
+   * If the task that waits for other tasks holds a slot of its query (see QueryContext), the slot is released, so that
+   * the tasks it waits for can be executed, and the QueryContext is returned. The slot is acquired again once the
+   * tasks are done, even if this exceeds the limit of the query for a short time.
+   */
+  std::shared_ptr<QueryContext> _release_query_slot_of_waiting_task();
+
+  /**
+   * Tries to steal a task, starting at a random victim: first from the other processing units of this node, then from
+   * the queues and processing units of the other nodes. Returns nullptr if no task was found.
+   */
+  std::shared_ptr<AbstractTask> _steal_task();
+
+  /**
+   * Blocks the idle worker until a task is scheduled or the scheduler shuts down. Returns a task if one was found
+   * while preparing to park, nullptr otherwise.
+   */
+  std::shared_ptr<AbstractTask> _park(ProcessingUnit& processing_unit, NodeQueueScheduler& scheduler);
+
   /**
    * Pin a worker to a particular core.
    * This does not work on non-NUMA systems, and might be addressed in the future.
@@ -67,6 +125,13 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
+  std::minstd_rand _random_engine;
+  size_t _num_nested_waits{0};
+
+  // The victims of work stealing, set up when the worker starts
+  std::vector<std::shared_ptr<ProcessingUnit>> _local_processing_units;
+  std::vector<std::shared_ptr<TaskQueue>> _remote_queues;
+  std::vector<std::shared_ptr<ProcessingUnit>> _remote_processing_units;
 };
 
 }  // namespace opossum
@@ -10,6 +10,7 @@
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_translator.hpp"
 #include "utils/assert.hpp"
 
@@ -111,14 +112,20 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
   const auto started = std::chrono::high_resolution_clock::now();
 
   try {
-    _query_plan->add_tree_by_root(LQPTranslator{}.translate_node(lqp));
+    // Chains of streaming operators and the probe sides of hash joins are executed morsel-wise (see Pipeline)
+    _query_plan->add_tree_by_root(LQPTranslator{true}.translate_node(lqp));
   } catch (const std::exception& exception) {
     throw std::runtime_error("Error while translating query plan:\n  " + std::string(exception.what()));
   }
 
   if (_use_mvcc) {
-    // If we need a transaction context but haven't passed one in, this is the latest point where we can create it
-    if (!_transaction_context) _transaction_context = TransactionManager::get().new_transaction_context();
+    // If we need a transaction context but haven't passed one in, this is the latest point where we can create it.
+    // Statements that do not modify any table get a read-only context, which is cheaper to create and commit.
+    if (!_transaction_context) {
+      auto& transaction_manager = TransactionManager::get();
+      _transaction_context = lqp->subtree_is_read_only() ? transaction_manager.new_read_only_transaction_context()
+                                                         : transaction_manager.new_transaction_context();
+    }
     _query_plan->set_transaction_context(_transaction_context);
   }
 
@@ -144,6 +151,13 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
     throw std::runtime_error("Error while creating tasks:\n  " + std::string(exception.what()));
   }
 
+  // The tasks of a statement share a QueryContext, so that the scheduler interleaves them fairly with the tasks of
+  // concurrent statements. Statements that modify tables are treated as short transactions and preferred.
+  const auto query_class =
+      get_optimized_logical_plan()->subtree_is_read_only() ? QueryClass::Default : QueryClass::Transactional;
+  const auto query_context = std::make_shared<QueryContext>(query_class);
+  for (const auto& task : _tasks) task->set_query_context(query_context);
+
   return _tasks;
 }
 
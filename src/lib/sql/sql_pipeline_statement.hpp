@@ -48,14 +48,15 @@ class SQLPipelineStatement : public Noncopyable {
   // For now, this always uses the optimized LQP.
   const std::shared_ptr<SQLQueryPlan>& get_query_plan();
 
-  // Returns all task sets that need to be executed for this query.
+  // Returns all task sets that need to be executed for this query. They share a QueryContext.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
-  // This can be a nullptr if no transaction management is wanted.
+  // This can be a nullptr if no transaction management is wanted. Created contexts are read-only if the statement does
+  // not contain an Insert, Update, or Delete.
   const std::shared_ptr<TransactionContext>& transaction_context() const;
 
   std::chrono::microseconds compile_time_microseconds() const;
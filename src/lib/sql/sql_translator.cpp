@@ -312,57 +312,76 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_join(const hsql::Join
   auto left_node = _translate_table_ref(*join.left);
   auto right_node = _translate_table_ref(*join.right);
 
-  const hsql::Expr& condition = *join.condition;
-
-  Assert(condition.type == hsql::kExprOperator, "Join condition must be operator.");
-  // The Join operators only support simple comparisons for now.
-  switch (condition.opType) {
-    case hsql::kOpEquals:
-    case hsql::kOpNotEquals:
-    case hsql::kOpLess:
-    case hsql::kOpLessEq:
-    case hsql::kOpGreater:
-    case hsql::kOpGreaterEq:
-      break;
-    default:
-      Fail("Join condition must be a simple comparison operator.");
-  }
-  Assert(condition.expr && condition.expr->type == hsql::kExprColumnRef,
-         "Left arg of join condition must be column ref");
-  Assert(condition.expr2 && condition.expr2->type == hsql::kExprColumnRef,
-         "Right arg of join condition must be column ref");
-
-  const auto left_qualified_column_name = HSQLExprTranslator::to_qualified_column_name(*condition.expr);
-  const auto right_qualified_column_name = HSQLExprTranslator::to_qualified_column_name(*condition.expr2);
+  // The join condition is a conjunction of one or more simple comparisons
+  std::vector<const hsql::Expr*> conditions;
+  const auto collect_conditions = [&](const hsql::Expr& expr, const auto& recurse) -> void {
+    if (expr.type == hsql::kExprOperator && expr.opType == hsql::kOpAnd) {
+      recurse(*expr.expr, recurse);
+      recurse(*expr.expr2, recurse);
+    } else {
+      conditions.emplace_back(&expr);
+    }
+  };
+  collect_conditions(*join.condition, collect_conditions);
+
+  const auto translate_condition = [&](const hsql::Expr& condition) {
+    Assert(condition.type == hsql::kExprOperator, "Join condition must be operator.");
+    // The Join operators only support simple comparisons for now.
+    switch (condition.opType) {
+      case hsql::kOpEquals:
+      case hsql::kOpNotEquals:
+      case hsql::kOpLess:
+      case hsql::kOpLessEq:
+      case hsql::kOpGreater:
+      case hsql::kOpGreaterEq:
+        break;
+      default:
+        Fail("Join condition must be a simple comparison operator.");
+    }
+    Assert(condition.expr && condition.expr->type == hsql::kExprColumnRef,
+           "Left arg of join condition must be column ref");
+    Assert(condition.expr2 && condition.expr2->type == hsql::kExprColumnRef,
+           "Right arg of join condition must be column ref");
 
-  /**
-   * `x_in_y_node` indicates whether the column identifier on the `x` side in the join expression is in the input node
-   * on
-   * the `y` side of the join. So in the query
-   * `SELECT * FROM T1 JOIN T2 on person_id == customer_id`
-   * We have to check whether `person_id` belongs to T1 (left_in_left_node == true) or to T2
-   * (left_in_right_node == true). Later we make sure that one and only one of them is true, otherwise we either have
-   * ambiguity or the column is simply not existing.
-   */
-  const auto left_in_left_node = left_node->find_column(left_qualified_column_name);
-  const auto left_in_right_node = right_node->find_column(left_qualified_column_name);
-  const auto right_in_left_node = left_node->find_column(right_qualified_column_name);
-  const auto right_in_right_node = right_node->find_column(right_qualified_column_name);
+    const auto left_qualified_column_name = HSQLExprTranslator::to_qualified_column_name(*condition.expr);
+    const auto right_qualified_column_name = HSQLExprTranslator::to_qualified_column_name(*condition.expr2);
 
-  Assert(static_cast<bool>(left_in_left_node) ^ static_cast<bool>(left_in_right_node),
-         std::string("Left operand ") + left_qualified_column_name.as_string() +
-             " must be in exactly one of the input nodes");
-  Assert(static_cast<bool>(right_in_left_node) ^ static_cast<bool>(right_in_right_node),
-         std::string("Right operand ") + right_qualified_column_name.as_string() +
-             " must be in exactly one of the input nodes");
+    /**
+     * `x_in_y_node` indicates whether the column identifier on the `x` side in the join expression is in the input
+     * node on the `y` side of the join. So in the query
+     * `SELECT * FROM T1 JOIN T2 on person_id == customer_id`
+     * We have to check whether `person_id` belongs to T1 (left_in_left_node == true) or to T2
+     * (left_in_right_node == true). Later we make sure that one and only one of them is true, otherwise we either have
+     * ambiguity or the column is simply not existing.
+     */
+    const auto left_in_left_node = left_node->find_column(left_qualified_column_name);
+    const auto left_in_right_node = right_node->find_column(left_qualified_column_name);
+    const auto right_in_left_node = left_node->find_column(right_qualified_column_name);
+    const auto right_in_right_node = right_node->find_column(right_qualified_column_name);
+
+    Assert(static_cast<bool>(left_in_left_node) ^ static_cast<bool>(left_in_right_node),
+           std::string("Left operand ") + left_qualified_column_name.as_string() +
+               " must be in exactly one of the input nodes");
+    Assert(static_cast<bool>(right_in_left_node) ^ static_cast<bool>(right_in_right_node),
+           std::string("Right operand ") + right_qualified_column_name.as_string() +
+               " must be in exactly one of the input nodes");
+
+    return left_in_left_node ? std::make_pair(*left_in_left_node, *right_in_right_node)
+                             : std::make_pair(*left_in_right_node, *right_in_left_node);
+  };
 
-  const auto column_references = left_in_left_node ? std::make_pair(*left_in_left_node, *right_in_right_node)
-                                                   : std::make_pair(*left_in_right_node, *right_in_left_node);
+  const auto column_references = translate_condition(*conditions.front());
+  auto scan_type = translate_operator_type_to_scan_type(conditions.front()->opType);
 
-  // Joins currently only support one simple condition (i.e., not multiple conditions).
-  auto scan_type = translate_operator_type_to_scan_type(condition.opType);
+  // Further conditions become additional predicates of an equi-join (e.g., for composite keys)
+  std::vector<LQPColumnReferencePair> additional_column_references;
+  for (auto condition_idx = size_t{1}; condition_idx < conditions.size(); ++condition_idx) {
+    Assert(scan_type == ScanType::Equals && conditions[condition_idx]->opType == hsql::kOpEquals,
+           "Joins with multiple conditions only support equality comparisons.");
+    additional_column_references.emplace_back(translate_condition(*conditions[condition_idx]));
+  }
 
-  auto join_node = std::make_shared<JoinNode>(join_mode, column_references, scan_type);
+  auto join_node = std::make_shared<JoinNode>(join_mode, column_references, scan_type, additional_column_references);
   join_node->set_left_child(left_node);
   join_node->set_right_child(right_node);
 
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * AppendOnlyVector is the storage of ValueColumns. Unlike tbb::concurrent_vector, it keeps all elements in one
+ * contiguous buffer, so that scans can iterate it using plain pointers.
+ *
+ * Concurrent appends (as done by the Insert operator) are supported as long as they fit into the capacity reserved
+ * beforehand: resize() constructs the new elements first and only then publishes the new size, so readers that call
+ * size() never see unconstructed elements. Growing beyond the capacity reallocates the buffer and thus must not
+ * happen while other threads access the vector. Vectors that are shared, such as the value columns of a table's
+ * mutable chunks, therefore have a fixed capacity (see fix_capacity()). Reallocating them fails, and tables grow
+ * them by replacing them with larger copies instead (see Table::reserve_chunk_capacity()).
+ *
+ * Writers of new elements must be synchronized externally (e.g., by the table's append mutex).
+ */
+template <typename T>
+class AppendOnlyVector {
+ public:
+  using value_type = T;
+  using allocator_type = PolymorphicAllocator<T>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  explicit AppendOnlyVector(const allocator_type& alloc = {}) : _alloc(alloc) {}
+
+  explicit AppendOnlyVector(const size_t size, const allocator_type& alloc = {}) : AppendOnlyVector(size, T{}, alloc) {}
+
+  AppendOnlyVector(const size_t size, const T& value, const allocator_type& alloc = {}) : _alloc(alloc) {
+    resize(size, value);
+  }
+
+  template <typename Iterator, typename = typename std::iterator_traits<Iterator>::iterator_category>
+  AppendOnlyVector(Iterator first, Iterator last, const allocator_type& alloc = {}) : _alloc(alloc) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<Iterator>::iterator_category>) {
+      reserve(static_cast<size_t>(std::distance(first, last)));
+    }
+
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  AppendOnlyVector(std::initializer_list<T> values, const allocator_type& alloc = {})
+      : AppendOnlyVector(values.begin(), values.end(), alloc) {}
+
+  AppendOnlyVector(const AppendOnlyVector& other, const allocator_type& alloc)
+      : AppendOnlyVector(other.cbegin(), other.cend(), alloc) {}
+
+  AppendOnlyVector(const AppendOnlyVector& other) : AppendOnlyVector(other, other.get_allocator()) {}
+
+  AppendOnlyVector(AppendOnlyVector&& other) noexcept
+      : _alloc(other._alloc),
+        _data(other._data),
+        _capacity(other._capacity),
+        _has_fixed_capacity(other._has_fixed_capacity),
+        _size(other.size()) {
+    other._data = nullptr;
+    other._capacity = 0u;
+    other._has_fixed_capacity = false;
+    other._size.store(0u, std::memory_order_release);
+  }
+
+  AppendOnlyVector& operator=(AppendOnlyVector other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~AppendOnlyVector() { _release(); }
+
+  void swap(AppendOnlyVector& other) noexcept {
+    std::swap(_alloc, other._alloc);
+    std::swap(_data, other._data);
+    std::swap(_capacity, other._capacity);
+    std::swap(_has_fixed_capacity, other._has_fixed_capacity);
+
+    const auto size = _size.load(std::memory_order_acquire);
+    _size.store(other._size.load(std::memory_order_acquire), std::memory_order_release);
+    other._size.store(size, std::memory_order_release);
+  }
+
+  size_t size() const { return _size.load(std::memory_order_acquire); }
+  bool empty() const { return size() == 0u; }
+  size_t capacity() const { return _capacity; }
+
+  T* data() { return _data; }
+  const T* data() const { return _data; }
+
+  iterator begin() { return _data; }
+  iterator end() { return _data + size(); }
+  const_iterator begin() const { return _data; }
+  const_iterator end() const { return _data + size(); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+  reverse_iterator rbegin() { return reverse_iterator{end()}; }
+  reverse_iterator rend() { return reverse_iterator{begin()}; }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+  const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+  const_reverse_iterator crbegin() const { return rbegin(); }
+  const_reverse_iterator crend() const { return rend(); }
+
+  T& operator[](const size_t index) {
+    DebugAssert(index < size(), "Index out of range.");
+    return _data[index];
+  }
+
+  const T& operator[](const size_t index) const {
+    DebugAssert(index < size(), "Index out of range.");
+    return _data[index];
+  }
+
+  T& at(const size_t index) {
+    Assert(index < size(), "Index " + std::to_string(index) + " out of range.");
+    return _data[index];
+  }
+
+  const T& at(const size_t index) const {
+    Assert(index < size(), "Index " + std::to_string(index) + " out of range.");
+    return _data[index];
+  }
+
+  T& front() { return (*this)[0u]; }
+  const T& front() const { return (*this)[0u]; }
+  T& back() { return (*this)[size() - 1u]; }
+  const T& back() const { return (*this)[size() - 1u]; }
+
+  const allocator_type& get_allocator() const { return _alloc; }
+
+  // Makes sure that at least `capacity` elements fit into the vector without reallocation. Not thread-safe.
+  void reserve(const size_t capacity) {
+    if (capacity <= _capacity) return;
+
+    Assert(!_has_fixed_capacity, "Cannot grow a vector with fixed capacity beyond " + std::to_string(_capacity) + ".");
+
+    const auto size = this->size();
+    auto new_data = std::allocator_traits<allocator_type>::allocate(_alloc, capacity);
+
+    for (auto index = size_t{0u}; index < size; ++index) {
+      std::allocator_traits<allocator_type>::construct(_alloc, new_data + index, std::move_if_noexcept(_data[index]));
+    }
+
+    _release();
+    _data = new_data;
+    _capacity = capacity;
+    _size.store(size, std::memory_order_release);
+  }
+
+  // Reserves `capacity` elements and forbids any further reallocation, so that the vector can be shared with
+  // concurrent readers and writers. All growth beyond the capacity, including push_back(), fails afterwards.
+  void fix_capacity(const size_t capacity) {
+    reserve(capacity);
+    _has_fixed_capacity = true;
+  }
+
+  bool has_fixed_capacity() const { return _has_fixed_capacity; }
+
+  // Grows or shrinks the vector. New elements are constructed before the new size becomes visible to readers.
+  void resize(const size_t new_size) { resize(new_size, T{}); }
+
+  void resize(const size_t new_size, const T& value) {
+    const auto size = this->size();
+
+    if (new_size < size) {
+      _size.store(new_size, std::memory_order_release);
+      _destroy(new_size, size);
+      return;
+    }
+
+    if (new_size > _capacity) reserve(std::max(new_size, 2u * _capacity));
+
+    for (auto index = size; index < new_size; ++index) {
+      std::allocator_traits<allocator_type>::construct(_alloc, _data + index, value);
+    }
+
+    _size.store(new_size, std::memory_order_release);
+  }
+
+  void clear() { resize(0u); }
+
+  void push_back(const T& value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    const auto size = this->size();
+    if (size == _capacity) reserve(std::max(size_t{1u}, 2u * _capacity));
+
+    std::allocator_traits<allocator_type>::construct(_alloc, _data + size, std::forward<Args>(args)...);
+    _size.store(size + 1u, std::memory_order_release);
+
+    return _data[size];
+  }
+
+ protected:
+  void _destroy(const size_t begin, const size_t end) {
+    for (auto index = begin; index < end; ++index) {
+      std::allocator_traits<allocator_type>::destroy(_alloc, _data + index);
+    }
+  }
+
+  void _release() {
+    if (!_data) return;
+
+    _destroy(0u, size());
+    std::allocator_traits<allocator_type>::deallocate(_alloc, _data, _capacity);
+    _data = nullptr;
+    _capacity = 0u;
+    _size.store(0u, std::memory_order_release);
+  }
+
+  allocator_type _alloc;
+  T* _data = nullptr;
+  size_t _capacity = 0u;
+  bool _has_fixed_capacity = false;
+  std::atomic<size_t> _size{0u};
+};
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "base_column.hpp"
+#include "encoding_type.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Super class of all encoded columns apart from dictionary columns
+ *
+ * Encoded columns are immutable. Operators that need typed access should resolve
+ * the column using resolve_encoded_column_type (see resolve_encoded_column_type.hpp).
+ */
+class BaseEncodedColumn : public BaseColumn {
+ public:
+  // returns the encoding that was used to create this column
+  virtual EncodingType encoding_type() const = 0;
+
+  // encoded columns are immutable
+  void append(const AllTypeVariant&) final;
+
+  // visitor pattern, see base_column.hpp
+  void visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVisitableContext> context = nullptr) const final;
+};
+
+}  // namespace opossum
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+
+#include "append_only_vector.hpp"
 #include "base_column.hpp"
 
 namespace opossum {
@@ -19,7 +22,21 @@ class BaseValueColumn : public BaseColumn {
    *
    * Throws exception if is_nullable() returns false
    */
-  virtual const pmr_concurrent_vector<bool>& null_values() const = 0;
-  virtual pmr_concurrent_vector<bool>& null_values() = 0;
+  virtual const AppendOnlyVector<bool>& null_values() const = 0;
+  virtual AppendOnlyVector<bool>& null_values() = 0;
+
+  /**
+   * @brief Returns the number of values that fit into the column without reallocation
+   *
+   * Concurrent inserts must not grow a column beyond this (see AppendOnlyVector).
+   */
+  virtual size_t capacity() const = 0;
+
+  /**
+   * @brief Copies the column into one that can hold `capacity` values and never reallocates
+   *
+   * Used to grow the columns of mutable chunks (see Table::reserve_chunk_capacity()).
+   */
+  virtual std::shared_ptr<BaseValueColumn> copy_with_capacity(const size_t capacity) const = 0;
 };
 }  // namespace opossum
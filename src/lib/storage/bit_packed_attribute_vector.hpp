@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * BitPackedAttributeVector is an attribute vector that stores each ValueID with the minimal number of bits
+ * necessary for the dictionary it belongs to (1 to 32 bits). In contrast to the FittedAttributeVector, a
+ * dictionary with 300 entries only costs 9 instead of 16 bits per row.
+ *
+ * The layout follows SIMD-BP128: The values are grouped into blocks of 128 ValueIDs. Each block is split
+ * into four 32-bit lanes, where the value at position i within the block belongs to lane i % 4. Within a lane,
+ * the values are packed back to back, so that a block occupies exactly 4 * bit_width 32-bit words and the words
+ * of the four lanes are interleaved. Decoding a block therefore applies the same shifts and masks to four adjacent
+ * words at a time, which compilers turn into 128-bit SIMD instructions (see decode_block()).
+ *
+ * The last block is padded with zeros, i.e., the vector always allocates full blocks.
+ *
+ * Note: Like in the FittedAttributeVector, NULL_VALUE_ID cannot be stored using bit_width bits.
+ *       It is represented by the largest value that fits into bit_width bits.
+ */
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{128u};
+  static constexpr auto LANE_COUNT = size_t{4u};
+  static constexpr auto WORD_BITS = size_t{32u};
+
+  using DecodedBlock = std::array<ValueID::base_type, BLOCK_SIZE>;
+
+ public:
+  explicit BitPackedAttributeVector(size_t size, uint8_t bit_width, const PolymorphicAllocator<uint32_t>& alloc = {})
+      : _size{size}, _bit_width{bit_width}, _words(_block_count(size) * LANE_COUNT * bit_width, 0u, alloc) {
+    DebugAssert(bit_width > 0u && bit_width <= WORD_BITS, "Bit width needs to be between 1 and 32.");
+  }
+
+  // Creates a BitPackedAttributeVector from already packed words
+  explicit BitPackedAttributeVector(size_t size, uint8_t bit_width, pmr_vector<uint32_t>&& words)
+      : _size{size}, _bit_width{bit_width}, _words(std::move(words)) {
+    DebugAssert(_words.size() == _block_count(size) * LANE_COUNT * bit_width, "Number of packed words is invalid.");
+  }
+
+  /**
+   * Returns the minimal number of bits needed to store unique_values_count different ValueIDs,
+   * of which one is NULL_VALUE_ID
+   */
+  static uint8_t bit_width_for(size_t unique_values_count) {
+    auto bit_width = uint8_t{1u};
+    while (bit_width < WORD_BITS && (uint64_t{1u} << bit_width) < unique_values_count) ++bit_width;
+    return bit_width;
+  }
+
+  /**
+   * Returns the ValueID for a given record
+   * Note: The clamped null value is converted to NULL_VALUE_ID
+   */
+  ValueID get(const ChunkOffset chunk_offset) const final {
+    const auto value = _unpack(chunk_offset);
+    return (value == _clamped_null_value_id()) ? NULL_VALUE_ID : ValueID{value};
+  }
+
+  /**
+   * Sets the value_id at a given position
+   * Note: NULL_VALUE_ID is converted to the clamped null value
+   */
+  void set(const ChunkOffset chunk_offset, const ValueID value_id) final {
+    DebugAssert(value_id < _clamped_null_value_id() || value_id == NULL_VALUE_ID,
+                "value_id to large to fit into bit_width bits");
+    const auto value = (value_id == NULL_VALUE_ID) ? _clamped_null_value_id() : static_cast<uint32_t>(value_id);
+
+    const auto position = _position(chunk_offset);
+    const auto mask = _mask();
+
+    auto combined = _combined_words(position);
+    combined &= ~(mask << position.shift);
+    combined |= (uint64_t{value} << position.shift);
+
+    _words[position.word_index] = static_cast<uint32_t>(combined);
+    if (position.spans_two_words) _words[position.word_index + LANE_COUNT] = static_cast<uint32_t>(combined >> 32u);
+  }
+
+  /**
+   * Decodes all 128 values of the block with the given index into out. Null values are returned
+   * as NULL_VALUE_ID. Positions behind the end of the vector are filled with ValueID{0}.
+   *
+   * The inner loop over the four lanes has no dependencies between its iterations and uses the
+   * same shift for all lanes, so that it can be auto-vectorized.
+   */
+  void decode_block(size_t block_index, DecodedBlock& out) const {
+    const auto* block_words = _words.data() + block_index * LANE_COUNT * _bit_width;
+    const auto mask = static_cast<uint32_t>(_mask());
+    const auto clamped_null_value_id = _clamped_null_value_id();
+    const auto null_value_id = static_cast<ValueID::base_type>(NULL_VALUE_ID);
+
+    auto bit_offset = size_t{0u};
+    for (auto row = size_t{0u}; row < BLOCK_SIZE / LANE_COUNT; ++row, bit_offset += _bit_width) {
+      const auto* words = block_words + (bit_offset / WORD_BITS) * LANE_COUNT;
+      const auto shift = bit_offset % WORD_BITS;
+      const auto spans_two_words = shift + _bit_width > WORD_BITS;
+
+      auto* values = out.data() + row * LANE_COUNT;
+
+      for (auto lane = size_t{0u}; lane < LANE_COUNT; ++lane) {
+        values[lane] = words[lane] >> shift;
+      }
+
+      if (spans_two_words) {
+        for (auto lane = size_t{0u}; lane < LANE_COUNT; ++lane) {
+          values[lane] |= words[LANE_COUNT + lane] << (WORD_BITS - shift);
+        }
+      }
+
+      for (auto lane = size_t{0u}; lane < LANE_COUNT; ++lane) {
+        values[lane] &= mask;
+        values[lane] = (values[lane] == clamped_null_value_id) ? null_value_id : values[lane];
+      }
+    }
+  }
+
+  // returns all packed words
+  const pmr_vector<uint32_t>& words() const { return _words; }
+
+  // returns the number of values
+  size_t size() const final { return _size; }
+
+  // returns the number of blocks, including the last, possibly incomplete one
+  size_t block_count() const { return _block_count(_size); }
+
+  // returns the number of bits used per value
+  uint8_t bit_width() const { return _bit_width; }
+
+  // returns the width of the values in bytes, rounded up
+  AttributeVectorWidth width() const final { return static_cast<AttributeVectorWidth>((_bit_width + 7u) / 8u); }
+
+  std::shared_ptr<BaseAttributeVector> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final {
+    pmr_vector<uint32_t> new_words(_words, alloc);
+    return std::allocate_shared<BitPackedAttributeVector>(alloc, _size, _bit_width, std::move(new_words));
+  }
+
+ private:
+  struct Position {
+    size_t word_index;
+    size_t shift;
+    bool spans_two_words;
+  };
+
+  static size_t _block_count(size_t size) { return (size + BLOCK_SIZE - 1u) / BLOCK_SIZE; }
+
+  uint64_t _mask() const { return (uint64_t{1u} << _bit_width) - 1u; }
+
+  uint32_t _clamped_null_value_id() const { return static_cast<uint32_t>(_mask()); }
+
+  Position _position(const ChunkOffset chunk_offset) const {
+    const auto block_index = chunk_offset / BLOCK_SIZE;
+    const auto offset_in_block = chunk_offset % BLOCK_SIZE;
+    const auto lane = offset_in_block % LANE_COUNT;
+    const auto bit_offset = (offset_in_block / LANE_COUNT) * _bit_width;
+    const auto shift = bit_offset % WORD_BITS;
+
+    const auto word_index = block_index * LANE_COUNT * _bit_width + (bit_offset / WORD_BITS) * LANE_COUNT + lane;
+    return {word_index, shift, shift + _bit_width > WORD_BITS};
+  }
+
+  uint64_t _combined_words(const Position& position) const {
+    auto combined = uint64_t{_words[position.word_index]};
+    if (position.spans_two_words) combined |= uint64_t{_words[position.word_index + LANE_COUNT]} << 32u;
+    return combined;
+  }
+
+  uint32_t _unpack(const ChunkOffset chunk_offset) const {
+    const auto position = _position(chunk_offset);
+    return static_cast<uint32_t>((_combined_words(position) >> position.shift) & _mask());
+  }
+
+ private:
+  size_t _size;
+  uint8_t _bit_width;
+  pmr_vector<uint32_t> _words;
+};
+}  // namespace opossum
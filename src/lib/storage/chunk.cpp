@@ -9,6 +9,7 @@
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "chunk_statistics.hpp"
 #include "index/base_index.hpp"
 #include "reference_column.hpp"
 #include "utils/assert.hpp"
@@ -87,6 +88,30 @@ void Chunk::grow_mvcc_column_size_by(size_t delta, CommitID begin_cid) {
   mvcc_columns->end_cids.grow_to_at_least(size() + delta, MAX_COMMIT_ID);
 }
 
+CommitID Chunk::MvccColumns::max_begin_cid(const ChunkOffset row_count) const {
+  const auto summary = _max_begin_cid_summary.load();
+  const auto summary_row_count = static_cast<ChunkOffset>(summary >> 32u);
+  if (summary_row_count != 0u && summary_row_count >= row_count) return static_cast<CommitID>(summary);
+
+  auto max_begin_cid = CommitID{0u};
+  auto begin_cid_iter = begin_cids.cbegin();
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < row_count; ++chunk_offset, ++begin_cid_iter) {
+    max_begin_cid = std::max(max_begin_cid, *begin_cid_iter);
+  }
+
+  // Uncommitted rows might still be rolled back and thus change their begin cid, so the result is not cached
+  if (max_begin_cid == MAX_COMMIT_ID) return MAX_COMMIT_ID;
+
+  if (row_count > summary_row_count) _max_begin_cid_summary = (static_cast<uint64_t>(row_count) << 32u) | max_begin_cid;
+  return max_begin_cid;
+}
+
+std::shared_ptr<const ChunkStatistics> Chunk::statistics() const { return std::atomic_load(&_statistics); }
+
+void Chunk::set_statistics(const std::shared_ptr<const ChunkStatistics>& statistics) {
+  std::atomic_store(&_statistics, statistics);
+}
+
 bool Chunk::has_mvcc_columns() const { return _mvcc_columns != nullptr; }
 bool Chunk::has_access_counter() const { return _access_counter != nullptr; }
 
@@ -176,6 +201,19 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
+std::optional<CommitID> Chunk::get_cleanup_commit_id() const {
+  const auto cleanup_commit_id = _cleanup_commit_id.load();
+  if (cleanup_commit_id == MAX_COMMIT_ID) return std::nullopt;
+  return cleanup_commit_id;
+}
+
+void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
+  DebugAssert(cleanup_commit_id != MAX_COMMIT_ID, "Cleanup commit id must not be MAX_COMMIT_ID.");
+  auto expected = MAX_COMMIT_ID;
+  Assert(_cleanup_commit_id.compare_exchange_strong(expected, cleanup_commit_id),
+         "Cleanup commit id can only be set once.");
+}
+
 uint64_t Chunk::AccessCounter::history_sample(size_t lookback) const {
   if (_history.size() < 2 || lookback == 0) return 0;
   const auto last = _history.back();
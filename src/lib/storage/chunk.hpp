@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+class ChunkStatistics;
 
 enum class ChunkUseMvcc { Yes, No };
 enum class ChunkUseAccessCounter { Yes, No };
@@ -51,7 +53,24 @@ class Chunk : private Noncopyable {
     pmr_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
     pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
 
+    /**
+     * Set once a row has been locked for deletion or an Insert into the chunk has been rolled back, never reset.
+     * Until then, the rows of the chunk only differ in when they have been committed, so Validate can check whether a
+     * snapshot sees all of them using max_begin_cid() instead of checking each row. Must be set before the MVCC
+     * columns of the affected rows are changed.
+     */
+    std::atomic_bool any_row_invalidated{false};
+
+    /**
+     * Returns the highest begin cid of the first `row_count` rows, or MAX_COMMIT_ID if one of them has not been
+     * committed yet. Begin cids of committed rows do not change anymore, so the result is cached.
+     */
+    CommitID max_begin_cid(const ChunkOffset row_count) const;
+
    private:
+    // The number of rows covered by the cached max_begin_cid() in the upper and the cid in the lower 32 bits
+    mutable std::atomic<uint64_t> _max_begin_cid_summary{0u};
+
     /**
      * @brief Mutex used to manage access to MVCC columns
      *
@@ -204,8 +223,23 @@ class Chunk : private Noncopyable {
 
   bool references_exactly_one_table() const;
 
+  /**
+   * Zone maps (min, max, and null count) of the chunk's columns, used to prune chunks that cannot contain matches.
+   * They are set by DictionaryCompression::compress_chunk. Returns nullptr for mutable chunks.
+   */
+  std::shared_ptr<const ChunkStatistics> statistics() const;
+  void set_statistics(const std::shared_ptr<const ChunkStatistics>& statistics);
+
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
+  /**
+   * Set by the ChunkCompactionTask once all visible rows of the chunk have been moved to the end of the table. From
+   * this commit id on, the chunk contains no rows that are visible to anyone. It can be removed physically once no
+   * active transaction has an older snapshot (see Table::remove_chunk()).
+   */
+  std::optional<CommitID> get_cleanup_commit_id() const;
+  void set_cleanup_commit_id(const CommitID cleanup_commit_id);
+
  private:
   std::vector<std::shared_ptr<const BaseColumn>> get_columns_for_ids(const std::vector<ColumnID>& column_ids) const;
 
@@ -215,6 +249,10 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccColumns> _mvcc_columns;
   std::shared_ptr<AccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  std::shared_ptr<const ChunkStatistics> _statistics;
+  // MAX_COMMIT_ID as long as the chunk has not been compacted. Atomic, because the MvccGarbageCollector sets it while
+  // other threads check it.
+  std::atomic<CommitID> _cleanup_commit_id{MAX_COMMIT_ID};
 };
 
 }  // namespace opossum
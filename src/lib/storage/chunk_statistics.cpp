@@ -0,0 +1,136 @@
+#include "chunk_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "chunk.hpp"
+#include "reference_column.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseChunkColumnStatistics::BaseChunkColumnStatistics(const size_t null_count) : _null_count{null_count} {}
+
+size_t BaseChunkColumnStatistics::null_count() const { return _null_count; }
+
+template <typename T>
+ChunkColumnStatistics<T>::ChunkColumnStatistics(const std::optional<T>& min, const std::optional<T>& max,
+                                                const size_t null_count,
+                                                std::shared_ptr<const BloomFilter<T>> filter)
+    : BaseChunkColumnStatistics{null_count}, _min{min}, _max{max}, _filter{std::move(filter)} {
+  DebugAssert(static_cast<bool>(_min) == static_cast<bool>(_max), "Either both or none of min and max must be set.");
+}
+
+template <typename T>
+const std::optional<T>& ChunkColumnStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const std::optional<T>& ChunkColumnStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+const std::shared_ptr<const BloomFilter<T>>& ChunkColumnStatistics<T>::filter() const {
+  return _filter;
+}
+
+template <typename T>
+bool ChunkColumnStatistics<T>::can_prune(const ScanType scan_type, const AllTypeVariant& value,
+                                         const std::optional<AllTypeVariant>& value2) const {
+  if (scan_type == ScanType::IsNull) return _null_count == 0u;
+  if (scan_type == ScanType::IsNotNull) return !_min;
+
+  // Comparisons with NULL never match, but that is up to the scan
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return false;
+
+  // The column contains only NULLs, which do not match any comparison
+  if (!_min) return true;
+
+  // Strings and numbers are not compared with each other
+  const auto is_comparable = [](const AllTypeVariant& variant) {
+    return (variant.type() == typeid(std::string)) == std::is_same<T, std::string>::value;
+  };
+  if (!is_comparable(value) || (value2 && !is_comparable(*value2))) return false;
+
+  // The value is cast in the same way as by the TableScan
+  const auto typed_value = type_cast<T>(value);
+
+  switch (scan_type) {
+    case ScanType::Equals:
+      if (typed_value < *_min || typed_value > *_max) return true;
+      return _filter && !_filter->may_contain(typed_value);
+    case ScanType::NotEquals:
+      return typed_value == *_min && typed_value == *_max;
+    case ScanType::LessThan:
+      return *_min >= typed_value;
+    case ScanType::LessThanEquals:
+      return *_min > typed_value;
+    case ScanType::GreaterThan:
+      return *_max <= typed_value;
+    case ScanType::GreaterThanEquals:
+      return *_max < typed_value;
+    case ScanType::Between:
+      DebugAssert(static_cast<bool>(value2), "Scan type BETWEEN requires a second value");
+      return typed_value > *_max || type_cast<T>(*value2) < *_min;
+    default:
+      // LIKE and NOT LIKE are not pruned
+      return false;
+  }
+}
+
+ChunkStatistics::ChunkStatistics(std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> column_statistics)
+    : _column_statistics{std::move(column_statistics)} {}
+
+const std::vector<std::shared_ptr<const BaseChunkColumnStatistics>>& ChunkStatistics::column_statistics() const {
+  return _column_statistics;
+}
+
+bool ChunkStatistics::can_prune(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value,
+                                const std::optional<AllTypeVariant>& value2) const {
+  DebugAssert(column_id < _column_statistics.size(), "Column does not exist.");
+  return _column_statistics[column_id]->can_prune(scan_type, value, value2);
+}
+
+std::shared_ptr<const BaseChunkColumnStatistics> origin_column_statistics(const Chunk& chunk,
+                                                                          const ColumnID column_id) {
+  const auto column = chunk.get_column(column_id);
+  const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+
+  if (!reference_column) {
+    const auto statistics = chunk.statistics();
+    if (!statistics) return nullptr;
+    return statistics->column_statistics()[column_id];
+  }
+
+  const auto& pos_list = *reference_column->pos_list();
+  if (pos_list.empty()) return nullptr;
+
+  const auto referenced_chunk_id = pos_list.front().chunk_id;
+  const auto referenced_table = reference_column->referenced_table();
+  if (referenced_chunk_id >= referenced_table->chunk_count()) return nullptr;
+
+  const auto statistics = referenced_table->get_chunk(referenced_chunk_id)->statistics();
+  if (!statistics) return nullptr;
+
+  // Checking the chunk ids is cheap compared to scanning the referenced values. NULL rows of outer joins
+  // (NULL_ROW_ID) claim to come from chunk 0, but are not covered by its statistics.
+  const auto single_chunk = std::all_of(pos_list.cbegin(), pos_list.cend(), [&](const auto& row_id) {
+    return row_id.chunk_id == referenced_chunk_id && row_id.chunk_offset != INVALID_CHUNK_OFFSET;
+  });
+  if (!single_chunk) return nullptr;
+
+  return statistics->column_statistics()[reference_column->referenced_column_id()];
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ChunkColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * Zone map of a single column within a chunk, i.e., its minimum, maximum, and number of NULLs, optionally
+ * complemented by a Bloom filter of its values.
+ * It is computed when a chunk is compressed and used to rule out chunks that cannot contain matches of a predicate.
+ */
+class BaseChunkColumnStatistics {
+ public:
+  explicit BaseChunkColumnStatistics(const size_t null_count);
+  virtual ~BaseChunkColumnStatistics() = default;
+
+  size_t null_count() const;
+
+  /**
+   * Returns true if no row of the column can satisfy `column <scan_type> value` (or `column BETWEEN value AND value2`).
+   * Returning false does not mean that there are matches.
+   */
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+ protected:
+  const size_t _null_count;
+};
+
+template <typename T>
+class ChunkColumnStatistics : public BaseChunkColumnStatistics {
+ public:
+  // min and max are std::nullopt if the column contains only NULLs
+  ChunkColumnStatistics(const std::optional<T>& min, const std::optional<T>& max, const size_t null_count,
+                        std::shared_ptr<const BloomFilter<T>> filter = nullptr);
+
+  const std::optional<T>& min() const;
+  const std::optional<T>& max() const;
+
+  // Contains all non-NULL values of the column. Used to prune equality predicates and join probes.
+  // nullptr if min and max already describe the values exactly (e.g., a dense range of integers).
+  const std::shared_ptr<const BloomFilter<T>>& filter() const;
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+
+ protected:
+  const std::optional<T> _min;
+  const std::optional<T> _max;
+  const std::shared_ptr<const BloomFilter<T>> _filter;
+};
+
+/**
+ * Zone maps of all columns of a chunk. Only immutable (i.e., compressed) chunks have statistics.
+ */
+class ChunkStatistics {
+ public:
+  explicit ChunkStatistics(std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> column_statistics);
+
+  const std::vector<std::shared_ptr<const BaseChunkColumnStatistics>>& column_statistics() const;
+
+  bool can_prune(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+ protected:
+  const std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> _column_statistics;
+};
+
+/**
+ * Returns the statistics of the stored chunk that all rows of the column come from, i.e., of the chunk itself if it
+ * is a data chunk, or of the single chunk referenced by the column if it is a ReferenceColumn (as in the output of
+ * Validate or of a TableScan on a stored table). Returns nullptr if there is no such chunk or it has no statistics.
+ * The NULL rows of outer joins do not come from any stored chunk, so columns that contain them have no origin.
+ */
+std::shared_ptr<const BaseChunkColumnStatistics> origin_column_statistics(const Chunk& chunk,
+                                                                          const ColumnID column_id);
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/base_encoded_column.hpp"
 #include "storage/base_value_column.hpp"
 
 namespace opossum {
@@ -22,6 +23,8 @@ class ColumnVisitable {
                                         std::shared_ptr<ColumnVisitableContext> context) = 0;
   virtual void handle_reference_column(const ReferenceColumn& column,
                                        std::shared_ptr<ColumnVisitableContext> context) = 0;
+  virtual void handle_encoded_column(const BaseEncodedColumn& column,
+                                     std::shared_ptr<ColumnVisitableContext> context) = 0;
 };
 
 }  // namespace opossum
@@ -0,0 +1,194 @@
+#include "compressed_string_dictionary.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CompressedStringDictionary::CompressedStringDictionary(const allocator_type& alloc)
+    : _data(alloc), _offsets(pmr_vector<uint32_t>(1u, 0u, alloc)) {}
+
+CompressedStringDictionary::CompressedStringDictionary(const pmr_vector<std::string>& values)
+    : CompressedStringDictionary(values, values.get_allocator()) {}
+
+CompressedStringDictionary::CompressedStringDictionary(const pmr_vector<std::string>& values,
+                                                       const allocator_type& alloc) {
+  auto data = pmr_vector<char>{alloc};
+  auto offsets = pmr_vector<uint32_t>{alloc};
+  offsets.reserve(values.size() + 1u);
+  offsets.push_back(0u);
+
+  auto head = std::string{};
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    DebugAssert(index == 0u || values[index - 1u] < values[index], "Values must be sorted and unique.");
+
+    if (index % BLOCK_SIZE == 0u) head = values[index];
+    _append(data, offsets, values[index], head);
+  }
+
+  data.shrink_to_fit();
+  _data = MappedVector<char>{std::move(data)};
+  _offsets = MappedVector<uint32_t>{std::move(offsets)};
+}
+
+CompressedStringDictionary::CompressedStringDictionary(const CompressedStringDictionary& other,
+                                                       const allocator_type& alloc)
+    : _data(other._data, alloc), _offsets(other._offsets, alloc) {}
+
+CompressedStringDictionary::CompressedStringDictionary(MappedVector<char> data, MappedVector<uint32_t> offsets)
+    : _data(std::move(data)), _offsets(std::move(offsets)) {
+  Assert(!_offsets.empty() && _offsets.front() == 0u && _offsets.back() == _data.size(),
+         "Offsets do not match the encoded data.");
+}
+
+size_t CompressedStringDictionary::size() const { return _offsets.size() - 1u; }
+
+bool CompressedStringDictionary::empty() const { return size() == 0u; }
+
+std::string CompressedStringDictionary::operator[](const size_t index) const {
+  auto value = std::string{};
+  decode(index, value);
+  return value;
+}
+
+std::string CompressedStringDictionary::front() const { return (*this)[0u]; }
+
+std::string CompressedStringDictionary::back() const { return (*this)[size() - 1u]; }
+
+void CompressedStringDictionary::decode(const size_t index, std::string& value) const {
+  DebugAssert(index < size(), "Index out of range.");
+
+  const auto [prefix_length, suffix] = _entry(index);
+  value.assign(_head(index).data(), prefix_length);
+  value.append(suffix.data(), suffix.size());
+}
+
+size_t CompressedStringDictionary::lower_bound(const std::string_view value) const {
+  const auto block = _find_block(value);
+  if (!block) return 0u;
+
+  const auto end = std::min(size(), (*block + 1u) * BLOCK_SIZE);
+  for (auto index = *block * BLOCK_SIZE; index < end; ++index) {
+    if (_compare(index, value) >= 0) return index;
+  }
+  return end;
+}
+
+size_t CompressedStringDictionary::upper_bound(const std::string_view value) const {
+  const auto block = _find_block(value);
+  if (!block) return 0u;
+
+  const auto end = std::min(size(), (*block + 1u) * BLOCK_SIZE);
+  for (auto index = *block * BLOCK_SIZE; index < end; ++index) {
+    if (_compare(index, value) > 0) return index;
+  }
+  return end;
+}
+
+CompressedStringDictionary::Iterator CompressedStringDictionary::begin() const { return Iterator{*this, 0u}; }
+
+CompressedStringDictionary::Iterator CompressedStringDictionary::end() const { return Iterator{*this, size()}; }
+
+CompressedStringDictionary::Iterator CompressedStringDictionary::cbegin() const { return begin(); }
+
+CompressedStringDictionary::Iterator CompressedStringDictionary::cend() const { return end(); }
+
+size_t CompressedStringDictionary::data_size() const {
+  return _data.size() * sizeof(char) + _offsets.size() * sizeof(uint32_t);
+}
+
+CompressedStringDictionary::allocator_type CompressedStringDictionary::get_allocator() const {
+  return _data.get_allocator();
+}
+
+const MappedVector<char>& CompressedStringDictionary::data() const { return _data; }
+
+const MappedVector<uint32_t>& CompressedStringDictionary::offsets() const { return _offsets; }
+
+std::pair<size_t, std::string_view> CompressedStringDictionary::_entry(const size_t index) const {
+  const auto* begin = _data.data() + _offsets[index];
+  const auto* end = _data.data() + _offsets[index + 1u];
+
+  if (index % BLOCK_SIZE == 0u) return {0u, std::string_view{begin, static_cast<size_t>(end - begin)}};
+
+  // Decode the variable-length prefix length, seven bits per byte, least significant bits first
+  auto prefix_length = size_t{0u};
+  auto shift = 0u;
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*begin++);
+    prefix_length |= static_cast<size_t>(byte & 0x7Fu) << shift;
+    if ((byte & 0x80u) == 0u) break;
+    shift += 7u;
+  }
+
+  return {prefix_length, std::string_view{begin, static_cast<size_t>(end - begin)}};
+}
+
+std::string_view CompressedStringDictionary::_head(const size_t index) const {
+  const auto head_index = index - index % BLOCK_SIZE;
+  return _entry(head_index).second;
+}
+
+int CompressedStringDictionary::_compare(const size_t index, const std::string_view value) const {
+  const auto [prefix_length, suffix] = _entry(index);
+
+  const auto prefix_comparison =
+      _head(index).substr(0u, prefix_length).compare(value.substr(0u, std::min(prefix_length, value.size())));
+  if (prefix_comparison != 0) return prefix_comparison;
+
+  return suffix.compare(value.substr(prefix_length));
+}
+
+std::optional<size_t> CompressedStringDictionary::_find_block(const std::string_view value) const {
+  const auto block_count = (size() + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+
+  // Find the first block whose head is greater than the value
+  auto first = size_t{0u};
+  auto count = block_count;
+  while (count > 0u) {
+    const auto step = count / 2u;
+    const auto block = first + step;
+
+    if (_entry(block * BLOCK_SIZE).second.compare(value) <= 0) {
+      first = block + 1u;
+      count -= step + 1u;
+    } else {
+      count = step;
+    }
+  }
+
+  if (first == 0u) return std::nullopt;
+  return first - 1u;
+}
+
+void CompressedStringDictionary::_append(pmr_vector<char>& data, pmr_vector<uint32_t>& offsets,
+                                         const std::string& value, const std::string& head) {
+  const auto is_head = (offsets.size() - 1u) % BLOCK_SIZE == 0u;
+
+  auto prefix_length = size_t{0u};
+  if (!is_head) {
+    const auto max_prefix_length = std::min(value.size(), head.size());
+    while (prefix_length < max_prefix_length && value[prefix_length] == head[prefix_length]) ++prefix_length;
+
+    auto remaining = prefix_length;
+    do {
+      auto byte = static_cast<uint8_t>(remaining & 0x7Fu);
+      remaining >>= 7u;
+      if (remaining > 0u) byte |= 0x80u;
+      data.push_back(static_cast<char>(byte));
+    } while (remaining > 0u);
+  }
+
+  data.insert(data.end(), value.cbegin() + prefix_length, value.cend());
+
+  Assert(data.size() <= std::numeric_limits<uint32_t>::max(), "Dictionary exceeds the maximum size of 4 GB.");
+  offsets.push_back(static_cast<uint32_t>(data.size()));
+}
+
+}  // namespace opossum
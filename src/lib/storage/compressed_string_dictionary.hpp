@@ -0,0 +1,117 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "mapped_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Sorted, duplicate-free string dictionary of DictionaryColumn<std::string>.
+ *
+ * Instead of one std::string (and usually one heap allocation) per entry, all entries are stored in one contiguous
+ * buffer, which is addressed by an offset array. The entries are front-coded in blocks of BLOCK_SIZE entries:
+ * The first entry of each block (its head) is stored as is. All other entries only store the length of the prefix
+ * they share with the head (as a variable-length integer) followed by the remaining suffix. Since the prefix always
+ * refers to the head and not to the preceding entry, each entry can be decoded in constant time.
+ *
+ * lower_bound() and upper_bound() binary search the block heads and scan a single block. They compare the front-coded
+ * entries directly, i.e., without decoding them into strings.
+ */
+class CompressedStringDictionary {
+ public:
+  static constexpr size_t BLOCK_SIZE = 16u;
+
+  class Iterator;
+  using value_type = std::string;
+  using const_iterator = Iterator;
+  using allocator_type = PolymorphicAllocator<char>;
+
+  explicit CompressedStringDictionary(const allocator_type& alloc = {});
+
+  // The values must be sorted and must not contain duplicates
+  explicit CompressedStringDictionary(const pmr_vector<std::string>& values);
+  CompressedStringDictionary(const pmr_vector<std::string>& values, const allocator_type& alloc);
+
+  CompressedStringDictionary(const CompressedStringDictionary& other, const allocator_type& alloc);
+
+  // Creates a dictionary from its encoded form, as returned by data() and offsets()
+  CompressedStringDictionary(MappedVector<char> data, MappedVector<uint32_t> offsets);
+
+  size_t size() const;
+  bool empty() const;
+
+  std::string operator[](const size_t index) const;
+  std::string front() const;
+  std::string back() const;
+
+  // Decodes the entry at `index` into `value`. Reusing the string avoids allocations when iterating the dictionary.
+  void decode(const size_t index, std::string& value) const;
+
+  // Returns the index of the first entry >= value (or > value for upper_bound), or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+  size_t upper_bound(const std::string_view value) const;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // Size of the encoded entries and of the offset array in bytes
+  size_t data_size() const;
+
+  allocator_type get_allocator() const;
+
+  // The encoded entries and the offset array, which has one more element than the dictionary has entries
+  const MappedVector<char>& data() const;
+  const MappedVector<uint32_t>& offsets() const;
+
+  class Iterator : public boost::iterator_facade<Iterator, std::string, boost::random_access_traversal_tag,
+                                                 std::string> {
+   public:
+    Iterator(const CompressedStringDictionary& dictionary, const size_t index)
+        : _dictionary{&dictionary}, _index{index} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_index; }
+    void decrement() { --_index; }
+    void advance(const std::ptrdiff_t n) { _index += n; }
+    bool equal(const Iterator& other) const { return _index == other._index; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+    std::string dereference() const { return (*_dictionary)[_index]; }
+
+    const CompressedStringDictionary* _dictionary;
+    size_t _index;
+  };
+
+ protected:
+  // Returns the length of the prefix shared with the block head and the remaining suffix of an entry
+  std::pair<size_t, std::string_view> _entry(const size_t index) const;
+  std::string_view _head(const size_t index) const;
+
+  // Compares the entry at `index` with `value` like std::string::compare
+  int _compare(const size_t index, const std::string_view value) const;
+
+  // Returns the index of the last block whose head is <= value, or nullopt if all heads are greater
+  std::optional<size_t> _find_block(const std::string_view value) const;
+
+  static void _append(pmr_vector<char>& data, pmr_vector<uint32_t>& offsets, const std::string& value,
+                      const std::string& head);
+
+  MappedVector<char> _data;
+  // Entry i is stored in _data[_offsets[i], _offsets[i + 1])
+  MappedVector<uint32_t> _offsets;
+};
+
+}  // namespace opossum
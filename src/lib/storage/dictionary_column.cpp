@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -17,10 +18,10 @@ namespace opossum {
 template <typename T>
 DictionaryColumn<T>::DictionaryColumn(pmr_vector<T>&& dictionary,
                                       const std::shared_ptr<BaseAttributeVector>& attribute_vector)
-    : _dictionary(std::make_shared<pmr_vector<T>>(std::move(dictionary))), _attribute_vector(attribute_vector) {}
+    : _dictionary(std::make_shared<Dictionary>(std::move(dictionary))), _attribute_vector(attribute_vector) {}
 
 template <typename T>
-DictionaryColumn<T>::DictionaryColumn(const std::shared_ptr<pmr_vector<T>>& dictionary,
+DictionaryColumn<T>::DictionaryColumn(const std::shared_ptr<Dictionary>& dictionary,
                                       const std::shared_ptr<BaseAttributeVector>& attribute_vector)
     : _dictionary(dictionary), _attribute_vector(attribute_vector) {}
 
@@ -61,7 +62,7 @@ void DictionaryColumn<T>::append(const AllTypeVariant&) {
 }
 
 template <typename T>
-std::shared_ptr<const pmr_vector<T>> DictionaryColumn<T>::dictionary() const {
+std::shared_ptr<const typename DictionaryColumn<T>::Dictionary> DictionaryColumn<T>::dictionary() const {
   return _dictionary;
 }
 
@@ -83,17 +84,25 @@ const pmr_concurrent_vector<std::optional<T>> DictionaryColumn<T>::materialize_v
 }
 
 template <typename T>
-const T& DictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
+const T DictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
   DebugAssert(value_id != NULL_VALUE_ID, "Null value id passed.");
+  Assert(value_id < _dictionary->size(), "Value id out of range.");
 
-  return _dictionary->at(value_id);
+  return (*_dictionary)[value_id];
 }
 
 template <typename T>
 ValueID DictionaryColumn<T>::lower_bound(T value) const {
-  auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-  if (it == _dictionary->cend()) return INVALID_VALUE_ID;
-  return static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
+  if constexpr (std::is_same<T, std::string>::value) {
+    // Compares the front-coded entries without decoding them
+    const auto index = _dictionary->lower_bound(value);
+    if (index == _dictionary->size()) return INVALID_VALUE_ID;
+    return static_cast<ValueID>(index);
+  } else {
+    auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+    if (it == _dictionary->cend()) return INVALID_VALUE_ID;
+    return static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
+  }
 }
 
 template <typename T>
@@ -106,9 +115,16 @@ ValueID DictionaryColumn<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionaryColumn<T>::upper_bound(T value) const {
-  auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-  if (it == _dictionary->cend()) return INVALID_VALUE_ID;
-  return static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
+  if constexpr (std::is_same<T, std::string>::value) {
+    // Compares the front-coded entries without decoding them
+    const auto index = _dictionary->upper_bound(value);
+    if (index == _dictionary->size()) return INVALID_VALUE_ID;
+    return static_cast<ValueID>(index);
+  } else {
+    auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+    if (it == _dictionary->cend()) return INVALID_VALUE_ID;
+    return static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
+  }
 }
 
 template <typename T>
@@ -137,9 +153,9 @@ void DictionaryColumn<T>::visit(ColumnVisitable& visitable, std::shared_ptr<Colu
 template <typename T>
 std::shared_ptr<BaseColumn> DictionaryColumn<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
   const auto new_attribute_vector = _attribute_vector->copy_using_allocator(alloc);
-  const pmr_vector<T> new_dictionary(*_dictionary, alloc);
+  Dictionary new_dictionary(*_dictionary, alloc);
   return std::allocate_shared<DictionaryColumn<T>>(
-      alloc, std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_dictionary)), new_attribute_vector);
+      alloc, std::allocate_shared<Dictionary>(alloc, std::move(new_dictionary)), new_attribute_vector);
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionaryColumn);
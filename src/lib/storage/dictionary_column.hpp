@@ -3,11 +3,14 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "base_dictionary_column.hpp"
+#include "compressed_string_dictionary.hpp"
+#include "mapped_vector.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -16,16 +19,20 @@ class BaseAttributeVector;
 class BaseColumn;
 
 // Dictionary is a specific column type that stores all its values in a vector
+// String dictionaries are front-coded, see compressed_string_dictionary.hpp
 template <typename T>
 class DictionaryColumn : public BaseDictionaryColumn {
  public:
+  using Dictionary =
+      std::conditional_t<std::is_same<T, std::string>::value, CompressedStringDictionary, MappedVector<T>>;
+
   /**
    * Creates a Dictionary column from a given dictionary and attribute vector.
    * See dictionary_compression.cpp for more.
    */
   explicit DictionaryColumn(pmr_vector<T>&& dictionary, const std::shared_ptr<BaseAttributeVector>& attribute_vector);
 
-  explicit DictionaryColumn(const std::shared_ptr<pmr_vector<T>>& dictionary,
+  explicit DictionaryColumn(const std::shared_ptr<Dictionary>& dictionary,
                             const std::shared_ptr<BaseAttributeVector>& attribute_vector);
 
   // return the value at a certain position. If you want to write efficient operators, back off!
@@ -42,7 +49,7 @@ class DictionaryColumn : public BaseDictionaryColumn {
   void append(const AllTypeVariant&) override;
 
   // returns an underlying dictionary
-  std::shared_ptr<const pmr_vector<T>> dictionary() const;
+  std::shared_ptr<const Dictionary> dictionary() const;
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const final;
@@ -51,7 +58,7 @@ class DictionaryColumn : public BaseDictionaryColumn {
   const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  const T value_by_value_id(ValueID value_id) const;
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
@@ -80,7 +87,7 @@ class DictionaryColumn : public BaseDictionaryColumn {
   std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
 
  protected:
-  std::shared_ptr<pmr_vector<T>> _dictionary;
+  std::shared_ptr<Dictionary> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
@@ -3,27 +3,52 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "bit_packed_attribute_vector.hpp"
 #include "chunk.hpp"
+#include "chunk_statistics.hpp"
 #include "dictionary_column.hpp"
 #include "fitted_attribute_vector.hpp"
+#include "frame_of_reference_column.hpp"
 #include "resolve_type.hpp"
+#include "run_length_column.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/bloom_filter.hpp"
 #include "value_column.hpp"
 
 namespace opossum {
 
 class ColumnCompressorBase {
  public:
-  virtual std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column) = 0;
+  virtual std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column,
+                                                      EncodingType encoding_type,
+                                                      AttributeVectorCompression attribute_vector_compression) = 0;
+
+  // Computes the zone map and Bloom filter of an encoded column. The value column it was created from is used to count
+  // the NULLs.
+  virtual std::shared_ptr<const BaseChunkColumnStatistics> create_statistics(
+      const std::shared_ptr<const BaseColumn>& column, const std::shared_ptr<const BaseColumn>& encoded_column) = 0;
 
  protected:
-  static std::shared_ptr<BaseAttributeVector> _create_fitted_attribute_vector(size_t unique_values_count, size_t size) {
+  static std::shared_ptr<BaseAttributeVector> _create_attribute_vector(
+      size_t unique_values_count, size_t size, AttributeVectorCompression attribute_vector_compression) {
+    const auto bit_width = BitPackedAttributeVector::bit_width_for(unique_values_count);
+    const auto fitted_bit_width = unique_values_count <= std::numeric_limits<uint8_t>::max()
+                                      ? 8u
+                                      : unique_values_count <= std::numeric_limits<uint16_t>::max() ? 16u : 32u;
+
+    if (attribute_vector_compression == AttributeVectorCompression::BitPacked ||
+        (attribute_vector_compression == AttributeVectorCompression::Auto && bit_width * 4u <= fitted_bit_width * 3u)) {
+      return std::make_shared<BitPackedAttributeVector>(size, bit_width);
+    }
+
     if (unique_values_count <= std::numeric_limits<uint8_t>::max()) {
       return std::make_shared<FittedAttributeVector<uint8_t>>(size);
     } else if (unique_values_count <= std::numeric_limits<uint16_t>::max()) {
@@ -37,11 +62,111 @@ class ColumnCompressorBase {
 template <typename T>
 class ColumnCompressor : public ColumnCompressorBase {
  public:
-  std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column) override {
+  std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column, EncodingType encoding_type,
+                                              AttributeVectorCompression attribute_vector_compression) override {
     auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column);
 
     Assert(value_column != nullptr, "Column is either already compressed or type mismatches.");
 
+    switch (encoding_type) {
+      case EncodingType::Dictionary:
+        return _compress_dictionary(value_column, attribute_vector_compression);
+      case EncodingType::RunLength:
+        return _compress_run_length(value_column);
+      case EncodingType::FrameOfReference:
+        if constexpr (std::is_integral<T>::value) {
+          return _compress_frame_of_reference(value_column, attribute_vector_compression);
+        }
+        Fail("Frame-of-reference encoding is only supported for int and long columns.");
+      default:
+        Fail("Unsupported encoding type encountered.");
+    }
+  }
+
+  std::shared_ptr<const BaseChunkColumnStatistics> create_statistics(
+      const std::shared_ptr<const BaseColumn>& column, const std::shared_ptr<const BaseColumn>& encoded_column) override {
+    const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column);
+    DebugAssert(value_column != nullptr, "Column is either already compressed or type mismatches.");
+
+    auto null_count = size_t{0u};
+    if (value_column->is_nullable()) {
+      const auto& null_values = value_column->null_values();
+      null_count = static_cast<size_t>(std::count(null_values.cbegin(), null_values.cend(), true));
+    }
+
+    auto min = std::optional<T>{};
+    auto max = std::optional<T>{};
+    auto filter = std::shared_ptr<BloomFilter<T>>{};
+
+    if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(encoded_column)) {
+      // The dictionary is sorted and contains no NULLs, so its bounds are the column's minimum and maximum
+      const auto& dictionary = *dictionary_column->dictionary();
+      if (!dictionary.empty()) {
+        min = dictionary.front();
+        max = dictionary.back();
+      }
+
+      // A filter adds nothing if the dictionary covers every integer between minimum and maximum
+      auto is_dense = false;
+      if constexpr (std::is_integral<T>::value) {
+        is_dense = dictionary.empty() || static_cast<uint64_t>(*max) - static_cast<uint64_t>(*min) + 1u == dictionary.size();
+      }
+
+      if (!is_dense) filter = _create_filter(dictionary.cbegin(), dictionary.cend(), dictionary.size());
+    } else if (const auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<T>>(encoded_column)) {
+      const auto& values = *run_length_column->values();
+      const auto& null_values = *run_length_column->null_values();
+      filter = std::make_shared<BloomFilter<T>>(values.size());
+
+      for (auto run_index = size_t{0u}; run_index < values.size(); ++run_index) {
+        if (null_values[run_index]) continue;
+
+        const auto& value = values[run_index];
+        if (!min || value < *min) min = value;
+        if (!max || value > *max) max = value;
+        filter->insert(value);
+      }
+    } else if constexpr (std::is_integral<T>::value) {
+      // Frames without any values have a minimum and maximum of T{}, which only makes the range wider than necessary
+      const auto for_column = std::dynamic_pointer_cast<const FrameOfReferenceColumn<T>>(encoded_column);
+      DebugAssert(for_column != nullptr, "Unsupported encoded column type encountered.");
+
+      const auto& frame_minima = *for_column->frame_minima();
+      const auto& frame_maxima = *for_column->frame_maxima();
+      if (null_count < value_column->size()) {
+        min = *std::min_element(frame_minima.cbegin(), frame_minima.cend());
+        max = *std::max_element(frame_maxima.cbegin(), frame_maxima.cend());
+      }
+
+      // Frame-of-reference columns do not know their distinct values, so the filter is built from all values
+      const auto& values = value_column->values();
+      filter = std::make_shared<BloomFilter<T>>(values.size() - null_count);
+      for (auto chunk_offset = size_t{0u}; chunk_offset < values.size(); ++chunk_offset) {
+        if (value_column->is_nullable() && value_column->null_values()[chunk_offset]) continue;
+        filter->insert(values[chunk_offset]);
+      }
+    }
+
+    return std::make_shared<ChunkColumnStatistics<T>>(min, max, null_count, std::move(filter));
+  }
+
+  ValueID get_value_id(const pmr_vector<T>& dictionary, const T& value) {
+    return static_cast<ValueID>(
+        std::distance(dictionary.cbegin(), std::lower_bound(dictionary.cbegin(), dictionary.cend(), value)));
+  }
+
+ private:
+  template <typename Iterator>
+  static std::shared_ptr<BloomFilter<T>> _create_filter(Iterator begin, Iterator end, const size_t count) {
+    auto filter = std::make_shared<BloomFilter<T>>(count);
+    for (; begin != end; ++begin) {
+      filter->insert(*begin);
+    }
+    return filter;
+  }
+
+  std::shared_ptr<BaseColumn> _compress_dictionary(const std::shared_ptr<const ValueColumn<T>>& value_column,
+                                                   AttributeVectorCompression attribute_vector_compression) {
     // See: https://goo.gl/MCM5rr
     // Create dictionary (enforce uniqueness and sorting)
     const auto& values = value_column->values();
@@ -69,15 +194,12 @@ class ColumnCompressor : public ColumnCompressorBase {
     dictionary.shrink_to_fit();
 
     // We need to increment the dictionary size here because of possible null values.
-    auto attribute_vector = _create_fitted_attribute_vector(dictionary.size() + 1u, values.size());
+    auto attribute_vector =
+        _create_attribute_vector(dictionary.size() + 1u, values.size(), attribute_vector_compression);
 
     if (value_column->is_nullable()) {
       const auto& null_values = value_column->null_values();
 
-      /**
-       * Iterators are used because values and null_values are of
-       * type tbb::concurrent_vector and thus index-based access isn’t in O(1)
-       */
       auto value_it = values.cbegin();
       auto null_value_it = null_values.cbegin();
       auto index = 0u;
@@ -102,46 +224,173 @@ class ColumnCompressor : public ColumnCompressorBase {
     return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), attribute_vector);
   }
 
-  ValueID get_value_id(const pmr_vector<T>& dictionary, const T& value) {
-    return static_cast<ValueID>(
-        std::distance(dictionary.cbegin(), std::lower_bound(dictionary.cbegin(), dictionary.cend(), value)));
+  std::shared_ptr<BaseColumn> _compress_run_length(const std::shared_ptr<const ValueColumn<T>>& value_column) {
+    auto values = std::make_shared<pmr_vector<T>>();
+    auto null_values = std::make_shared<pmr_vector<bool>>();
+    auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>();
+
+    // A new run starts whenever the value or the null flag differs from the current run.
+    // All consecutive null values form a single run, independent of the values stored at their positions.
+    const auto append = [&](const T& value, const bool is_null, const ChunkOffset index) {
+      if (!values->empty() && null_values->back() == is_null && values->back() == value) {
+        end_positions->back() = index;
+        return;
+      }
+
+      values->push_back(value);
+      null_values->push_back(is_null);
+      end_positions->push_back(index);
+    };
+
+    const auto& column_values = value_column->values();
+
+    if (value_column->is_nullable()) {
+      auto null_value_it = value_column->null_values().cbegin();
+      auto index = ChunkOffset{0u};
+      for (auto value_it = column_values.cbegin(); value_it != column_values.cend(); ++value_it, ++null_value_it) {
+        append(*null_value_it ? T{} : *value_it, *null_value_it, index++);
+      }
+    } else {
+      auto index = ChunkOffset{0u};
+      for (auto value_it = column_values.cbegin(); value_it != column_values.cend(); ++value_it) {
+        append(*value_it, false, index++);
+      }
+    }
+
+    values->shrink_to_fit();
+    null_values->shrink_to_fit();
+    end_positions->shrink_to_fit();
+
+    return std::make_shared<RunLengthColumn<T>>(values, null_values, end_positions);
+  }
+
+  std::shared_ptr<BaseColumn> _compress_frame_of_reference(const std::shared_ptr<const ValueColumn<T>>& value_column,
+                                                          AttributeVectorCompression attribute_vector_compression) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto frame_size = FrameOfReferenceColumn<T>::FRAME_SIZE;
+
+    const auto& column_values = value_column->values();
+    const auto size = column_values.size();
+    const auto frame_count = (size + frame_size - 1u) / frame_size;
+
+    // Calls functor(value, is_null, chunk_offset) for every row.
+    const auto for_each_value = [&](const auto& functor) {
+      auto index = ChunkOffset{0u};
+      if (value_column->is_nullable()) {
+        auto null_value_it = value_column->null_values().cbegin();
+        for (auto value_it = column_values.cbegin(); value_it != column_values.cend(); ++value_it, ++null_value_it) {
+          functor(*value_it, *null_value_it, index++);
+        }
+      } else {
+        for (auto value_it = column_values.cbegin(); value_it != column_values.cend(); ++value_it) {
+          functor(*value_it, false, index++);
+        }
+      }
+    };
+
+    // First pass: find the minimum and maximum of each frame, ignoring null values
+    auto frame_minima = std::make_shared<pmr_vector<T>>(frame_count, T{});
+    auto frame_maxima = std::make_shared<pmr_vector<T>>(frame_count, T{});
+    auto frame_has_values = std::vector<bool>(frame_count, false);
+
+    for_each_value([&](const T& value, const bool is_null, const ChunkOffset index) {
+      if (is_null) return;
+
+      const auto frame_index = index / frame_size;
+      auto& frame_minimum = (*frame_minima)[frame_index];
+      auto& frame_maximum = (*frame_maxima)[frame_index];
+
+      if (!frame_has_values[frame_index]) {
+        frame_minimum = value;
+        frame_maximum = value;
+        frame_has_values[frame_index] = true;
+        return;
+      }
+
+      frame_minimum = std::min(frame_minimum, value);
+      frame_maximum = std::max(frame_maximum, value);
+    });
+
+    // All frames share the bit width needed by the largest range. The largest offset must stay below
+    // the representation of NULL_VALUE_ID, hence the + 2u.
+    auto max_range = uint64_t{0u};
+    for (auto frame_index = size_t{0u}; frame_index < frame_count; ++frame_index) {
+      const auto range = static_cast<UnsignedT>((*frame_maxima)[frame_index]) -
+                         static_cast<UnsignedT>((*frame_minima)[frame_index]);
+      max_range = std::max(max_range, static_cast<uint64_t>(range));
+    }
+
+    // Offsets are stored as ValueIDs. If a frame's range does not fit, the column is dictionary encoded instead.
+    if (max_range >= std::numeric_limits<uint32_t>::max()) {
+      return _compress_dictionary(value_column, attribute_vector_compression);
+    }
+
+    const auto bit_width = BitPackedAttributeVector::bit_width_for(max_range + 2u);
+    auto offsets = std::make_shared<BitPackedAttributeVector>(size, bit_width);
+
+    // Second pass: store the offsets to the frame minima
+    for_each_value([&](const T& value, const bool is_null, const ChunkOffset index) {
+      if (is_null) {
+        offsets->set(index, NULL_VALUE_ID);
+        return;
+      }
+
+      const auto frame_minimum = (*frame_minima)[index / frame_size];
+      const auto offset = static_cast<UnsignedT>(value) - static_cast<UnsignedT>(frame_minimum);
+      offsets->set(index, ValueID{static_cast<ValueID::base_type>(offset)});
+    });
+
+    return std::make_shared<FrameOfReferenceColumn<T>>(frame_minima, frame_maxima, offsets);
   }
 };
 
-std::shared_ptr<BaseColumn> DictionaryCompression::compress_column(DataType data_type,
-                                                                   const std::shared_ptr<BaseColumn>& column) {
+std::shared_ptr<BaseColumn> DictionaryCompression::compress_column(
+    DataType data_type, const std::shared_ptr<BaseColumn>& column, EncodingType encoding_type,
+    AttributeVectorCompression attribute_vector_compression) {
   auto compressor = make_shared_by_data_type<ColumnCompressorBase, ColumnCompressor>(data_type);
-  return compressor->compress_column(column);
+  return compressor->compress_column(column, encoding_type, attribute_vector_compression);
 }
 
 void DictionaryCompression::compress_chunk(const std::vector<DataType>& column_types,
-                                           const std::shared_ptr<Chunk>& chunk) {
+                                           const std::shared_ptr<Chunk>& chunk, EncodingType encoding_type,
+                                           AttributeVectorCompression attribute_vector_compression) {
   DebugAssert((column_types.size() == chunk->column_count()),
               "Number of column types does not match the chunk’s column count.");
 
+  auto column_statistics = std::vector<std::shared_ptr<const BaseChunkColumnStatistics>>{};
+  column_statistics.reserve(chunk->column_count());
+
   for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    auto compressor = make_shared_by_data_type<ColumnCompressorBase, ColumnCompressor>(column_types[column_id]);
     auto value_column = chunk->get_mutable_column(column_id);
-    auto dict_column = compress_column(column_types[column_id], value_column);
-    chunk->replace_column(column_id, dict_column);
+    auto encoded_column = compressor->compress_column(value_column, encoding_type, attribute_vector_compression);
+    column_statistics.push_back(compressor->create_statistics(value_column, encoded_column));
+    chunk->replace_column(column_id, encoded_column);
   }
 
+  // Compressed chunks are immutable, so their zone maps never become stale
+  chunk->set_statistics(std::make_shared<ChunkStatistics>(std::move(column_statistics)));
+
   if (chunk->has_mvcc_columns()) {
     chunk->shrink_mvcc_columns();
   }
 }
 
-void DictionaryCompression::compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids) {
+void DictionaryCompression::compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids,
+                                            EncodingType encoding_type,
+                                            AttributeVectorCompression attribute_vector_compression) {
   for (auto chunk_id : chunk_ids) {
     Assert(chunk_id < table.chunk_count(), "Chunk with given ID does not exist.");
 
-    compress_chunk(table.column_types(), table.get_chunk(chunk_id));
+    compress_chunk(table.column_types(), table.get_chunk(chunk_id), encoding_type, attribute_vector_compression);
   }
 }
 
-void DictionaryCompression::compress_table(Table& table) {
+void DictionaryCompression::compress_table(Table& table, EncodingType encoding_type,
+                                           AttributeVectorCompression attribute_vector_compression) {
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
     auto chunk = table.get_chunk(chunk_id);
-    compress_chunk(table.column_types(), chunk);
+    compress_chunk(table.column_types(), chunk, encoding_type, attribute_vector_compression);
   }
 }
 
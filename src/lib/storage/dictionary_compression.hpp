@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "encoding_type.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -12,6 +13,16 @@ class BaseColumn;
 class Chunk;
 class Table;
 
+/**
+ * Selects the attribute vector implementation created by the DictionaryCompression
+ *
+ * - Auto: BitPacked if it saves at least a quarter of the memory of Fitted, otherwise Fitted. Decoding a single
+ *         value of a BitPackedAttributeVector is slower, so it is only used if it is considerably smaller.
+ * - Fitted: FittedAttributeVector, i.e., 8, 16, or 32 bits per value
+ * - BitPacked: BitPackedAttributeVector, i.e., the minimal number of bits per value
+ */
+enum class AttributeVectorCompression { Auto, Fitted, BitPacked };
+
 class DictionaryCompression {
  public:
   /**
@@ -22,15 +33,22 @@ class DictionaryCompression {
    *
    * @param data_type enum value of the column’s type
    * @param column needs to be of type ValueColumn<T>
-   * @return a compressed column of type DictionaryColumn<T>
+   * @param encoding_type determines the type of the compressed column (FrameOfReference requires an int or long column
+   *                      and falls back to Dictionary if the value range of a frame does not fit into 32 bits)
+   * @param attribute_vector_compression determines the type of the attribute vector (only used by dictionary columns)
+   * @return a compressed column of type DictionaryColumn<T>, RunLengthColumn<T>, or FrameOfReferenceColumn<T>
    */
-  static std::shared_ptr<BaseColumn> compress_column(DataType data_type, const std::shared_ptr<BaseColumn>& column);
+  static std::shared_ptr<BaseColumn> compress_column(
+      DataType data_type, const std::shared_ptr<BaseColumn>& column,
+      EncodingType encoding_type = EncodingType::Dictionary,
+      AttributeVectorCompression attribute_vector_compression = AttributeVectorCompression::Auto);
 
   /**
    * @brief Compresses a chunk
    *
    * Compresses the passed chunk by compressing each column
-   * and reducing the fragmentation of its mvcc columns
+   * and reducing the fragmentation of its mvcc columns.
+   * Also stores the minimum, maximum, null count, and a Bloom filter of each column as the chunk's statistics.
    * All columns of the chunk need to be of type ValueColumn<T>
    *
    * This is potentially unsafe if another operation modifies the table at the same time. In most cases, this should
@@ -38,8 +56,13 @@ class DictionaryCompression {
    *
    * @param column_types from the chunk’s table
    * @param chunk to be compressed
+   * @param encoding_type determines the type of the compressed columns
+   * @param attribute_vector_compression determines the type of the attribute vectors
    */
-  static void compress_chunk(const std::vector<DataType>& column_types, const std::shared_ptr<Chunk>& chunk);
+  static void compress_chunk(
+      const std::vector<DataType>& column_types, const std::shared_ptr<Chunk>& chunk,
+      EncodingType encoding_type = EncodingType::Dictionary,
+      AttributeVectorCompression attribute_vector_compression = AttributeVectorCompression::Auto);
 
   /**
    * @brief Compresses specified chunks of a table
@@ -47,7 +70,9 @@ class DictionaryCompression {
    * This is potentially unsafe if another operation modifies the table at the same time. In most cases, this should
    * only be called by the ChunkCompressionTask.
    */
-  static void compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids);
+  static void compress_chunks(
+      Table& table, const std::vector<ChunkID>& chunk_ids, EncodingType encoding_type = EncodingType::Dictionary,
+      AttributeVectorCompression attribute_vector_compression = AttributeVectorCompression::Auto);
 
   /**
    * @brief Compresses a table by calling compress_chunk for each chunk
@@ -55,7 +80,9 @@ class DictionaryCompression {
    * This is potentially unsafe if another operation modifies the table at the same time. In most cases, this should
    * only be called by the ChunkCompressionTask.
    */
-  static void compress_table(Table& table);
+  static void compress_table(
+      Table& table, EncodingType encoding_type = EncodingType::Dictionary,
+      AttributeVectorCompression attribute_vector_compression = AttributeVectorCompression::Auto);
 };
 
 }  // namespace opossum
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace opossum {
+
+/**
+ * Selects the encoding used when compressing a ValueColumn
+ *
+ * - Dictionary: DictionaryColumn, i.e., a sorted dictionary and an attribute vector
+ * - RunLength: RunLengthColumn, i.e., one value per run of equal values
+ * - FrameOfReference: FrameOfReferenceColumn, i.e., bit-packed offsets to a per-frame minimum (int and long only)
+ */
+enum class EncodingType { Dictionary, RunLength, FrameOfReference };
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "base_attribute_vector.hpp"
+#include "mapped_vector.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -19,6 +20,8 @@ namespace opossum {
  *
  * Note: Because in most cases NULL_VALUE_ID cannot be stored inside uintX_t,
  *       it is represented by max(uintX_t)
+ *
+ * Attribute vectors imported from a memory-mappable binary file reference the file and are read-only.
  */
 
 template <typename uintX_t>
@@ -27,11 +30,13 @@ class FittedAttributeVector : public BaseAttributeVector {
   static constexpr auto CLAMPED_NULL_VALUE_ID = std::numeric_limits<uintX_t>::max();
 
  public:
-  explicit FittedAttributeVector(size_t size) : _attributes(size) {}
-  explicit FittedAttributeVector(size_t size, const PolymorphicAllocator<uintX_t>& alloc) : _attributes(size, alloc) {}
+  explicit FittedAttributeVector(size_t size) : _attributes(pmr_vector<uintX_t>(size)) {}
+  explicit FittedAttributeVector(size_t size, const PolymorphicAllocator<uintX_t>& alloc)
+      : _attributes(pmr_vector<uintX_t>(size, alloc)) {}
 
   // Creates a FittedAttributeVector from given attributes
-  explicit FittedAttributeVector(const pmr_vector<uintX_t>& attributes) : _attributes(attributes) {}
+  explicit FittedAttributeVector(pmr_vector<uintX_t> attributes) : _attributes(std::move(attributes)) {}
+  explicit FittedAttributeVector(MappedVector<uintX_t> attributes) : _attributes(std::move(attributes)) {}
 
   /**
    * Returns the ValueID for a given record
@@ -48,11 +53,11 @@ class FittedAttributeVector : public BaseAttributeVector {
    */
   void set(const ChunkOffset chunk_offset, const ValueID value_id) final {
     DebugAssert(value_id < CLAMPED_NULL_VALUE_ID || value_id == NULL_VALUE_ID, "value_id to large to fit into uintX_t");
-    _attributes[chunk_offset] = static_cast<uintX_t>(value_id);
+    _attributes.set(chunk_offset, static_cast<uintX_t>(value_id));
   }
 
   // returns all attributes
-  const pmr_vector<uintX_t>& attributes() const { return _attributes; }
+  const MappedVector<uintX_t>& attributes() const { return _attributes; }
 
   // returns the number of values
   size_t size() const final { return _attributes.size(); }
@@ -60,13 +65,13 @@ class FittedAttributeVector : public BaseAttributeVector {
   AttributeVectorWidth width() const final { return sizeof(uintX_t); }
 
   std::shared_ptr<BaseAttributeVector> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final {
-    pmr_vector<uintX_t> new_attributes(_attributes, alloc);
+    MappedVector<uintX_t> new_attributes(_attributes, alloc);
     const auto new_attribute_vector =
         std::allocate_shared<FittedAttributeVector<uintX_t>>(alloc, std::move(new_attributes));
     return new_attribute_vector;
   }
 
  private:
-  pmr_vector<uintX_t> _attributes;
+  MappedVector<uintX_t> _attributes;
 };
 }  // namespace opossum
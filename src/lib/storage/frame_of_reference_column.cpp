@@ -0,0 +1,125 @@
+#include "frame_of_reference_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceColumn<T>::FrameOfReferenceColumn(const std::shared_ptr<const pmr_vector<T>>& frame_minima,
+                                                  const std::shared_ptr<const pmr_vector<T>>& frame_maxima,
+                                                  const std::shared_ptr<const BitPackedAttributeVector>& offsets)
+    : _frame_minima{frame_minima}, _frame_maxima{frame_maxima}, _offsets{offsets} {
+  DebugAssert(_frame_minima->size() == _frame_maxima->size(), "Number of frame minima and maxima must be equal.");
+  DebugAssert(_frame_minima->size() == (_offsets->size() + FRAME_SIZE - 1u) / FRAME_SIZE,
+              "Number of frames does not match the number of offsets.");
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> FrameOfReferenceColumn<T>::frame_minima() const {
+  return _frame_minima;
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> FrameOfReferenceColumn<T>::frame_maxima() const {
+  return _frame_maxima;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedAttributeVector> FrameOfReferenceColumn<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+const AllTypeVariant FrameOfReferenceColumn<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto value = get_typed_value(chunk_offset);
+  if (!value) return NULL_VALUE;
+
+  return *value;
+}
+
+template <typename T>
+bool FrameOfReferenceColumn<T>::is_null(const ChunkOffset chunk_offset) const {
+  return _offsets->get(chunk_offset) == NULL_VALUE_ID;
+}
+
+template <typename T>
+const T FrameOfReferenceColumn<T>::get(const ChunkOffset chunk_offset) const {
+  const auto value = get_typed_value(chunk_offset);
+
+  DebugAssert(value, "Value at index " + std::to_string(chunk_offset) + " is null.");
+
+  return *value;
+}
+
+template <typename T>
+std::optional<T> FrameOfReferenceColumn<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto offset = _offsets->get(chunk_offset);
+  if (offset == NULL_VALUE_ID) return std::nullopt;
+
+  return decode((*_frame_minima)[chunk_offset / FRAME_SIZE], offset);
+}
+
+template <typename T>
+const pmr_concurrent_vector<std::optional<T>> FrameOfReferenceColumn<T>::materialize_values() const {
+  pmr_concurrent_vector<std::optional<T>> values(size(), std::nullopt, _frame_minima->get_allocator());
+
+  auto decoded_block = BitPackedAttributeVector::DecodedBlock{};
+  auto value_it = values.begin();
+
+  for (auto block_index = size_t{0u}; block_index < _offsets->block_count(); ++block_index) {
+    _offsets->decode_block(block_index, decoded_block);
+
+    const auto block_begin = block_index * BitPackedAttributeVector::BLOCK_SIZE;
+    const auto frame_minimum = (*_frame_minima)[block_begin / FRAME_SIZE];
+    const auto block_size = std::min(BitPackedAttributeVector::BLOCK_SIZE, size() - block_begin);
+
+    for (auto index = size_t{0u}; index < block_size; ++index, ++value_it) {
+      const auto offset = ValueID{decoded_block[index]};
+      if (offset != NULL_VALUE_ID) *value_it = decode(frame_minimum, offset);
+    }
+  }
+
+  return values;
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::frame_count() const {
+  return _frame_minima->size();
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+EncodingType FrameOfReferenceColumn<T>::encoding_type() const {
+  return EncodingType::FrameOfReference;
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> FrameOfReferenceColumn<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  pmr_vector<T> new_frame_minima(*_frame_minima, alloc);
+  pmr_vector<T> new_frame_maxima(*_frame_maxima, alloc);
+  auto new_offsets = std::static_pointer_cast<const BitPackedAttributeVector>(_offsets->copy_using_allocator(alloc));
+
+  return std::allocate_shared<FrameOfReferenceColumn<T>>(
+      alloc, std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_frame_minima)),
+      std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_frame_maxima)), new_offsets);
+}
+
+template class FrameOfReferenceColumn<int32_t>;
+template class FrameOfReferenceColumn<int64_t>;
+
+}  // namespace opossum
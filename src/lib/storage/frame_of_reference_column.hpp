@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_encoded_column.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * FrameOfReferenceColumn is an encoded column for int and long columns. It splits the column into frames of
+ * FRAME_SIZE rows and stores every value as the offset to the minimum of its frame. This works best on columns
+ * whose values are close to each other within a frame, such as monotonically increasing keys.
+ *
+ * The column stores
+ *  - frame_minima[i]: the smallest non-null value of frame i (T{} if the frame only contains null values)
+ *  - frame_maxima[i]: the largest non-null value of frame i (T{} if the frame only contains null values)
+ *  - offsets: value - frame_minima[i] for every row, bit-packed using the bit width of the largest frame range
+ *
+ * Null values are stored in the offsets as NULL_VALUE_ID, i.e., the bit width is chosen such that the largest
+ * representable value is never a valid offset (see BitPackedAttributeVector).
+ *
+ * The frame maxima are not needed for decoding, but allow operators to rule out entire frames (see
+ * SingleColumnTableScanImpl).
+ *
+ * The column is only instantiated for int32_t and int64_t (see frame_of_reference_column.cpp).
+ */
+template <typename T>
+class FrameOfReferenceColumn : public BaseEncodedColumn {
+ public:
+  static constexpr auto FRAME_SIZE = ChunkOffset{2048u};
+  static_assert(FRAME_SIZE % BitPackedAttributeVector::BLOCK_SIZE == 0u,
+                "Frames need to consist of complete bit-packed blocks.");
+
+  explicit FrameOfReferenceColumn(const std::shared_ptr<const pmr_vector<T>>& frame_minima,
+                                  const std::shared_ptr<const pmr_vector<T>>& frame_maxima,
+                                  const std::shared_ptr<const BitPackedAttributeVector>& offsets);
+
+  std::shared_ptr<const pmr_vector<T>> frame_minima() const;
+  std::shared_ptr<const pmr_vector<T>> frame_maxima() const;
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const;
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // returns whether a value is NULL
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // return the value at a certain position.
+  // Only use if you are certain that no null values are present, otherwise an Assert fails.
+  const T get(const ChunkOffset chunk_offset) const;
+
+  // return the value at a certain position or std::nullopt if it is NULL
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // return a generated vector of all values (or nulls)
+  const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
+
+  // returns the value of a non-null offset within the given frame
+  static T decode(const T frame_minimum, const ValueID::base_type offset) {
+    return static_cast<T>(static_cast<std::make_unsigned_t<T>>(frame_minimum) + offset);
+  }
+
+  // returns the number of frames, including the last, possibly incomplete one
+  size_t frame_count() const;
+
+  size_t size() const final;
+
+  EncodingType encoding_type() const final;
+
+  // Copies a FrameOfReferenceColumn using a new allocator. This is useful for placing it on a new NUMA node.
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+ protected:
+  const std::shared_ptr<const pmr_vector<T>> _frame_minima;
+  const std::shared_ptr<const pmr_vector<T>> _frame_maxima;
+  const std::shared_ptr<const BitPackedAttributeVector> _offsets;
+};
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 
 #include "iterables.hpp"
 #include "storage/base_attribute_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 
 namespace opossum {
 
@@ -15,6 +16,14 @@ class AttributeVectorIterable : public IndexableIterable<AttributeVectorIterable
 
   template <typename Functor>
   void _on_with_iterators(const Functor& f) const {
+    // Bit-packed attribute vectors are decoded block-wise instead of value by value
+    if (auto bit_packed_vector = dynamic_cast<const BitPackedAttributeVector*>(&_attribute_vector)) {
+      auto begin = BitPackedIterator{*bit_packed_vector, 0u};
+      auto end = BitPackedIterator{*bit_packed_vector, static_cast<ChunkOffset>(bit_packed_vector->size())};
+      f(begin, end);
+      return;
+    }
+
     auto begin = Iterator{_attribute_vector, 0u};
     auto end = Iterator{_attribute_vector, static_cast<ChunkOffset>(_attribute_vector.size())};
     f(begin, end);
@@ -54,6 +63,47 @@ class AttributeVectorIterable : public IndexableIterable<AttributeVectorIterable
     ChunkOffset _chunk_offset;
   };
 
+  /**
+   * Decodes the bit-packed vector one block of BitPackedAttributeVector::BLOCK_SIZE values at a time and
+   * serves the values from the decoded block. Only the iterator that is incremented decodes, i.e., the
+   * end iterator never touches the data.
+   */
+  class BitPackedIterator : public BaseIterator<BitPackedIterator, NullableColumnValue<ValueID>> {
+   public:
+    explicit BitPackedIterator(const BitPackedAttributeVector& attribute_vector, ChunkOffset chunk_offset)
+        : _attribute_vector{attribute_vector}, _chunk_offset{chunk_offset} {
+      if (_chunk_offset < _attribute_vector.size()) _decode_current_block();
+    }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+      if (_chunk_offset % BitPackedAttributeVector::BLOCK_SIZE == 0u && _chunk_offset < _attribute_vector.size()) {
+        _decode_current_block();
+      }
+    }
+
+    bool equal(const BitPackedIterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    NullableColumnValue<ValueID> dereference() const {
+      const auto value_id = ValueID{_decoded_block[_chunk_offset % BitPackedAttributeVector::BLOCK_SIZE]};
+      const auto is_null = (value_id == NULL_VALUE_ID);
+
+      return NullableColumnValue<ValueID>{value_id, is_null, _chunk_offset};
+    }
+
+    void _decode_current_block() {
+      _attribute_vector.decode_block(_chunk_offset / BitPackedAttributeVector::BLOCK_SIZE, _decoded_block);
+    }
+
+   private:
+    const BitPackedAttributeVector& _attribute_vector;
+    ChunkOffset _chunk_offset;
+    BitPackedAttributeVector::DecodedBlock _decoded_block{};
+  };
+
   class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<ValueID>> {
    public:
     explicit IndexedIterator(const BaseAttributeVector& attribute_vector, const ChunkOffsetsIterator& chunk_offsets_it)
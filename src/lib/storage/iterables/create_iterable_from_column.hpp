@@ -1,7 +1,9 @@
 #pragma once
 
 #include "dictionary_column_iterable.hpp"
+#include "frame_of_reference_column_iterable.hpp"
 #include "reference_column_iterable.hpp"
+#include "run_length_column_iterable.hpp"
 #include "value_column_iterable.hpp"
 
 namespace opossum {
@@ -25,6 +27,16 @@ auto create_iterable_from_column(const DictionaryColumn<T>& column) {
   return DictionaryColumnIterable<T>{column};
 }
 
+template <typename T>
+auto create_iterable_from_column(const RunLengthColumn<T>& column) {
+  return RunLengthColumnIterable<T>{column};
+}
+
+template <typename T>
+auto create_iterable_from_column(const FrameOfReferenceColumn<T>& column) {
+  return FrameOfReferenceColumnIterable<T>{column};
+}
+
 template <typename T>
 auto create_iterable_from_column(const ReferenceColumn& column) {
   return ReferenceColumnIterable<T>{column};
@@ -34,7 +34,7 @@ class DictionaryColumnIterable : public IndexableIterable<DictionaryColumnIterab
  private:
   class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
    public:
-    using Dictionary = pmr_vector<T>;
+    using Dictionary = typename DictionaryColumn<T>::Dictionary;
 
    public:
     explicit Iterator(const Dictionary& dictionary, const BaseAttributeVector& attribute_vector,
@@ -64,7 +64,7 @@ class DictionaryColumnIterable : public IndexableIterable<DictionaryColumnIterab
 
   class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>> {
    public:
-    using Dictionary = pmr_vector<T>;
+    using Dictionary = typename DictionaryColumn<T>::Dictionary;
 
    public:
     explicit IndexedIterator(const Dictionary& dictionary, const BaseAttributeVector& attribute_vector,
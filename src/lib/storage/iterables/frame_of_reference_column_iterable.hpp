@@ -0,0 +1,105 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "iterables.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/frame_of_reference_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+class FrameOfReferenceColumnIterable : public IndexableIterable<FrameOfReferenceColumnIterable<T>> {
+ public:
+  explicit FrameOfReferenceColumnIterable(const FrameOfReferenceColumn<T>& column) : _column{column} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    auto begin = Iterator{_column, 0u};
+    auto end = Iterator{_column, static_cast<ChunkOffset>(_column.size())};
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    auto begin = IndexedIterator{_column, mapped_chunk_offsets.cbegin()};
+    auto end = IndexedIterator{_column, mapped_chunk_offsets.cend()};
+    functor(begin, end);
+  }
+
+ private:
+  const FrameOfReferenceColumn<T>& _column;
+
+ private:
+  /**
+   * Decodes the offsets one block of BitPackedAttributeVector::BLOCK_SIZE values at a time
+   * and adds the minimum of the current frame to each of them
+   */
+  class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
+   public:
+    explicit Iterator(const FrameOfReferenceColumn<T>& column, ChunkOffset chunk_offset)
+        : _frame_minima{*column.frame_minima()}, _offsets{*column.offsets()}, _chunk_offset{chunk_offset} {
+      if (_chunk_offset < _offsets.size()) _decode_current_block();
+    }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+      if (_chunk_offset % BitPackedAttributeVector::BLOCK_SIZE == 0u && _chunk_offset < _offsets.size()) {
+        _decode_current_block();
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    NullableColumnValue<T> dereference() const {
+      const auto offset = _decoded_block[_chunk_offset % BitPackedAttributeVector::BLOCK_SIZE];
+
+      if (ValueID{offset} == NULL_VALUE_ID) return NullableColumnValue<T>{T{}, true, _chunk_offset};
+
+      return NullableColumnValue<T>{FrameOfReferenceColumn<T>::decode(_frame_minimum, offset), false, _chunk_offset};
+    }
+
+    void _decode_current_block() {
+      _offsets.decode_block(_chunk_offset / BitPackedAttributeVector::BLOCK_SIZE, _decoded_block);
+      _frame_minimum = _frame_minima[_chunk_offset / FrameOfReferenceColumn<T>::FRAME_SIZE];
+    }
+
+   private:
+    const pmr_vector<T>& _frame_minima;
+    const BitPackedAttributeVector& _offsets;
+    ChunkOffset _chunk_offset;
+    T _frame_minimum{};
+    BitPackedAttributeVector::DecodedBlock _decoded_block{};
+  };
+
+  class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>> {
+   public:
+    explicit IndexedIterator(const FrameOfReferenceColumn<T>& column, const ChunkOffsetsIterator& chunk_offsets_it)
+        : BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>>{chunk_offsets_it}, _column{column} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    NullableColumnValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      if (chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET)
+        return NullableColumnValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      const auto value = _column.get_typed_value(chunk_offsets.into_referenced);
+
+      if (!value) return NullableColumnValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      return NullableColumnValue<T>{*value, false, chunk_offsets.into_referencing};
+    }
+
+   private:
+    const FrameOfReferenceColumn<T>& _column;
+  };
+};
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "iterables.hpp"
+#include "storage/append_only_vector.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -14,7 +15,7 @@ namespace opossum {
  */
 class NullValueVectorIterable : public IndexableIterable<NullValueVectorIterable> {
  public:
-  explicit NullValueVectorIterable(const pmr_concurrent_vector<bool>& null_values) : _null_values{null_values} {}
+  explicit NullValueVectorIterable(const AppendOnlyVector<bool>& null_values) : _null_values{null_values} {}
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
@@ -31,12 +32,12 @@ class NullValueVectorIterable : public IndexableIterable<NullValueVectorIterable
   }
 
  private:
-  const pmr_concurrent_vector<bool>& _null_values;
+  const AppendOnlyVector<bool>& _null_values;
 
  private:
   class Iterator : public BaseIterator<Iterator, ColumnNullValue> {
    public:
-    using NullValueIterator = pmr_concurrent_vector<bool>::const_iterator;
+    using NullValueIterator = AppendOnlyVector<bool>::const_iterator;
 
    public:
     explicit Iterator(const NullValueIterator& begin_null_value_it, const NullValueIterator& null_value_it)
@@ -60,7 +61,7 @@ class NullValueVectorIterable : public IndexableIterable<NullValueVectorIterable
 
   class IndexedIterator : public BaseIndexedIterator<IndexedIterator, ColumnNullValue> {
    public:
-    using NullValueVector = pmr_concurrent_vector<bool>;
+    using NullValueVector = AppendOnlyVector<bool>;
 
    public:
     explicit IndexedIterator(const NullValueVector& null_values, const ChunkOffsetsIterator& chunk_offsets_it)
@@ -2,10 +2,13 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "iterables.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_encoded_column.hpp"
 #include "storage/reference_column.hpp"
 
 namespace opossum {
@@ -65,6 +68,11 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
         return _value_from_dictionary_column(*(dict_column_it->second), chunk_offset);
       }
 
+      auto encoded_column_it = _encoded_columns.find(chunk_id);
+      if (encoded_column_it != _encoded_columns.end()) {
+        return _value_from_encoded_column(*(encoded_column_it->second), chunk_offset);
+      }
+
       const auto chunk = _table->get_chunk(chunk_id);
       const auto column = chunk->get_column(_column_id);
 
@@ -78,7 +86,12 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
         return _value_from_dictionary_column(*dict_column, chunk_offset);
       }
 
-      Fail("Referenced column is neither value nor dictionary column.");
+      if (auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column)) {
+        _encoded_columns[chunk_id] = encoded_column;
+        return _value_from_encoded_column(*encoded_column, chunk_offset);
+      }
+
+      Fail("Referenced column is neither value, dictionary, nor encoded column.");
     }
 
    private:
@@ -112,6 +125,20 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
       return NullableColumnValue<T>{value, false, chunk_offset_into_ref_column};
     }
 
+    auto _value_from_encoded_column(const BaseEncodedColumn& column, const ChunkOffset& chunk_offset) const {
+      const auto chunk_offset_into_ref_column =
+          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+
+      auto value = std::optional<T>{};
+      resolve_encoded_column_type<T>(column, [&](const auto& typed_column) {
+        value = typed_column.get_typed_value(chunk_offset);
+      });
+
+      if (!value) return NullableColumnValue<T>{T{}, true, chunk_offset_into_ref_column};
+
+      return NullableColumnValue<T>{*value, false, chunk_offset_into_ref_column};
+    }
+
    private:
     const std::shared_ptr<const Table> _table;
     const ColumnID _column_id;
@@ -121,6 +148,7 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
 
     mutable std::map<ChunkID, std::shared_ptr<const ValueColumn<T>>> _value_columns;
     mutable std::map<ChunkID, std::shared_ptr<const DictionaryColumn<T>>> _dictionary_columns;
+    mutable std::map<ChunkID, std::shared_ptr<const BaseEncodedColumn>> _encoded_columns;
   };
 };
 
@@ -15,28 +15,37 @@ class ValueColumnIterable : public IndexableIterable<ValueColumnIterable<T>> {
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    // Load the size only once so that both iterators refer to the same range even if values are appended concurrently
+    const auto size = _column.size();
+    const auto* values = _column.values().data();
+
     if (_column.is_nullable()) {
-      auto begin =
-          NullableIterator{_column.values().cbegin(), _column.values().cbegin(), _column.null_values().cbegin()};
-      auto end = NullableIterator{_column.values().cbegin(), _column.values().cend(), _column.null_values().cend()};
+      const auto* null_values = _column.null_values().data();
+
+      auto begin = NullableIterator{values, values, null_values};
+      auto end = NullableIterator{values, values + size, null_values + size};
       functor(begin, end);
       return;
     }
 
-    auto begin = Iterator{_column.values().cbegin(), _column.values().cbegin()};
-    auto end = Iterator{_column.values().cend(), _column.values().cend()};
+    auto begin = Iterator{values, values};
+    auto end = Iterator{values, values + size};
     functor(begin, end);
   }
 
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    const auto* values = _column.values().data();
+
     if (_column.is_nullable()) {
-      auto begin = NullableIndexedIterator{_column.values(), _column.null_values(), mapped_chunk_offsets.cbegin()};
-      auto end = NullableIndexedIterator{_column.values(), _column.null_values(), mapped_chunk_offsets.cend()};
+      const auto* null_values = _column.null_values().data();
+
+      auto begin = NullableIndexedIterator{values, null_values, mapped_chunk_offsets.cbegin()};
+      auto end = NullableIndexedIterator{values, null_values, mapped_chunk_offsets.cend()};
       functor(begin, end);
     } else {
-      auto begin = IndexedIterator{_column.values(), mapped_chunk_offsets.cbegin()};
-      auto end = IndexedIterator{_column.values(), mapped_chunk_offsets.cend()};
+      auto begin = IndexedIterator{values, mapped_chunk_offsets.cbegin()};
+      auto end = IndexedIterator{values, mapped_chunk_offsets.cend()};
       functor(begin, end);
     }
   }
@@ -47,7 +56,7 @@ class ValueColumnIterable : public IndexableIterable<ValueColumnIterable<T>> {
  private:
   class Iterator : public BaseIterator<Iterator, ColumnValue<T>> {
    public:
-    using ValueIterator = typename pmr_concurrent_vector<T>::const_iterator;
+    using ValueIterator = const T*;
 
    public:
     explicit Iterator(const ValueIterator& begin_value_it, const ValueIterator& value_it)
@@ -70,8 +79,8 @@ class ValueColumnIterable : public IndexableIterable<ValueColumnIterable<T>> {
 
   class NullableIterator : public BaseIterator<NullableIterator, NullableColumnValue<T>> {
    public:
-    using ValueIterator = typename pmr_concurrent_vector<T>::const_iterator;
-    using NullValueIterator = pmr_concurrent_vector<bool>::const_iterator;
+    using ValueIterator = const T*;
+    using NullValueIterator = const bool*;
 
    public:
     explicit NullableIterator(const ValueIterator& begin_value_it, const ValueIterator& value_it,
@@ -101,10 +110,10 @@ class ValueColumnIterable : public IndexableIterable<ValueColumnIterable<T>> {
 
   class IndexedIterator : public BaseIndexedIterator<IndexedIterator, ColumnValue<T>> {
    public:
-    using ValueVector = pmr_concurrent_vector<T>;
+    using ValueIterator = const T*;
 
    public:
-    explicit IndexedIterator(const ValueVector& values, const ChunkOffsetsIterator& chunk_offsets_it)
+    explicit IndexedIterator(const ValueIterator values, const ChunkOffsetsIterator& chunk_offsets_it)
         : BaseIndexedIterator<IndexedIterator, ColumnValue<T>>{chunk_offsets_it}, _values{values} {}
 
    private:
@@ -120,16 +129,16 @@ class ValueColumnIterable : public IndexableIterable<ValueColumnIterable<T>> {
     }
 
    private:
-    const ValueVector& _values;
+    const ValueIterator _values;
   };
 
   class NullableIndexedIterator : public BaseIndexedIterator<NullableIndexedIterator, NullableColumnValue<T>> {
    public:
-    using ValueVector = pmr_concurrent_vector<T>;
-    using NullValueVector = pmr_concurrent_vector<bool>;
+    using ValueIterator = const T*;
+    using NullValueIterator = const bool*;
 
    public:
-    explicit NullableIndexedIterator(const ValueVector& values, const NullValueVector& null_values,
+    explicit NullableIndexedIterator(const ValueIterator values, const NullValueIterator null_values,
                                      const ChunkOffsetsIterator& chunk_offsets_it)
         : BaseIndexedIterator<NullableIndexedIterator, NullableColumnValue<T>>{chunk_offsets_it},
           _values{values},
@@ -149,8 +158,8 @@ class ValueColumnIterable : public IndexableIterable<ValueColumnIterable<T>> {
     }
 
    private:
-    const ValueVector& _values;
-    const NullValueVector& _null_values;
+    const ValueIterator _values;
+    const NullValueIterator _null_values;
   };
 };
 
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+/**
+ * MappedVector is the contiguous storage of dictionaries and attribute vectors. It either owns its values in a
+ * pmr_vector, or it references values that lie in a MemoryMappedFile, which is kept alive by the vector. The latter
+ * allows ImportBinary to load columns without copying them (see ExportBinary for the file format).
+ *
+ * Owned values can be modified in place, but the size of a MappedVector is fixed. Mapped values are read-only.
+ */
+template <typename T>
+class MappedVector {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be mapped from a file.");
+
+ public:
+  using value_type = T;
+  using allocator_type = PolymorphicAllocator<T>;
+  using size_type = size_t;
+  using const_reference = const T&;
+  using const_pointer = const T*;
+  using const_iterator = const T*;
+  using iterator = const_iterator;
+
+  explicit MappedVector(const allocator_type& alloc = {}) : _values(alloc) {}
+
+  explicit MappedVector(pmr_vector<T>&& values) : _values(std::move(values)) { _update_data(); }
+
+  // References `size` values starting at `data`, which must lie within the mapped file
+  MappedVector(std::shared_ptr<const MemoryMappedFile> file, const T* data, const size_t size)
+      : _file(std::move(file)), _data(data), _size(size) {
+    DebugAssert(_file != nullptr, "Mapped values need a file.");
+    DebugAssert(reinterpret_cast<const char*>(data) >= _file->data() &&
+                    reinterpret_cast<const char*>(data + size) <= _file->data() + _file->size(),
+                "Mapped values must lie within the file.");
+  }
+
+  // Copies always own their values, so this can be used to move mapped values into memory (e.g., of a NUMA node)
+  MappedVector(const MappedVector& other, const allocator_type& alloc)
+      : _values(other.cbegin(), other.cend(), alloc) {
+    _update_data();
+  }
+
+  MappedVector(const MappedVector& other) : _values(other._values), _file(other._file) {
+    if (_file) {
+      _data = other._data;
+      _size = other._size;
+    } else {
+      _update_data();
+    }
+  }
+
+  MappedVector(MappedVector&& other) noexcept
+      : _values(std::move(other._values)), _file(std::move(other._file)), _data(other._data), _size(other._size) {
+    if (!_file) _update_data();
+    other._data = nullptr;
+    other._size = 0u;
+  }
+
+  MappedVector& operator=(MappedVector other) noexcept {
+    // Moving the pmr_vector might copy its values if the allocators differ, so _data is updated afterwards
+    _values = std::move(other._values);
+    _file = std::move(other._file);
+    _data = other._data;
+    _size = other._size;
+    if (!_file) _update_data();
+    return *this;
+  }
+
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0u; }
+
+  const T& operator[](const size_t index) const { return _data[index]; }
+
+  void set(const size_t index, const T& value) {
+    DebugAssert(!is_mapped(), "Mapped values are read-only.");
+    _values[index] = value;
+  }
+
+  const T& front() const { return _data[0]; }
+  const T& back() const { return _data[_size - 1u]; }
+
+  const T* data() const { return _data; }
+
+  const_iterator begin() const { return _data; }
+  const_iterator end() const { return _data + _size; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  // Returns whether the values reference a mapped file instead of being owned
+  bool is_mapped() const { return _file != nullptr; }
+
+  allocator_type get_allocator() const { return _values.get_allocator(); }
+
+ private:
+  void _update_data() {
+    _data = _values.data();
+    _size = _values.size();
+  }
+
+  pmr_vector<T> _values;
+  std::shared_ptr<const MemoryMappedFile> _file;
+
+  // Point to either _values or the mapped file
+  const T* _data = nullptr;
+  size_t _size = 0u;
+};
+
+}  // namespace opossum
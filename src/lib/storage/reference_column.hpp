@@ -8,7 +8,9 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "base_encoded_column.hpp"
 #include "dictionary_column.hpp"
+#include "resolve_encoded_column_type.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -63,7 +65,14 @@ class ReferenceColumn : public BaseColumn {
         continue;
       }
 
-      Fail("column is no dictionary or value column");
+      if (auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column)) {
+        resolve_encoded_column_type<T>(*encoded_column, [&](const auto& typed_column) {
+          values.push_back(typed_column.get_typed_value(row.chunk_offset));
+        });
+        continue;
+      }
+
+      Fail("column is no dictionary, encoded, or value column");
     }
 
     return values;
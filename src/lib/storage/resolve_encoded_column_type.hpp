@@ -0,0 +1,62 @@
+#pragma once
+
+#include <type_traits>
+
+#include "base_encoded_column.hpp"
+#include "encoding_type.hpp"
+#include "frame_of_reference_column.hpp"
+#include "run_length_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename In, typename Out>
+using ConstOutIfConstIn = std::conditional_t<std::is_const<In>::value, const Out, Out>;
+
+/**
+ * Given a BaseEncodedColumn and its known column type, resolve the encoded column implementation
+ * by its encoding type and call the lambda
+ *
+ * @param func is a generic lambda or similar accepting a reference to a specialized encoded column
+ *
+ * Note: FrameOfReferenceColumn only exists for int and long, i.e., func is never called with it for other types.
+ *
+ *
+ * Example:
+ *
+ *   template <typename T>
+ *   void process_column(const RunLengthColumn<T>& column);
+ *
+ *   template <typename T>
+ *   void process_column(const FrameOfReferenceColumn<T>& column);
+ *
+ *   resolve_encoded_column_type<T>(base_encoded_column, [&](const auto& typed_column) {
+ *     process_column(typed_column);
+ *   });
+ */
+template <typename ColumnDataType, typename BaseEncodedColumnType, typename Functor>
+// BaseEncodedColumnType allows column to be const and non-const
+std::enable_if_t<std::is_same<BaseEncodedColumn, std::remove_const_t<BaseEncodedColumnType>>::value>
+    /*void*/ resolve_encoded_column_type(BaseEncodedColumnType& column, const Functor& func) {
+  using RunLengthColumnRef = ConstOutIfConstIn<BaseEncodedColumnType, RunLengthColumn<ColumnDataType>>&;
+
+  switch (column.encoding_type()) {
+    case EncodingType::RunLength:
+      func(static_cast<RunLengthColumnRef>(column));
+      return;
+
+    case EncodingType::FrameOfReference:
+      if constexpr (std::is_integral<ColumnDataType>::value) {
+        using FrameOfReferenceColumnRef =
+            ConstOutIfConstIn<BaseEncodedColumnType, FrameOfReferenceColumn<ColumnDataType>>&;
+        func(static_cast<FrameOfReferenceColumnRef>(column));
+        return;
+      }
+      Fail("Frame-of-reference encoding is only supported for int and long columns.");
+
+    default:
+      Fail("Unrecognized encoding type encountered.");
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include "run_length_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthColumn<T>::RunLengthColumn(const std::shared_ptr<const pmr_vector<T>>& values,
+                                    const std::shared_ptr<const pmr_vector<bool>>& null_values,
+                                    const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions)
+    : _values{values}, _null_values{null_values}, _end_positions{end_positions} {
+  DebugAssert(_values->size() == _null_values->size() && _values->size() == _end_positions->size(),
+              "Number of values, null values, and end positions must be equal.");
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> RunLengthColumn<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<bool>> RunLengthColumn<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<ChunkOffset>> RunLengthColumn<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+const AllTypeVariant RunLengthColumn<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto value = get_typed_value(chunk_offset);
+  if (!value) return NULL_VALUE;
+
+  return *value;
+}
+
+template <typename T>
+bool RunLengthColumn<T>::is_null(const ChunkOffset chunk_offset) const {
+  return (*_null_values)[run_index(chunk_offset)];
+}
+
+template <typename T>
+const T RunLengthColumn<T>::get(const ChunkOffset chunk_offset) const {
+  const auto index = run_index(chunk_offset);
+
+  DebugAssert(!(*_null_values)[index], "Value at index " + std::to_string(chunk_offset) + " is null.");
+
+  return (*_values)[index];
+}
+
+template <typename T>
+std::optional<T> RunLengthColumn<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  const auto index = run_index(chunk_offset);
+
+  if ((*_null_values)[index]) return std::nullopt;
+
+  return (*_values)[index];
+}
+
+template <typename T>
+const pmr_concurrent_vector<std::optional<T>> RunLengthColumn<T>::materialize_values() const {
+  pmr_concurrent_vector<std::optional<T>> values(size(), std::nullopt, _values->get_allocator());
+
+  auto run_begin = ChunkOffset{0u};
+  for (auto index = size_t{0u}; index < run_count(); ++index) {
+    const auto run_end = (*_end_positions)[index];
+
+    if (!(*_null_values)[index]) {
+      std::fill(values.begin() + run_begin, values.begin() + run_end + 1u, (*_values)[index]);
+    }
+
+    run_begin = run_end + 1u;
+  }
+
+  return values;
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::run_index(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto end_position_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
+  return static_cast<size_t>(std::distance(_end_positions->cbegin(), end_position_it));
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::size() const {
+  if (_end_positions->empty()) return 0u;
+  return _end_positions->back() + 1u;
+}
+
+template <typename T>
+EncodingType RunLengthColumn<T>::encoding_type() const {
+  return EncodingType::RunLength;
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> RunLengthColumn<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  pmr_vector<T> new_values(*_values, alloc);
+  pmr_vector<bool> new_null_values(*_null_values, alloc);
+  pmr_vector<ChunkOffset> new_end_positions(*_end_positions, alloc);
+
+  return std::allocate_shared<RunLengthColumn<T>>(
+      alloc, std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_values)),
+      std::allocate_shared<pmr_vector<bool>>(alloc, std::move(new_null_values)),
+      std::allocate_shared<pmr_vector<ChunkOffset>>(alloc, std::move(new_end_positions)));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthColumn);
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_encoded_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * RunLengthColumn is an encoded column that stores consecutive equal values (a run) only once.
+ * It works best on sorted or low-cardinality data, such as dates in a clustered table or status flags.
+ *
+ * For every run i, the column stores
+ *  - values[i]: the value of the run (T{} if the run consists of null values)
+ *  - null_values[i]: whether the run consists of null values
+ *  - end_positions[i]: the chunk offset of the last row of the run (inclusive)
+ *
+ * end_positions is sorted, so the run of a given chunk offset can be found using binary search.
+ */
+template <typename T>
+class RunLengthColumn : public BaseEncodedColumn {
+ public:
+  explicit RunLengthColumn(const std::shared_ptr<const pmr_vector<T>>& values,
+                           const std::shared_ptr<const pmr_vector<bool>>& null_values,
+                           const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions);
+
+  std::shared_ptr<const pmr_vector<T>> values() const;
+  std::shared_ptr<const pmr_vector<bool>> null_values() const;
+  std::shared_ptr<const pmr_vector<ChunkOffset>> end_positions() const;
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // returns whether a value is NULL
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // return the value at a certain position.
+  // Only use if you are certain that no null values are present, otherwise an Assert fails.
+  const T get(const ChunkOffset chunk_offset) const;
+
+  // return the value at a certain position or std::nullopt if it is NULL
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // return a generated vector of all values (or nulls)
+  const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
+
+  // returns the index of the run that contains chunk_offset
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  // returns the number of runs
+  size_t run_count() const;
+
+  size_t size() const final;
+
+  EncodingType encoding_type() const final;
+
+  // Copies a RunLengthColumn using a new allocator. This is useful for placing it on a new NUMA node.
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+ protected:
+  const std::shared_ptr<const pmr_vector<T>> _values;
+  const std::shared_ptr<const pmr_vector<bool>> _null_values;
+  const std::shared_ptr<const pmr_vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "base_value_column.hpp"
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -48,9 +49,11 @@ bool Table::layouts_equal(const std::shared_ptr<const Table>& left, const std::s
 }
 
 Table::Table(const uint32_t max_chunk_size)
-    : _max_chunk_size(max_chunk_size), _append_mutex(std::make_unique<std::mutex>()) {
+    : _max_chunk_size(max_chunk_size),
+      _append_mutex(std::make_unique<std::mutex>()),
+      _column_write_mutex(std::make_unique<std::shared_mutex>()) {
   Assert(max_chunk_size > 0, "Table must have a chunk size greater than 0.");
-  _chunks.push_back(std::make_shared<Chunk>(ChunkUseMvcc::Yes));
+  _append_chunk(std::make_shared<Chunk>(ChunkUseMvcc::Yes));
 }
 
 void Table::add_column_definition(const std::string& name, DataType data_type, bool nullable) {
@@ -64,16 +67,19 @@ void Table::add_column_definition(const std::string& name, DataType data_type, b
 void Table::add_column(const std::string& name, DataType data_type, bool nullable) {
   add_column_definition(name, data_type, nullable);
 
-  for (auto& chunk : _chunks) {
-    chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(data_type, nullable));
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    get_chunk(chunk_id)->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(data_type, nullable, size_t{0}));
   }
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  // TODO(Anyone): Chunks should be preallocated for chunk size
-  if (_chunks.back()->size() == _max_chunk_size) create_new_chunk();
+  auto append_lock = acquire_append_mutex();
 
-  _chunks.back()->append(values);
+  if (get_chunk(ChunkID{chunk_count() - 1u})->size() == _max_chunk_size) create_new_chunk();
+
+  const auto chunk_id = ChunkID{chunk_count() - 1u};
+  reserve_chunk_capacity(chunk_id, get_chunk(chunk_id)->size() + 1u);
+  get_chunk(chunk_id)->append(values);
 }
 
 void Table::create_new_chunk() {
@@ -84,22 +90,48 @@ void Table::create_new_chunk() {
     const auto type = _column_types[column_id];
     auto nullable = _column_nullable[column_id];
 
-    new_chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(type, nullable));
+    new_chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(type, nullable, size_t{0}));
+  }
+  _append_chunk(std::move(new_chunk));
+}
+
+void Table::reserve_chunk_capacity(const ChunkID chunk_id, const size_t row_count) {
+  Assert(row_count <= _max_chunk_size, "Cannot reserve more rows than fit into a chunk.");
+
+  const auto chunk = get_chunk(chunk_id);
+
+  auto capacity = std::numeric_limits<size_t>::max();
+  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(chunk->get_column(column_id));
+    Assert(value_column, "Only the value columns of mutable chunks can grow.");
+    capacity = std::min(capacity, value_column->capacity());
+  }
+
+  if (chunk->column_count() == 0u || row_count <= capacity) return;
+
+  // Growing in doubling steps keeps the copying linear in the number of appended rows
+  const auto new_capacity = std::min(std::max(row_count, 2u * capacity), static_cast<size_t>(_max_chunk_size));
+
+  std::unique_lock<std::shared_mutex> column_write_lock(*_column_write_mutex);
+  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto value_column = std::static_pointer_cast<const BaseValueColumn>(chunk->get_column(column_id));
+    if (value_column->capacity() >= new_capacity) continue;
+
+    chunk->replace_column(column_id, value_column->copy_with_capacity(new_capacity));
   }
-  _chunks.push_back(std::move(new_chunk));
 }
 
 uint16_t Table::column_count() const { return _column_types.size(); }
 
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
-  for (const auto& chunk : _chunks) {
-    ret += chunk->size();
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    ret += get_chunk(chunk_id)->size();
   }
   return ret;
 }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+ChunkID Table::chunk_count() const { return ChunkID{_chunk_count.load(std::memory_order_acquire)}; }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   for (ColumnID column_id{0}; column_id < column_count(); ++column_id) {
@@ -135,45 +167,123 @@ const std::vector<DataType>& Table::column_types() const { return _column_types;
 const std::vector<bool>& Table::column_nullables() const { return _column_nullable; }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return _load_chunk(chunk_id);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return _load_chunk(chunk_id);
 }
 
 ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return ProxyChunk(_load_chunk(chunk_id));
 }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return ProxyChunk(_load_chunk(chunk_id));
 }
 
 void Table::emplace_chunk(const std::shared_ptr<Chunk>& chunk) {
-  if (_chunks.size() == 1 && (_chunks.back()->column_count() == 0 || _chunks.back()->size() == 0)) {
-    // the initial chunk was not used yet
-    _chunks.clear();
-  }
   DebugAssert(chunk->column_count() > 0, "Trying to add chunk without columns.");
   DebugAssert(chunk->column_count() == column_count(),
               std::string("adding chunk with ") + std::to_string(chunk->column_count()) + " columns to table with " +
                   std::to_string(column_count()) + " columns");
-  _chunks.emplace_back(chunk);
+
+  if (chunk_count() == 1) {
+    const auto first_chunk = get_chunk(ChunkID{0});
+    if (first_chunk->column_count() == 0 || first_chunk->size() == 0) {
+      // the initial chunk was not used yet
+      _set_chunk(_chunk_slot(ChunkID{0}), chunk);
+      return;
+    }
+  }
+
+  _append_chunk(chunk);
+}
+
+void Table::remove_chunk(const ChunkID chunk_id) {
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+
+  auto empty_chunk = std::make_shared<Chunk>(ChunkUseMvcc::Yes);
+  for (ColumnID column_id{0}; column_id < column_count(); ++column_id) {
+    empty_chunk->add_column(
+        make_shared_by_data_type<BaseColumn, ValueColumn>(_column_types[column_id], _column_nullable[column_id]));
+  }
+
+  // create_new_chunk() also writes _chunk_references
+  auto append_lock = acquire_append_mutex();
+  _set_chunk(_chunk_slot(chunk_id), std::move(empty_chunk));
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
+std::shared_lock<std::shared_mutex> Table::acquire_column_write_lock() {
+  return std::shared_lock<std::shared_mutex>(*_column_write_mutex);
+}
+
+void Table::add_snapshot_pin(const SnapshotPin& snapshot_pin) {
+  if (!snapshot_pin.is_pinned()) return;
+
+  const auto snapshot_commit_id = snapshot_pin.snapshot_commit_id();
+  const auto is_pinned = std::any_of(_snapshot_pins.cbegin(), _snapshot_pins.cend(), [&](const auto& pin) {
+    return pin.snapshot_commit_id() == snapshot_commit_id;
+  });
+  if (is_pinned) return;
+
+  _snapshot_pins.emplace_back(snapshot_pin.copy());
+}
+
+const std::vector<SnapshotPin>& Table::snapshot_pins() const { return _snapshot_pins; }
+
+Table::ChunkSlot& Table::_chunk_slot(const ChunkID chunk_id) const {
+  const auto index = uint64_t{chunk_id} + 1u;
+  const auto block = static_cast<size_t>(63 - __builtin_clzll(index));
+  return _chunk_blocks[block][index - (uint64_t{1} << block)];
+}
+
+std::shared_ptr<Chunk> Table::_load_chunk(const ChunkID chunk_id) const {
+  const auto& slot = _chunk_slot(chunk_id);
+
+  // If remove_chunk() replaced and released the chunk after its reference was loaded, the replacement is loaded next
+  auto chunk = std::shared_ptr<Chunk>{};
+  while (!chunk) {
+    chunk = slot.chunk.load(std::memory_order_acquire)->lock();
+  }
+  return chunk;
+}
+
+void Table::_append_chunk(std::shared_ptr<Chunk> chunk) {
+  const auto chunk_id = ChunkID{_chunk_count.load(std::memory_order_relaxed)};
+  Assert(chunk_id < std::numeric_limits<ChunkID::base_type>::max(), "Table cannot hold more chunks.");
+
+  const auto index = uint64_t{chunk_id} + 1u;
+  const auto block = static_cast<size_t>(63 - __builtin_clzll(index));
+  if (!_chunk_blocks[block]) _chunk_blocks[block] = std::make_unique<ChunkSlot[]>(size_t{1} << block);
+
+  _set_chunk(_chunk_slot(chunk_id), std::move(chunk));
+
+  // Readers that see the new chunk count also see the slot of the chunk
+  _chunk_count.store(chunk_id + 1u, std::memory_order_release);
+}
+
+void Table::_set_chunk(ChunkSlot& slot, std::shared_ptr<Chunk> chunk) {
+  auto reference = std::make_unique<const std::weak_ptr<Chunk>>(chunk);
+  slot.chunk.store(reference.get(), std::memory_order_release);
+  _chunk_references.emplace_back(std::move(reference));
+
+  // The previous chunk, if any, is released once no reader holds it anymore
+  slot.owner = std::move(chunk);
+}
+
 TableType Table::get_type() const {
   // Cannot answer this if the table has no content
-  Assert(!_chunks.empty() && column_count() > 0, "Table has no content, can't specify type");
+  Assert(chunk_count() > 0 && column_count() > 0, "Table has no content, can't specify type");
 
   // We assume if one column is a reference column, all are.
-  const auto column = _chunks[0]->get_column(ColumnID{0});
+  const auto column = get_chunk(ChunkID{0})->get_column(ColumnID{0});
   const auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
 
   if (ref_column != nullptr) {
@@ -181,7 +291,7 @@ TableType Table::get_type() const {
 #if IS_DEBUG
     for (auto chunk_idx = ChunkID{0}; chunk_idx < chunk_count(); ++chunk_idx) {
       for (auto column_idx = ColumnID{0}; column_idx < column_count(); ++column_idx) {
-        const auto column2 = _chunks[chunk_idx]->get_column(ColumnID{column_idx});
+        const auto column2 = get_chunk(chunk_idx)->get_column(ColumnID{column_idx});
         const auto ref_column2 = std::dynamic_pointer_cast<const ReferenceColumn>(column);
         DebugAssert(ref_column2 != nullptr, "Invalid table: Contains Reference and Non-Reference Columns");
       }
@@ -193,7 +303,7 @@ TableType Table::get_type() const {
 #if IS_DEBUG
     for (auto chunk_idx = ChunkID{0}; chunk_idx < chunk_count(); ++chunk_idx) {
       for (auto column_idx = ColumnID{0}; column_idx < column_count(); ++column_idx) {
-        const auto column2 = _chunks[chunk_idx]->get_column(ColumnID{column_idx});
+        const auto column2 = get_chunk(chunk_idx)->get_column(ColumnID{column_idx});
         const auto ref_column2 = std::dynamic_pointer_cast<const ReferenceColumn>(column);
         DebugAssert(ref_column2 == nullptr, "Invalid table: Contains Reference and Non-Reference Columns");
       }
@@ -1,13 +1,17 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "proxy_chunk.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -35,11 +39,6 @@ class Table : private Noncopyable {
   // default is the maximum allowed chunk size. A table holds always at least one chunk
   explicit Table(const uint32_t max_chunk_size = Chunk::MAX_SIZE);
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Table(Table&&) = default;
-  Table& operator=(Table&&) = default;
-
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
 
@@ -51,7 +50,7 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
+  // returns the chunk with the given id. Does not take a lock, so chunks can be read while others are appended.
   std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
   std::shared_ptr<const Chunk> get_chunk(ChunkID chunk_id) const;
   ProxyChunk get_chunk_with_access_counting(ChunkID chunk_id);
@@ -60,6 +59,15 @@ class Table : private Noncopyable {
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
   void emplace_chunk(const std::shared_ptr<Chunk>& chunk);
 
+  /**
+   * Atomically replaces the chunk with an empty one without blocking readers. Its memory is released once no operator
+   * holds it anymore. The ChunkIDs, and thus the RowIDs of other chunks, stay the same. The chunk must not contain rows
+   * that are visible to any transaction, and RowIDs pointing into it must not be dereferenced afterwards (see
+   * MvccGarbageCollector and add_snapshot_pin()). Takes the append mutex, because it must not run concurrently with
+   * create_new_chunk().
+   */
+  void remove_chunk(const ChunkID chunk_id);
+
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
@@ -93,7 +101,7 @@ class Table : private Noncopyable {
   void add_column(const std::string& name, DataType data_type, bool nullable = false);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and should be used for testing purposes only. Rows are not visible to transactions.
   void append(std::vector<AllTypeVariant> values);
 
   // returns one materialized value
@@ -107,7 +115,8 @@ class Table : private Noncopyable {
     Assert(column_id < column_count(), "column_id invalid");
 
     size_t row_counter = 0u;
-    for (auto& chunk : _chunks) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
       size_t current_size = chunk->size();
       row_counter += current_size;
       if (row_counter > row_number) {
@@ -118,10 +127,31 @@ class Table : private Noncopyable {
   }
 
   // creates a new chunk and appends it
+  // The value columns of the new chunk start without capacity, see reserve_chunk_capacity().
   void create_new_chunk();
 
+  /**
+   * The value columns of mutable chunks have a fixed capacity, so that readers and concurrent Inserts never see them
+   * reallocated (see AppendOnlyVector). This replaces the value columns of a chunk by copies that can hold at least
+   * `row_count` rows. The capacity at least doubles, but never exceeds max_chunk_size(). Readers keep using the old
+   * columns. Must be called with the append mutex held. Waits until no Insert writes to reserved rows anymore.
+   */
+  void reserve_chunk_capacity(const ChunkID chunk_id, const size_t row_count);
+
   std::unique_lock<std::mutex> acquire_append_mutex();
 
+  // Held by Inserts while they write to the rows they reserved, so that reserve_chunk_capacity() does not copy the
+  // columns before the writes are done. Must be acquired with the append mutex held.
+  std::shared_lock<std::shared_mutex> acquire_column_write_lock();
+
+  /**
+   * The ReferenceColumns of a result table can point into chunks that the MvccGarbageCollector removes once no snapshot
+   * can read them anymore. A result table therefore keeps the snapshots it was read under registered as active for as
+   * long as it exists. AbstractOperator::execute() adds the pins, so they must not be added while the table is read.
+   */
+  void add_snapshot_pin(const SnapshotPin& snapshot_pin);
+  const std::vector<SnapshotPin>& snapshot_pins() const;
+
   void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
 
   std::shared_ptr<TableStatistics> table_statistics() { return _table_statistics; }
@@ -135,8 +165,34 @@ class Table : private Noncopyable {
   TableType get_type() const;
 
  protected:
+  /**
+   * The slot of a chunk references it through a weak_ptr, so that remove_chunk() can replace the chunk by atomically
+   * replacing that pointer, while `owner` keeps the chunk alive. The weak_ptrs of replaced chunks are kept in
+   * _chunk_references until the table is destroyed, so that readers that still load them are safe. The replaced chunk
+   * itself is released once no reader holds it anymore.
+   */
+  struct ChunkSlot {
+    std::atomic<const std::weak_ptr<Chunk>*> chunk{nullptr};
+    std::shared_ptr<Chunk> owner;
+  };
+
+  // Block b holds the 2^b slots starting at ChunkID 2^b - 1, which is enough for all ChunkIDs
+  static constexpr size_t CHUNK_BLOCK_COUNT = 32u;
+
+  ChunkSlot& _chunk_slot(const ChunkID chunk_id) const;
+  std::shared_ptr<Chunk> _load_chunk(const ChunkID chunk_id) const;
+
+  // Writes a chunk to the next slot and then publishes it. Writers must be synchronized externally.
+  void _append_chunk(std::shared_ptr<Chunk> chunk);
+  void _set_chunk(ChunkSlot& slot, std::shared_ptr<Chunk> chunk);
+
   const uint32_t _max_chunk_size;
-  std::vector<std::shared_ptr<Chunk>> _chunks;
+
+  // Chunks are appended without moving the slots of existing chunks, and readers do not need to synchronize with
+  // writers beyond reading _chunk_count. Blocks are allocated before the first chunk in them is published.
+  std::array<std::unique_ptr<ChunkSlot[]>, CHUNK_BLOCK_COUNT> _chunk_blocks;
+  std::atomic<ChunkID::base_type> _chunk_count{0u};
+  std::vector<std::unique_ptr<const std::weak_ptr<Chunk>>> _chunk_references;
 
   // these should be const strings, but having a vector of const values is a C++17 feature
   // that is not yet completely implemented in all compilers
@@ -147,5 +203,9 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
 
   std::unique_ptr<std::mutex> _append_mutex;
+  std::unique_ptr<std::shared_mutex> _column_write_mutex;
+
+  // Holds one pin per snapshot commit id
+  std::vector<SnapshotPin> _snapshot_pins;
 };
 }  // namespace opossum
@@ -14,21 +14,46 @@
 
 namespace opossum {
 
+namespace {
+
+// Copies the values into a new vector with room for `capacity` elements
+template <typename T>
+AppendOnlyVector<T> copy_values(const AppendOnlyVector<T>& values, const size_t capacity, const bool fix_capacity,
+                                const PolymorphicAllocator<T>& alloc) {
+  auto copy = AppendOnlyVector<T>{alloc};
+  if (fix_capacity) {
+    copy.fix_capacity(capacity);
+  } else {
+    copy.reserve(capacity);
+  }
+
+  for (const auto& value : values) copy.push_back(value);
+  return copy;
+}
+
+}  // namespace
+
 template <typename T>
 ValueColumn<T>::ValueColumn(bool nullable) {
-  if (nullable) _null_values = pmr_concurrent_vector<bool>();
+  if (nullable) _null_values.emplace();
 }
 
 template <typename T>
 ValueColumn<T>::ValueColumn(const PolymorphicAllocator<T>& alloc, bool nullable) : _values(alloc) {
-  if (nullable) _null_values = pmr_concurrent_vector<bool>(alloc);
+  if (nullable) _null_values.emplace(alloc);
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(bool nullable, size_t capacity) : ValueColumn(nullable) {
+  _values.fix_capacity(capacity);
+  if (nullable) _null_values->fix_capacity(capacity);
 }
 
 template <typename T>
-ValueColumn<T>::ValueColumn(pmr_concurrent_vector<T>&& values) : _values(std::move(values)) {}
+ValueColumn<T>::ValueColumn(AppendOnlyVector<T>&& values) : _values(std::move(values)) {}
 
 template <typename T>
-ValueColumn<T>::ValueColumn(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values)
+ValueColumn<T>::ValueColumn(AppendOnlyVector<T>&& values, AppendOnlyVector<bool>&& null_values)
     : _values(std::move(values)), _null_values(std::move(null_values)) {}
 
 template <typename T>
@@ -94,12 +119,12 @@ void ValueColumn<std::string>::append(const AllTypeVariant& val) {
 }
 
 template <typename T>
-const pmr_concurrent_vector<T>& ValueColumn<T>::values() const {
+const AppendOnlyVector<T>& ValueColumn<T>::values() const {
   return _values;
 }
 
 template <typename T>
-pmr_concurrent_vector<T>& ValueColumn<T>::values() {
+AppendOnlyVector<T>& ValueColumn<T>::values() {
   return _values;
 }
 
@@ -121,14 +146,14 @@ bool ValueColumn<T>::is_nullable() const {
 }
 
 template <typename T>
-const pmr_concurrent_vector<bool>& ValueColumn<T>::null_values() const {
+const AppendOnlyVector<bool>& ValueColumn<T>::null_values() const {
   DebugAssert(is_nullable(), "This ValueColumn does not support null values.");
 
   return *_null_values;
 }
 
 template <typename T>
-pmr_concurrent_vector<bool>& ValueColumn<T>::null_values() {
+AppendOnlyVector<bool>& ValueColumn<T>::null_values() {
   DebugAssert(is_nullable(), "This ValueColumn does not support null values.");
 
   return *_null_values;
@@ -139,6 +164,11 @@ size_t ValueColumn<T>::size() const {
   return _values.size();
 }
 
+template <typename T>
+size_t ValueColumn<T>::capacity() const {
+  return _values.capacity();
+}
+
 template <typename T>
 void ValueColumn<T>::visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVisitableContext> context) const {
   visitable.handle_value_column(*this, std::move(context));
@@ -146,15 +176,31 @@ void ValueColumn<T>::visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVis
 
 template <typename T>
 std::shared_ptr<BaseColumn> ValueColumn<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
-  pmr_concurrent_vector<T> new_values(_values, alloc);
+  // Keep the capacity so that a copied mutable chunk can still be inserted into.
+  const auto fix_capacity = _values.has_fixed_capacity();
+  auto new_values = copy_values(_values, _values.capacity(), fix_capacity, PolymorphicAllocator<T>{alloc});
   if (is_nullable()) {
-    pmr_concurrent_vector<bool> new_null_values(*_null_values, alloc);
+    auto new_null_values =
+        copy_values(*_null_values, _values.capacity(), fix_capacity, PolymorphicAllocator<bool>{alloc});
     return std::allocate_shared<ValueColumn<T>>(alloc, std::move(new_values), std::move(new_null_values));
   } else {
     return std::allocate_shared<ValueColumn<T>>(alloc, std::move(new_values));
   }
 }
 
+template <typename T>
+std::shared_ptr<BaseValueColumn> ValueColumn<T>::copy_with_capacity(const size_t capacity) const {
+  DebugAssert(capacity >= size(), "Capacity is too small for the values of the column.");
+
+  auto new_values = copy_values(_values, capacity, true, _values.get_allocator());
+  if (is_nullable()) {
+    auto new_null_values = copy_values(*_null_values, capacity, true, _null_values->get_allocator());
+    return std::make_shared<ValueColumn<T>>(std::move(new_values), std::move(new_null_values));
+  } else {
+    return std::make_shared<ValueColumn<T>>(std::move(new_values));
+  }
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueColumn);
 
 }  // namespace opossum
@@ -6,20 +6,26 @@
 #include <utility>
 #include <vector>
 
+#include "append_only_vector.hpp"
 #include "base_value_column.hpp"
 
 namespace opossum {
 
-// ValueColumn is a specific column type that stores all its values in a vector.
+// ValueColumn is a specific column type that stores all its values in a contiguous vector.
+// Null values are tracked in a separate vector of flags that is only allocated for nullable columns.
 template <typename T>
 class ValueColumn : public BaseValueColumn {
  public:
   explicit ValueColumn(bool nullable = false);
   explicit ValueColumn(const PolymorphicAllocator<T>& alloc, bool nullable = false);
 
+  // Create an empty ValueColumn for a mutable chunk of a table. It can hold `capacity` values and never reallocates,
+  // so that it can be read while Inserts write to it (see AppendOnlyVector::fix_capacity()).
+  explicit ValueColumn(bool nullable, size_t capacity);
+
   // Create a ValueColumn with the given values.
-  explicit ValueColumn(pmr_concurrent_vector<T>&& values);
-  explicit ValueColumn(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values);
+  explicit ValueColumn(AppendOnlyVector<T>&& values);
+  explicit ValueColumn(AppendOnlyVector<T>&& values, AppendOnlyVector<bool>&& null_values);
 
   // Return the value at a certain position. If you want to write efficient operators, back off!
   // Use values() and null_values() to get the vectors and check the content yourself.
@@ -38,8 +44,8 @@ class ValueColumn : public BaseValueColumn {
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
-  const pmr_concurrent_vector<T>& values() const;
-  pmr_concurrent_vector<T>& values();
+  const AppendOnlyVector<T>& values() const;
+  AppendOnlyVector<T>& values();
 
   // return a generated vector of all values (or nulls)
   const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
@@ -51,12 +57,17 @@ class ValueColumn : public BaseValueColumn {
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
   // Usually you need to access more than a single value anyway.
-  const pmr_concurrent_vector<bool>& null_values() const final;
-  pmr_concurrent_vector<bool>& null_values() final;
+  const AppendOnlyVector<bool>& null_values() const final;
+  AppendOnlyVector<bool>& null_values() final;
 
   // Return the number of entries in the column.
   size_t size() const override;
 
+  // Return the number of entries the column can hold without reallocating its vectors.
+  size_t capacity() const final;
+
+  std::shared_ptr<BaseValueColumn> copy_with_capacity(const size_t capacity) const final;
+
   // Visitor pattern, see base_column.hpp
   void visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVisitableContext> context = nullptr) const override;
 
@@ -64,11 +75,11 @@ class ValueColumn : public BaseValueColumn {
   std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
 
  protected:
-  pmr_concurrent_vector<T> _values;
+  AppendOnlyVector<T> _values;
 
   // While a ValueColumn knows if it is nullable or not by looking at this optional, a DictionaryColumn does not.
   // For this reason, we need to store the nullable information separately in the table's definition.
-  std::optional<pmr_concurrent_vector<bool>> _null_values;
+  std::optional<AppendOnlyVector<bool>> _null_values;
 };
 
 }  // namespace opossum
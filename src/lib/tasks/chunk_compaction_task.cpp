@@ -0,0 +1,65 @@
+#include "chunk_compaction_task.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkCompactionTask::ChunkCompactionTask(const std::string& table_name, const ChunkID chunk_id)
+    : _table_name{table_name}, _chunk_id{chunk_id} {}
+
+bool ChunkCompactionTask::succeeded() const { return _succeeded; }
+
+void ChunkCompactionTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  Assert(_chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+
+  const auto chunk = table->get_chunk(_chunk_id);
+  Assert(!chunk->get_cleanup_commit_id(), "Chunk has already been compacted.");
+
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (chunk_id != _chunk_id) excluded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  auto get_table = std::make_shared<GetTable>(_table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_excluded_chunk_ids(excluded_chunk_ids);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  // Chunks that consist of invisible rows only do not need to be updated
+  if (validate->get_output()->row_count() > 0u) {
+    auto update = std::make_shared<Update>(_table_name, validate, validate);
+    update->set_transaction_context(transaction_context);
+    update->execute();
+
+    if (update->execute_failed()) {
+      transaction_context->rollback();
+      return;
+    }
+  }
+
+  transaction_context->commit();
+
+  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+  _succeeded = true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Moves the visible rows of a chunk to the end of its table
+ *
+ * Deleted and updated rows stay in their chunk, because other transactions might still see them. Once a chunk
+ * consists mostly of such rows, this task compacts it in two steps. This task performs the first one: Within a
+ * transaction of its own, it updates all rows of the chunk that are visible to it with their current values. Like every
+ * Update, this invalidates the old versions and inserts the new ones at the end of the table. If the transaction
+ * commits, its commit id is set as the chunk's cleanup commit id - from then on, the chunk does not contain any row
+ * that new transactions can see. The second step, physically removing the chunk once no older transaction is active,
+ * is done by the MvccGarbageCollectionTask.
+ *
+ * If one of the rows is modified concurrently, the move conflicts and the transaction is rolled back. The chunk is
+ * left untouched then and can be compacted later.
+ *
+ * Only completed chunks (see ChunkCompressionTask) can be compacted, because their rows cannot change anymore except
+ * for being invalidated.
+ */
+class ChunkCompactionTask : public AbstractTask {
+ public:
+  explicit ChunkCompactionTask(const std::string& table_name, const ChunkID chunk_id);
+
+  // Returns true if the visible rows have been moved and the chunk has been marked for cleanup
+  bool succeeded() const;
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const ChunkID _chunk_id;
+  bool _succeeded = false;
+};
+}  // namespace opossum
@@ -13,11 +13,13 @@
 
 namespace opossum {
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
-    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           EncodingType encoding_type)
+    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}, encoding_type} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           EncodingType encoding_type)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _encoding_type{encoding_type} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
@@ -32,7 +34,7 @@ void ChunkCompressionTask::_on_execute() {
     DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    DictionaryCompression::compress_chunk(table->column_types(), chunk);
+    DictionaryCompression::compress_chunk(table->column_types(), chunk, _encoding_type);
   }
 }
 
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
@@ -13,8 +14,8 @@ class Chunk;
  * @brief Compresses a chunk of a table
  *
  * The task compresses a chunk by sequentially compressing columns.
- * From each value column, a dictionary column is created that replaces the
- * uncompressed column. The exchange is done atomically. Since this can
+ * From each value column, an encoded column (by default a dictionary column,
+ * see EncodingType) is created that replaces the uncompressed column. The exchange is done atomically. Since this can
  * happen during simultaneous access by transactions, operators need to be
  * designed such that they are aware that column types might change from
  * ValueColumn<T> to DictionaryColumn<T> during execution. Shared pointers
@@ -36,8 +37,10 @@ class Chunk;
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
-  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                EncodingType encoding_type = EncodingType::Dictionary);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                EncodingType encoding_type = EncodingType::Dictionary);
 
  protected:
   void _on_execute() override;
@@ -53,5 +56,6 @@ class ChunkCompressionTask : public AbstractTask {
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const EncodingType _encoding_type;
 };
 }  // namespace opossum
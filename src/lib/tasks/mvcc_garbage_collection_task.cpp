@@ -0,0 +1,73 @@
+#include "mvcc_garbage_collection_task.hpp"
+
+#include <memory>
+#include <string>
+
+#include "chunk_compaction_task.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// See ChunkCompressionTask::chunk_is_completed()
+bool chunk_is_completed(const Chunk& chunk, const uint32_t max_chunk_size) {
+  if (chunk.size() != max_chunk_size) return false;
+
+  const auto mvcc_columns = chunk.mvcc_columns();
+  for (const auto begin_cid : mvcc_columns->begin_cids) {
+    if (begin_cid == Chunk::MAX_COMMIT_ID) return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+MvccGarbageCollectionTask::MvccGarbageCollectionTask(const MvccGarbageCollector::Options& options)
+    : _options{options} {}
+
+double MvccGarbageCollectionTask::invalid_row_share(const Chunk& chunk, const CommitID commit_id) {
+  const auto mvcc_columns = chunk.mvcc_columns();
+  const auto row_count = mvcc_columns->end_cids.size();
+  if (row_count == 0u) return 0.0;
+
+  // Rolled back Inserts have an end cid of zero and are thus included
+  auto invalid_row_count = size_t{0u};
+  for (const auto end_cid : mvcc_columns->end_cids) {
+    if (end_cid <= commit_id) ++invalid_row_count;
+  }
+
+  return static_cast<double>(invalid_row_count) / row_count;
+}
+
+void MvccGarbageCollectionTask::_on_execute() {
+  const auto lowest_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    const auto table = StorageManager::get().get_table(table_name);
+
+    // The last chunk is still appended to. NULL_ROW_IDs refer to chunk 0, but are resolved without reading it, so
+    // chunk 0 is collected like any other chunk.
+    for (ChunkID chunk_id{0}; chunk_id + 1u < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk->has_mvcc_columns()) continue;
+
+      if (const auto cleanup_commit_id = chunk->get_cleanup_commit_id()) {
+        if (*cleanup_commit_id <= lowest_snapshot_commit_id) table->remove_chunk(chunk_id);
+        continue;
+      }
+
+      if (!chunk_is_completed(*chunk, table->max_chunk_size())) continue;
+
+      if (invalid_row_share(*chunk, lowest_snapshot_commit_id) > _options.invalid_row_share_threshold) {
+        ChunkCompactionTask{table_name, chunk_id}.execute();
+      }
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "concurrency/mvcc_garbage_collector.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * @brief Reclaims the space of rows that are invisible to all transactions
+ *
+ * A row is invisible to all current and future transactions once it has been deleted (or updated) at or before the
+ * lowest snapshot commit id of all active transactions. For each table in the StorageManager, the task
+ *
+ *  1. removes chunks that have been compacted by a ChunkCompactionTask at or before that commit id, i.e., that no
+ *     active transaction can read anymore (see Table::remove_chunk()), and
+ *  2. compacts completed chunks in which the share of such rows exceeds Options::invalid_row_share_threshold.
+ *
+ * Thus, compacted chunks are removed by the next run of the task that no older transaction overlaps with. The first
+ * chunk of each table is left alone: Table::emplace_chunk() replaces an empty first chunk, so removing it would shift
+ * the ChunkIDs of a table that is exported and imported again (e.g., by the checkpoints of the WriteAheadLog). The
+ * last chunk is left alone, as it still receives Inserts.
+ */
+class MvccGarbageCollectionTask : public AbstractTask {
+ public:
+  explicit MvccGarbageCollectionTask(const MvccGarbageCollector::Options& options);
+
+  // Returns the share of rows in `chunk` that were invalidated at or before `commit_id`
+  static double invalid_row_share(const Chunk& chunk, const CommitID commit_id);
+
+ protected:
+  void _on_execute() override;
+
+  const MvccGarbageCollector::Options _options;
+};
+}  // namespace opossum
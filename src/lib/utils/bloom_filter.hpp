@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "key_hash.hpp"
+#include "murmur_hash.hpp"
+
+namespace opossum {
+
+/*
+Approximate set membership test. may_contain() never returns false for an inserted value, but might return true for
+values that were never inserted. With BITS_PER_VALUE bits per expected value and HASH_COUNT hash functions, about
+1% of the lookups of absent values are false positives.
+Instead of HASH_COUNT independent hash functions, the bit positions are derived from two murmur hashes
+(Kirsch and Mitzenmacher, "Less Hashing, Same Performance: Building a Better Bloom Filter").
+*/
+template <typename T>
+class BloomFilter {
+ public:
+  static constexpr size_t BITS_PER_VALUE = 10;
+  static constexpr size_t HASH_COUNT = 7;
+
+  explicit BloomFilter(const size_t expected_value_count)
+      : _bits((std::max(expected_value_count, size_t{1u}) * BITS_PER_VALUE + 63u) / 64u, 0u) {}
+
+  void insert(const T& value) {
+    const auto [hash1, hash2] = _hash(value);
+    const auto bit_count = this->bit_count();
+
+    for (auto index = uint64_t{0u}; index < HASH_COUNT; ++index) {
+      const auto bit = (hash1 + index * hash2) % bit_count;
+      _bits[bit / 64u] |= uint64_t{1u} << (bit % 64u);
+    }
+  }
+
+  bool may_contain(const T& value) const {
+    const auto [hash1, hash2] = _hash(value);
+    const auto bit_count = this->bit_count();
+
+    for (auto index = uint64_t{0u}; index < HASH_COUNT; ++index) {
+      const auto bit = (hash1 + index * hash2) % bit_count;
+      if ((_bits[bit / 64u] & (uint64_t{1u} << (bit % 64u))) == 0u) return false;
+    }
+
+    return true;
+  }
+
+  size_t bit_count() const { return _bits.size() * 64u; }
+
+ protected:
+  static std::pair<uint64_t, uint64_t> _hash(const T& value) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      return {murmur_hash2(value.data(), static_cast<int>(value.size()), HASH_SEED_1),
+              murmur_hash2(value.data(), static_cast<int>(value.size()), HASH_SEED_2) | 1u};
+    } else {
+      const auto normalized_value = normalize_key_value(value);
+      return {murmur2<T>(normalized_value, HASH_SEED_1), murmur2<T>(normalized_value, HASH_SEED_2) | 1u};
+    }
+  }
+
+  static constexpr unsigned int HASH_SEED_1 = 17u;
+  static constexpr unsigned int HASH_SEED_2 = 41u;
+
+  std::vector<uint64_t> _bits;
+};
+
+}  // namespace opossum
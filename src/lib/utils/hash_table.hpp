@@ -0,0 +1,259 @@
+#pragma once
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "key_hash.hpp"
+#include "murmur_hash.hpp"
+#include "type_comparison.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/*
+Insert-only open-addressing hash table that maps values to the RowIDs they occur in. The HashTable is currently only
+used for HashJoins, where it is a temporary object built from one partition of the build relation and then probed.
+
+The slots are organized in groups of GROUP_SIZE. Each slot has a one-byte tag that either marks it as empty or holds
+seven bits of the hash of its value. A lookup hashes the value once, compares the tags of a whole group with the
+searched tag using a single SIMD comparison (SSE2, or a scalar loop if that is not available), and only compares the
+values of the slots whose tag matches. If the value is not found and the group has an empty slot, the value is not in
+the table. Otherwise, the search continues in the next group (linear probing). The table is never filled to more than
+7/8, so every search ends.
+
+Values are stored inline in the slots. All RowIDs of a value are stored contiguously in one vector, so duplicate values
+neither need an allocation of their own nor a pointer to be followed.
+
+Usage: put() all rows, call finalize() once, then look up values with get() or probe(). Lookups can run concurrently.
+*/
+template <typename T>
+class HashTable : private Noncopyable {
+ public:
+  static constexpr size_t GROUP_SIZE = 16;
+
+  // probe() hashes a batch of values and prefetches their groups before it searches the first one, so that the cache
+  // misses of the lookups overlap
+  static constexpr size_t PROBE_BATCH_SIZE = 16;
+
+  // The RowIDs of a value. Empty if the value is not in the table.
+  class RowIDRange {
+   public:
+    RowIDRange(const RowID* begin, const RowID* end) : _begin(begin), _end(end) {}
+
+    const RowID* begin() const { return _begin; }
+    const RowID* end() const { return _end; }
+    bool empty() const { return _begin == _end; }
+    size_t size() const { return static_cast<size_t>(_end - _begin); }
+
+   private:
+    const RowID* _begin;
+    const RowID* _end;
+  };
+
+  // max_size is the number of rows (not distinct values) that will be put into the table
+  explicit HashTable(const size_t max_size) : _max_size(max_size) {
+    auto group_count = size_t{1u};
+    while (group_count * GROUP_SIZE * 7u < (max_size + 1u) * 8u) group_count *= 2u;
+
+    _group_mask = group_count - 1u;
+    _tags.resize(group_count * GROUP_SIZE, EMPTY_TAG);
+    _slots.resize(group_count * GROUP_SIZE);
+    _row_ids.reserve(max_size);
+    _row_slots.reserve(max_size);
+  }
+
+  HashTable(HashTable&&) = default;
+  HashTable& operator=(HashTable&&) = default;
+
+  /*
+  Insert a new row into the hashtable. Must not be called after finalize().
+  */
+  void put(const T& value, const RowID row_id) {
+    DebugAssert(!_is_finalized, "Cannot put rows into a finalized HashTable.");
+    Assert(_row_ids.size() < _max_size, "HashTable is full.");
+
+    const auto slot_index = _find_or_insert(value, _hash(value));
+    ++_slots[slot_index].row_count;
+
+    _row_ids.emplace_back(row_id);
+    _row_slots.emplace_back(static_cast<uint32_t>(slot_index));
+  }
+
+  /*
+  Groups the RowIDs by value. Each value keeps its RowIDs in the order in which they were put.
+  */
+  void finalize() {
+    DebugAssert(!_is_finalized, "HashTable has already been finalized.");
+
+    auto row_offset = uint32_t{0u};
+    for (auto& slot : _slots) {
+      slot.row_offset = row_offset;
+      row_offset += slot.row_count;
+    }
+
+    auto sorted_row_ids = std::vector<RowID>(_row_ids.size());
+    for (auto row_index = size_t{0u}; row_index < _row_ids.size(); ++row_index) {
+      sorted_row_ids[_slots[_row_slots[row_index]].row_offset++] = _row_ids[row_index];
+    }
+
+    for (auto& slot : _slots) slot.row_offset -= slot.row_count;
+
+    _row_ids = std::move(sorted_row_ids);
+    _row_slots = std::vector<uint32_t>{};
+    _is_finalized = true;
+  }
+
+  /*
+  Returns all RowIDs of rows whose value equals `value`.
+  */
+  template <typename S>
+  RowIDRange get(const S& value) const {
+    DebugAssert(_is_finalized, "HashTable must be finalized before it is probed.");
+    return _find(value, _hash(value));
+  }
+
+  /*
+  Looks up `count` values, where get_value(index) returns the value with the given index, and calls
+  functor(index, row_id_range) for each of them in ascending index order.
+  */
+  template <typename GetValue, typename Functor>
+  void probe(const size_t count, const GetValue& get_value, const Functor& functor) const {
+    DebugAssert(_is_finalized, "HashTable must be finalized before it is probed.");
+
+    auto hashes = std::array<uint32_t, PROBE_BATCH_SIZE>{};
+
+    for (auto batch_begin = size_t{0u}; batch_begin < count; batch_begin += PROBE_BATCH_SIZE) {
+      const auto batch_size = std::min(PROBE_BATCH_SIZE, count - batch_begin);
+
+      for (auto batch_index = size_t{0u}; batch_index < batch_size; ++batch_index) {
+        const auto hash = _hash(get_value(batch_begin + batch_index));
+        const auto first_slot_index = _group(hash) * GROUP_SIZE;
+        __builtin_prefetch(&_tags[first_slot_index]);
+        __builtin_prefetch(&_slots[first_slot_index]);
+        hashes[batch_index] = hash;
+      }
+
+      for (auto batch_index = size_t{0u}; batch_index < batch_size; ++batch_index) {
+        const auto index = batch_begin + batch_index;
+        functor(index, _find(get_value(index), hashes[batch_index]));
+      }
+    }
+  }
+
+  size_t row_count() const { return _row_ids.size(); }
+  size_t slot_count() const { return _slots.size(); }
+
+  // Approximate memory used per row while the table is built, assuming unique values and the maximum load factor
+  static constexpr size_t estimated_bytes_per_row() {
+    return (sizeof(int8_t) + sizeof(Slot)) * 8u / 7u + sizeof(RowID) + sizeof(uint32_t);
+  }
+
+ protected:
+  struct Slot {
+    T value{};
+    uint32_t row_offset = 0u;
+    uint32_t row_count = 0u;
+  };
+
+  static constexpr int8_t EMPTY_TAG = -128;
+  static constexpr unsigned int HASH_SEED = 10u;
+
+  template <typename S>
+  static uint32_t _hash(const S& value) {
+    if constexpr (std::is_same<S, std::string>::value) {
+      return murmur_hash2(value.data(), static_cast<int>(value.size()), HASH_SEED);
+    } else {
+      return murmur2<S>(normalize_key_value(value), HASH_SEED);
+    }
+  }
+
+  // The lower seven bits of the hash are used for the tag, the following ones select the group
+  static int8_t _tag(const uint32_t hash) { return static_cast<int8_t>(hash & 0x7Fu); }
+  size_t _group(const uint32_t hash) const { return (hash >> 7u) & _group_mask; }
+
+  // Returns a bit mask of the slots in the group whose tag equals `tag`
+  static uint32_t _match(const int8_t* group_tags, const int8_t tag) {
+#if defined(__SSE2__)
+    const auto tags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group_tags));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(tags, _mm_set1_epi8(tag))));
+#else
+    auto mask = uint32_t{0u};
+    for (auto slot_index = size_t{0u}; slot_index < GROUP_SIZE; ++slot_index) {
+      mask |= static_cast<uint32_t>(group_tags[slot_index] == tag) << slot_index;
+    }
+    return mask;
+#endif
+  }
+
+  template <typename S>
+  static bool _equals(const T& stored_value, const S& value) {
+    if constexpr (std::is_same<S, T>::value) {
+      return stored_value == value;
+    } else {
+      return value_equal(stored_value, value);
+    }
+  }
+
+  template <typename S>
+  RowIDRange _find(const S& value, const uint32_t hash) const {
+    const auto tag = _tag(hash);
+
+    for (auto group = _group(hash);; group = (group + 1u) & _group_mask) {
+      const auto* group_tags = &_tags[group * GROUP_SIZE];
+
+      for (auto matches = _match(group_tags, tag); matches != 0u; matches &= matches - 1u) {
+        const auto& slot = _slots[group * GROUP_SIZE + __builtin_ctz(matches)];
+        if (_equals(slot.value, value)) {
+          const auto* row_ids = _row_ids.data() + slot.row_offset;
+          return RowIDRange{row_ids, row_ids + slot.row_count};
+        }
+      }
+
+      if (_match(group_tags, EMPTY_TAG) != 0u) return RowIDRange{nullptr, nullptr};
+    }
+  }
+
+  size_t _find_or_insert(const T& value, const uint32_t hash) {
+    const auto tag = _tag(hash);
+
+    for (auto group = _group(hash);; group = (group + 1u) & _group_mask) {
+      const auto* group_tags = &_tags[group * GROUP_SIZE];
+
+      for (auto matches = _match(group_tags, tag); matches != 0u; matches &= matches - 1u) {
+        const auto slot_index = group * GROUP_SIZE + __builtin_ctz(matches);
+        if (_slots[slot_index].value == value) return slot_index;
+      }
+
+      // Slots are never removed, so the value cannot be in a later group if this one has an empty slot
+      const auto empty_slots = _match(group_tags, EMPTY_TAG);
+      if (empty_slots != 0u) {
+        const auto slot_index = group * GROUP_SIZE + __builtin_ctz(empty_slots);
+        _tags[slot_index] = tag;
+        _slots[slot_index].value = value;
+        return slot_index;
+      }
+    }
+  }
+
+  size_t _max_size;
+  size_t _group_mask;
+  bool _is_finalized = false;
+
+  std::vector<int8_t> _tags;
+  std::vector<Slot> _slots;
+  std::vector<RowID> _row_ids;
+
+  // Slot of each row in _row_ids, only needed until finalize()
+  std::vector<uint32_t> _row_slots;
+};
+
+}  // namespace opossum
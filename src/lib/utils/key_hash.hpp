@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace opossum {
+
+/**
+ * Helpers shared by the operators and data structures that hash or encode keys: JoinHash and JoinSortMerge (via
+ * NormalizedJoinKeys), Aggregate, Sort, HashTable and BloomFilter.
+ */
+
+// Returns `value`, but with the same bit pattern for all values that compare equal. -0.0 and 0.0 are equal, but have
+// different bit patterns, so they would be hashed or encoded differently.
+template <typename T>
+T normalize_key_value(const T& value) {
+  if constexpr (std::is_floating_point<T>::value) {
+    return value == T{0} ? T{0} : value;
+  } else {
+    return value;
+  }
+}
+
+// Hashes a key that consists of `word_count` 64-bit words. Hashes of similar keys differ in their lowest bits and in
+// their highest bits, which are used to select hash table slots, radix clusters, and partitions.
+inline uint64_t hash_key_words(const uint64_t* key, const size_t word_count) {
+  auto hash = uint64_t{0};
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    hash = (hash ^ key[word_index]) * 0x9E3779B97F4A7C15ull;
+    hash ^= hash >> 32u;
+  }
+  return hash;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + filename);
+
+  struct stat file_status {};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // mmap does not accept empty mappings, an empty file simply has no data
+  void* data = nullptr;
+  if (stat_result == 0 && _size > 0u) {
+    data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  }
+
+  // The mapping stays valid after the file descriptor has been closed
+  close(file_descriptor);
+
+  Assert(stat_result == 0, "Could not determine the size of file " + filename);
+  Assert(data != MAP_FAILED, "Could not map file " + filename);
+  _data = static_cast<const char*>(data);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MemoryMappedFile::data() const { return _data; }
+
+size_t MemoryMappedFile::size() const { return _size; }
+
+}  // namespace opossum
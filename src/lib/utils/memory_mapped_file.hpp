@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Read-only mapping of an entire file into memory. The operating system loads the pages lazily on their first access
+ * and can drop them again under memory pressure without writing them to swap.
+ *
+ * Data structures that reference the mapping (see MappedVector) share ownership of it, so that the file stays mapped
+ * as long as any column still points into it.
+ */
+class MemoryMappedFile : private Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& filename);
+  ~MemoryMappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ private:
+  const char* _data = nullptr;
+  size_t _size = 0u;
+};
+
+}  // namespace opossum
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "concurrency/mvcc_garbage_collector.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
@@ -32,7 +33,7 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
   template <class T>
   static std::shared_ptr<DictionaryColumn<T>> create_dict_column_by_type(DataType data_type,
                                                                          const std::vector<T>& values) {
-    auto vector_values = tbb::concurrent_vector<T>(values.begin(), values.end());
+    auto vector_values = AppendOnlyVector<T>(values.begin(), values.end());
     auto value_column = std::make_shared<ValueColumn<T>>(std::move(vector_values));
     auto compressed_column = DictionaryCompression::compress_column(data_type, value_column);
     return std::static_pointer_cast<DictionaryColumn<T>>(compressed_column);
@@ -67,6 +68,7 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
     NUMAPlacementManager::get().pause();
 #endif
 
+    MvccGarbageCollector::reset();
     StorageManager::reset();
     TransactionManager::reset();
   }
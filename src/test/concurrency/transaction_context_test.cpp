@@ -1,7 +1,9 @@
+#include <atomic>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -99,4 +101,107 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, PendingTransactionsAreCommittedAsOneBatch) {
+  auto context_1 = manager().new_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+  auto context_3 = manager().new_transaction_context();
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto committed_transactions = std::vector<TransactionID>{};
+  const auto callback = [&committed_transactions](TransactionID transaction_id) {
+    committed_transactions.emplace_back(transaction_id);
+  };
+
+  auto try_commit_contexts_2_and_3 = [&]() {
+    context_3->commit_async(callback);
+    context_2->commit_async(callback);
+
+    EXPECT_EQ(prev_last_commit_id, manager().last_commit_id());
+    EXPECT_TRUE(committed_transactions.empty());
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(try_commit_contexts_2_and_3);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  // context_1 gets the smallest commit id, so committing it makes the pending contexts 2 and 3 visible as well
+  context_1->commit_async(callback);
+
+  EXPECT_EQ(context_2->commit_id(), manager().last_commit_id());
+  EXPECT_LT(context_3->commit_id(), context_2->commit_id());
+
+  const auto expected_transactions = std::vector<TransactionID>{
+      context_1->transaction_id(), context_3->transaction_id(), context_2->transaction_id()};
+  EXPECT_EQ(committed_transactions, expected_transactions);
+}
+
+TEST_F(TransactionContextTest, ReadOnlyTransactionsCommitWithoutCommitId) {
+  auto context = manager().new_transaction_context();
+  auto read_only_context = manager().new_read_only_transaction_context();
+
+  EXPECT_FALSE(context->is_read_only());
+  EXPECT_TRUE(read_only_context->is_read_only());
+  EXPECT_EQ(read_only_context->transaction_id(), INVALID_TRANSACTION_ID);
+  EXPECT_EQ(read_only_context->snapshot_commit_id(), manager().last_commit_id());
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), read_only_context->snapshot_commit_id());
+
+  // The read-only transaction neither waits for nor delays the pending read/write transaction
+  auto op = std::make_shared<CommitFuncOp>([]() {});
+  op->set_transaction_context(context);
+  op->execute();
+
+  auto callback_called = false;
+  EXPECT_TRUE(read_only_context->commit_async([&](TransactionID) { callback_called = true; }));
+  EXPECT_TRUE(callback_called);
+  EXPECT_EQ(read_only_context->phase(), TransactionPhase::Committed);
+  EXPECT_FALSE(read_only_context->commit());
+  EXPECT_THROW(read_only_context->commit_id(), std::logic_error);
+
+  const auto last_commit_id = manager().last_commit_id();
+  context->commit();
+  EXPECT_EQ(manager().last_commit_id(), last_commit_id + 1);
+}
+
+TEST_F(TransactionContextTest, ReadOnlyTransactionsCannotRegisterOperators) {
+  auto context = manager().new_read_only_transaction_context();
+
+  auto op = std::make_shared<CommitFuncOp>([]() {});
+  op->set_transaction_context(context);
+  EXPECT_THROW(op->execute(), std::logic_error);
+
+  EXPECT_TRUE(context->rollback());
+  EXPECT_EQ(context->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(TransactionContextTest, ConcurrentReadOnlyTransactionsAreTracked) {
+  const auto thread_count = 8;
+  const auto transactions_per_thread = 200;
+
+  auto untracked_snapshot_count = std::atomic<size_t>{0};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto transaction_index = 0; transaction_index < transactions_per_thread; ++transaction_index) {
+        // Half of the threads keep the last commit id moving
+        if (thread_index % 2 == 0) {
+          manager().run_transaction([](std::shared_ptr<TransactionContext>) {});
+          continue;
+        }
+
+        const auto context = manager().new_read_only_transaction_context();
+        if (!context->snapshot_pin().is_pinned() ||
+            manager().lowest_active_snapshot_commit_id() > context->snapshot_commit_id()) {
+          ++untracked_snapshot_count;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(untracked_snapshot_count.load(), 0u);
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), manager().last_commit_id());
+}
+
 }  // namespace opossum
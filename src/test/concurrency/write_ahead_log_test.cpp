@@ -0,0 +1,319 @@
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/log_record.hpp"
+#include "concurrency/recovery.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    char directory[] = "/tmp/write_ahead_log_testXXXXXX";
+    ASSERT_NE(mkdtemp(directory), nullptr);
+    _directory = directory;
+
+    StorageManager::get().add_table(_table_name, _load_base_table());
+  }
+
+  void TearDown() override {
+    WriteAheadLog::reset();
+
+    for (const auto& name : _list_directory(_directory)) {
+      const auto path = _directory + "/" + name;
+      for (const auto& nested_name : _list_directory(path)) unlink((path + "/" + nested_name).c_str());
+      rmdir(path.c_str());
+      unlink(path.c_str());
+    }
+    rmdir(_directory.c_str());
+  }
+
+  static std::vector<std::string> _list_directory(const std::string& directory) {
+    auto names = std::vector<std::string>{};
+    auto* dir = opendir(directory.c_str());
+    if (!dir) return names;
+    while (const auto* entry = readdir(dir)) {
+      const auto name = std::string{entry->d_name};
+      if (name != "." && name != "..") names.emplace_back(name);
+    }
+    closedir(dir);
+    return names;
+  }
+
+  // Two compressed chunks, so that Inserts start a new chunk
+  std::shared_ptr<Table> _load_base_table() {
+    auto table = load_table("src/test/tables/int_string.tbl", 4u);
+    DictionaryCompression::compress_table(*table);
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _values(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto values = std::make_shared<Table>();
+    values->add_column("a", DataType::Int);
+    values->add_column("b", DataType::String);
+    for (const auto& row : rows) values->append(row);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  void _insert(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto table_wrapper = _values(rows);
+
+    auto context = TransactionManager::get().new_transaction_context();
+    auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    ASSERT_TRUE(context->commit());
+  }
+
+  std::shared_ptr<AbstractOperator> _select(const std::shared_ptr<TransactionContext>& context, const int value) {
+    auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, ScanType::Equals, value);
+    table_scan->execute();
+    return table_scan;
+  }
+
+  void _delete(const int value) {
+    auto context = TransactionManager::get().new_transaction_context();
+    auto delete_op = std::make_shared<Delete>(_table_name, _select(context, value));
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    ASSERT_FALSE(delete_op->execute_failed());
+    ASSERT_TRUE(context->commit());
+  }
+
+  void _update(const int value, const std::string& new_value) {
+    auto context = TransactionManager::get().new_transaction_context();
+    const auto rows_to_update = _select(context, value);
+
+    auto update = std::make_shared<Update>(_table_name, rows_to_update, _values({{value, new_value}}));
+    update->set_transaction_context(context);
+    update->execute();
+    ASSERT_FALSE(update->execute_failed());
+    ASSERT_TRUE(context->commit());
+  }
+
+  std::shared_ptr<const Table> _visible_rows() {
+    auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    const auto context = TransactionManager::get().new_transaction_context();
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  // Loses everything that is only held in memory
+  void _crash() {
+    WriteAheadLog::reset();
+    StorageManager::reset();
+    TransactionManager::reset();
+  }
+
+  std::string _directory;
+  const std::string _table_name = "table_a";
+};
+
+TEST_F(WriteAheadLogTest, LogRecordRoundTrip) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String, true);
+  table->add_column("c", DataType::Double);
+  table->append({1, "one", 1.5});
+  table->append({2, NULL_VALUE, 2.5});
+
+  auto record = LogRecord{CommitID{42}};
+  record.add_insert("table_b", *table, PosList{RowID{ChunkID{0}, 1u}, RowID{ChunkID{0}, 0u}});
+  record.add_delete("table_c", PosList{RowID{ChunkID{3}, 7u}});
+
+  auto buffer = std::vector<char>{};
+  record.serialize(buffer);
+  record.serialize(buffer);
+
+  auto offset = size_t{0u};
+  for (auto copy = 0; copy < 2; ++copy) {
+    const auto deserialized = LogRecord::deserialize(buffer, offset);
+    ASSERT_TRUE(deserialized);
+    EXPECT_EQ(deserialized->commit_id(), CommitID{42});
+    ASSERT_EQ(deserialized->entries().size(), 2u);
+
+    const auto& insert_entry = deserialized->entries()[0];
+    EXPECT_EQ(insert_entry.type, LogEntryType::Insert);
+    EXPECT_EQ(insert_entry.table_name, "table_b");
+    EXPECT_EQ(insert_entry.row_ids, (PosList{RowID{ChunkID{0}, 1u}, RowID{ChunkID{0}, 0u}}));
+    EXPECT_EQ(insert_entry.column_types, table->column_types());
+    ASSERT_EQ(insert_entry.values.size(), 6u);
+    EXPECT_EQ(insert_entry.values[0], AllTypeVariant{2});
+    EXPECT_TRUE(variant_is_null(insert_entry.values[1]));
+    EXPECT_EQ(insert_entry.values[2], AllTypeVariant{2.5});
+    EXPECT_EQ(insert_entry.values[4], AllTypeVariant{"one"});
+
+    const auto& delete_entry = deserialized->entries()[1];
+    EXPECT_EQ(delete_entry.type, LogEntryType::Delete);
+    EXPECT_EQ(delete_entry.table_name, "table_c");
+    EXPECT_EQ(delete_entry.row_ids, (PosList{RowID{ChunkID{3}, 7u}}));
+  }
+  EXPECT_EQ(offset, buffer.size());
+  EXPECT_FALSE(LogRecord::deserialize(buffer, offset));
+}
+
+TEST_F(WriteAheadLogTest, IncompleteRecordsAreRejected) {
+  auto record = LogRecord{CommitID{2}};
+  record.add_delete("table_c", PosList{RowID{ChunkID{0}, 1u}});
+
+  auto buffer = std::vector<char>{};
+  record.serialize(buffer);
+
+  auto truncated_buffer = std::vector<char>{buffer.cbegin(), buffer.cend() - 1};
+  auto offset = size_t{0u};
+  EXPECT_FALSE(LogRecord::deserialize(truncated_buffer, offset));
+
+  buffer.back() ^= 0x01;
+  EXPECT_FALSE(LogRecord::deserialize(buffer, offset));
+  EXPECT_EQ(offset, 0u);
+}
+
+TEST_F(WriteAheadLogTest, RecoverFromLog) {
+  WriteAheadLog::get().enable(_directory);
+
+  _insert({{100, "hundred"}, {101, "hundred and one"}});
+  _delete(4);
+  _update(100, "updated");
+  _insert({{102, "hundred and two"}});
+
+  const auto expected_rows = _visible_rows();
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  _crash();
+
+  // Without a checkpoint, the table needs to be loaded as before
+  StorageManager::get().add_table(_table_name, _load_base_table());
+  EXPECT_EQ(Recovery::recover(_directory), last_commit_id);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+TEST_F(WriteAheadLogTest, RecoverFromCheckpointAndLog) {
+  WriteAheadLog::get().enable(_directory);
+
+  _insert({{100, "hundred"}, {101, "hundred and one"}});
+  _delete(4);
+  const auto checkpoint_commit_id = WriteAheadLog::get().checkpoint();
+  EXPECT_EQ(checkpoint_commit_id, TransactionManager::get().last_commit_id());
+
+  // The segment written before the checkpoint is not needed anymore
+  EXPECT_EQ(WriteAheadLog::find_log_segments(_directory), std::vector<uint32_t>{1u});
+
+  _delete(100);
+  _update(101, "updated");
+  _insert({{102, "hundred and two"}});
+
+  const auto expected_rows = _visible_rows();
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  _crash();
+
+  EXPECT_EQ(Recovery::recover(_directory), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+
+  // Logging continues after the recovered transactions
+  WriteAheadLog::get().enable(_directory);
+  _insert({{103, "hundred and three"}});
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id + 1u);
+
+  const auto expected_rows_after_restart = _visible_rows();
+  _crash();
+
+  Recovery::recover(_directory);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows_after_restart);
+}
+
+TEST_F(WriteAheadLogTest, RecoveryIgnoresTornWrites) {
+  WriteAheadLog::get().enable(_directory);
+  _insert({{100, "hundred"}});
+  const auto expected_rows = _visible_rows();
+  _crash();
+
+  // A record the process was writing when it crashed
+  auto record = LogRecord{CommitID{100}};
+  record.add_delete(_table_name, PosList{RowID{ChunkID{0}, 0u}});
+  auto buffer = std::vector<char>{};
+  record.serialize(buffer);
+
+  auto log_file = std::ofstream{_directory + "/" + WriteAheadLog::log_segment_filename(0u),
+                                std::ios::binary | std::ios::app};
+  log_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size() / 2u));
+  log_file.close();
+
+  StorageManager::get().add_table(_table_name, _load_base_table());
+  Recovery::recover(_directory);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+TEST_F(WriteAheadLogTest, ConcurrentCommitsShareSyncs) {
+  WriteAheadLog::get().enable(_directory);
+
+  const auto thread_count = 8;
+  const auto inserts_per_thread = 20;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto insert_index = 0; insert_index < inserts_per_thread; ++insert_index) {
+        _insert({{1000 + thread_index * inserts_per_thread + insert_index, "value"}});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Each commit waits for its record to be synced, but commits that arrive during a sync are grouped
+  EXPECT_GE(WriteAheadLog::get().sync_count(), 1u);
+  EXPECT_LE(WriteAheadLog::get().sync_count(), static_cast<uint64_t>(thread_count * inserts_per_thread));
+
+  const auto expected_rows = _visible_rows();
+  EXPECT_EQ(expected_rows->row_count(), 12u + thread_count * inserts_per_thread);
+  _crash();
+
+  StorageManager::get().add_table(_table_name, _load_base_table());
+  Recovery::recover(_directory);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+TEST_F(WriteAheadLogTest, DisabledByDefault) {
+  EXPECT_FALSE(WriteAheadLog::get().is_enabled());
+
+  _insert({{100, "hundred"}});
+  EXPECT_TRUE(_list_directory(_directory).empty());
+}
+
+}  // namespace opossum
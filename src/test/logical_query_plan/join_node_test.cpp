@@ -1,5 +1,6 @@
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -50,6 +51,26 @@ TEST_F(JoinNodeTest, Description) { EXPECT_EQ(_join_node->description(), "[Cross
 
 TEST_F(JoinNodeTest, DescriptionInnerJoin) { EXPECT_EQ(_inner_join_node->description(), "[Inner Join] t_a.a = t_b.y"); }
 
+TEST_F(JoinNodeTest, AdditionalJoinColumnReferences) {
+  const auto join_node = std::make_shared<JoinNode>(JoinMode::Inner, std::make_pair(_t_a_a, _t_b_x), ScanType::Equals,
+                                                    std::vector<LQPColumnReferencePair>{{_t_a_c, _t_b_y}});
+  join_node->set_left_child(_mock_node_a);
+  join_node->set_right_child(_mock_node_b);
+
+  EXPECT_EQ(join_node->description(), "[Inner Join] t_a.a = t_b.x AND t_a.c = t_b.y");
+
+  const auto copied_join_node = std::dynamic_pointer_cast<JoinNode>(join_node->deep_copy());
+  ASSERT_EQ(copied_join_node->additional_join_column_references().size(), 1u);
+
+  const auto& [copied_left_column_reference, copied_right_column_reference] =
+      copied_join_node->additional_join_column_references().front();
+  EXPECT_EQ(copied_left_column_reference.original_node(), copied_join_node->left_child());
+  EXPECT_EQ(copied_left_column_reference.original_column_id(), ColumnID{2});
+  EXPECT_EQ(copied_right_column_reference.original_node(), copied_join_node->right_child());
+  EXPECT_EQ(copied_right_column_reference.original_column_id(), ColumnID{1});
+  EXPECT_EQ(copied_join_node->join_column_references()->second.original_node(), copied_join_node->right_child());
+}
+
 TEST_F(JoinNodeTest, VerboseColumnNames) {
   EXPECT_EQ(_join_node->get_verbose_column_name(ColumnID{0}), "t_a.a");
   EXPECT_EQ(_join_node->get_verbose_column_name(ColumnID{1}), "t_a.b");
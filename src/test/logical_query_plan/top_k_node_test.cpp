@@ -0,0 +1,51 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_k_node.hpp"
+
+namespace opossum {
+
+class TopKNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float_double_string.tbl", 2));
+
+    _table_node = std::make_shared<StoredTableNode>("table_a");
+
+    _a_a = LQPColumnReference{_table_node, ColumnID{0}};
+    _a_b = LQPColumnReference{_table_node, ColumnID{1}};
+
+    _top_k_node = std::make_shared<TopKNode>(
+        OrderByDefinitions{{_a_b, OrderByMode::Descending}, {_a_a, OrderByMode::AscendingNullsLast}}, 10);
+    _top_k_node->set_left_child(_table_node);
+  }
+
+  std::shared_ptr<StoredTableNode> _table_node;
+  std::shared_ptr<TopKNode> _top_k_node;
+  LQPColumnReference _a_a, _a_b;
+};
+
+TEST_F(TopKNodeTest, Description) {
+  EXPECT_EQ(_top_k_node->description(),
+            "[TopK] 10 rows by table_a.f (Descending), table_a.i (AscendingNullsLast)");
+}
+
+TEST_F(TopKNodeTest, NumberOfRows) { EXPECT_EQ(_top_k_node->num_rows(), 10u); }
+
+TEST_F(TopKNodeTest, DeepCopy) {
+  const auto copy = std::dynamic_pointer_cast<TopKNode>(_top_k_node->deep_copy());
+  ASSERT_TRUE(copy);
+
+  EXPECT_EQ(copy->num_rows(), 10u);
+  ASSERT_EQ(copy->order_by_definitions().size(), 2u);
+  EXPECT_EQ(copy->order_by_definitions()[0].column_reference,
+            LQPColumnReference(copy->left_child(), ColumnID{1}));
+  EXPECT_EQ(copy->order_by_definitions()[1].order_by_mode, OrderByMode::AscendingNullsLast);
+}
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -93,6 +94,12 @@ class OperatorsAggregateTest : public BaseTest {
     std::shared_ptr<Table> expected_result = load_table(file_name, chunk_size);
     EXPECT_NE(expected_result, nullptr) << "Could not load expected result table";
 
+    test_output(in, aggregates, groupby_column_ids, expected_result, test_references);
+  }
+
+  void test_output(const std::shared_ptr<AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
+                   const std::vector<ColumnID>& groupby_column_ids, const std::shared_ptr<Table>& expected_result,
+                   bool test_references = true) {
     // collect possible columns to scan before aggregate
     std::set<ColumnID> ref_columns;
 
@@ -532,4 +539,101 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, ManyChunks) {
+  // 100 chunks are merged in multiple partitions, half of them are dictionary-compressed
+  auto table = std::make_shared<Table>(10u);
+  table->add_column("a", DataType::String);
+  table->add_column("b", DataType::Int, true);
+  table->add_column("c", DataType::Double);
+
+  auto expected_groups = std::map<std::pair<std::string, std::optional<int32_t>>, std::pair<double, int64_t>>{};
+  for (auto row = 0; row < 1000; ++row) {
+    const auto a = "s" + std::to_string(row % 13);
+    const auto b = row % 7 == 0 ? std::nullopt : std::optional<int32_t>{row % 5};
+    // -0.0 and 0.0 are the same group-by value
+    const auto c = row % 4 == 0 ? (row % 8 == 0 ? -0.0 : 0.0) : (row % 4) * 0.5;
+    table->append({a, b ? AllTypeVariant{*b} : AllTypeVariant{NULL_VALUE}, c});
+
+    auto& [sum, count] = expected_groups[{a, b}];
+    sum += c;
+    ++count;
+  }
+
+  auto chunks_to_compress = std::vector<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id += 2) chunks_to_compress.emplace_back(chunk_id);
+  DictionaryCompression::compress_chunks(*table, chunks_to_compress);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::String, true);
+  expected_result->add_column("b", DataType::Int, true);
+  expected_result->add_column("SUM(c)", DataType::Double, true);
+  expected_result->add_column("COUNT(*)", DataType::Long);
+  for (const auto& [group, aggregates] : expected_groups) {
+    expected_result->append({group.first, group.second ? AllTypeVariant{*group.second} : AllTypeVariant{NULL_VALUE},
+                             aggregates.first, aggregates.second});
+  }
+
+  this->test_output(table_wrapper, {{ColumnID{2}, AggregateFunction::Sum}, {std::nullopt, AggregateFunction::Count}},
+                    {ColumnID{0}, ColumnID{1}}, expected_result, false);
+
+  auto zero_table = std::make_shared<Table>();
+  zero_table->add_column("c", DataType::Double, true);
+  zero_table->add_column("COUNT(*)", DataType::Long);
+  zero_table->append({0.0, int64_t{250}});
+  zero_table->append({0.5, int64_t{250}});
+  zero_table->append({1.0, int64_t{250}});
+  zero_table->append({1.5, int64_t{250}});
+
+  this->test_output(table_wrapper, {{std::nullopt, AggregateFunction::Count}}, {ColumnID{2}}, zero_table, false);
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryColumnsAggregatedOnValueIds) {
+  // Group-by and aggregate columns are dictionary-compressed in all but the last chunk
+  auto table = std::make_shared<Table>(20u);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::String, true);
+  table->add_column("c", DataType::Int);
+
+  auto expected_groups = std::map<std::optional<int32_t>, std::tuple<std::string, std::string, int64_t, int64_t>>{};
+  for (auto row = 0; row < 100; ++row) {
+    const auto a = row % 9 == 0 ? std::nullopt : std::optional<int32_t>{row % 4};
+    const auto b = row % 6 == 0 ? std::nullopt : std::optional<std::string>{"v" + std::to_string((row * 7) % 23)};
+    table->append(
+        {a ? AllTypeVariant{*a} : AllTypeVariant{NULL_VALUE}, b ? AllTypeVariant{*b} : AllTypeVariant{NULL_VALUE}, row});
+
+    auto& [min, max, count, sum] = expected_groups[a];
+    if (b) {
+      if (count == 0 || *b < min) min = *b;
+      if (count == 0 || *b > max) max = *b;
+      ++count;
+    }
+    sum += row;
+  }
+  DictionaryCompression::compress_chunks(*table, {ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int, true);
+  expected_result->add_column("MIN(b)", DataType::String, true);
+  expected_result->add_column("MAX(b)", DataType::String, true);
+  expected_result->add_column("COUNT(b)", DataType::Long);
+  expected_result->add_column("SUM(c)", DataType::Long, true);
+  for (const auto& [a, aggregates] : expected_groups) {
+    const auto& [min, max, count, sum] = aggregates;
+    expected_result->append({a ? AllTypeVariant{*a} : AllTypeVariant{NULL_VALUE}, min, max, count, sum});
+  }
+
+  this->test_output(table_wrapper,
+                    {{ColumnID{1}, AggregateFunction::Min},
+                     {ColumnID{1}, AggregateFunction::Max},
+                     {ColumnID{1}, AggregateFunction::Count},
+                     {ColumnID{2}, AggregateFunction::Sum}},
+                    {ColumnID{0}}, expected_result, false);
+}
+
 }  // namespace opossum
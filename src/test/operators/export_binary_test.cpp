@@ -10,6 +10,7 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/dictionary_compression.hpp"
@@ -318,4 +319,129 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("src/test/binary/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, AllTypesRunLengthNullValuesRoundTrip) {
+  auto table = std::make_shared<opossum::Table>(4);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::Float, true);
+  table->add_column("c", DataType::Long, true);
+  table->add_column("d", DataType::String, true);
+  table->add_column("e", DataType::Double, true);
+
+  table->append({opossum::NULL_VALUE, 1.1f, 100, "one", 1.11});
+  table->append({opossum::NULL_VALUE, 1.1f, 100, "one", 1.11});
+  table->append({3, 3.3f, opossum::NULL_VALUE, "three", 3.33});
+  table->append({3, 3.3f, 400, opossum::NULL_VALUE, 3.33});
+  table->append({5, 5.5f, 500, "five", opossum::NULL_VALUE});
+
+  DictionaryCompression::compress_table(*table, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), table);
+  EXPECT_EQ(importer->get_output()->chunk_count(), 2u);
+}
+
+TEST_F(OperatorsExportBinaryTest, FrameOfReferenceNullValuesRoundTrip) {
+  auto table = std::make_shared<opossum::Table>(3000);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::Long);
+
+  for (auto index = 0; index < 5000; ++index) {
+    table->append({index % 10 == 3 ? AllTypeVariant{opossum::NULL_VALUE} : AllTypeVariant{index * 7 - 200},
+                   int64_t{10'000'000'000} - index});
+  }
+
+  DictionaryCompression::compress_table(*table, EncodingType::FrameOfReference);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), table);
+  EXPECT_EQ(importer->get_output()->chunk_count(), 2u);
+}
+
+TEST_F(OperatorsExportBinaryTest, MappedFormatRoundTrip) {
+  auto table = std::make_shared<opossum::Table>(30);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::String, true);
+  table->add_column("c", DataType::Double);
+
+  for (auto index = 0; index < 100; ++index) {
+    const auto a = index % 7 == 3 ? AllTypeVariant{opossum::NULL_VALUE} : AllTypeVariant{index * 3};
+    const auto b = index % 11 == 5 ? AllTypeVariant{opossum::NULL_VALUE} : AllTypeVariant{"value" + std::to_string(index)};
+    table->append({a, b, index * 0.5});
+  }
+
+  // Leave the last chunk uncompressed and run-length encode the third one
+  DictionaryCompression::compress_chunks(*table, {ChunkID{0}, ChunkID{1}});
+  DictionaryCompression::compress_chunks(*table, {ChunkID{2}}, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename, BinaryFormat::mapped);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+  const auto imported_table = importer->get_output();
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  EXPECT_EQ(imported_table->chunk_count(), 4u);
+
+  // The dictionary columns reference the mapped file
+  const auto int_column = std::dynamic_pointer_cast<const DictionaryColumn<int>>(
+      imported_table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_NE(int_column, nullptr);
+  EXPECT_TRUE(int_column->dictionary()->is_mapped());
+
+  const auto string_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      imported_table->get_chunk(ChunkID{1})->get_column(ColumnID{1}));
+  ASSERT_NE(string_column, nullptr);
+  EXPECT_TRUE(string_column->dictionary()->data().is_mapped());
+  EXPECT_EQ(string_column->value_by_value_id(string_column->lower_bound(std::string{"value4"})), "value40");
+}
+
+TEST_F(OperatorsExportBinaryTest, MappedColumnsOutliveImporter) {
+  auto table = std::make_shared<opossum::Table>(10);
+  table->add_column("a", DataType::String);
+  for (auto index = 0; index < 20; ++index) table->append({"value" + std::to_string(index % 5)});
+  DictionaryCompression::compress_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  std::make_shared<opossum::ExportBinary>(table_wrapper, filename, BinaryFormat::mapped)->execute();
+
+  auto imported_table = std::shared_ptr<const Table>{};
+  {
+    auto importer = std::make_shared<opossum::ImportBinary>(filename);
+    importer->execute();
+    imported_table = importer->get_output();
+  }
+  std::remove(filename.c_str());
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  // Copies, e.g., for migrating a column to another NUMA node, own their values
+  const auto column = imported_table->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  const auto copied_column =
+      std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(column->copy_using_allocator({}));
+  ASSERT_NE(copied_column, nullptr);
+  EXPECT_FALSE(copied_column->dictionary()->data().is_mapped());
+  EXPECT_EQ(copied_column->get(3u), "value3");
+}
+
 }  // namespace opossum
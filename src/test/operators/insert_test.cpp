@@ -52,6 +52,42 @@ TEST_F(OperatorsInsertTest, SelfInsert) {
   EXPECT_EQ(t->get_chunk(ChunkID{0})->get_column(ColumnID{1})->size(), 6u);
 }
 
+TEST_F(OperatorsInsertTest, InsertGrowsChunkWithoutReallocatingColumns) {
+  auto table_name = "test_table";
+
+  // Chunks that were not created by the table have no spare capacity
+  auto t = std::make_shared<Table>();
+  t->add_column_definition("a", DataType::Int);
+  auto chunk = std::make_shared<Chunk>(ChunkUseMvcc::Yes);
+  chunk->add_column(std::make_shared<ValueColumn<int>>(AppendOnlyVector<int>{1, 2, 3}));
+  chunk->grow_mvcc_column_size_by(3u, CommitID{0});
+  t->emplace_chunk(std::move(chunk));
+  StorageManager::get().add_table(table_name, t);
+
+  // A reader that holds the column while the Insert runs
+  const auto old_column =
+      std::static_pointer_cast<const ValueColumn<int>>(t->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  const auto* old_values = old_column->values().data();
+
+  auto gt = std::make_shared<GetTable>(table_name);
+  gt->execute();
+
+  auto ins = std::make_shared<Insert>(table_name, gt);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+  context->commit();
+
+  // The table has no chunk size limit, so the chunk is grown instead of starting a new one
+  EXPECT_EQ(t->chunk_count(), 1u);
+  EXPECT_EQ(t->get_chunk(ChunkID{0})->size(), 6u);
+  EXPECT_EQ((*t->get_chunk(ChunkID{0})->get_column(ColumnID{0}))[5], AllTypeVariant(3));
+
+  EXPECT_EQ(old_column->size(), 3u);
+  EXPECT_EQ(old_column->values().data(), old_values);
+  EXPECT_EQ(old_column->values()[2], 3);
+}
+
 TEST_F(OperatorsInsertTest, InsertRespectChunkSize) {
   auto t_name = "test1";
   auto t_name2 = "test2";
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/join_bloom_filter.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinBloomFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 1000 visible rows in chunks of 100, half of them compressed
+    auto probe_table = std::make_shared<Table>(100u);
+    probe_table->add_column("a", DataType::Int, true);
+    probe_table->add_column("b", DataType::Int);
+    for (auto value = 0; value < 1000; ++value) {
+      probe_table->append({value % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}, value % 7});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < probe_table->chunk_count(); ++chunk_id) {
+      auto mvcc_columns = probe_table->get_chunk(chunk_id)->mvcc_columns();
+      std::fill(mvcc_columns->begin_cids.begin(), mvcc_columns->begin_cids.end(), 0u);
+    }
+    DictionaryCompression::compress_chunks(*probe_table, {ChunkID{1}, ChunkID{3}, ChunkID{5}, ChunkID{7}, ChunkID{9}});
+    _probe_wrapper = std::make_shared<TableWrapper>(std::move(probe_table));
+    _probe_wrapper->execute();
+
+    auto build_table = std::make_shared<Table>();
+    build_table->add_column("c", DataType::Int);
+    for (auto value : {3, 20, 333, 334, 998, 2000}) build_table->append({value});
+    _build_wrapper = std::make_shared<TableWrapper>(std::move(build_table));
+    _build_wrapper->execute();
+  }
+
+  // The result of joining the build table with `probe_operator` must not change because of the filter
+  void expect_join_result(const std::shared_ptr<AbstractOperator>& probe_operator) {
+    auto join = std::make_shared<JoinHash>(_build_wrapper, probe_operator, JoinMode::Inner,
+                                           ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+    join->execute();
+
+    auto expected_result = std::make_shared<Table>();
+    expected_result->add_column("c", DataType::Int);
+    expected_result->add_column("a", DataType::Int, true);
+    expected_result->add_column("b", DataType::Int);
+    for (auto value : {3, 333, 334, 998}) expected_result->append({value, value, value % 7});
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+  }
+
+  std::shared_ptr<TableWrapper> _probe_wrapper, _build_wrapper;
+};
+
+TEST_F(OperatorsJoinBloomFilterTest, TableScanDropsRowsWithoutJoinPartner) {
+  auto table_scan = std::make_shared<TableScan>(_probe_wrapper, ColumnID{1}, ScanType::NotEquals, 1);
+  table_scan->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(_build_wrapper, ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(table_scan->input_right(), _build_wrapper);
+  table_scan->execute();
+
+  ASSERT_TRUE(table_scan->join_bloom_filter()->is_active());
+  EXPECT_LT(table_scan->get_output()->row_count(), 100u);
+  expect_join_result(table_scan);
+
+  // Referencing input
+  auto table_scan_ref = std::make_shared<TableScan>(table_scan, ColumnID{1}, ScanType::NotEquals, 2);
+  table_scan_ref->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(_build_wrapper, ColumnID{0}, ColumnID{0}));
+  table_scan_ref->execute();
+
+  EXPECT_LE(table_scan_ref->get_output()->row_count(), table_scan->get_output()->row_count());
+  expect_join_result(table_scan_ref);
+}
+
+TEST_F(OperatorsJoinBloomFilterTest, ValidateDropsRowsWithoutJoinPartner) {
+  auto context = std::make_shared<TransactionContext>(1u, 1u);
+
+  auto validate = std::make_shared<Validate>(_probe_wrapper);
+  validate->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(_build_wrapper, ColumnID{0}, ColumnID{0}));
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  EXPECT_LT(validate->get_output()->row_count(), 100u);
+  expect_join_result(validate);
+
+  // Referencing input
+  auto table_scan = std::make_shared<TableScan>(_probe_wrapper, ColumnID{1}, ScanType::NotEquals, 1);
+  table_scan->execute();
+
+  auto validate_ref = std::make_shared<Validate>(table_scan);
+  validate_ref->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(_build_wrapper, ColumnID{0}, ColumnID{0}));
+  validate_ref->set_transaction_context(context);
+  validate_ref->execute();
+
+  EXPECT_LT(validate_ref->get_output()->row_count(), 100u);
+  expect_join_result(validate_ref);
+}
+
+TEST_F(OperatorsJoinBloomFilterTest, InactiveFilters) {
+  // Values of different types are hashed differently
+  auto float_table = std::make_shared<Table>();
+  float_table->add_column("c", DataType::Float);
+  float_table->append({3.0f});
+  auto float_wrapper = std::make_shared<TableWrapper>(std::move(float_table));
+  float_wrapper->execute();
+
+  auto float_filter = JoinBloomFilter{float_wrapper, ColumnID{0}, ColumnID{0}};
+  float_filter.init(*_probe_wrapper->get_output());
+  EXPECT_FALSE(float_filter.is_active());
+
+  // The build input is larger than the probe input
+  auto small_table = std::make_shared<Table>();
+  small_table->add_column("a", DataType::Int);
+  for (auto value : {1, 2, 3}) small_table->append({value});
+  auto small_wrapper = std::make_shared<TableWrapper>(std::move(small_table));
+  small_wrapper->execute();
+
+  auto table_scan = std::make_shared<TableScan>(small_wrapper, ColumnID{0}, ScanType::LessThan, 3);
+  table_scan->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(_build_wrapper, ColumnID{0}, ColumnID{0}));
+  table_scan->execute();
+
+  EXPECT_FALSE(table_scan->join_bloom_filter()->is_active());
+  EXPECT_EQ(table_scan->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsJoinBloomFilterTest, BuildOperatorIsExecutedFirst) {
+  // Operators are only executed once, so the tasks need wrappers of their own
+  auto build_wrapper = std::make_shared<TableWrapper>(_build_wrapper->get_output());
+  auto probe_wrapper = std::make_shared<TableWrapper>(_probe_wrapper->get_output());
+
+  auto build_scan = std::make_shared<TableScan>(build_wrapper, ColumnID{0}, ScanType::LessThan, 1000);
+  auto probe_scan = std::make_shared<TableScan>(probe_wrapper, ColumnID{1}, ScanType::NotEquals, 1);
+  probe_scan->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(build_scan, ColumnID{0}, ColumnID{0}));
+  auto join = std::make_shared<JoinHash>(build_scan, probe_scan, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 5u);
+  for (const auto& task : tasks) task->execute();
+
+  EXPECT_LT(probe_scan->get_output()->row_count(), 100u);
+  EXPECT_EQ(join->get_output()->row_count(), 4u);
+}
+
+TEST_F(OperatorsJoinBloomFilterTest, RecreatedJoinKeepsFilter) {
+  auto build_scan = std::make_shared<TableScan>(_build_wrapper, ColumnID{0}, ScanType::LessThan, 1000);
+  auto probe_scan = std::make_shared<TableScan>(_probe_wrapper, ColumnID{1}, ScanType::NotEquals, 1);
+  probe_scan->set_join_bloom_filter(std::make_shared<JoinBloomFilter>(build_scan, ColumnID{0}, ColumnID{0}));
+  auto join = std::make_shared<JoinHash>(build_scan, probe_scan, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+
+  // The recreated filter is built from the recreated build input, so that it is executed only once
+  const auto recreated_join = join->recreate();
+  const auto recreated_probe_scan = std::dynamic_pointer_cast<const TableScan>(recreated_join->input_right());
+  ASSERT_TRUE(recreated_probe_scan && recreated_probe_scan->join_bloom_filter());
+  EXPECT_EQ(recreated_probe_scan->join_bloom_filter()->build_operator(), recreated_join->input_left());
+  EXPECT_EQ(recreated_probe_scan->input_right(), recreated_join->input_left());
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(recreated_join);
+  ASSERT_EQ(tasks.size(), 5u);
+  for (const auto& task : tasks) task->execute();
+
+  EXPECT_LT(recreated_probe_scan->get_output()->row_count(), 100u);
+  EXPECT_EQ(recreated_join->get_output()->row_count(), 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three compressed chunks, whose value ranges overlap, so that only the Bloom filters can rule them out
+    auto probe_table = std::make_shared<Table>(4u);
+    probe_table->add_column("a", DataType::Int);
+    for (auto value : {1, 20, 40, 60, 2, 21, 41, 61, 3, 22, 42, 62}) probe_table->append({value});
+    DictionaryCompression::compress_table(*probe_table);
+    _probe_wrapper = std::make_shared<TableWrapper>(std::move(probe_table));
+    _probe_wrapper->execute();
+
+    auto build_table = std::make_shared<Table>();
+    build_table->add_column("b", DataType::Int);
+    build_table->append({41});
+    _build_wrapper = std::make_shared<TableWrapper>(std::move(build_table));
+    _build_wrapper->execute();
+
+    _expected_result = std::make_shared<Table>();
+    _expected_result->add_column("b", DataType::Int);
+    _expected_result->add_column("a", DataType::Int);
+    _expected_result->append({41, 41});
+  }
+
+  std::shared_ptr<TableWrapper> _probe_wrapper, _build_wrapper;
+  std::shared_ptr<Table> _expected_result;
+};
+
+TEST_F(OperatorsJoinHashTest, InnerJoinSkipsProbeChunks) {
+  auto join = std::make_shared<JoinHash>(_build_wrapper, _probe_wrapper, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+  join->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), _expected_result);
+}
+
+TEST_F(OperatorsJoinHashTest, InnerJoinSkipsReferencedProbeChunks) {
+  auto scan = std::make_shared<TableScan>(_probe_wrapper, ColumnID{0}, ScanType::GreaterThan, 10);
+  scan->execute();
+
+  auto join = std::make_shared<JoinHash>(_build_wrapper, scan, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::Equals);
+  join->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), _expected_result);
+}
+
+TEST_F(OperatorsJoinHashTest, SemiJoinSkipsProbeChunks) {
+  auto join = std::make_shared<JoinHash>(_probe_wrapper, _build_wrapper, JoinMode::Semi,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+  join->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int);
+  expected_result->append({41});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
+TEST_F(OperatorsJoinHashTest, OuterJoinKeepsProbeChunks) {
+  auto join = std::make_shared<JoinHash>(_build_wrapper, _probe_wrapper, JoinMode::Right,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 12u);
+}
+
+TEST_F(OperatorsJoinHashTest, RadixPartitioningDoesNotChangeResult) {
+  // Duplicates on both sides, NULLs, and values without a join partner
+  const auto create_table = [](const int row_count, const int distinct_count) {
+    auto table = std::make_shared<Table>(100u);
+    table->add_column("a", DataType::Int, true);
+    for (auto row_index = 0; row_index < row_count; ++row_index) {
+      table->append({row_index % 97 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_index % distinct_count}});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto left = create_table(1'000, 300);
+  const auto right = create_table(2'000, 500);
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti}) {
+    const auto join = [&](const std::optional<size_t>& radix_bits) {
+      auto join = std::make_shared<JoinHash>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                             ScanType::Equals, std::vector<ColumnIDPair>{}, radix_bits);
+      join->execute();
+      return join->get_output();
+    };
+
+    const auto expected_result = join(0u);
+    EXPECT_TABLE_EQ_UNORDERED(join(std::nullopt), expected_result);
+    EXPECT_TABLE_EQ_UNORDERED(join(4u), expected_result);
+
+    // More partitions than a single pass creates
+    EXPECT_TABLE_EQ_UNORDERED(join(12u), expected_result);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, NegativeZeroMatchesZeroWithRadixPartitioning) {
+  auto left_table = std::make_shared<Table>();
+  left_table->add_column("a", DataType::Double);
+  left_table->append({-0.0});
+  auto left = std::make_shared<TableWrapper>(std::move(left_table));
+  left->execute();
+
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("b", DataType::Double);
+  right_table->append({0.0});
+  right_table->append({1.0});
+  auto right = std::make_shared<TableWrapper>(std::move(right_table));
+  right->execute();
+
+  auto join = std::make_shared<JoinHash>(left, right, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::Equals, std::vector<ColumnIDPair>{}, size_t{8});
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "constant_mappings.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+This contains the tests for joins with additional predicates. The expected results are computed by comparing all pairs
+of rows.
+*/
+
+template <typename T>
+class JoinMultiColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left_table = std::make_shared<Table>(3u);
+    left_table->add_column("a", DataType::Int);
+    left_table->add_column("b", DataType::String);
+    left_table->add_column("c", DataType::Float, true);
+    for (auto row = 0; row < 40; ++row) {
+      const auto c = row % 5 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<float>(row % 4)};
+      left_table->append({row % 7, "s" + std::to_string(row % 3), c});
+    }
+
+    // "s3" does not occur in the left table
+    auto right_table = std::make_shared<Table>(2u);
+    right_table->add_column("x", DataType::Int);
+    right_table->add_column("y", DataType::String);
+    right_table->add_column("z", DataType::Double, true);
+    for (auto row = 0; row < 30; ++row) {
+      const auto z = row % 6 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<double>(row % 3)};
+      right_table->append({row % 5, "s" + std::to_string(row % 4), z});
+    }
+    DictionaryCompression::compress_chunks(*right_table, {ChunkID{1}, ChunkID{4}});
+
+    _left = std::make_shared<TableWrapper>(std::move(left_table));
+    _left->execute();
+    _right = std::make_shared<TableWrapper>(std::move(right_table));
+    _right->execute();
+  }
+
+  static std::vector<JoinMode> supported_modes() {
+    if constexpr (std::is_same<T, JoinHash>::value) {
+      return {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti};
+    } else {
+      return {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer};
+    }
+  }
+
+  static std::vector<std::vector<AllTypeVariant>> get_rows(const Table& table) {
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        auto& row = rows.emplace_back();
+        for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+          row.emplace_back((*chunk->get_column(column_id))[chunk_offset]);
+        }
+      }
+    }
+    return rows;
+  }
+
+  static bool values_equal(const AllTypeVariant& left, const AllTypeVariant& right) {
+    if (variant_is_null(left) || variant_is_null(right)) return false;
+    if (left.type() == typeid(std::string)) return left == right;
+    return type_cast<double>(left) == type_cast<double>(right);
+  }
+
+  static std::shared_ptr<Table> expected_result(const Table& left, const Table& right, const JoinMode mode,
+                                                const std::vector<ColumnIDPair>& column_ids) {
+    auto result = std::make_shared<Table>();
+    for (ColumnID column_id{0}; column_id < left.column_count(); ++column_id) {
+      result->add_column(left.column_name(column_id), left.column_type(column_id), true);
+    }
+    if (mode != JoinMode::Semi && mode != JoinMode::Anti) {
+      for (ColumnID column_id{0}; column_id < right.column_count(); ++column_id) {
+        result->add_column(right.column_name(column_id), right.column_type(column_id), true);
+      }
+    }
+
+    const auto left_nulls = std::vector<AllTypeVariant>(left.column_count(), NULL_VALUE);
+    const auto right_nulls = std::vector<AllTypeVariant>(right.column_count(), NULL_VALUE);
+    const auto left_rows = get_rows(left);
+    const auto right_rows = get_rows(right);
+    auto right_has_match = std::vector<bool>(right_rows.size(), false);
+
+    for (const auto& left_row : left_rows) {
+      // Like single-column anti joins, those with additional predicates drop rows with NULL join values
+      if (mode == JoinMode::Anti) {
+        const auto has_null = std::any_of(column_ids.begin(), column_ids.end(), [&](const ColumnIDPair& column_ids) {
+          return variant_is_null(left_row[column_ids.first]);
+        });
+        if (has_null) continue;
+      }
+
+      auto left_has_match = false;
+
+      for (auto right_row_idx = size_t{0}; right_row_idx < right_rows.size(); ++right_row_idx) {
+        const auto& right_row = right_rows[right_row_idx];
+
+        auto match = true;
+        for (const auto& [left_column_id, right_column_id] : column_ids) {
+          match &= values_equal(left_row[left_column_id], right_row[right_column_id]);
+        }
+        if (!match) continue;
+
+        left_has_match = true;
+        right_has_match[right_row_idx] = true;
+        if (mode == JoinMode::Semi || mode == JoinMode::Anti) continue;
+
+        auto row = left_row;
+        row.insert(row.end(), right_row.begin(), right_row.end());
+        result->append(row);
+      }
+
+      if ((mode == JoinMode::Semi && left_has_match) || (mode == JoinMode::Anti && !left_has_match)) {
+        result->append(left_row);
+      } else if (!left_has_match && (mode == JoinMode::Left || mode == JoinMode::Outer)) {
+        auto row = left_row;
+        row.insert(row.end(), right_nulls.begin(), right_nulls.end());
+        result->append(row);
+      }
+    }
+
+    if (mode == JoinMode::Right || mode == JoinMode::Outer) {
+      for (auto right_row_idx = size_t{0}; right_row_idx < right_rows.size(); ++right_row_idx) {
+        if (right_has_match[right_row_idx]) continue;
+        auto row = left_nulls;
+        row.insert(row.end(), right_rows[right_row_idx].begin(), right_rows[right_row_idx].end());
+        result->append(row);
+      }
+    }
+
+    return result;
+  }
+
+  void test_join(const std::shared_ptr<const AbstractOperator>& left,
+                 const std::shared_ptr<const AbstractOperator>& right,
+                 const std::vector<ColumnIDPair>& additional_column_ids) {
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+    auto all_column_ids = std::vector<ColumnIDPair>{column_ids};
+    all_column_ids.insert(all_column_ids.end(), additional_column_ids.begin(), additional_column_ids.end());
+
+    for (const auto mode : supported_modes()) {
+      SCOPED_TRACE(join_mode_to_string.at(mode));
+
+      auto join = std::make_shared<T>(left, right, mode, column_ids, ScanType::Equals, additional_column_ids);
+      join->execute();
+
+      const auto expected = expected_result(*left->get_output(), *right->get_output(), mode, all_column_ids);
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected);
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _left, _right;
+};
+
+using JoinMultiColumnTypes = ::testing::Types<JoinHash, JoinSortMerge>;
+TYPED_TEST_CASE(JoinMultiColumnTest, JoinMultiColumnTypes);
+
+TYPED_TEST(JoinMultiColumnTest, IntAndString) {
+  this->test_join(this->_left, this->_right, {ColumnIDPair{ColumnID{1}, ColumnID{1}}});
+}
+
+TYPED_TEST(JoinMultiColumnTest, FloatAndDoubleWithNulls) {
+  this->test_join(this->_left, this->_right, {ColumnIDPair{ColumnID{2}, ColumnID{2}}});
+}
+
+TYPED_TEST(JoinMultiColumnTest, ThreeColumns) {
+  this->test_join(this->_left, this->_right,
+                  {ColumnIDPair{ColumnID{2}, ColumnID{2}}, ColumnIDPair{ColumnID{1}, ColumnID{1}}});
+}
+
+TYPED_TEST(JoinMultiColumnTest, ReferenceColumns) {
+  auto left_scan = std::make_shared<TableScan>(this->_left, ColumnID{0}, ScanType::GreaterThanEquals, 1);
+  left_scan->execute();
+  auto right_scan = std::make_shared<TableScan>(this->_right, ColumnID{1}, ScanType::NotEquals, "s0");
+  right_scan->execute();
+
+  this->test_join(left_scan, right_scan, {ColumnIDPair{ColumnID{1}, ColumnID{1}}});
+}
+
+TYPED_TEST(JoinMultiColumnTest, Description) {
+  auto join = std::make_shared<TypeParam>(this->_left, this->_right, JoinMode::Inner,
+                                          ColumnIDPair{ColumnID{0}, ColumnID{0}}, ScanType::Equals,
+                                          std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{1}}});
+  join->execute();
+
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine),
+            join->name() + " (Inner Join where a = x AND b = y)");
+  EXPECT_EQ(join->recreate()->description(DescriptionMode::SingleLine),
+            join->name() + " (Inner Join where Col #0 = Col #0 AND Col #1 = Col #1)");
+}
+
+}  // namespace opossum
@@ -0,0 +1,360 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Int);
+    for (auto row = 0; row < 1000; ++row) {
+      table->append({row % 50, (row * 7) % 31});
+    }
+    DictionaryCompression::compress_chunks(*table, {ChunkID{2}, ChunkID{5}});
+    _table = table;
+
+    _table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    _table_wrapper->execute();
+
+    auto build_table = std::make_shared<Table>(10);
+    build_table->add_column("c", DataType::Int, true);
+    build_table->add_column("d", DataType::Int);
+    for (auto row = 0; row < 30; ++row) {
+      build_table->append({row % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row % 20}, row});
+    }
+
+    _build_wrapper = std::make_shared<TableWrapper>(std::move(build_table));
+    _build_wrapper->execute();
+  }
+
+  // Executes the stages one after another, as if they were not fused, and compares the output to the Pipeline's
+  void test_pipeline(const std::shared_ptr<const AbstractOperator>& input,
+                     const std::vector<std::shared_ptr<const AbstractOperator>>& stages,
+                     const std::shared_ptr<const AbstractOperator>& build_input = nullptr) {
+    auto pipeline = std::make_shared<Pipeline>(input, stages, build_input);
+    pipeline->execute();
+
+    for (const auto& stage : stages) {
+      std::const_pointer_cast<AbstractOperator>(stage)->execute();
+    }
+
+    // JoinHash does not guarantee the order of its output
+    if (build_input) {
+      EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), stages.back()->get_output());
+    } else {
+      EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), stages.back()->get_output());
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableWrapper> _build_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, ScansAndProjection) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThanEquals, 10);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::LessThan, 20);
+  auto projection = std::make_shared<Projection>(
+      scan_b, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1}),
+                                            PQPExpression::create_binary_operator(
+                                                ExpressionType::Addition, PQPExpression::create_column(ColumnID{0}),
+                                                PQPExpression::create_column(ColumnID{1}), {"a+b"})});
+
+  test_pipeline(_table_wrapper, {scan_a, scan_b, projection});
+}
+
+TEST_F(OperatorsPipelineTest, OutputReferencesInputTable) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::LessThan, 5);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::NotEquals, 3);
+
+  test_pipeline(_table_wrapper, {scan_a, scan_b});
+
+  // The output references the input table, not a table per morsel
+  auto pipeline = std::make_shared<Pipeline>(_table_wrapper, std::vector<std::shared_ptr<const AbstractOperator>>{
+                                                                 scan_a, scan_b});
+  pipeline->execute();
+
+  const auto output = pipeline->get_output();
+  EXPECT_EQ(output->chunk_count(), _table->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(
+        output->get_chunk(chunk_id)->get_column(ColumnID{1}));
+    ASSERT_TRUE(column);
+    EXPECT_EQ(column->referenced_table(), _table);
+    EXPECT_EQ((*column->pos_list())[0].chunk_id, chunk_id);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::GreaterThan, 4);
+  scan->execute();
+
+  auto scan_b = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::LessThanEquals, 30);
+  auto projection = std::make_shared<Projection>(
+      scan_b, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1}),
+                                            PQPExpression::create_column(ColumnID{0})});
+
+  test_pipeline(scan, {scan_b, projection});
+}
+
+TEST_F(OperatorsPipelineTest, EmptyOutput) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThan, 100);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::GreaterThan, 0);
+
+  test_pipeline(_table_wrapper, {scan_a, scan_b});
+}
+
+TEST_F(OperatorsPipelineTest, EmptyInput) {
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column("a", DataType::Int);
+  empty_table->add_column("b", DataType::Int);
+  auto empty_table_wrapper = std::make_shared<TableWrapper>(std::move(empty_table));
+  empty_table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(empty_table_wrapper, ColumnID{0}, ScanType::GreaterThan, 5);
+  auto projection = std::make_shared<Projection>(
+      scan, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1}, std::string{"b2"})});
+
+  test_pipeline(empty_table_wrapper, {scan, projection});
+
+  // Without any chunk that has columns, the output still has the columns of the last stage
+  auto layout_table_wrapper = std::make_shared<TableWrapper>(Table::create_with_layout_from(_table));
+  layout_table_wrapper->execute();
+
+  auto pipeline = std::make_shared<Pipeline>(layout_table_wrapper,
+                                             std::vector<std::shared_ptr<const AbstractOperator>>{scan, projection});
+  pipeline->execute();
+
+  const auto output = pipeline->get_output();
+  EXPECT_EQ(output->row_count(), 0u);
+  ASSERT_EQ(output->column_count(), 1u);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "b2");
+  EXPECT_EQ(output->column_type(ColumnID{0}), DataType::Int);
+}
+
+TEST_F(OperatorsPipelineTest, ExcludedChunks) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThan, 5);
+  scan_a->set_excluded_chunk_ids({ChunkID{0}, ChunkID{2}, ChunkID{9}});
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::LessThan, 10);
+
+  test_pipeline(_table_wrapper, {scan_a, scan_b});
+
+  // All chunks excluded
+  auto all_chunk_ids = std::vector<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) all_chunk_ids.emplace_back(chunk_id);
+  auto scan_c = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThan, 5);
+  scan_c->set_excluded_chunk_ids(all_chunk_ids);
+  auto scan_d = std::make_shared<TableScan>(scan_c, ColumnID{1}, ScanType::LessThan, 10);
+
+  test_pipeline(_table_wrapper, {scan_c, scan_d});
+}
+
+TEST_F(OperatorsPipelineTest, Validate) {
+  auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto mvcc_columns = table->get_chunk(chunk_id)->mvcc_columns();
+    for (auto chunk_offset = 0u; chunk_offset < table->get_chunk(chunk_id)->size(); ++chunk_offset) {
+      mvcc_columns->begin_cids[chunk_offset] = 0u;
+      mvcc_columns->end_cids[chunk_offset] = Chunk::MAX_COMMIT_ID;
+    }
+  }
+  auto mvcc_columns = table->get_chunk(ChunkID{1})->mvcc_columns();
+  mvcc_columns->any_row_invalidated = true;
+  mvcc_columns->end_cids[0] = 2u;
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  auto scan = std::make_shared<TableScan>(validate, ColumnID{0}, ScanType::GreaterThanEquals, 2);
+  validate->set_transaction_context(context);
+  scan->set_transaction_context(context);
+
+  auto pipeline =
+      std::make_shared<Pipeline>(table_wrapper, std::vector<std::shared_ptr<const AbstractOperator>>{validate, scan});
+  pipeline->set_transaction_context(context);
+  pipeline->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(),
+                            load_table("src/test/tables/validate_output_validated_scanned.tbl", 2u));
+}
+
+TEST_F(OperatorsPipelineTest, WithScheduler) {
+  auto nodes = std::vector<TopologyNode>{};
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}, TopologyCpu{CpuID{1}}});
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{2}}, TopologyCpu{CpuID{3}}});
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 4)));
+
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::LessThan, 30);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::GreaterThanEquals, 7);
+  auto projection = std::make_shared<Projection>(
+      scan_b, Projection::ColumnExpressions{PQPExpression::create_binary_operator(
+                  ExpressionType::Multiplication, PQPExpression::create_column(ColumnID{0}),
+                  PQPExpression::create_column(ColumnID{1}), {"a*b"})});
+
+  auto pipeline = std::make_shared<Pipeline>(
+      _table_wrapper, std::vector<std::shared_ptr<const AbstractOperator>>{scan_a, scan_b, projection});
+  pipeline->execute();
+
+  CurrentScheduler::set(nullptr);
+
+  // Without a scheduler, the operators produce their output chunks in the order of their input chunks
+  scan_a->execute();
+  scan_b->execute();
+  projection->execute();
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), projection->get_output());
+}
+
+TEST_F(OperatorsPipelineTest, JoinHashProbingLeftInput) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::Anti}) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThanEquals, 10);
+    auto join = std::make_shared<JoinHash>(scan, _build_wrapper, mode, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                           ScanType::Equals);
+
+    test_pipeline(_table_wrapper, {scan, join}, _build_wrapper);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, JoinHashProbingRightInput) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Right}) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::LessThan, 25);
+    auto join = std::make_shared<JoinHash>(_build_wrapper, scan, mode, ColumnIDPair{ColumnID{0}, ColumnID{1}},
+                                           ScanType::Equals);
+    auto projection = std::make_shared<Projection>(
+        join, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{3}),
+                                            PQPExpression::create_column(ColumnID{1})});
+
+    test_pipeline(_table_wrapper, {scan, join, projection}, _build_wrapper);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, JoinHashAsFirstStage) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper, _build_wrapper, JoinMode::Inner,
+                                         ColumnIDPair{ColumnID{1}, ColumnID{0}}, ScanType::Equals);
+
+  test_pipeline(_table_wrapper, {join}, _build_wrapper);
+}
+
+TEST_F(OperatorsPipelineTest, JoinHashWithEmptyBuildInput) {
+  auto build_scan = std::make_shared<TableScan>(_build_wrapper, ColumnID{1}, ScanType::GreaterThan, 100);
+  build_scan->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Anti}) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::LessThan, 20);
+    auto join = std::make_shared<JoinHash>(scan, build_scan, mode, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                           ScanType::Equals);
+
+    test_pipeline(_table_wrapper, {scan, join}, build_scan);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, CanAppendStage) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::LessThan, 5);
+  auto scan_with_excluded_chunks = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::LessThan, 5);
+  scan_with_excluded_chunks->set_excluded_chunk_ids({ChunkID{1}});
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{0})});
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0});
+
+  EXPECT_TRUE(Pipeline::can_append_stage({}, *scan));
+  EXPECT_TRUE(Pipeline::can_append_stage({}, *scan_with_excluded_chunks));
+  EXPECT_TRUE(Pipeline::can_append_stage({}, *validate));
+  EXPECT_TRUE(Pipeline::can_append_stage({}, *projection));
+  EXPECT_FALSE(Pipeline::can_append_stage({}, *sort));
+
+  EXPECT_TRUE(Pipeline::can_append_stage({validate}, *scan));
+  EXPECT_FALSE(Pipeline::can_append_stage({validate}, *scan_with_excluded_chunks));
+  EXPECT_TRUE(Pipeline::can_append_stage({scan, validate}, *projection));
+  EXPECT_TRUE(Pipeline::can_append_stage({scan, projection}, *projection));
+  EXPECT_FALSE(Pipeline::can_append_stage({scan, projection}, *scan));
+  EXPECT_FALSE(Pipeline::can_append_stage({projection}, *validate));
+
+  const auto join_column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+  auto join = std::make_shared<JoinHash>(scan, _build_wrapper, JoinMode::Inner, join_column_ids, ScanType::Equals);
+  auto join_with_additional_predicates =
+      std::make_shared<JoinHash>(scan, _build_wrapper, JoinMode::Inner, join_column_ids, ScanType::Equals,
+                                 std::vector<ColumnIDPair>{ColumnIDPair{ColumnID{1}, ColumnID{1}}});
+  auto outer_join = std::make_shared<JoinHash>(scan, _build_wrapper, JoinMode::Outer, join_column_ids,
+                                               ScanType::Equals);
+
+  EXPECT_TRUE(Pipeline::can_append_stage({}, *join));
+  EXPECT_TRUE(Pipeline::can_append_stage({scan, validate}, *join));
+  EXPECT_FALSE(Pipeline::can_append_stage({scan}, *join_with_additional_predicates));
+  EXPECT_FALSE(Pipeline::can_append_stage({scan}, *outer_join));
+  EXPECT_FALSE(Pipeline::can_append_stage({projection}, *join));
+  EXPECT_TRUE(Pipeline::can_append_stage({scan, join}, *projection));
+  EXPECT_FALSE(Pipeline::can_append_stage({scan, join}, *scan));
+  EXPECT_FALSE(Pipeline::can_append_stage({scan, join}, *join));
+}
+
+TEST_F(OperatorsPipelineTest, DescriptionAndRecreation) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThanEquals, 10);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::LessThan, ValuePlaceholder{0});
+  auto pipeline = std::make_shared<Pipeline>(_table_wrapper,
+                                             std::vector<std::shared_ptr<const AbstractOperator>>{scan_a, scan_b});
+
+  EXPECT_EQ(pipeline->description(DescriptionMode::SingleLine),
+            "Pipeline (TableScan (a >= 10) -> TableScan (Col #1 < Placeholder #0))");
+
+  auto recreated_pipeline = pipeline->recreate({AllParameterVariant{20}});
+
+  // The table wrapper needs to be executed manually
+  recreated_pipeline->mutable_input_left()->execute();
+  recreated_pipeline->execute();
+
+  auto scan_c = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::LessThan, 20);
+  scan_a->execute();
+  scan_c->execute();
+  EXPECT_TABLE_EQ_ORDERED(recreated_pipeline->get_output(), scan_c->get_output());
+}
+
+TEST_F(OperatorsPipelineTest, JoinHashRecreation) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::LessThan, ValuePlaceholder{0});
+  auto join = std::make_shared<JoinHash>(_build_wrapper, scan, JoinMode::Right, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                         ScanType::Equals);
+  auto pipeline =
+      std::make_shared<Pipeline>(_table_wrapper, std::vector<std::shared_ptr<const AbstractOperator>>{scan, join},
+                                 _build_wrapper);
+
+  auto recreated_pipeline = pipeline->recreate({AllParameterVariant{20}});
+  ASSERT_TRUE(recreated_pipeline->input_right());
+
+  // The table wrappers need to be executed manually
+  recreated_pipeline->mutable_input_left()->execute();
+  recreated_pipeline->mutable_input_right()->execute();
+  recreated_pipeline->execute();
+
+  auto expected_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::LessThan, 20);
+  auto expected_join = std::make_shared<JoinHash>(_build_wrapper, expected_scan, JoinMode::Right,
+                                                  ColumnIDPair{ColumnID{0}, ColumnID{0}}, ScanType::Equals);
+  expected_scan->execute();
+  expected_join->execute();
+  EXPECT_TABLE_EQ_UNORDERED(recreated_pipeline->get_output(), expected_join->get_output());
+}
+
+}  // namespace opossum
@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <numeric>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -13,6 +17,7 @@
 #include "storage/dictionary_compression.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -130,6 +135,97 @@ TEST_F(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_F(OperatorsSortTest, MultipleColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}}}, 2u);
+  sort->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float2_sorted.tbl", 2));
+
+  auto sort_mixed = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort_mixed->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_mixed->get_output(), load_table("src/test/tables/int_float2_sorted_mixed.tbl", 2));
+}
+
+TEST_F(OperatorsSortTest, MultipleColumnSortOfManyRows) {
+  // Enough rows for the sample sort to use multiple buckets. The strings share prefixes longer than those in the
+  // normalized keys, and the doubles contain both -0.0 and 0.0.
+  const auto row_count = 150'000;
+  auto table = std::make_shared<Table>(10'000);
+  table->add_column("a", DataType::String, true);
+  table->add_column("b", DataType::Double, true);
+  table->add_column("c", DataType::Int);
+
+  for (auto row = 0; row < row_count; ++row) {
+    const auto a = row % 11 == 0 ? AllTypeVariant{NULL_VALUE}
+                                 : AllTypeVariant{"common_prefix_" + std::to_string((row * 7) % 5)};
+    const auto b = row % 13 == 0 ? AllTypeVariant{NULL_VALUE}
+                                 : AllTypeVariant{row % 17 == 0 ? -0.0 : static_cast<double>((row * 31) % 97) - 48.5};
+    table->append({a, b, (row * 7919) % 1000 - 500});
+  }
+  DictionaryCompression::compress_chunks(*table, {ChunkID{1}, ChunkID{4}, ChunkID{9}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto definitions = std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                                                             {ColumnID{1}, OrderByMode::Ascending},
+                                                             {ColumnID{2}, OrderByMode::Descending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, definitions, 20'000u);
+  sort->execute();
+
+  // Compute the expected order with a stable sort on the rows of the input table
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      rows.emplace_back(std::vector<AllTypeVariant>{(*chunk->get_column(ColumnID{0}))[chunk_offset],
+                                                    (*chunk->get_column(ColumnID{1}))[chunk_offset],
+                                                    (*chunk->get_column(ColumnID{2}))[chunk_offset]});
+    }
+  }
+
+  std::stable_sort(rows.begin(), rows.end(), [](const auto& left, const auto& right) {
+    // a: descending, NULLs last
+    if (variant_is_null(left[0]) != variant_is_null(right[0])) return variant_is_null(right[0]);
+    if (!variant_is_null(left[0]) && left[0] != right[0]) return right[0] < left[0];
+
+    // b: ascending, NULLs first
+    if (variant_is_null(left[1]) != variant_is_null(right[1])) return variant_is_null(left[1]);
+    if (!variant_is_null(left[1]) && type_cast<double>(left[1]) != type_cast<double>(right[1])) {
+      return type_cast<double>(left[1]) < type_cast<double>(right[1]);
+    }
+
+    // c: descending
+    return right[2] < left[2];
+  });
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::String, true);
+  expected_result->add_column("b", DataType::Double, true);
+  expected_result->add_column("c", DataType::Int);
+  for (const auto& row : rows) expected_result->append(row);
+
+  const auto output = sort->get_output();
+  EXPECT_EQ(output->chunk_count(), ChunkID{8});
+  EXPECT_TABLE_EQ_ORDERED(output, expected_result);
+}
+
+TEST_F(OperatorsSortTest, Description) {
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::DescendingNullsLast}, {ColumnID{0}}});
+
+  EXPECT_EQ(sort->description(DescriptionMode::SingleLine), "Sort (b DescendingNullsLast, a Ascending)");
+  EXPECT_EQ(sort->recreate()->description(DescriptionMode::SingleLine),
+            "Sort (Col #1 DescendingNullsLast, Col #0 Ascending)");
+}
+
 TEST_F(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
 
@@ -40,9 +40,18 @@ class OperatorsTableScanLikeTest : public BaseTest {
 
     _gt_string_dict = std::make_shared<GetTable>("table_string_dict");
     _gt_string_dict->execute();
+
+    // load and run-length encode string table
+    auto test_table_string_run_length = load_table("src/test/tables/int_string_like.tbl", 5);
+    DictionaryCompression::compress_chunks(*test_table_string_run_length, {ChunkID{0}}, EncodingType::RunLength);
+
+    StorageManager::get().add_table("table_string_run_length", test_table_string_run_length);
+
+    _gt_string_run_length = std::make_shared<GetTable>("table_string_run_length");
+    _gt_string_run_length->execute();
   }
 
-  std::shared_ptr<GetTable> _gt, _gt_string, _gt_string_dict;
+  std::shared_ptr<GetTable> _gt, _gt_string, _gt_string_dict, _gt_string_run_length;
 };
 
 /*
@@ -117,6 +126,20 @@ TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnReferencedDictColumn) {
   scan2->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
 }
+TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnRunLengthColumn) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_gt_string_run_length, ColumnID{1}, ScanType::Like, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnReferencedRunLengthColumn) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
+  auto scan1 = std::make_shared<TableScan>(_gt_string_run_length, ColumnID{0}, ScanType::GreaterThan, 0);
+  scan1->execute();
+  auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{1}, ScanType::Like, "Dampf%");
+  scan2->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
+}
 // ScanType::Like - Ending
 TEST_F(OperatorsTableScanLikeTest, ScanLikeEnding) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_ending.tbl", 1);
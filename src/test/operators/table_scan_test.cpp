@@ -11,6 +11,7 @@
 #include "gtest/gtest.h"
 
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/join_hash.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/dictionary_compression.hpp"
@@ -105,6 +106,41 @@ class OperatorsTableScanTest : public BaseTest {
     return table_wrapper;
   }
 
+  std::shared_ptr<TableWrapper> get_table_op_run_length() {
+    // Column "a" consists of runs of equal values, column "b" is unique
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Int);
+
+    const auto values = std::vector<int>{1, 1, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6};
+    for (auto index = 0u; index < values.size(); ++index) {
+      table->append({values[index], static_cast<int>(100 + index)});
+    }
+
+    DictionaryCompression::compress_table(*table, EncodingType::RunLength);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> get_table_frame_of_reference_keys() {
+    // Column "a" consists of increasing keys spanning multiple frames with a null value every 7 rows
+    auto table = std::make_shared<Table>(5000);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::Long);
+
+    for (auto index = 0; index < 6000; ++index) {
+      if (index % 7 == 6) {
+        table->append({NULL_VALUE, int64_t{index}});
+      } else {
+        table->append({1000 + index, int64_t{index}});
+      }
+    }
+
+    return table;
+  }
+
   std::shared_ptr<const Table> to_referencing_table(const std::shared_ptr<const Table>& table) {
     auto table_out = std::make_shared<Table>();
 
@@ -441,6 +477,65 @@ TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
 }
 
+TEST_F(OperatorsTableScanTest, ScanPrunesChunksUsingStatistics) {
+  // One row per chunk with a = 12345, 123, and 1234
+  auto table = load_table("src/test/tables/int_float.tbl", 1);
+  DictionaryCompression::compress_table(*table);
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  // All chunks are pruned, but the output keeps the input's columns
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::Equals, 1000);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan_1->get_output()->column_count(), 2u);
+  EXPECT_EQ(scan_1->get_output()->get_chunk(ChunkID{0})->column_count(), 2u);
+
+  // Chunks of reference tables are pruned using the statistics of the referenced chunks
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::GreaterThan, 0);
+  scan_2->execute();
+  auto scan_3 = std::make_shared<TableScan>(scan_2, ColumnID{1}, ScanType::Equals, 457.7f);
+  scan_3->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan_3->get_output(), load_table("src/test/tables/int_float_filtered.tbl", 1));
+
+  auto scan_4 = std::make_shared<TableScan>(scan_2, ColumnID{1}, ScanType::Equals, 400.0f);
+  scan_4->execute();
+  EXPECT_EQ(scan_4->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan_4->get_output()->get_chunk(ChunkID{0})->column_count(), 2u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanDoesNotPruneNullRowsOfOuterJoins) {
+  auto left_table = std::make_shared<Table>(10);
+  left_table->add_column("a", DataType::Int);
+  for (auto value : {1, 2, 3}) left_table->append({value});
+  auto left_wrapper = std::make_shared<TableWrapper>(std::move(left_table));
+  left_wrapper->execute();
+
+  // The single chunk of the right table has statistics without any NULL value
+  auto right_table = std::make_shared<Table>(10);
+  right_table->add_column("b", DataType::Int);
+  right_table->append({2});
+  DictionaryCompression::compress_table(*right_table);
+  auto right_wrapper = std::make_shared<TableWrapper>(std::move(right_table));
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, JoinMode::Left,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), ScanType::Equals);
+  join->execute();
+
+  // The NULL rows of the join reference chunk 0 of the right table, but must not be pruned by its statistics
+  auto scan = std::make_shared<TableScan>(join, ColumnID{1}, ScanType::IsNull, NULL_VALUE);
+  scan->execute();
+
+  auto expected_table = std::make_shared<Table>();
+  expected_table->add_column("a", DataType::Int);
+  expected_table->add_column("b", DataType::Int, true);
+  expected_table->append({1, NULL_VALUE});
+  expected_table->append({3, NULL_VALUE});
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_table);
+}
+
 TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
   // 2**8 + 1 values require a data type of 16bit.
   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
@@ -587,4 +682,153 @@ TEST_F(OperatorsTableScanTest, ScanWithExcludedFirstChunk) {
   ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
 }
 
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthColumn) {
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::Equals] = {105, 106, 107, 108};
+  tests[ScanType::NotEquals] = {100, 101, 102, 103, 104, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119};
+  tests[ScanType::LessThan] = {100, 101, 102, 103, 104};
+  tests[ScanType::LessThanEquals] = {100, 101, 102, 103, 104, 105, 106, 107, 108};
+  tests[ScanType::GreaterThan] = {109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119};
+  tests[ScanType::GreaterThanEquals] = {105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119};
+
+  const auto table_wrapper = get_table_op_run_length();
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 3);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedRunLengthColumn) {
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::Equals] = {109, 110, 111};
+  tests[ScanType::NotEquals] = {102, 103, 104, 105, 106, 107, 108, 112, 113, 114, 115, 116, 117, 118, 119};
+  tests[ScanType::LessThan] = {102, 103, 104, 105, 106, 107, 108};
+  tests[ScanType::GreaterThanEquals] = {109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119};
+
+  // Removes the first two rows, so that the second scan is executed on reference columns
+  auto scan_1 = std::make_shared<TableScan>(get_table_op_run_length(), ColumnID{1}, ScanType::GreaterThanEquals, 102);
+  scan_1->execute();
+
+  for (const auto& test : tests) {
+    auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, test.first, 4);
+    scan_2->execute();
+
+    ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanForNullValuesOnRunLengthColumn) {
+  auto table = load_table("src/test/tables/int_float_w_null_8_rows.tbl", 4);
+  DictionaryCompression::compress_table(*table, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{
+      {ScanType::IsNull, {12, 123}}, {ScanType::IsNotNull, {12345, NULL_VALUE, 1234, 12345, 12, 1234}}};
+
+  scan_for_null_values(table_wrapper, tests);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceColumn) {
+  auto value_table_wrapper = std::make_shared<TableWrapper>(get_table_frame_of_reference_keys());
+  value_table_wrapper->execute();
+
+  auto encoded_table = get_table_frame_of_reference_keys();
+  DictionaryCompression::compress_table(*encoded_table, EncodingType::FrameOfReference);
+  auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  const auto scan_types = {ScanType::Equals,         ScanType::NotEquals,   ScanType::LessThan,
+                           ScanType::LessThanEquals, ScanType::GreaterThan, ScanType::GreaterThanEquals};
+
+  // Values before, at the border of, within, and behind the frames
+  for (const auto value : {0, 1000, 1006, 3047, 3048, 5500, 6999, 8000}) {
+    for (const auto scan_type : scan_types) {
+      auto expected_scan = std::make_shared<TableScan>(value_table_wrapper, ColumnID{0}, scan_type, value);
+      expected_scan->execute();
+
+      auto scan = std::make_shared<TableScan>(encoded_table_wrapper, ColumnID{0}, scan_type, value);
+      scan->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_scan->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedFrameOfReferenceColumn) {
+  auto value_table_wrapper = std::make_shared<TableWrapper>(get_table_frame_of_reference_keys());
+  value_table_wrapper->execute();
+
+  auto encoded_table = get_table_frame_of_reference_keys();
+  DictionaryCompression::compress_table(*encoded_table, EncodingType::FrameOfReference);
+  auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  // Removes every other row, so that the second scan is executed on reference columns
+  auto expected_scan_1 = std::make_shared<TableScan>(value_table_wrapper, ColumnID{1}, ScanType::GreaterThan, 1500);
+  expected_scan_1->execute();
+  auto scan_1 = std::make_shared<TableScan>(encoded_table_wrapper, ColumnID{1}, ScanType::GreaterThan, 1500);
+  scan_1->execute();
+
+  const auto scan_types = {ScanType::Equals, ScanType::NotEquals, ScanType::LessThan, ScanType::GreaterThanEquals};
+
+  for (const auto scan_type : scan_types) {
+    for (const auto value : {0, 2400, 3100, 5500, 8000}) {
+      auto expected_scan_2 = std::make_shared<TableScan>(expected_scan_1, ColumnID{0}, scan_type, value);
+      expected_scan_2->execute();
+
+      auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, scan_type, value);
+      scan_2->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(scan_2->get_output(), expected_scan_2->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanForNullValuesOnFrameOfReferenceColumn) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::Int);
+
+  for (auto row : std::vector<std::vector<AllTypeVariant>>{
+           {12345, 1}, {NULL_VALUE, 2}, {1234, 3}, {12345, 4}, {NULL_VALUE, 5}, {NULL_VALUE, 6}, {12, 7}}) {
+    table->append(row);
+  }
+
+  DictionaryCompression::compress_table(*table, EncodingType::FrameOfReference);
+
+  // Scans both the encoded column and a reference column pointing to it
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto referencing_table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(table));
+  referencing_table_wrapper->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<TableWrapper>>{table_wrapper, referencing_table_wrapper}) {
+    auto scan = std::make_shared<TableScan>(input, ColumnID{0}, ScanType::IsNull, NULL_VALUE);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {2, 5, 6});
+
+    scan = std::make_shared<TableScan>(input, ColumnID{0}, ScanType::IsNotNull, NULL_VALUE);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {1, 3, 4, 7});
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanForNullValuesOnReferencedRunLengthColumn) {
+  auto table = load_table("src/test/tables/int_float_w_null_8_rows.tbl", 4);
+  DictionaryCompression::compress_table(*table, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(table));
+  table_wrapper->execute();
+
+  const auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{
+      {ScanType::IsNull, {12, 123}}, {ScanType::IsNotNull, {12345, NULL_VALUE, 1234, 12345, 12, 1234}}};
+
+  scan_for_null_values(table_wrapper, tests);
+}
+
 }  // namespace opossum
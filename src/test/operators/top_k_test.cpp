@@ -0,0 +1,111 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+
+    // Many duplicates, NULLs, and strings that only differ after their first characters
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::String);
+    for (auto row = 0; row < 1000; ++row) {
+      const auto a = row % 9 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(row * 7) % 13};
+      table->append({a, "string_" + std::to_string((row * 11) % 17)});
+    }
+    DictionaryCompression::compress_chunks(*table, {ChunkID{2}, ChunkID{5}});
+
+    _table_wrapper_many_rows = std::make_shared<TableWrapper>(std::move(table));
+    _table_wrapper_many_rows->execute();
+  }
+
+  // TopK has to return the same rows in the same order as a Sort followed by a Limit
+  void test_top_k(const std::shared_ptr<const AbstractOperator>& input,
+                  const std::vector<SortColumnDefinition>& definitions, const size_t num_rows) {
+    auto top_k = std::make_shared<TopK>(input, definitions, num_rows);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, num_rows);
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_many_rows;
+};
+
+TEST_F(OperatorsTopKTest, AscendingTopKOfOneColumn) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 2u);
+  top_k->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int);
+  expected_result->add_column("b", DataType::Float);
+  expected_result->append({123, 456.7f});
+  expected_result->append({1234, 457.7f});
+
+  EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), expected_result);
+  EXPECT_EQ(top_k->get_output()->get_type(), TableType::References);
+}
+
+TEST_F(OperatorsTopKTest, MoreRowsThanInput) {
+  test_top_k(_table_wrapper, {{ColumnID{1}, OrderByMode::Descending}}, 10u);
+}
+
+TEST_F(OperatorsTopKTest, ZeroRows) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 0u);
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_count(), 2u);
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumnsWithNulls) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    test_top_k(_table_wrapper_many_rows, {{ColumnID{0}, order_by_mode}, {ColumnID{1}, OrderByMode::Descending}}, 150u);
+  }
+}
+
+TEST_F(OperatorsTopKTest, TiesKeepInputOrder) {
+  test_top_k(_table_wrapper_many_rows, {{ColumnID{1}}}, 123u);
+}
+
+TEST_F(OperatorsTopKTest, ReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_many_rows, ColumnID{0}, ScanType::GreaterThan, 3);
+  scan->execute();
+
+  test_top_k(scan, {{ColumnID{0}, OrderByMode::Descending}}, 50u);
+}
+
+TEST_F(OperatorsTopKTest, Description) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::DescendingNullsLast}, {ColumnID{0}}}, 10u);
+
+  EXPECT_EQ(top_k->description(DescriptionMode::SingleLine), "TopK (10 rows by b DescendingNullsLast, a Ascending)");
+  EXPECT_EQ(top_k->recreate()->description(DescriptionMode::SingleLine),
+            "TopK (10 rows by Col #1 DescendingNullsLast, Col #0 Ascending)");
+}
+
+}  // namespace opossum
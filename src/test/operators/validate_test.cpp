@@ -7,11 +7,15 @@
 #include "gtest/gtest.h"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -49,7 +53,9 @@ void OperatorsValidateTest::set_all_records_visible(Table& table) {
 }
 
 void OperatorsValidateTest::set_record_invisible_for(Table& table, RowID row, CommitID end_cid) {
-  table.get_chunk(row.chunk_id)->mvcc_columns()->end_cids[row.chunk_offset] = end_cid;
+  auto mvcc_columns = table.get_chunk(row.chunk_id)->mvcc_columns();
+  mvcc_columns->any_row_invalidated = true;
+  mvcc_columns->end_cids[row.chunk_offset] = end_cid;
 }
 
 TEST_F(OperatorsValidateTest, SimpleValidate) {
@@ -80,4 +86,62 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, VisibleChunksShareInputPosList) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::GreaterThanEquals, 0);
+  table_scan->execute();
+
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto get_pos_list = [](const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+    const auto column = table->get_chunk(chunk_id)->get_column(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceColumn>(column)->pos_list();
+  };
+
+  // All rows of the first chunk are visible, one row of the second is not
+  const auto output = validate->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(get_pos_list(output, ChunkID{0}), get_pos_list(table_scan->get_output(), ChunkID{0}));
+  EXPECT_EQ(get_pos_list(output, ChunkID{1})->size(), 1u);
+  EXPECT_EQ(output->row_count(), 3u);
+}
+
+TEST_F(OperatorsValidateTest, ChunkVisibilityFollowsCommits) {
+  auto table = load_table("src/test/tables/validate_input.tbl", 10u);
+  set_all_records_visible(*table);
+  table->get_chunk(ChunkID{0})->mvcc_columns()->begin_cids[2] = 2u;
+  StorageManager::get().add_table("validate_table", table);
+
+  const auto validate_row_count = [](const CommitID snapshot_commit_id) {
+    auto context = std::make_shared<TransactionContext>(TransactionID{100u}, snapshot_commit_id);
+    auto get_table = std::make_shared<GetTable>("validate_table");
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  EXPECT_EQ(validate_row_count(1u), 3u);
+  EXPECT_EQ(validate_row_count(2u), 4u);
+
+  // A deleted row makes Validate check each row of the chunk again
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("validate_table");
+  get_table->execute();
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::Equals, 1);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>("validate_table", table_scan);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  transaction_context->commit();
+
+  ASSERT_LE(transaction_context->commit_id(), 2u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->mvcc_columns()->any_row_invalidated);
+  EXPECT_EQ(validate_row_count(2u), 3u);
+}
+
 }  // namespace opossum
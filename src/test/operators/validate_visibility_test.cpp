@@ -21,6 +21,9 @@ class OperatorsValidateVisibilityTest : public BaseTest {
     t->add_column("col_2", DataType::Int);
     t->append({123, 456});
 
+    // The tests write the MVCC columns directly, so Validate must not assume that the chunk is unchanged
+    t->get_chunk(ChunkID{0})->mvcc_columns()->any_row_invalidated = true;
+
     StorageManager::get().add_table(table_name, t);
 
     gt = std::make_shared<GetTable>(table_name);
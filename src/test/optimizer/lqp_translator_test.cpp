@@ -17,18 +17,22 @@
 #include "logical_query_plan/show_tables_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_k_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/get_table.hpp"
+#include "operators/join_bloom_filter.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
+#include "operators/pipeline.hpp"
 #include "operators/pqp_expression.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -142,6 +146,121 @@ TEST_F(LQPTranslatorTest, SortNode) {
   EXPECT_EQ(sort_op->order_by_mode(), OrderByMode::Ascending);
 }
 
+TEST_F(LQPTranslatorTest, SortNodeWithMultipleDefinitions) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+  auto sort_node = std::make_shared<SortNode>(
+      std::vector<OrderByDefinition>{{LQPColumnReference(stored_table_node, ColumnID{1}), OrderByMode::Descending},
+                                     {LQPColumnReference(stored_table_node, ColumnID{0}), OrderByMode::Ascending}});
+  sort_node->set_left_child(stored_table_node);
+  const auto op = LQPTranslator{}.translate_node(sort_node);
+
+  /**
+   * Check PQP: All definitions are sorted by a single operator
+   */
+  const auto sort_op = std::dynamic_pointer_cast<Sort>(op);
+  ASSERT_TRUE(sort_op);
+  ASSERT_EQ(sort_op->sort_definitions().size(), 2u);
+  EXPECT_EQ(sort_op->sort_definitions()[0].column_id, ColumnID{1});
+  EXPECT_EQ(sort_op->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_op->sort_definitions()[1].column_id, ColumnID{0});
+  EXPECT_EQ(sort_op->sort_definitions()[1].order_by_mode, OrderByMode::Ascending);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(sort_op->input_left()));
+}
+
+TEST_F(LQPTranslatorTest, TopKNode) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+  auto top_k_node = std::make_shared<TopKNode>(
+      OrderByDefinitions{{LQPColumnReference(stored_table_node, ColumnID{1}), OrderByMode::Descending}}, 3);
+  top_k_node->set_left_child(stored_table_node);
+  const auto op = LQPTranslator{}.translate_node(top_k_node);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k_op = std::dynamic_pointer_cast<TopK>(op);
+  ASSERT_TRUE(top_k_op);
+  EXPECT_EQ(top_k_op->num_rows(), 3u);
+  ASSERT_EQ(top_k_op->sort_definitions().size(), 1u);
+  EXPECT_EQ(top_k_op->sort_definitions()[0].column_id, ColumnID{1});
+  EXPECT_EQ(top_k_op->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(top_k_op->input_left()));
+}
+
+TEST_F(LQPTranslatorTest, PipelinedPredicatesAndProjection) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+  auto predicate_node_a =
+      std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node, ColumnID{0}), ScanType::GreaterThan, 5);
+  predicate_node_a->set_left_child(stored_table_node);
+  auto predicate_node_b =
+      std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node, ColumnID{1}), ScanType::LessThan, 50);
+  predicate_node_b->set_left_child(predicate_node_a);
+  auto projection_node = std::make_shared<ProjectionNode>(std::vector<std::shared_ptr<LQPExpression>>{
+      LQPExpression::create_column(LQPColumnReference(stored_table_node, ColumnID{1}))});
+  projection_node->set_left_child(predicate_node_b);
+  const auto op = LQPTranslator{true}.translate_node(projection_node);
+
+  /**
+   * Check PQP
+   */
+  const auto pipeline_op = std::dynamic_pointer_cast<Pipeline>(op);
+  ASSERT_TRUE(pipeline_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(pipeline_op->input_left()));
+
+  const auto& stages = pipeline_op->stages();
+  ASSERT_EQ(stages.size(), 3u);
+  const auto table_scan_op_a = std::dynamic_pointer_cast<const TableScan>(stages[0]);
+  ASSERT_TRUE(table_scan_op_a);
+  EXPECT_EQ(table_scan_op_a->left_column_id(), ColumnID{0});
+  const auto table_scan_op_b = std::dynamic_pointer_cast<const TableScan>(stages[1]);
+  ASSERT_TRUE(table_scan_op_b);
+  EXPECT_EQ(table_scan_op_b->left_column_id(), ColumnID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Projection>(stages[2]));
+
+  // Without pipelines, every node is translated into an operator of its own
+  EXPECT_TRUE(std::dynamic_pointer_cast<Projection>(LQPTranslator{}.translate_node(projection_node)));
+}
+
+TEST_F(LQPTranslatorTest, SharedOperatorsAreNotPipelined) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+  auto predicate_node_a =
+      std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node, ColumnID{0}), ScanType::GreaterThan, 5);
+  predicate_node_a->set_left_child(stored_table_node);
+  auto predicate_node_b =
+      std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node, ColumnID{1}), ScanType::LessThan, 50);
+  predicate_node_b->set_left_child(predicate_node_a);
+  auto predicate_node_c =
+      std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node, ColumnID{1}), ScanType::GreaterThan, 90);
+  predicate_node_c->set_left_child(predicate_node_a);
+  auto union_node = std::make_shared<UnionNode>(UnionMode::Positions);
+  union_node->set_left_child(predicate_node_b);
+  union_node->set_right_child(predicate_node_c);
+  const auto op = LQPTranslator{true}.translate_node(union_node);
+
+  /**
+   * Check PQP
+   */
+  ASSERT_TRUE(op->input_left());
+  ASSERT_TRUE(op->input_right());
+  const auto table_scan_op_b = std::dynamic_pointer_cast<const TableScan>(op->input_left());
+  const auto table_scan_op_c = std::dynamic_pointer_cast<const TableScan>(op->input_right());
+  ASSERT_TRUE(table_scan_op_b);
+  ASSERT_TRUE(table_scan_op_c);
+  EXPECT_EQ(table_scan_op_b->input_left(), table_scan_op_c->input_left());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(table_scan_op_b->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, JoinNode) {
   /**
    * Build LQP and translate to PQP
@@ -166,6 +285,37 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeWithAdditionalPredicates) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node_left = std::make_shared<StoredTableNode>("table_int_float");
+  const auto stored_table_node_right = std::make_shared<StoredTableNode>("table_int_float2");
+  const auto additional_join_column_references = std::vector<LQPColumnReferencePair>{
+      {LQPColumnReference(stored_table_node_left, ColumnID{0}),
+       LQPColumnReference(stored_table_node_right, ColumnID{1})}};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Outer}) {
+    const auto join_column_references = std::make_pair(LQPColumnReference(stored_table_node_left, ColumnID{1}),
+                                                       LQPColumnReference(stored_table_node_right, ColumnID{0}));
+    auto join_node = std::make_shared<JoinNode>(mode, join_column_references, ScanType::Equals,
+                                                additional_join_column_references);
+    join_node->set_left_child(stored_table_node_left);
+    join_node->set_right_child(stored_table_node_right);
+    const auto op = LQPTranslator{}.translate_node(join_node);
+
+    /**
+     * Check PQP
+     */
+    const auto join_op = std::dynamic_pointer_cast<AbstractJoinOperator>(op);
+    ASSERT_TRUE(join_op);
+    EXPECT_EQ(mode == JoinMode::Outer, std::dynamic_pointer_cast<JoinSortMerge>(op) != nullptr);
+    EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{0}));
+    EXPECT_EQ(join_op->additional_column_ids(), std::vector<ColumnIDPair>{ColumnIDPair(ColumnID{0}, ColumnID{1})});
+    EXPECT_EQ(join_op->mode(), mode);
+  }
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
@@ -333,6 +483,104 @@ TEST_F(LQPTranslatorTest, MultipleNodesHierarchy) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinBloomFilter) {
+  /**
+   * Inner and semi joins let the TableScan of their probe input drop rows that cannot find a join partner
+   */
+  const auto stored_table_node_left = std::make_shared<StoredTableNode>("table_int_float");
+  const auto stored_table_node_right = std::make_shared<StoredTableNode>("table_int_float2");
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Semi, JoinMode::Left, JoinMode::Anti}) {
+    auto predicate_node_left = std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node_left, ColumnID{0}),
+                                                               ScanType::GreaterThan, AllParameterVariant(1));
+    predicate_node_left->set_left_child(stored_table_node_left);
+
+    auto predicate_node_right = std::make_shared<PredicateNode>(
+        LQPColumnReference(stored_table_node_right, ColumnID{1}), ScanType::GreaterThan, AllParameterVariant(30.0));
+    predicate_node_right->set_left_child(stored_table_node_right);
+
+    auto join_node = std::make_shared<JoinNode>(
+        join_mode, LQPColumnReferencePair(LQPColumnReference(stored_table_node_left, ColumnID{0}),
+                                          LQPColumnReference(stored_table_node_right, ColumnID{0})),
+        ScanType::Equals);
+    join_node->set_left_child(predicate_node_left);
+    join_node->set_right_child(predicate_node_right);
+
+    const auto join_op = std::dynamic_pointer_cast<const JoinHash>(LQPTranslator{}.translate_node(join_node));
+    ASSERT_TRUE(join_op);
+
+    const auto table_scan_left = std::dynamic_pointer_cast<const TableScan>(join_op->input_left());
+    const auto table_scan_right = std::dynamic_pointer_cast<const TableScan>(join_op->input_right());
+    ASSERT_TRUE(table_scan_left && table_scan_right);
+
+    if (join_mode == JoinMode::Inner) {
+      EXPECT_FALSE(table_scan_left->join_bloom_filter());
+      ASSERT_TRUE(table_scan_right->join_bloom_filter());
+      EXPECT_EQ(table_scan_right->join_bloom_filter()->build_operator(), table_scan_left);
+      EXPECT_EQ(table_scan_right->input_right(), table_scan_left);
+    } else if (join_mode == JoinMode::Semi) {
+      ASSERT_TRUE(table_scan_left->join_bloom_filter());
+      EXPECT_EQ(table_scan_left->join_bloom_filter()->build_operator(), table_scan_right);
+      EXPECT_FALSE(table_scan_right->join_bloom_filter());
+    } else {
+      EXPECT_FALSE(table_scan_left->join_bloom_filter());
+      EXPECT_FALSE(table_scan_right->join_bloom_filter());
+    }
+  }
+}
+
+TEST_F(LQPTranslatorTest, PipelinedJoinProbe) {
+  /**
+   * Hash joins are fused into the Pipeline of their probe input, unless a JoinBloomFilter is applied to it
+   */
+  const auto stored_table_node_left = std::make_shared<StoredTableNode>("table_int_float");
+  const auto stored_table_node_right = std::make_shared<StoredTableNode>("table_int_float2");
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right}) {
+    auto predicate_node_left = std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node_left, ColumnID{0}),
+                                                               ScanType::GreaterThan, AllParameterVariant(1));
+    predicate_node_left->set_left_child(stored_table_node_left);
+
+    auto predicate_node_right = std::make_shared<PredicateNode>(
+        LQPColumnReference(stored_table_node_right, ColumnID{1}), ScanType::GreaterThan, AllParameterVariant(30.0));
+    predicate_node_right->set_left_child(stored_table_node_right);
+
+    auto join_node = std::make_shared<JoinNode>(
+        join_mode, LQPColumnReferencePair(LQPColumnReference(stored_table_node_left, ColumnID{0}),
+                                          LQPColumnReference(stored_table_node_right, ColumnID{0})),
+        ScanType::Equals);
+    join_node->set_left_child(predicate_node_left);
+    join_node->set_right_child(predicate_node_right);
+
+    const auto op = LQPTranslator{true}.translate_node(join_node);
+
+    if (join_mode == JoinMode::Inner) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(op));
+      continue;
+    }
+
+    const auto pipeline_op = std::dynamic_pointer_cast<const Pipeline>(op);
+    ASSERT_TRUE(pipeline_op);
+
+    // Left joins probe with their left input, Right joins with their right one
+    const auto probe_table_name = join_mode == JoinMode::Left ? "table_int_float" : "table_int_float2";
+    const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(pipeline_op->input_left());
+    ASSERT_TRUE(get_table_op);
+    EXPECT_EQ(get_table_op->table_name(), probe_table_name);
+
+    const auto build_op = std::dynamic_pointer_cast<const TableScan>(pipeline_op->input_right());
+    ASSERT_TRUE(build_op);
+
+    const auto& stages = pipeline_op->stages();
+    ASSERT_EQ(stages.size(), 2u);
+    EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(stages[0]));
+    const auto join_op = std::dynamic_pointer_cast<const JoinHash>(stages[1]);
+    ASSERT_TRUE(join_op);
+    EXPECT_EQ(join_op->mode(), join_mode);
+    EXPECT_EQ(join_mode == JoinMode::Left ? join_op->input_right() : join_op->input_left(), build_op);
+  }
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
@@ -0,0 +1,119 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ChunkPruningRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    // Three chunks with a = 12345, 123, and 1234
+    auto table = load_table("src/test/tables/int_float.tbl", 1u);
+    DictionaryCompression::compress_table(*table);
+    StorageManager::get().add_table("compressed", table);
+
+    StorageManager::get().add_table("uncompressed", load_table("src/test/tables/int_float.tbl", 1u));
+
+    _rule = std::make_shared<ChunkPruningRule>();
+  }
+
+  std::shared_ptr<ChunkPruningRule> _rule;
+};
+
+TEST_F(ChunkPruningRuleTest, PrunesChunksOfPredicateOnStoredTable) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(LQPColumnReference{stored_table_node, ColumnID{0}}, ScanType::GreaterThan, 1000);
+  predicate_node->set_left_child(stored_table_node);
+
+  auto result = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(result, predicate_node);
+  EXPECT_EQ(predicate_node->excluded_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+}
+
+TEST_F(ChunkPruningRuleTest, CombinesPredicateChain) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  auto predicate_node_0 =
+      std::make_shared<PredicateNode>(LQPColumnReference{stored_table_node, ColumnID{0}}, ScanType::GreaterThan, 1000);
+  predicate_node_0->set_left_child(stored_table_node);
+
+  auto predicate_node_1 = std::make_shared<PredicateNode>(LQPColumnReference{stored_table_node, ColumnID{0}},
+                                                          ScanType::LessThan, 10000);
+  predicate_node_1->set_left_child(predicate_node_0);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node_1);
+
+  // The ids are attached to the node reading the stored table only
+  EXPECT_EQ(predicate_node_0->excluded_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_TRUE(predicate_node_1->excluded_chunk_ids().empty());
+}
+
+TEST_F(ChunkPruningRuleTest, PrunesChunksOfValidate) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  auto validate_node = std::make_shared<ValidateNode>();
+  validate_node->set_left_child(stored_table_node);
+
+  auto predicate_node = std::make_shared<PredicateNode>(LQPColumnReference{stored_table_node, ColumnID{0}},
+                                                        ScanType::Between, 100, AllTypeVariant{200});
+  predicate_node->set_left_child(validate_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(validate_node->excluded_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{2}}));
+  EXPECT_TRUE(predicate_node->excluded_chunk_ids().empty());
+}
+
+TEST_F(ChunkPruningRuleTest, DoesNotPruneUncompressedChunks) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("uncompressed");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(LQPColumnReference{stored_table_node, ColumnID{0}}, ScanType::GreaterThan, 1000);
+  predicate_node->set_left_child(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_TRUE(predicate_node->excluded_chunk_ids().empty());
+}
+
+TEST_F(ChunkPruningRuleTest, PrunedScanReturnsSameResult) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(LQPColumnReference{stored_table_node, ColumnID{0}}, ScanType::Equals, 123);
+  predicate_node->set_left_child(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  ASSERT_EQ(predicate_node->excluded_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{2}}));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(LQPTranslator{}.translate_node(predicate_node));
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto get_table = std::make_shared<GetTable>("uncompressed");
+  get_table->execute();
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::Equals, 123);
+  table_scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(tasks.back()->get_operator()->get_output(), table_scan->get_output());
+}
+
+}  // namespace opossum
@@ -159,6 +159,62 @@ TEST_F(JoinDetectionRuleTest, SecondDetectionTest) {
   EXPECT_EQ(output->left_child()->right_child()->type(), LQPNodeType::StoredTable);
 }
 
+TEST_F(JoinDetectionRuleTest, AdditionalEqualityPredicates) {
+  /**
+   * Test that
+   *
+   *   Predicate
+   *  (a.a > b.b)
+   *       |
+   *   Predicate
+   *  (b.b == a.b)
+   *       |
+   *   Predicate
+   *  (a.a == b.a)
+   *       |
+   *     Cross
+   *    /     \
+   *   a       b
+   *
+   * gets converted to
+   *
+   *   Predicate
+   *  (a.a > b.b)
+   *       |
+   *      Join
+   *  (a.a == b.a AND a.b == b.b)
+   *    /     \
+   *   a       b
+   */
+
+  // Generate LQP
+  const auto cross_join_node = std::make_shared<JoinNode>(JoinMode::Cross);
+  cross_join_node->set_left_child(_table_node_a);
+  cross_join_node->set_right_child(_table_node_b);
+
+  const auto predicate_node_a = std::make_shared<PredicateNode>(_a_a, ScanType::Equals, _b_a);
+  predicate_node_a->set_left_child(cross_join_node);
+
+  const auto predicate_node_b = std::make_shared<PredicateNode>(_b_b, ScanType::Equals, _a_b);
+  predicate_node_b->set_left_child(predicate_node_a);
+
+  const auto predicate_node_c = std::make_shared<PredicateNode>(_a_a, ScanType::GreaterThan, _b_b);
+  predicate_node_c->set_left_child(predicate_node_b);
+
+  auto output = StrategyBaseTest::apply_rule(_rule, predicate_node_c);
+
+  EXPECT_EQ(output, predicate_node_c);
+
+  // Verification of the new JOIN
+  ASSERT_INNER_JOIN_NODE(output->left_child(), ScanType::Equals, _a_a, _b_a);
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(output->left_child());
+  EXPECT_EQ(join_node->additional_join_column_references(),
+            std::vector<LQPColumnReferencePair>{std::make_pair(_a_b, _b_b)});
+
+  EXPECT_EQ(join_node->left_child()->type(), LQPNodeType::StoredTable);
+  EXPECT_EQ(join_node->right_child()->type(), LQPNodeType::StoredTable);
+}
+
 TEST_F(JoinDetectionRuleTest, NoPredicate) {
   /**
    * Test that
@@ -525,7 +581,8 @@ TEST_P(JoinDetectionRuleTest, JoinDetectionSQL) {
 
 const JoinDetectionTestParam test_queries[] = {{__LINE__, "SELECT * FROM a, b WHERE a.a = b.a", 1},
                                                {__LINE__, "SELECT * FROM a, b, c WHERE a.a = c.a", 1},
-                                               {__LINE__, "SELECT * FROM a, b, c WHERE b.a = c.a", 1}};
+                                               {__LINE__, "SELECT * FROM a, b, c WHERE b.a = c.a", 1},
+                                               {__LINE__, "SELECT * FROM a, b WHERE a.a = b.a AND a.b = b.b", 1}};
 
 auto formatter = [](const testing::TestParamInfo<struct JoinDetectionTestParam> info) {
   return std::to_string(info.param.line);
@@ -0,0 +1,78 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_k_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class TopKRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+
+    _stored_table_node = std::make_shared<StoredTableNode>("table_a");
+    _a = LQPColumnReference{_stored_table_node, ColumnID{0}};
+
+    _sort_node = std::make_shared<SortNode>(OrderByDefinitions{{_a, OrderByMode::Descending}});
+    _sort_node->set_left_child(_stored_table_node);
+
+    _rule = std::make_shared<TopKRule>();
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<SortNode> _sort_node;
+  LQPColumnReference _a;
+  std::shared_ptr<TopKRule> _rule;
+};
+
+TEST_F(TopKRuleTest, ReplacesLimitOnTopOfSort) {
+  auto limit_node = std::make_shared<LimitNode>(5);
+  limit_node->set_left_child(_sort_node);
+
+  const auto result = StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  const auto top_k_node = std::dynamic_pointer_cast<TopKNode>(result);
+  ASSERT_TRUE(top_k_node);
+  EXPECT_EQ(top_k_node->num_rows(), 5u);
+  ASSERT_EQ(top_k_node->order_by_definitions().size(), 1u);
+  EXPECT_EQ(top_k_node->order_by_definitions()[0].column_reference, _a);
+  EXPECT_EQ(top_k_node->order_by_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(top_k_node->left_child(), _stored_table_node);
+}
+
+TEST_F(TopKRuleTest, KeepsSortWithOtherParents) {
+  auto limit_node = std::make_shared<LimitNode>(5);
+  limit_node->set_left_child(_sort_node);
+
+  auto union_node = std::make_shared<UnionNode>(UnionMode::Positions);
+  union_node->set_left_child(limit_node);
+  union_node->set_right_child(_sort_node);
+
+  const auto result = StrategyBaseTest::apply_rule(_rule, union_node);
+
+  EXPECT_EQ(result, union_node);
+  EXPECT_EQ(union_node->left_child(), limit_node);
+  EXPECT_EQ(limit_node->left_child(), _sort_node);
+}
+
+TEST_F(TopKRuleTest, KeepsLimitWithoutSort) {
+  auto limit_node = std::make_shared<LimitNode>(5);
+  limit_node->set_left_child(_stored_table_node);
+
+  const auto result = StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(result, limit_node);
+  EXPECT_EQ(limit_node->left_child(), _stored_table_node);
+}
+
+}  // namespace opossum
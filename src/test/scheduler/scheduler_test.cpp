@@ -1,4 +1,6 @@
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -10,6 +12,8 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_context.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -181,6 +185,228 @@ TEST_F(SchedulerTest, DiamondDependenciesWithoutScheduler) {
   ASSERT_EQ(counter, 7u);
 }
 
+TEST_F(SchedulerTest, JobsOfOneTaskAreStolen) {
+  // All jobs are pushed to the deque of the processing unit that runs the spawning task, the other processing units
+  // have to steal them. Some jobs are unstealable across nodes, and one is explicitly scheduled on the second node.
+  // The topology is created explicitly to get two nodes regardless of the number of CPUs.
+  auto nodes = std::vector<TopologyNode>{};
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}, TopologyCpu{CpuID{1}}});
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{2}}, TopologyCpu{CpuID{3}}});
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 4)));
+
+  std::atomic_uint counter{0};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto job_idx = size_t{0}; job_idx < 100; ++job_idx) {
+      auto priority = job_idx % 10 == 0 ? SchedulePriority::Unstealable : SchedulePriority::Normal;
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        std::vector<std::shared_ptr<AbstractTask>> nested_jobs;
+        for (auto nested_job_idx = size_t{0}; nested_job_idx < 3; ++nested_job_idx) {
+          nested_jobs.emplace_back(std::make_shared<JobTask>([&]() { counter++; }));
+          nested_jobs.back()->schedule();
+        }
+        CurrentScheduler::wait_for_tasks(nested_jobs);
+      }));
+      jobs.back()->schedule(CURRENT_NODE_ID, priority);
+    }
+    jobs.emplace_back(std::make_shared<JobTask>([&]() { counter++; }));
+    jobs.back()->schedule(NodeID{1});
+
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->schedule();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(counter, 301u);
+
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, ParkedWorkersAreWokenUp) {
+  // The workers park while the main thread sleeps. Every round of tasks has to wake them up again, including those of
+  // the second node for the unstealable tasks scheduled there.
+  auto nodes = std::vector<TopologyNode>{};
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}, TopologyCpu{CpuID{1}}});
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{2}}, TopologyCpu{CpuID{3}}});
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 4)));
+
+  std::atomic_uint counter{0};
+
+  for (auto round = size_t{0}; round < 5; ++round) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::vector<std::shared_ptr<AbstractTask>> tasks;
+    for (auto task_idx = size_t{0}; task_idx < 20; ++task_idx) {
+      tasks.emplace_back(std::make_shared<JobTask>([&]() { counter++; }));
+      tasks.back()->schedule(NodeID{static_cast<uint32_t>(task_idx % 2)}, SchedulePriority::Unstealable);
+    }
+    CurrentScheduler::wait_for_tasks(tasks);
+
+    EXPECT_EQ(counter, (round + 1) * 20);
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, TaskQueueTakesTurnsBetweenQueries) {
+  auto configs = default_query_class_configs();
+  configs[static_cast<size_t>(QueryClass::Analytical)].weight = 1;
+  configs[static_cast<size_t>(QueryClass::Transactional)].weight = 2;
+  TaskQueue queue{NodeID{0}, configs};
+
+  const auto analytical_query = std::make_shared<QueryContext>(QueryClass::Analytical);
+  const auto transactional_query = std::make_shared<QueryContext>(QueryClass::Transactional);
+
+  // The analytical query enqueues all of its tasks first
+  for (auto task_idx = size_t{0}; task_idx < 6; ++task_idx) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_query_context(analytical_query);
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Normal));
+  }
+  for (auto task_idx = size_t{0}; task_idx < 3; ++task_idx) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_query_context(transactional_query);
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Normal));
+  }
+
+  const auto expected_queries = std::vector<std::shared_ptr<QueryContext>>{
+      analytical_query, transactional_query, transactional_query, analytical_query, transactional_query,
+      analytical_query, analytical_query,    analytical_query,    analytical_query};
+  for (const auto& expected_query : expected_queries) {
+    const auto task = queue.pull();
+    ASSERT_TRUE(task);
+    EXPECT_EQ(task->query_context(), expected_query);
+  }
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pull());
+}
+
+TEST_F(SchedulerTest, TaskQueueSkipsQueriesAtTheirLimit) {
+  auto configs = default_query_class_configs();
+  configs[static_cast<size_t>(QueryClass::Analytical)].max_concurrent_tasks = 1;
+  TaskQueue queue{NodeID{0}, configs};
+
+  const auto analytical_query = std::make_shared<QueryContext>(QueryClass::Analytical);
+  for (auto task_idx = size_t{0}; task_idx < 2; ++task_idx) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_query_context(analytical_query);
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Normal));
+  }
+  queue.push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Normal));
+
+  EXPECT_EQ(queue.pull()->query_context(), analytical_query);
+  EXPECT_EQ(analytical_query->num_running_tasks(), 1u);
+
+  // The second task of the analytical query has to wait until the first one is done
+  EXPECT_EQ(queue.pull()->query_context(), nullptr);
+  EXPECT_FALSE(queue.pull());
+  EXPECT_FALSE(queue.empty());
+}
+
+TEST_F(SchedulerTest, QueryContextIsInherited) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto query_context = std::make_shared<QueryContext>(QueryClass::Analytical);
+  std::atomic_uint num_jobs_of_query{0};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto job_idx = size_t{0}; job_idx < 10; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        if (QueryContext::current() == query_context) num_jobs_of_query++;
+      }));
+      jobs.back()->schedule();
+      EXPECT_EQ(jobs.back()->query_context(), query_context);
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->set_query_context(query_context);
+  task->schedule();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(num_jobs_of_query, 10u);
+  EXPECT_EQ(QueryContext::current(), nullptr);
+}
+
+TEST_F(SchedulerTest, ConcurrencyOfQueriesIsLimited) {
+  // The task of the analytical query holds the only slot of the query until it waits for its jobs, which then have to
+  // be executed one at a time
+  auto nodes = std::vector<TopologyNode>{};
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}, TopologyCpu{CpuID{1}}});
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{2}}, TopologyCpu{CpuID{3}}});
+  auto configs = default_query_class_configs();
+  configs[static_cast<size_t>(QueryClass::Analytical)].max_concurrent_tasks = 1;
+  CurrentScheduler::set(
+      std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 4), configs));
+
+  const auto query_context = std::make_shared<QueryContext>(QueryClass::Analytical);
+  std::atomic_uint num_running_jobs{0};
+  std::atomic_uint max_num_running_jobs{0};
+  std::atomic_uint counter{0};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto job_idx = size_t{0}; job_idx < 20; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        const auto num_running = ++num_running_jobs;
+        auto max_num_running = max_num_running_jobs.load();
+        while (num_running > max_num_running &&
+               !max_num_running_jobs.compare_exchange_weak(max_num_running, num_running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        counter++;
+        --num_running_jobs;
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->set_query_context(query_context);
+  task->schedule();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(counter, 20u);
+  EXPECT_EQ(max_num_running_jobs, 1u);
+  EXPECT_EQ(query_context->num_running_tasks(), 0u);
+}
+
+TEST_F(SchedulerTest, TransactionalQueriesArePreferred) {
+  // With a single worker, the order of execution is determined by the priorities of the query classes only
+  auto nodes = std::vector<TopologyNode>{};
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}});
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 1)));
+
+  std::atomic_bool blocker_started{false};
+  std::atomic_bool blocker_released{false};
+  auto blocker = std::make_shared<JobTask>([&]() {
+    blocker_started = true;
+    while (!blocker_released) std::this_thread::yield();
+  });
+  blocker->schedule();
+  while (!blocker_started) std::this_thread::yield();
+
+  std::vector<QueryClass> executed_query_classes;
+  for (const auto query_class : {QueryClass::Analytical, QueryClass::Default, QueryClass::Transactional}) {
+    auto task = std::make_shared<JobTask>([&, query_class]() { executed_query_classes.emplace_back(query_class); });
+    task->set_query_context(std::make_shared<QueryContext>(query_class));
+    task->schedule(NodeID{0});
+  }
+  blocker_released = true;
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(executed_query_classes,
+            std::vector<QueryClass>({QueryClass::Transactional, QueryClass::Analytical, QueryClass::Default}));
+}
+
 TEST_F(SchedulerTest, MultipleOperators) {
   CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
 
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  // The tasks are never executed, they are only compared by identity
+  std::vector<std::shared_ptr<AbstractTask>> create_tasks(size_t count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_idx = size_t{0}; task_idx < count; ++task_idx) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifo) {
+  auto deque = WorkStealingDeque{};
+  const auto tasks = create_tasks(3);
+  for (const auto& task : tasks) deque.push(task);
+
+  EXPECT_FALSE(deque.empty());
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.pop(), tasks[1]);
+  EXPECT_EQ(deque.pop(), tasks[0]);
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, StealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  const auto tasks = create_tasks(3);
+  for (const auto& task : tasks) deque.push(task);
+
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  EXPECT_EQ(deque.steal(), nullptr);
+  EXPECT_EQ(deque.pop(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grows) {
+  auto deque = WorkStealingDeque{2};
+  const auto tasks = create_tasks(100);
+
+  // Wrap around the ring buffer before it has to grow
+  deque.push(tasks[0]);
+  deque.push(tasks[1]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+
+  for (auto task_idx = size_t{2}; task_idx < tasks.size(); ++task_idx) deque.push(tasks[task_idx]);
+
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  for (auto task_idx = tasks.size() - 1; task_idx >= 2; --task_idx) {
+    EXPECT_EQ(deque.pop(), tasks[task_idx]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, DestroysRemainingTasks) {
+  auto task = create_tasks(1).front();
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealing) {
+  // Every task has to be taken exactly once, either by the owner or by one of the thieves
+  constexpr auto task_count = size_t{20'000};
+  constexpr auto thief_count = size_t{3};
+
+  auto deque = WorkStealingDeque{4};
+  const auto tasks = create_tasks(task_count);
+  auto taken = std::vector<std::atomic_uint>(task_count);
+  std::atomic_bool done{false};
+
+  const auto take = [&](const std::shared_ptr<AbstractTask>& task) {
+    if (task) ++taken[task->id()];
+  };
+
+  for (auto task_idx = size_t{0}; task_idx < task_count; ++task_idx) {
+    tasks[task_idx]->set_id(task_idx);
+  }
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_idx = size_t{0}; thief_idx < thief_count; ++thief_idx) {
+    thieves.emplace_back([&]() {
+      while (!done || !deque.empty()) take(deque.steal());
+    });
+  }
+
+  // The owner pops some of its tasks right away, so that it races with the thieves for the last tasks of the deque
+  for (auto task_idx = size_t{0}; task_idx < task_count; ++task_idx) {
+    deque.push(tasks[task_idx]);
+    if (task_idx % 3 == 0) take(deque.pop());
+  }
+  while (!deque.empty()) take(deque.pop());
+  done = true;
+
+  for (auto& thief : thieves) thief.join();
+
+  for (auto task_idx = size_t{0}; task_idx < task_count; ++task_idx) {
+    EXPECT_EQ(taken[task_idx], 1u);
+  }
+}
+
+}  // namespace opossum
@@ -14,6 +14,7 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/query_context.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_query_operator.hpp"
@@ -295,6 +296,25 @@ TEST_F(SQLPipelineStatementTest, GetQueryPlanWithMVCC) {
   EXPECT_NE(plan->tree_roots().at(0)->transaction_context(), nullptr);
 }
 
+TEST_F(SQLPipelineStatementTest, GetQueryPlanWithReadOnlyTransactionContext) {
+  SQLPipelineStatement select_pipeline{_select_query_a};
+  select_pipeline.get_query_plan();
+  EXPECT_TRUE(select_pipeline.transaction_context()->is_read_only());
+
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+  select_pipeline.get_result_table();
+  EXPECT_EQ(select_pipeline.transaction_context()->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+
+  SQLPipelineStatement insert_pipeline{"INSERT INTO table_a VALUES (11, 11.11)"};
+  insert_pipeline.get_query_plan();
+  EXPECT_FALSE(insert_pipeline.transaction_context()->is_read_only());
+
+  SQLPipelineStatement drop_view_pipeline{"DROP VIEW some_view"};
+  drop_view_pipeline.get_query_plan();
+  EXPECT_FALSE(drop_view_pipeline.transaction_context()->is_read_only());
+}
+
 TEST_F(SQLPipelineStatementTest, GetQueryPlanWithoutMVCC) {
   SQLPipelineStatement sql_pipeline{_select_query_a, false};
   const auto& plan = sql_pipeline.get_query_plan();
@@ -329,6 +349,22 @@ TEST_F(SQLPipelineStatementTest, GetTasksTwice) {
   EXPECT_TRUE(_contains_validate(tasks));
 }
 
+TEST_F(SQLPipelineStatementTest, GetTasksWithQueryContext) {
+  SQLPipelineStatement select_pipeline{_select_query_a};
+  const auto& select_tasks = select_pipeline.get_tasks();
+
+  const auto& query_context = select_tasks.front()->query_context();
+  ASSERT_NE(query_context, nullptr);
+  EXPECT_EQ(query_context->query_class(), QueryClass::Default);
+  for (const auto& task : select_tasks) EXPECT_EQ(task->query_context(), query_context);
+
+  SQLPipelineStatement insert_pipeline{"INSERT INTO table_a VALUES (11, 11.11)"};
+  const auto& insert_query_context = insert_pipeline.get_tasks().front()->query_context();
+  ASSERT_NE(insert_query_context, nullptr);
+  EXPECT_NE(insert_query_context, query_context);
+  EXPECT_EQ(insert_query_context->query_class(), QueryClass::Transactional);
+}
+
 TEST_F(SQLPipelineStatementTest, GetTasksNotValidated) {
   SQLPipelineStatement sql_pipeline{_select_query_a, false};
 
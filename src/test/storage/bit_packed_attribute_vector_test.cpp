@@ -0,0 +1,157 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/dictionary_compression.hpp"
+#include "../lib/storage/iterables/attribute_vector_iterable.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, BitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(1u), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(2u), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(3u), 2u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(256u), 8u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(257u), 9u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(301u), 9u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(size_t{1u} << 32u), 32u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, GetAndSet) {
+  // 300 rows spread over three blocks with a bit width that makes values span two words
+  for (auto bit_width : {1u, 3u, 9u, 17u, 31u, 32u}) {
+    const auto size = size_t{300u};
+    const auto max_value_id = static_cast<uint32_t>((uint64_t{1u} << bit_width) - 2u);
+
+    auto attribute_vector = BitPackedAttributeVector{size, static_cast<uint8_t>(bit_width)};
+
+    for (ChunkOffset chunk_offset = 0; chunk_offset < size; ++chunk_offset) {
+      if (chunk_offset % 7u == 0u) {
+        attribute_vector.set(chunk_offset, NULL_VALUE_ID);
+      } else {
+        attribute_vector.set(chunk_offset, ValueID{(chunk_offset * 2654435761u) % (max_value_id + 1u)});
+      }
+    }
+
+    EXPECT_EQ(attribute_vector.size(), size);
+    EXPECT_EQ(attribute_vector.block_count(), 3u);
+    EXPECT_EQ(attribute_vector.words().size(), 3u * 4u * bit_width);
+
+    for (ChunkOffset chunk_offset = 0; chunk_offset < size; ++chunk_offset) {
+      if (chunk_offset % 7u == 0u) {
+        EXPECT_EQ(attribute_vector.get(chunk_offset), NULL_VALUE_ID);
+      } else {
+        EXPECT_EQ(attribute_vector.get(chunk_offset), ValueID{(chunk_offset * 2654435761u) % (max_value_id + 1u)});
+      }
+    }
+
+    auto decoded_block = BitPackedAttributeVector::DecodedBlock{};
+    for (auto block_index = size_t{0u}; block_index < attribute_vector.block_count(); ++block_index) {
+      attribute_vector.decode_block(block_index, decoded_block);
+
+      for (auto index = size_t{0u}; index < BitPackedAttributeVector::BLOCK_SIZE; ++index) {
+        const auto chunk_offset = static_cast<ChunkOffset>(block_index * BitPackedAttributeVector::BLOCK_SIZE + index);
+        if (chunk_offset >= size) break;
+
+        EXPECT_EQ(ValueID{decoded_block[index]}, attribute_vector.get(chunk_offset));
+      }
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, OverwriteValues) {
+  auto attribute_vector = BitPackedAttributeVector{4u, 5u};
+
+  attribute_vector.set(0u, ValueID{30u});
+  attribute_vector.set(1u, ValueID{17u});
+  attribute_vector.set(0u, ValueID{1u});
+
+  EXPECT_EQ(attribute_vector.get(0u), ValueID{1u});
+  EXPECT_EQ(attribute_vector.get(1u), ValueID{17u});
+  EXPECT_EQ(attribute_vector.get(2u), ValueID{0u});
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, CompressWithBitPacking) {
+  auto value_column = std::make_shared<ValueColumn<int>>(true);
+  for (auto value = 0; value < 300; ++value) {
+    value_column->append(value % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value});
+  }
+
+  auto column = DictionaryCompression::compress_column(DataType::Int, value_column, EncodingType::Dictionary,
+                                                       AttributeVectorCompression::BitPacked);
+  auto dict_column = std::dynamic_pointer_cast<DictionaryColumn<int>>(column);
+  ASSERT_NE(dict_column, nullptr);
+
+  auto attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_column->attribute_vector());
+  ASSERT_NE(attribute_vector, nullptr);
+
+  // 200 distinct values plus NULL need 8 bits
+  EXPECT_EQ(attribute_vector->bit_width(), 8u);
+  EXPECT_EQ(attribute_vector->width(), 1u);
+
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 300u; ++chunk_offset) {
+    if (chunk_offset % 3 == 0) {
+      EXPECT_TRUE(variant_is_null((*dict_column)[chunk_offset]));
+    } else {
+      EXPECT_EQ((*dict_column)[chunk_offset], (*value_column)[chunk_offset]);
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, CompressWithAutoSelection) {
+  const auto compress = [](const int distinct_count) {
+    auto value_column = std::make_shared<ValueColumn<int>>();
+    for (auto value = 0; value < 1000; ++value) value_column->append(value % distinct_count);
+    const auto column = DictionaryCompression::compress_column(DataType::Int, value_column);
+    return std::static_pointer_cast<DictionaryColumn<int>>(column)->attribute_vector();
+  };
+
+  // 6 bits instead of 8 bits
+  const auto small_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(compress(50));
+  ASSERT_NE(small_vector, nullptr);
+  EXPECT_EQ(small_vector->bit_width(), 6u);
+
+  // 8 bits do not save anything, and 10 bits instead of 16 bits do
+  EXPECT_EQ(std::dynamic_pointer_cast<const BitPackedAttributeVector>(compress(200)), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(compress(1000)), nullptr);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, AttributeVectorIterable) {
+  auto attribute_vector = BitPackedAttributeVector{200u, 9u};
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 200u; ++chunk_offset) {
+    attribute_vector.set(chunk_offset, chunk_offset == 130u ? NULL_VALUE_ID : ValueID{chunk_offset * 2u});
+  }
+
+  auto iterable = AttributeVectorIterable{attribute_vector};
+
+  auto chunk_offset = ChunkOffset{0u};
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), chunk_offset);
+
+    if (chunk_offset == 130u) {
+      EXPECT_TRUE(value.is_null());
+    } else {
+      EXPECT_FALSE(value.is_null());
+      EXPECT_EQ(value.value(), ValueID{chunk_offset * 2u});
+    }
+
+    ++chunk_offset;
+  });
+
+  EXPECT_EQ(chunk_offset, 200u);
+
+  auto chunk_offsets = ChunkOffsetsList{{0u, 129u}, {1u, 130u}, {2u, 3u}};
+  auto values = std::vector<ValueID>{};
+  iterable.for_each(&chunk_offsets, [&](const auto& value) { values.push_back(value.value()); });
+
+  EXPECT_EQ(values, (std::vector<ValueID>{ValueID{258u}, NULL_VALUE_ID, ValueID{6u}}));
+}
+
+}  // namespace opossum
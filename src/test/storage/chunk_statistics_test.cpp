@@ -0,0 +1,226 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_statistics.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageChunkStatisticsTest : public BaseTest {
+ protected:
+  std::shared_ptr<Chunk> create_chunk() {
+    auto vc_int = std::make_shared<ValueColumn<int>>(true);
+    for (auto value : {17, 4, 4, 23}) vc_int->append(value);
+    vc_int->append(NULL_VALUE);
+
+    auto vc_str = std::make_shared<ValueColumn<std::string>>();
+    for (auto value : {"Steve", "Bill", "Hasso", "Alexander", "Bill"}) vc_str->append(value);
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->add_column(vc_int);
+    chunk->add_column(vc_str);
+    return chunk;
+  }
+
+  void check_statistics(const std::shared_ptr<Chunk>& chunk) {
+    const auto statistics = chunk->statistics();
+    ASSERT_NE(statistics, nullptr);
+    ASSERT_EQ(statistics->column_statistics().size(), 2u);
+
+    const auto int_statistics =
+        std::dynamic_pointer_cast<const ChunkColumnStatistics<int>>(statistics->column_statistics()[0]);
+    ASSERT_NE(int_statistics, nullptr);
+    EXPECT_EQ(int_statistics->min(), 4);
+    EXPECT_EQ(int_statistics->max(), 23);
+    EXPECT_EQ(int_statistics->null_count(), 1u);
+
+    const auto str_statistics =
+        std::dynamic_pointer_cast<const ChunkColumnStatistics<std::string>>(statistics->column_statistics()[1]);
+    ASSERT_NE(str_statistics, nullptr);
+    EXPECT_EQ(str_statistics->min(), "Alexander");
+    EXPECT_EQ(str_statistics->max(), "Steve");
+    EXPECT_EQ(str_statistics->null_count(), 0u);
+  }
+
+  const std::vector<DataType> column_types{DataType::Int, DataType::String};
+};
+
+TEST_F(StorageChunkStatisticsTest, UncompressedChunkHasNoStatistics) {
+  EXPECT_EQ(create_chunk()->statistics(), nullptr);
+}
+
+TEST_F(StorageChunkStatisticsTest, CompressChunkWithDictionaryEncoding) {
+  auto chunk = create_chunk();
+  DictionaryCompression::compress_chunk(column_types, chunk, EncodingType::Dictionary);
+  check_statistics(chunk);
+}
+
+TEST_F(StorageChunkStatisticsTest, CompressChunkWithRunLengthEncoding) {
+  auto chunk = create_chunk();
+  DictionaryCompression::compress_chunk(column_types, chunk, EncodingType::RunLength);
+  check_statistics(chunk);
+}
+
+TEST_F(StorageChunkStatisticsTest, CompressChunkWithFrameOfReferenceEncoding) {
+  auto vc_int = std::make_shared<ValueColumn<int>>(true);
+  vc_int->append(NULL_VALUE);
+  for (auto value : {-3, 1000, 7}) vc_int->append(value);
+
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_column(vc_int);
+  DictionaryCompression::compress_chunk({DataType::Int}, chunk, EncodingType::FrameOfReference);
+
+  ASSERT_NE(chunk->statistics(), nullptr);
+  const auto int_statistics =
+      std::dynamic_pointer_cast<const ChunkColumnStatistics<int>>(chunk->statistics()->column_statistics()[0]);
+  ASSERT_NE(int_statistics, nullptr);
+  EXPECT_EQ(int_statistics->min(), -3);
+  EXPECT_EQ(int_statistics->max(), 1000);
+  EXPECT_EQ(int_statistics->null_count(), 1u);
+}
+
+TEST_F(StorageChunkStatisticsTest, AllNullColumn) {
+  auto vc_int = std::make_shared<ValueColumn<int>>(true);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(NULL_VALUE);
+
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_column(vc_int);
+  DictionaryCompression::compress_chunk({DataType::Int}, chunk);
+
+  const auto statistics = chunk->statistics();
+  ASSERT_NE(statistics, nullptr);
+  EXPECT_EQ(statistics->column_statistics()[0]->null_count(), 2u);
+  EXPECT_TRUE(statistics->can_prune(ColumnID{0}, ScanType::Equals, 4));
+  EXPECT_TRUE(statistics->can_prune(ColumnID{0}, ScanType::IsNotNull, NULL_VALUE));
+  EXPECT_FALSE(statistics->can_prune(ColumnID{0}, ScanType::IsNull, NULL_VALUE));
+}
+
+TEST_F(StorageChunkStatisticsTest, CanPrune) {
+  const auto statistics = ChunkColumnStatistics<int>{4, 23, 0u};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::Equals, 3));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Equals, 4));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Equals, 23));
+  EXPECT_TRUE(statistics.can_prune(ScanType::Equals, 24));
+
+  EXPECT_FALSE(statistics.can_prune(ScanType::NotEquals, 4));
+  EXPECT_TRUE(ChunkColumnStatistics<int>(4, 4, 0u).can_prune(ScanType::NotEquals, 4));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::LessThan, 4));
+  EXPECT_FALSE(statistics.can_prune(ScanType::LessThan, 5));
+  EXPECT_TRUE(statistics.can_prune(ScanType::LessThanEquals, 3));
+  EXPECT_FALSE(statistics.can_prune(ScanType::LessThanEquals, 4));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::GreaterThan, 23));
+  EXPECT_FALSE(statistics.can_prune(ScanType::GreaterThan, 22));
+  EXPECT_TRUE(statistics.can_prune(ScanType::GreaterThanEquals, 24));
+  EXPECT_FALSE(statistics.can_prune(ScanType::GreaterThanEquals, 23));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::Between, 24, AllTypeVariant{30}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::Between, 0, AllTypeVariant{3}));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Between, 0, AllTypeVariant{4}));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Between, 10, AllTypeVariant{12}));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::IsNull, NULL_VALUE));
+  EXPECT_FALSE(statistics.can_prune(ScanType::IsNotNull, NULL_VALUE));
+}
+
+TEST_F(StorageChunkStatisticsTest, CanPruneCastsValue) {
+  const auto statistics = ChunkColumnStatistics<int>{4, 23, 0u};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::GreaterThan, 23.5f));
+  EXPECT_TRUE(statistics.can_prune(ScanType::Equals, int64_t{2}));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Equals, 10.0));
+}
+
+TEST_F(StorageChunkStatisticsTest, DoesNotPruneUncomparableValues) {
+  const auto statistics = ChunkColumnStatistics<std::string>{std::string{"Bill"}, std::string{"Steve"}, 0u};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::Equals, "Alexander"));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Equals, 4));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Equals, NULL_VALUE));
+  EXPECT_FALSE(statistics.can_prune(ScanType::Like, "A%"));
+}
+
+TEST_F(StorageChunkStatisticsTest, FilterPrunesValuesBetweenMinAndMax) {
+  for (auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference}) {
+    auto vc_int = std::make_shared<ValueColumn<int>>();
+    for (auto value : {100, 1, 5, 5, 100}) vc_int->append(value);
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->add_column(vc_int);
+    DictionaryCompression::compress_chunk({DataType::Int}, chunk, encoding_type);
+
+    const auto int_statistics =
+        std::dynamic_pointer_cast<const ChunkColumnStatistics<int>>(chunk->statistics()->column_statistics()[0]);
+    ASSERT_NE(int_statistics, nullptr);
+    ASSERT_NE(int_statistics->filter(), nullptr);
+
+    EXPECT_FALSE(int_statistics->can_prune(ScanType::Equals, 1));
+    EXPECT_FALSE(int_statistics->can_prune(ScanType::Equals, 5));
+    EXPECT_FALSE(int_statistics->can_prune(ScanType::Equals, 100));
+    EXPECT_TRUE(int_statistics->can_prune(ScanType::Equals, 50));
+    EXPECT_FALSE(int_statistics->can_prune(ScanType::GreaterThan, 50));
+  }
+}
+
+TEST_F(StorageChunkStatisticsTest, NoFilterForDenseDictionary) {
+  auto vc_int = std::make_shared<ValueColumn<int>>();
+  for (auto value : {3, 1, 2, 3}) vc_int->append(value);
+
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_column(vc_int);
+  DictionaryCompression::compress_chunk({DataType::Int}, chunk);
+
+  const auto int_statistics =
+      std::dynamic_pointer_cast<const ChunkColumnStatistics<int>>(chunk->statistics()->column_statistics()[0]);
+  ASSERT_NE(int_statistics, nullptr);
+  EXPECT_EQ(int_statistics->filter(), nullptr);
+}
+
+TEST_F(StorageChunkStatisticsTest, OriginColumnStatistics) {
+  auto table = std::make_shared<Table>(5u);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::String);
+  table->emplace_chunk(create_chunk());
+  table->emplace_chunk(create_chunk());
+  DictionaryCompression::compress_chunks(*table, {ChunkID{1}});
+
+  EXPECT_EQ(origin_column_statistics(*table->get_chunk(ChunkID{0}), ColumnID{0}), nullptr);
+  EXPECT_EQ(origin_column_statistics(*table->get_chunk(ChunkID{1}), ColumnID{1}),
+            table->get_chunk(ChunkID{1})->statistics()->column_statistics()[1]);
+
+  const auto reference_chunk = [&](const PosList& pos_list) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->add_column(std::make_shared<ReferenceColumn>(table, ColumnID{1}, std::make_shared<PosList>(pos_list)));
+    return chunk;
+  };
+  const auto statistics_of = [&](const PosList& pos_list) {
+    return origin_column_statistics(*reference_chunk(pos_list), ColumnID{0});
+  };
+
+  EXPECT_EQ(statistics_of(PosList{RowID{ChunkID{1}, 0u}, RowID{ChunkID{1}, 3u}}),
+            table->get_chunk(ChunkID{1})->statistics()->column_statistics()[1]);
+
+  // Rows from more than one chunk
+  EXPECT_EQ(statistics_of(PosList{RowID{ChunkID{1}, 0u}, RowID{ChunkID{0}, 3u}}), nullptr);
+  EXPECT_EQ(statistics_of(PosList{RowID{ChunkID{1}, 0u}, NULL_ROW_ID}), nullptr);
+
+  // NULL rows of outer joins reference chunk 0, but do not come from it
+  DictionaryCompression::compress_chunks(*table, {ChunkID{0}});
+  EXPECT_NE(statistics_of(PosList{RowID{ChunkID{0}, 1u}}), nullptr);
+  EXPECT_EQ(statistics_of(PosList{RowID{ChunkID{0}, 1u}, NULL_ROW_ID}), nullptr);
+  EXPECT_EQ(statistics_of(PosList{NULL_ROW_ID}), nullptr);
+  EXPECT_EQ(statistics_of(PosList{}), nullptr);
+}
+
+}  // namespace opossum
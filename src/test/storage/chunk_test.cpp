@@ -60,6 +60,29 @@ TEST_F(StorageChunkTest, RetrieveColumn) {
   EXPECT_EQ(base_col->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, MaxBeginCommitId) {
+  c = std::make_shared<Chunk>(ChunkUseMvcc::Yes);
+  c->add_column(vc_int);
+  c->append({5});
+
+  {
+    auto mvcc_columns = c->mvcc_columns();
+    mvcc_columns->begin_cids[1] = 7u;
+
+    // The appended row has not been committed yet
+    EXPECT_EQ(mvcc_columns->max_begin_cid(4u), Chunk::MAX_COMMIT_ID);
+    EXPECT_EQ(mvcc_columns->max_begin_cid(3u), 7u);
+
+    mvcc_columns->begin_cids[3] = 5u;
+    EXPECT_EQ(mvcc_columns->max_begin_cid(4u), 7u);
+
+    // Committed rows never change their begin cid, so the result for the first three rows is cached
+    mvcc_columns->begin_cids[0] = 9u;
+    EXPECT_EQ(mvcc_columns->max_begin_cid(3u), 7u);
+    EXPECT_FALSE(mvcc_columns->any_row_invalidated);
+  }
+}
+
 TEST_F(StorageChunkTest, UnknownColumnType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
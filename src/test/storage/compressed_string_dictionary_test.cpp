@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/compressed_string_dictionary.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageCompressedStringDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Enough values for several blocks, with prefixes shared within and across blocks
+    _values.push_back("");
+    for (auto index = 0; index < 50; ++index) {
+      _values.push_back("customer#" + std::to_string(1000 + index));
+    }
+    _values.push_back(std::string(200u, 'x'));
+    _values.push_back(std::string(200u, 'x') + "y");
+    _values.push_back("z");
+
+    std::sort(_values.begin(), _values.end());
+  }
+
+  pmr_vector<std::string> _values;
+};
+
+TEST_F(StorageCompressedStringDictionaryTest, Empty) {
+  const auto dictionary = CompressedStringDictionary{};
+
+  EXPECT_TRUE(dictionary.empty());
+  EXPECT_EQ(dictionary.size(), 0u);
+  EXPECT_EQ(dictionary.lower_bound("a"), 0u);
+  EXPECT_EQ(dictionary.upper_bound("a"), 0u);
+  EXPECT_EQ(dictionary.begin(), dictionary.end());
+}
+
+TEST_F(StorageCompressedStringDictionaryTest, DecodesAllValues) {
+  const auto dictionary = CompressedStringDictionary{_values};
+
+  ASSERT_EQ(dictionary.size(), _values.size());
+  for (auto index = size_t{0u}; index < _values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], _values[index]);
+  }
+
+  EXPECT_EQ(dictionary.front(), _values.front());
+  EXPECT_EQ(dictionary.back(), _values.back());
+  EXPECT_TRUE(std::equal(dictionary.cbegin(), dictionary.cend(), _values.cbegin(), _values.cend()));
+}
+
+TEST_F(StorageCompressedStringDictionaryTest, LowerUpperBound) {
+  const auto dictionary = CompressedStringDictionary{_values};
+
+  auto search_values = std::vector<std::string>{_values.cbegin(), _values.cend()};
+  for (const auto& search_value : {"", "a", "customer", "customer#1025a", "customer#9", "x", "y", "zz"}) {
+    search_values.emplace_back(search_value);
+  }
+  search_values.push_back(std::string(199u, 'x'));
+  search_values.push_back(std::string(201u, 'x'));
+
+  for (const auto& search_value : search_values) {
+    const auto lower = std::lower_bound(_values.cbegin(), _values.cend(), search_value) - _values.cbegin();
+    const auto upper = std::upper_bound(_values.cbegin(), _values.cend(), search_value) - _values.cbegin();
+
+    EXPECT_EQ(dictionary.lower_bound(search_value), static_cast<size_t>(lower)) << search_value;
+    EXPECT_EQ(dictionary.upper_bound(search_value), static_cast<size_t>(upper)) << search_value;
+  }
+}
+
+TEST_F(StorageCompressedStringDictionaryTest, SmallerThanStrings) {
+  const auto dictionary = CompressedStringDictionary{_values};
+
+  auto string_size = _values.size() * sizeof(std::string);
+  for (const auto& value : _values) string_size += value.capacity() > 15u ? value.capacity() : 0u;
+
+  EXPECT_LT(dictionary.data_size(), string_size);
+}
+
+TEST_F(StorageCompressedStringDictionaryTest, CopyUsingAllocator) {
+  const auto dictionary = CompressedStringDictionary{_values};
+  const auto copy = CompressedStringDictionary{dictionary, PolymorphicAllocator<char>{}};
+
+  EXPECT_TRUE(std::equal(copy.cbegin(), copy.cend(), dictionary.cbegin(), dictionary.cend()));
+}
+
+TEST_F(StorageCompressedStringDictionaryTest, DictionaryColumn) {
+  auto value_column = std::make_shared<ValueColumn<std::string>>();
+  for (auto index = 0; index < 40; ++index) value_column->append("value" + std::to_string(index % 20));
+
+  const auto column = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(
+      DictionaryCompression::compress_column(DataType::String, value_column));
+  ASSERT_NE(column, nullptr);
+
+  EXPECT_EQ(column->unique_values_count(), 20u);
+  EXPECT_EQ(column->get(3u), "value3");
+  EXPECT_EQ(column->value_by_value_id(column->lower_bound(std::string{"value3"})), "value3");
+  EXPECT_EQ(column->upper_bound(std::string{"value3"}), column->lower_bound(std::string{"value4"}));
+  EXPECT_EQ(column->lower_bound(std::string{"zzz"}), INVALID_VALUE_ID);
+}
+
+}  // namespace opossum
@@ -153,7 +153,8 @@ TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorSize) {
   vc_int->append(1);
   vc_int->append(2);
 
-  auto col = DictionaryCompression::compress_column(DataType::Int, vc_int);
+  auto col = DictionaryCompression::compress_column(DataType::Int, vc_int, EncodingType::Dictionary,
+                                                    AttributeVectorCompression::Fitted);
   auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
   auto attribute_vector_uint8_t =
       std::dynamic_pointer_cast<const FittedAttributeVector<uint8_t>>(dict_col->attribute_vector());
@@ -167,7 +168,8 @@ TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorSize) {
     vc_int->append(i);
   }
 
-  col = DictionaryCompression::compress_column(DataType::Int, vc_int);
+  col = DictionaryCompression::compress_column(DataType::Int, vc_int, EncodingType::Dictionary,
+                                               AttributeVectorCompression::Fitted);
   dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
   attribute_vector_uint8_t =
       std::dynamic_pointer_cast<const FittedAttributeVector<uint8_t>>(dict_col->attribute_vector());
@@ -0,0 +1,179 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_column.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceColumnTest : public BaseTest {
+ protected:
+  static constexpr auto frame_size = FrameOfReferenceColumn<int64_t>::FRAME_SIZE;
+
+  void SetUp() override {
+    // Two full frames and a partial one of increasing keys with a null value every 100 rows
+    vc_long = std::make_shared<ValueColumn<int64_t>>(true);
+    for (auto index = int64_t{0}; index < 2 * frame_size + 300; ++index) {
+      if (index % 100 == 99) {
+        vc_long->append(NULL_VALUE);
+      } else {
+        vc_long->append(int64_t{5'000'000'000} + 3 * index);
+      }
+    }
+
+    auto col = DictionaryCompression::compress_column(DataType::Long, vc_long, EncodingType::FrameOfReference);
+    for_long = std::dynamic_pointer_cast<FrameOfReferenceColumn<int64_t>>(col);
+  }
+
+  std::shared_ptr<ValueColumn<int64_t>> vc_long;
+  std::shared_ptr<FrameOfReferenceColumn<int64_t>> for_long;
+};
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressColumnLong) {
+  ASSERT_NE(for_long, nullptr);
+  EXPECT_EQ(for_long->encoding_type(), EncodingType::FrameOfReference);
+  EXPECT_EQ(for_long->size(), vc_long->size());
+  EXPECT_EQ(for_long->frame_count(), 3u);
+
+  const auto& frame_minima = *for_long->frame_minima();
+  const auto& frame_maxima = *for_long->frame_maxima();
+  EXPECT_EQ(frame_minima[0], int64_t{5'000'000'000});
+  EXPECT_EQ(frame_maxima[0], int64_t{5'000'000'000} + 3 * (frame_size - 1));
+  EXPECT_EQ(frame_minima[2], int64_t{5'000'000'000} + 3 * 2 * frame_size);
+  EXPECT_EQ(frame_maxima[2], int64_t{5'000'000'000} + 3 * (2 * frame_size + 299));
+
+  // The largest range is 3 * 2047 = 6141, i.e., 13 bits suffice
+  EXPECT_EQ(for_long->offsets()->bit_width(), 13u);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressColumnInt) {
+  auto vc_int = std::make_shared<ValueColumn<int>>();
+  for (auto value : {-4, 7, std::numeric_limits<int>::min() / 2, 0}) vc_int->append(value);
+
+  auto col = DictionaryCompression::compress_column(DataType::Int, vc_int, EncodingType::FrameOfReference);
+  auto for_int = std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(col);
+
+  ASSERT_NE(for_int, nullptr);
+  EXPECT_EQ(for_int->frame_count(), 1u);
+  EXPECT_EQ((*for_int->frame_minima())[0], std::numeric_limits<int>::min() / 2);
+  EXPECT_EQ((*for_int->frame_maxima())[0], 7);
+
+  for (auto offset = ChunkOffset{0u}; offset < vc_int->size(); ++offset) {
+    EXPECT_EQ(for_int->get(offset), vc_int->get(offset));
+  }
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressEmptyColumn) {
+  auto col = DictionaryCompression::compress_column(DataType::Int, std::make_shared<ValueColumn<int>>(),
+                                                    EncodingType::FrameOfReference);
+  auto for_int = std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(col);
+
+  ASSERT_NE(for_int, nullptr);
+  EXPECT_EQ(for_int->size(), 0u);
+  EXPECT_EQ(for_int->frame_count(), 0u);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, UnsupportedColumns) {
+  auto vc_str = std::make_shared<ValueColumn<std::string>>();
+  vc_str->append("Hasso");
+  EXPECT_THROW(DictionaryCompression::compress_column(DataType::String, vc_str, EncodingType::FrameOfReference),
+               std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, WideRangesFallBackToDictionary) {
+  // The range of a frame does not fit into 32 bits
+  auto vc_long_wide = std::make_shared<ValueColumn<int64_t>>(true);
+  vc_long_wide->append(int64_t{0});
+  vc_long_wide->append(NULL_VALUE);
+  vc_long_wide->append(std::numeric_limits<int64_t>::max());
+
+  auto col = DictionaryCompression::compress_column(DataType::Long, vc_long_wide, EncodingType::FrameOfReference);
+  auto dictionary_column = std::dynamic_pointer_cast<DictionaryColumn<int64_t>>(col);
+
+  ASSERT_NE(dictionary_column, nullptr);
+  EXPECT_EQ(type_cast<int64_t>((*dictionary_column)[0]), int64_t{0});
+  EXPECT_TRUE(variant_is_null((*dictionary_column)[1]));
+  EXPECT_EQ(type_cast<int64_t>((*dictionary_column)[2]), std::numeric_limits<int64_t>::max());
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, AccessValues) {
+  auto offset = ChunkOffset{0u};
+  for (auto value_it = vc_long->values().cbegin(); value_it != vc_long->values().cend(); ++value_it, ++offset) {
+    EXPECT_EQ(for_long->is_null(offset), vc_long->is_null(offset));
+    if (vc_long->is_null(offset)) {
+      EXPECT_TRUE(variant_is_null((*for_long)[offset]));
+      EXPECT_FALSE(for_long->get_typed_value(offset));
+    } else {
+      EXPECT_EQ(for_long->get(offset), *value_it);
+    }
+  }
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, MaterializeValues) {
+  const auto values = for_long->materialize_values();
+  ASSERT_EQ(values.size(), vc_long->size());
+
+  auto offset = ChunkOffset{0u};
+  auto value_it = vc_long->values().cbegin();
+  for (auto it = values.cbegin(); it != values.cend(); ++it, ++value_it, ++offset) {
+    EXPECT_EQ(it->has_value(), !vc_long->is_null(offset));
+    if (it->has_value()) EXPECT_EQ(**it, *value_it);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, Iterable) {
+  auto iterable = create_iterable_from_column(*for_long);
+
+  auto offset = ChunkOffset{0u};
+  auto value_it = vc_long->values().cbegin();
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), offset);
+    EXPECT_EQ(value.is_null(), vc_long->is_null(offset));
+    if (!value.is_null()) EXPECT_EQ(value.value(), *value_it);
+    ++offset;
+    ++value_it;
+  });
+  EXPECT_EQ(offset, vc_long->size());
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, IndexedIterable) {
+  auto iterable = create_iterable_from_column(*for_long);
+
+  const auto chunk_offsets =
+      ChunkOffsetsList{{0u, 2 * frame_size + 1}, {1u, 99u}, {2u, INVALID_CHUNK_OFFSET}, {3u, 5u}};
+  const auto expected_nulls = std::vector<bool>{false, true, true, false};
+  const auto expected_values =
+      std::vector<int64_t>{int64_t{5'000'000'000} + 3 * (2 * frame_size + 1), 0, 0, int64_t{5'000'000'015}};
+
+  auto index = size_t{0u};
+  iterable.for_each(&chunk_offsets, [&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), chunk_offsets[index].into_referencing);
+    EXPECT_EQ(value.is_null(), expected_nulls[index]);
+    if (!value.is_null()) EXPECT_EQ(value.value(), expected_values[index]);
+    ++index;
+  });
+  EXPECT_EQ(index, 4u);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CopyUsingAllocator) {
+  auto copy = std::dynamic_pointer_cast<FrameOfReferenceColumn<int64_t>>(for_long->copy_using_allocator({}));
+
+  ASSERT_NE(copy, nullptr);
+  EXPECT_NE(copy->offsets(), for_long->offsets());
+  EXPECT_EQ(*copy->frame_minima(), *for_long->frame_minima());
+  EXPECT_EQ(*copy->frame_maxima(), *for_long->frame_maxima());
+  EXPECT_EQ(copy->offsets()->words(), for_long->offsets()->words());
+}
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_compression.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageRunLengthColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vc_int = std::make_shared<ValueColumn<int>>(true);
+    for (auto value : {4, 4, 4, 3, 3, 5}) vc_int->append(value);
+    vc_int->append(NULL_VALUE);
+    vc_int->append(NULL_VALUE);
+    vc_int->append(4);
+
+    auto col = DictionaryCompression::compress_column(DataType::Int, vc_int, EncodingType::RunLength);
+    rl_int = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+  }
+
+  std::shared_ptr<ValueColumn<int>> vc_int;
+  std::shared_ptr<RunLengthColumn<int>> rl_int;
+};
+
+TEST_F(StorageRunLengthColumnTest, CompressColumnInt) {
+  ASSERT_NE(rl_int, nullptr);
+  EXPECT_EQ(rl_int->encoding_type(), EncodingType::RunLength);
+  EXPECT_EQ(rl_int->size(), 9u);
+  EXPECT_EQ(rl_int->run_count(), 5u);
+
+  const auto& end_positions = *rl_int->end_positions();
+  EXPECT_EQ(end_positions, (pmr_vector<ChunkOffset>{2u, 4u, 5u, 7u, 8u}));
+
+  const auto& null_values = *rl_int->null_values();
+  EXPECT_EQ(null_values, (pmr_vector<bool>{false, false, false, true, false}));
+
+  const auto& values = *rl_int->values();
+  EXPECT_EQ(values[0], 4);
+  EXPECT_EQ(values[1], 3);
+  EXPECT_EQ(values[2], 5);
+  EXPECT_EQ(values[4], 4);
+}
+
+TEST_F(StorageRunLengthColumnTest, CompressColumnString) {
+  auto vc_str = std::make_shared<ValueColumn<std::string>>();
+  for (auto value : {"Bill", "Bill", "Steve", "Bill"}) vc_str->append(value);
+
+  auto col = DictionaryCompression::compress_column(DataType::String, vc_str, EncodingType::RunLength);
+  auto rl_str = std::dynamic_pointer_cast<RunLengthColumn<std::string>>(col);
+
+  ASSERT_NE(rl_str, nullptr);
+  EXPECT_EQ(rl_str->size(), 4u);
+  EXPECT_EQ(rl_str->run_count(), 3u);
+  EXPECT_EQ(rl_str->get(1u), "Bill");
+  EXPECT_EQ(rl_str->get(2u), "Steve");
+  EXPECT_EQ(type_cast<std::string>((*rl_str)[3u]), "Bill");
+}
+
+TEST_F(StorageRunLengthColumnTest, CompressEmptyColumn) {
+  auto col = DictionaryCompression::compress_column(DataType::Int, std::make_shared<ValueColumn<int>>(),
+                                                    EncodingType::RunLength);
+  auto rl_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  ASSERT_NE(rl_col, nullptr);
+  EXPECT_EQ(rl_col->size(), 0u);
+  EXPECT_EQ(rl_col->run_count(), 0u);
+}
+
+TEST_F(StorageRunLengthColumnTest, AccessValues) {
+  for (auto offset = ChunkOffset{0u}; offset < vc_int->size(); ++offset) {
+    EXPECT_EQ(rl_int->is_null(offset), vc_int->is_null(offset));
+    if (vc_int->is_null(offset)) {
+      EXPECT_TRUE(variant_is_null((*rl_int)[offset]));
+      EXPECT_FALSE(rl_int->get_typed_value(offset));
+    } else {
+      EXPECT_EQ((*rl_int)[offset], (*vc_int)[offset]);
+      EXPECT_EQ(rl_int->get(offset), vc_int->get(offset));
+    }
+  }
+
+  EXPECT_EQ(rl_int->run_index(0u), 0u);
+  EXPECT_EQ(rl_int->run_index(2u), 0u);
+  EXPECT_EQ(rl_int->run_index(3u), 1u);
+  EXPECT_EQ(rl_int->run_index(8u), 4u);
+}
+
+TEST_F(StorageRunLengthColumnTest, MaterializeValues) {
+  const auto values = rl_int->materialize_values();
+  ASSERT_EQ(values.size(), 9u);
+
+  auto offset = ChunkOffset{0u};
+  for (auto it = values.cbegin(); it != values.cend(); ++it, ++offset) {
+    EXPECT_EQ(it->has_value(), !vc_int->is_null(offset));
+    if (it->has_value()) EXPECT_EQ(**it, vc_int->get(offset));
+  }
+}
+
+TEST_F(StorageRunLengthColumnTest, Iterable) {
+  auto iterable = create_iterable_from_column(*rl_int);
+
+  auto offset = ChunkOffset{0u};
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), offset);
+    EXPECT_EQ(value.is_null(), vc_int->is_null(offset));
+    if (!value.is_null()) EXPECT_EQ(value.value(), vc_int->get(offset));
+    ++offset;
+  });
+  EXPECT_EQ(offset, 9u);
+}
+
+TEST_F(StorageRunLengthColumnTest, IndexedIterable) {
+  auto iterable = create_iterable_from_column(*rl_int);
+
+  const auto chunk_offsets = ChunkOffsetsList{{0u, 8u}, {1u, 6u}, {2u, INVALID_CHUNK_OFFSET}, {3u, 3u}};
+  const auto expected_nulls = std::vector<bool>{false, true, true, false};
+  const auto expected_values = std::vector<int>{4, 0, 0, 3};
+
+  auto index = size_t{0u};
+  iterable.for_each(&chunk_offsets, [&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), chunk_offsets[index].into_referencing);
+    EXPECT_EQ(value.is_null(), expected_nulls[index]);
+    if (!value.is_null()) EXPECT_EQ(value.value(), expected_values[index]);
+    ++index;
+  });
+  EXPECT_EQ(index, 4u);
+}
+
+TEST_F(StorageRunLengthColumnTest, CopyUsingAllocator) {
+  auto copy = std::dynamic_pointer_cast<RunLengthColumn<int>>(rl_int->copy_using_allocator({}));
+
+  ASSERT_NE(copy, nullptr);
+  EXPECT_NE(copy->values(), rl_int->values());
+  EXPECT_EQ(*copy->end_positions(), *rl_int->end_positions());
+  EXPECT_EQ(*copy->null_values(), *rl_int->null_values());
+  EXPECT_EQ(*copy->values(), *rl_int->values());
+}
+
+TEST_F(StorageRunLengthColumnTest, IsImmutable) { EXPECT_THROW(rl_int->append(4), std::logic_error); }
+
+}  // namespace opossum
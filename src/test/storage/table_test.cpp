@@ -1,6 +1,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/base_value_column.hpp"
 #include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/table.hpp"
 
@@ -174,6 +176,75 @@ TEST_F(StorageTableTest, EmplaceChunkDoesNotReplaceIfNumberOfChunksGreaterOne) {
   EXPECT_EQ(t.chunk_count(), 3u);
 }
 
+TEST_F(StorageTableTest, ChunksGrowInBoundedSteps) {
+  auto table = Table{5};
+  table.add_column("col_1", DataType::Int);
+
+  const auto capacity = [&](const ChunkID chunk_id) {
+    const auto column = table.get_chunk(chunk_id)->get_column(ColumnID{0});
+    return std::static_pointer_cast<const BaseValueColumn>(column)->capacity();
+  };
+
+  // Empty chunks do not allocate memory
+  EXPECT_EQ(capacity(ChunkID{0}), 0u);
+
+  table.append({1});
+  EXPECT_EQ(capacity(ChunkID{0}), 1u);
+  table.append({2});
+  table.append({3});
+  EXPECT_EQ(capacity(ChunkID{0}), 4u);
+
+  // The capacity never exceeds the chunk size
+  table.append({4});
+  table.append({5});
+  EXPECT_EQ(capacity(ChunkID{0}), 5u);
+
+  table.append({6});
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(capacity(ChunkID{1}), 1u);
+  EXPECT_EQ(table.get_value<int>(ColumnID{0}, 4u), 5);
+}
+
+TEST_F(StorageTableTest, ChunksKeepTheirIdsWhileAppending) {
+  auto table = Table{1};
+  table.add_column("col_1", DataType::Int);
+
+  // Reads of earlier chunks run concurrently with the appends
+  table.append({0});
+  const auto first_chunk = table.get_chunk(ChunkID{0});
+  auto reader = std::thread([&]() {
+    for (auto i = 0; i < 1000; ++i) {
+      EXPECT_EQ(table.get_chunk(ChunkID{0}), first_chunk);
+    }
+  });
+  for (auto value = 1; value < 100; ++value) {
+    table.append({value});
+  }
+  reader.join();
+
+  EXPECT_EQ(table.chunk_count(), 100u);
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table.get_value<int>(ColumnID{0}, chunk_id), static_cast<int>(chunk_id));
+  }
+}
+
+TEST_F(StorageTableTest, RemoveChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  const auto removed_chunk = t.get_chunk(ChunkID{0});
+  t.remove_chunk(ChunkID{0});
+
+  // Chunks that were already handed out stay valid
+  EXPECT_EQ(removed_chunk->size(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0})->column_count(), 2u);
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.row_count(), 1u);
+  EXPECT_EQ(t.get_value<int>(ColumnID{0}, 0u), 3);
+}
+
 TEST_F(StorageTableTest, ChunkSizeZeroThrows) { EXPECT_THROW(Table{0}, std::logic_error); }
 
 }  // namespace opossum
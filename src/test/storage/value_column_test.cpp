@@ -96,6 +96,64 @@ TEST_F(StorageValueColumnTest, ArraySubscriptOperatorReturnsNullValue) {
   EXPECT_TRUE(variant_is_null(vc_double[0]));
 }
 
+TEST_F(StorageValueColumnTest, PreallocatedColumnDoesNotReallocate) {
+  auto vc = ValueColumn<int>{true, 100u};
+  EXPECT_EQ(vc.size(), 0u);
+  EXPECT_EQ(vc.capacity(), 100u);
+
+  const auto* values = vc.values().data();
+  const auto* null_values = vc.null_values().data();
+
+  for (auto value = 0; value < 100; ++value) {
+    vc.append(value % 10 == 0 ? NULL_VALUE : AllTypeVariant{value});
+  }
+
+  EXPECT_EQ(vc.size(), 100u);
+  EXPECT_EQ(vc.values().data(), values);
+  EXPECT_EQ(vc.null_values().data(), null_values);
+  EXPECT_TRUE(vc.null_values()[90]);
+  EXPECT_EQ(vc.values()[99], 99);
+}
+
+TEST_F(StorageValueColumnTest, PreallocatedColumnDoesNotGrow) {
+  auto vc = ValueColumn<int>{false, 2u};
+  vc.append(1);
+  vc.append(2);
+
+  EXPECT_THROW(vc.append(3), std::logic_error);
+  EXPECT_THROW(vc.values().resize(3u), std::logic_error);
+  EXPECT_EQ(vc.size(), 2u);
+
+  const auto copy = std::static_pointer_cast<const ValueColumn<int>>(vc.copy_with_capacity(4u));
+  EXPECT_EQ(copy->capacity(), 4u);
+  EXPECT_EQ(copy->values()[1], 2);
+  EXPECT_TRUE(copy->values().has_fixed_capacity());
+}
+
+TEST_F(StorageValueColumnTest, ValuesAreStoredContiguously) {
+  for (auto value = 0; value < 1000; ++value) {
+    vc_int.append(value);
+  }
+
+  const auto& values = vc_int.values();
+  EXPECT_EQ(values.end() - values.begin(), 1000);
+  for (auto index = 0u; index < 1000u; ++index) {
+    EXPECT_EQ(values.data()[index], static_cast<int>(index));
+  }
+}
+
+TEST_F(StorageValueColumnTest, CopyUsingAllocatorKeepsCapacity) {
+  auto vc = ValueColumn<std::string>{true, 10u};
+  vc.append("Hello");
+  vc.append(NULL_VALUE);
+
+  const auto copy = std::static_pointer_cast<ValueColumn<std::string>>(vc.copy_using_allocator({}));
+  EXPECT_EQ(copy->size(), 2u);
+  EXPECT_EQ(copy->capacity(), 10u);
+  EXPECT_EQ(copy->values()[0], "Hello");
+  EXPECT_TRUE(copy->null_values()[1]);
+}
+
 TEST_F(StorageValueColumnTest, StringTooLong) {
   EXPECT_THROW(vc_str.append(std::string(std::numeric_limits<StringLength>::max() + 1ul, 'A')), std::exception);
 }
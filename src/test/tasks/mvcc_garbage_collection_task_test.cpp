@@ -0,0 +1,245 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/mvcc_garbage_collector.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compaction_task.hpp"
+#include "tasks/mvcc_garbage_collection_task.hpp"
+
+namespace opossum {
+
+class MvccGarbageCollectionTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks: {2, 4, 6}, {8, 10, 12}, {14, 16, 18}, {19, 20, 21}
+    _table = load_table("src/test/tables/int_string.tbl", 3u);
+    StorageManager::get().add_table(_table_name, _table);
+  }
+
+  std::shared_ptr<AbstractOperator> _select(const std::shared_ptr<TransactionContext>& context, const int value) {
+    auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, ScanType::GreaterThanEquals, value);
+    table_scan->execute();
+    return table_scan;
+  }
+
+  uint64_t _visible_row_count(const std::shared_ptr<TransactionContext>& context) {
+    return _select(context, 0)->get_output()->row_count();
+  }
+
+  std::shared_ptr<Delete> _lock_for_deletion(const std::shared_ptr<TransactionContext>& context, const int value) {
+    auto table_scan = std::make_shared<TableScan>(_select(context, value), ColumnID{0}, ScanType::Equals, value);
+    table_scan->execute();
+    auto delete_op = std::make_shared<Delete>(_table_name, table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    return delete_op;
+  }
+
+  void _delete(const int value) {
+    auto context = TransactionManager::get().new_transaction_context();
+    ASSERT_FALSE(_lock_for_deletion(context, value)->execute_failed());
+    ASSERT_TRUE(context->commit());
+  }
+
+  void _collect_garbage() { MvccGarbageCollectionTask{MvccGarbageCollector::Options{}}.execute(); }
+
+  const std::string _table_name = "table";
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MvccGarbageCollectionTaskTest, LowestActiveSnapshotCommitId) {
+  auto& manager = TransactionManager::get();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), manager.last_commit_id());
+
+  auto old_context = manager.new_transaction_context();
+  _delete(8);
+  auto new_context = manager.new_transaction_context();
+
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), old_context->snapshot_commit_id());
+  EXPECT_LT(manager.lowest_active_snapshot_commit_id(), manager.last_commit_id());
+
+  old_context = nullptr;
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), new_context->snapshot_commit_id());
+
+  new_context = nullptr;
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), manager.last_commit_id());
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, LowestActiveSnapshotCommitIdOfManySnapshots) {
+  auto& manager = TransactionManager::get();
+
+  // More snapshots than fit into the first block of slots
+  auto contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto index = 0; index < 200; ++index) {
+    contexts.emplace_back(manager.new_transaction_context());
+    if (index % 50 == 0) _delete(8 + index / 50 * 2);
+  }
+
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), contexts.front()->snapshot_commit_id());
+
+  contexts.erase(contexts.begin(), contexts.begin() + 150);
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), contexts.front()->snapshot_commit_id());
+
+  contexts.clear();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), manager.last_commit_id());
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, ResetReleasesSnapshots) {
+  auto& manager = TransactionManager::get();
+
+  auto context = manager.new_transaction_context();
+  TransactionManager::reset();
+  _delete(8);
+  EXPECT_LT(context->snapshot_commit_id(), manager.last_commit_id());
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), manager.last_commit_id());
+
+  // Pins that outlive the reset do not affect the new snapshots
+  context = nullptr;
+  auto new_context = manager.new_transaction_context();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), new_context->snapshot_commit_id());
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, InvalidRowShare) {
+  _delete(8);
+  const auto chunk = _table->get_chunk(ChunkID{1});
+
+  EXPECT_DOUBLE_EQ(MvccGarbageCollectionTask::invalid_row_share(*chunk, TransactionManager::get().last_commit_id()),
+                   1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(MvccGarbageCollectionTask::invalid_row_share(*chunk, CommitID{0}), 0.0);
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, CompactsAndRemovesChunks) {
+  _delete(8);
+  _delete(10);
+
+  auto old_context = TransactionManager::get().new_transaction_context();
+
+  // 12 is moved to a new chunk at the end of the table
+  _collect_garbage();
+  ASSERT_EQ(_table->chunk_count(), 5u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 3u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 1u);
+  EXPECT_EQ(_table->get_value<int>(ColumnID{0}, 12u), 12);
+
+  // The old transaction still reads the chunk, so it must not be removed yet
+  _collect_garbage();
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 3u);
+  EXPECT_EQ(_visible_row_count(old_context), 10u);
+
+  old_context = nullptr;
+  _collect_garbage();
+  EXPECT_EQ(_table->chunk_count(), 5u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 0u);
+
+  const auto new_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(_visible_row_count(new_context), 10u);
+  EXPECT_EQ(_select(new_context, 11)->get_output()->row_count(), 7u);
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, ResultTablesOutliveTheirTransaction) {
+  _delete(8);
+  _delete(10);
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto result = _select(context, 12)->get_output();
+  context = nullptr;
+
+  // The result still references 12 in the compacted chunk, so the chunk must not be removed
+  _collect_garbage();
+  _collect_garbage();
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 3u);
+  EXPECT_EQ(result->get_value<int>(ColumnID{0}, 0u), 12);
+
+  result = nullptr;
+  _collect_garbage();
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 0u);
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, RowsVisibleToActiveTransactionsAreNotInvalid) {
+  auto old_context = TransactionManager::get().new_transaction_context();
+
+  _delete(8);
+  _delete(10);
+
+  _collect_garbage();
+  EXPECT_EQ(_table->chunk_count(), 4u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, LastChunkIsNotCompacted) {
+  _delete(19);
+  _delete(20);
+
+  _collect_garbage();
+  EXPECT_EQ(_table->chunk_count(), 4u);
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, FirstChunkIsCompacted) {
+  _delete(2);
+  _delete(4);
+
+  _collect_garbage();
+  ASSERT_EQ(_table->chunk_count(), 5u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->get_value<int>(ColumnID{0}, 12u), 6);
+
+  _collect_garbage();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, ConflictingCompactionIsRolledBack) {
+  _delete(8);
+  _delete(10);
+
+  // A concurrent transaction has locked 12 for deletion
+  auto context = TransactionManager::get().new_transaction_context();
+  ASSERT_FALSE(_lock_for_deletion(context, 12)->execute_failed());
+
+  auto compaction = ChunkCompactionTask{_table_name, ChunkID{1}};
+  compaction.execute();
+  EXPECT_FALSE(compaction.succeeded());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+
+  context->rollback();
+}
+
+TEST_F(MvccGarbageCollectionTaskTest, CollectorRunsInBackground) {
+  _delete(8);
+  _delete(10);
+
+  auto options = MvccGarbageCollector::Options{};
+  options.interval = std::chrono::milliseconds(1);
+  MvccGarbageCollector::get().set_options(options);
+  MvccGarbageCollector::get().resume();
+
+  // The chunk is compacted by one run and removed by a later one
+  for (auto attempt = 0; attempt < 1000 && _table->get_chunk(ChunkID{1})->size() != 0u; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  MvccGarbageCollector::reset();
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 0u);
+  EXPECT_FALSE(MvccGarbageCollector::get().is_running());
+}
+
+}  // namespace opossum
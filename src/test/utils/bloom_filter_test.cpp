@@ -0,0 +1,64 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class BloomFilterTest : public BaseTest {};
+
+TEST_F(BloomFilterTest, ContainsInsertedValues) {
+  auto filter = BloomFilter<int>{1000};
+  for (auto value = 0; value < 1000; ++value) {
+    filter.insert(value * 7);
+  }
+
+  for (auto value = 0; value < 1000; ++value) {
+    EXPECT_TRUE(filter.may_contain(value * 7));
+  }
+}
+
+TEST_F(BloomFilterTest, FewFalsePositives) {
+  auto filter = BloomFilter<int64_t>{1000};
+  for (auto value = int64_t{0}; value < 1000; ++value) {
+    filter.insert(value);
+  }
+
+  auto false_positives = 0;
+  for (auto value = int64_t{1000}; value < 11000; ++value) {
+    if (filter.may_contain(value)) ++false_positives;
+  }
+
+  // About 1% are expected
+  EXPECT_LT(false_positives, 300);
+}
+
+TEST_F(BloomFilterTest, Strings) {
+  auto filter = BloomFilter<std::string>{3};
+  filter.insert("Bill");
+  filter.insert("Steve");
+  filter.insert("");
+
+  EXPECT_TRUE(filter.may_contain("Bill"));
+  EXPECT_TRUE(filter.may_contain("Steve"));
+  EXPECT_TRUE(filter.may_contain(""));
+  EXPECT_FALSE(filter.may_contain("Hasso"));
+}
+
+TEST_F(BloomFilterTest, NegativeZero) {
+  auto filter = BloomFilter<double>{1};
+  filter.insert(-0.0);
+
+  EXPECT_TRUE(filter.may_contain(0.0));
+}
+
+TEST_F(BloomFilterTest, Empty) {
+  auto filter = BloomFilter<float>{0};
+
+  EXPECT_GE(filter.bit_count(), 64u);
+  EXPECT_FALSE(filter.may_contain(1.5f));
+}
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/hash_table.hpp"
+
+namespace opossum {
+
+class HashTableTest : public BaseTest {};
+
+TEST_F(HashTableTest, BasicPutAndGet) {
+  auto hashtable = std::make_shared<HashTable<int32_t>>(2);
+  hashtable->put(5, RowID{ChunkID{0}, 0});
+  hashtable->put(6, RowID{ChunkID{0}, 0});
+  hashtable->finalize();
+
+  EXPECT_FALSE(hashtable->get(5).empty());
+  EXPECT_FALSE(hashtable->get(6).empty());
+  EXPECT_TRUE(hashtable->get(7).empty());
+}
+
+TEST_F(HashTableTest, StackRowIDs) {
+  auto hashtable = std::make_shared<HashTable<int32_t>>(2);
+  hashtable->put(5, RowID{ChunkID{0}, 0});
+  hashtable->put(5, RowID{ChunkID{0}, 1});
+  hashtable->finalize();
+
+  auto row_ids = hashtable->get(5);
+
+  ASSERT_EQ(row_ids.size(), 2u);
+  EXPECT_EQ(*row_ids.begin(), (RowID{ChunkID{0}, 0}));
+  EXPECT_EQ(*(row_ids.begin() + 1), (RowID{ChunkID{0}, 1}));
+}
+
+TEST_F(HashTableTest, HandleCollision) {
+  auto table_size = 4;
+  auto hashtable = std::make_shared<HashTable<int32_t>>(table_size);
+  hashtable->put(4, RowID{ChunkID{0}, 0});
+  hashtable->put(3617331, RowID{ChunkID{0}, 0});
+  hashtable->put(5346671, RowID{ChunkID{0}, 0});
+  hashtable->put(6165505, RowID{ChunkID{0}, 0});
+  hashtable->finalize();
+
+  EXPECT_FALSE(hashtable->get(4).empty());
+  EXPECT_FALSE(hashtable->get(3617331).empty());
+  EXPECT_FALSE(hashtable->get(5346671).empty());
+  EXPECT_FALSE(hashtable->get(6165505).empty());
+}
+
+TEST_F(HashTableTest, FullGroups) {
+  // With 10000 rows, many groups overflow into their successors
+  const auto row_count = 10'000u;
+  auto hashtable = HashTable<int32_t>{row_count};
+  EXPECT_GE(hashtable.slot_count() * 7u, row_count * 8u);
+
+  for (auto value = 0u; value < row_count; ++value) {
+    hashtable.put(static_cast<int32_t>(value), RowID{ChunkID{value % 3}, value});
+  }
+  hashtable.finalize();
+
+  for (auto value = 0u; value < row_count; ++value) {
+    const auto row_ids = hashtable.get(static_cast<int32_t>(value));
+    ASSERT_EQ(row_ids.size(), 1u);
+    EXPECT_EQ(*row_ids.begin(), (RowID{ChunkID{value % 3}, value}));
+  }
+  EXPECT_TRUE(hashtable.get(static_cast<int32_t>(row_count)).empty());
+  EXPECT_TRUE(hashtable.get(-1).empty());
+}
+
+TEST_F(HashTableTest, DuplicateValuesKeepTheirOrder) {
+  auto hashtable = HashTable<std::string>{100u};
+  for (auto row_index = 0u; row_index < 100u; ++row_index) {
+    hashtable.put(row_index % 2 ? "odd" : "even", RowID{ChunkID{0}, row_index});
+  }
+  hashtable.finalize();
+
+  EXPECT_EQ(hashtable.row_count(), 100u);
+
+  const auto odd_row_ids = hashtable.get(std::string{"odd"});
+  ASSERT_EQ(odd_row_ids.size(), 50u);
+  auto expected_chunk_offset = ChunkOffset{1u};
+  for (const auto& row_id : odd_row_ids) {
+    EXPECT_EQ(row_id.chunk_offset, expected_chunk_offset);
+    expected_chunk_offset += 2u;
+  }
+
+  EXPECT_EQ(hashtable.get(std::string{"even"}).size(), 50u);
+  EXPECT_TRUE(hashtable.get(std::string{"none"}).empty());
+}
+
+TEST_F(HashTableTest, NegativeZero) {
+  auto hashtable = HashTable<double>{1u};
+  hashtable.put(-0.0, RowID{ChunkID{0}, 0});
+  hashtable.finalize();
+
+  EXPECT_EQ(hashtable.get(0.0).size(), 1u);
+}
+
+TEST_F(HashTableTest, Probe) {
+  auto hashtable = HashTable<int32_t>{100u};
+  for (auto value = 0; value < 100; ++value) {
+    hashtable.put(value / 2, RowID{ChunkID{0}, static_cast<ChunkOffset>(value)});
+  }
+  hashtable.finalize();
+
+  // More values than fit into one batch
+  auto probe_values = std::vector<int32_t>{};
+  for (auto value = -10; value < 60; ++value) probe_values.emplace_back(value);
+
+  auto probed_indices = std::vector<size_t>{};
+  const auto get_value = [&](const size_t index) { return probe_values[index]; };
+  hashtable.probe(probe_values.size(), get_value, [&](const size_t index, const auto& row_ids) {
+    probed_indices.emplace_back(index);
+
+    const auto value = probe_values[index];
+    if (value < 0 || value >= 50) {
+      EXPECT_TRUE(row_ids.empty());
+      return;
+    }
+
+    ASSERT_EQ(row_ids.size(), 2u);
+    EXPECT_EQ(row_ids.begin()->chunk_offset, static_cast<ChunkOffset>(value * 2));
+  });
+
+  ASSERT_EQ(probed_indices.size(), probe_values.size());
+  for (auto index = size_t{0u}; index < probed_indices.size(); ++index) EXPECT_EQ(probed_indices[index], index);
+}
+
+}  // namespace opossum